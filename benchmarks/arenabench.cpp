@@ -0,0 +1,51 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 5;
+
+//_______________________________________________________________________________
+// reads all the files and then destroys all the trees, with and without an arena
+static void measure (const vector<string>& files, bool arena)
+{
+	double parse = 0, destroy = 0;
+	for (int n = 0; n < kRuns; n++) {
+		vector<SXMLFile> docs;
+		double p = best (1, [&] () {
+			xmlreader r;
+			r.useArena (arena);
+			for (size_t i = 0; i < files.size(); i++) docs.push_back (r.read (files[i].c_str()));
+		});
+		double d = best (1, [&] () { docs.clear(); });
+		if (!n || (p < parse)) parse = p;
+		if (!n || (d < destroy)) destroy = d;
+	}
+	report (arena ? "arena: parse" : "heap: parse", parse);
+	report (arena ? "arena: destroy" : "heap: destroy", destroy);
+}
+
+//_______________________________________________________________________________
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = benchFiles (benchFiles (argv[2]), ".xml");
+	cout << files.size() << " files" << endl;
+	measure (files, false);
+	measure (files, true);
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __bench__
+#define __bench__
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+	The benchmarks are run by 'make bench' with 2 arguments:
+	the files folder and a list of the MusicXML files it contains, one per line.
+	They print their measures to cout, the times are the best of several runs.
+*/
+
+//_______________________________________________________________________________
+inline std::vector<std::string> benchFiles (const char* list)
+{
+	std::vector<std::string> files;
+	std::ifstream in (list);
+	std::string line;
+	while (std::getline (in, line))
+		if (line.size()) files.push_back (line);
+	return files;
+}
+
+// the files with a given extension
+inline std::vector<std::string> benchFiles (const std::vector<std::string>& files, const std::string& ext)
+{
+	std::vector<std::string> out;
+	for (size_t i = 0; i < files.size(); i++)
+		if ((files[i].size() > ext.size()) && !files[i].compare (files[i].size() - ext.size(), ext.size(), ext))
+			out.push_back (files[i]);
+	return out;
+}
+
+inline size_t fileSize (const std::string& file)
+{
+	std::ifstream in (file.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+	return in ? size_t(in.tellg()) : 0;
+}
+
+inline int usage (const char* bench)
+{
+	std::cerr << "usage: " << bench << " files-folder files-list" << std::endl;
+	return 1;
+}
+
+//_______________________________________________________________________________
+// the best time of f() over runs, in milliseconds
+template <typename F> double best (int runs, F f)
+{
+	double min = 0;
+	for (int i = 0; i < runs; i++) {
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		f();
+		std::chrono::duration<double, std::milli> d = std::chrono::steady_clock::now() - start;
+		if (!i || (d.count() < min)) min = d.count();
+	}
+	return min;
+}
+
+// prints a measure: a name, a time and an optional rate
+inline void report (const std::string& name, double ms, double count = 0, const char* unit = 0)
+{
+	std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+		<< std::setw(10) << ms << " ms";
+	if (unit && (ms > 0))
+		std::cout << std::setw(10) << (count / ms / 1000.) << " M" << unit << "/s";
+	std::cout << std::endl;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "libmusicxml.h"
+#include "utilities.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 7;
+static const int kLines = 200000;
+
+#ifdef WIN32
+static const char* kNullDevice = "NUL";
+#else
+static const char* kNullDevice = "/dev/null";
+#endif
+
+//_______________________________________________________________________________
+// writes indented lines to a file, the way the LilyPond code is written:
+// ending them with endl flushes the file at each line when unbuffered
+static size_t writeLines (size_t bufferSize, bool flushLines)
+{
+	ofstream file (kNullDevice);
+	indenter idtr;
+	indentedOstream out (file, idtr, bufferSize);
+	size_t bytes = 0;
+	for (int i = 0; i < kLines; i++) {
+		if ((i % 8) == 0) idtr++;
+		out << "\\relative c' { c4 d e f }";
+		if (flushLines) out << endl;
+		else out << '\n';
+		bytes += 26 + idtr.getIndent() * idtr.getSpacer().size();
+		if ((i % 8) == 7) idtr--;
+	}
+	out.flushOutput();
+	return bytes;
+}
+
+//_______________________________________________________________________________
+// the indentedOstream throughput, unbuffered as for the log and buffered as for the
+// LilyPond code, with lines ended by endl or '\n',
+// and the conversion time of the unofficial test suite
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	size_t bytes = 0;
+	double unbuffered = best (kRuns, [&] () { bytes = writeLines (0, true); });
+	report ("indentedOstream (unbuffered, endl)", unbuffered, double(bytes), "B");
+	double flushed = best (kRuns, [&] () { bytes = writeLines (indentedOstream::K_BUFFER_SIZE, true); });
+	report ("indentedOstream (buffered, endl)", flushed, double(bytes), "B");
+	double buffered = best (kRuns, [&] () { bytes = writeLines (indentedOstream::K_BUFFER_SIZE, false); });
+	report ("indentedOstream (buffered, '\\n')", buffered, double(bytes), "B");
+
+	vector<string> all = benchFiles (argv[2]), files;
+	for (size_t i = 0; i < all.size(); i++)
+		if (all[i].find ("UnofficialTestSuite") != string::npos) files.push_back (all[i]);
+	xml2lyContext context;
+	context.setOptions (optionsVector (1, "-q"));
+	// the converter warnings are discarded
+	ostringstream warnings;
+	streambuf* cerrbuf = cerr.rdbuf (warnings.rdbuf());
+	double convert = best (kRuns, [&] () {
+		for (size_t i = 0; i < files.size(); i++) {
+			ostringstream out;
+			musicxmlfile2lilypond (files[i].c_str(), context, out);
+			warnings.str ("");
+		}
+	});
+	cerr.rdbuf (cerrbuf);
+	ostringstream name;
+	name << "musicxmlfile2lilypond (" << files.size() << " files)";
+	report (name.str(), convert);
+	return 0;
+}
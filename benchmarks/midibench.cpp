@@ -0,0 +1,70 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "elements.h"
+#include "smfwriter.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 5;
+
+//_______________________________________________________________________________
+static double convert (const vector<Sscoreindex>& scores, int threads)
+{
+	return best (kRuns, [&] () {
+		for (size_t i = 0; i < scores.size(); i++) {
+			smfwriter writer;
+			writer.setThreads (threads);
+			writer.convert (scores[i]);
+		}
+	});
+}
+
+//_______________________________________________________________________________
+// the conversion of the indexed scores to MIDI events, and the Standard MIDI Files writing
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = benchFiles (benchFiles (argv[2]), ".xml");
+	vector<SXMLFile> docs;
+	vector<Sscoreindex> scores;
+	vector<smfwriter> writers;
+	size_t events = 0;
+	for (size_t i = 0; i < files.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[i].c_str());
+		if (!file || !file->elements() || (file->elements()->getType() != k_score_partwise)) continue;
+		docs.push_back (file);
+		scores.push_back (file->getIndex());
+		writers.push_back (smfwriter());
+		writers.back().convert (scores.back());
+		events += writers.back().events();
+	}
+	cout << scores.size() << " scores, " << events << " events" << endl;
+
+	report ("convert (1 thread)", convert (scores, 1), double(events), "events");
+	report ("convert (4 threads)", convert (scores, 4), double(events), "events");
+	double write = best (kRuns, [&] () {
+		for (size_t i = 0; i < writers.size(); i++) {
+			ostringstream out;
+			writers[i].write (out);
+		}
+	});
+	report ("write", write, double(events), "events");
+	return 0;
+}
@@ -0,0 +1,48 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 7;
+
+//_______________________________________________________________________________
+// the compressed files read time, compared to the read time of their uncompressed score
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = benchFiles (benchFiles (argv[2]), ".mxl");
+	for (size_t i = 0; i < files.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[i].c_str());
+		if (!file) {
+			cerr << "can't read " << files[i] << endl;
+			continue;
+		}
+		ostringstream score;
+		file->print (score);
+		string xml = score.str();
+
+		size_t pos = files[i].find_last_of ("/\\");
+		string name = (pos == string::npos) ? files[i] : files[i].substr (pos + 1);
+		cout << name << ": " << fileSize (files[i]) << " bytes, " << xml.size() << " bytes of score" << endl;
+		report ("  read .mxl", best (kRuns, [&] () { r.read (files[i].c_str()); }));
+		report ("  read the score from memory", best (kRuns, [&] () { r.readbuff (xml.c_str()); }));
+	}
+	return 0;
+}
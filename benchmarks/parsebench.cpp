@@ -0,0 +1,69 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <set>
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 5;
+
+//_______________________________________________________________________________
+static size_t count (xmlelement* elt)
+{
+	size_t n = 1;
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++)
+		n += count (*i);
+	return n;
+}
+
+//_______________________________________________________________________________
+// the parsing throughput, in bytes and in elements per second:
+// - with the parts skipped: the parts content is scanned but not built
+// - with the whole tree built
+// the flex parser that xmlparser replaced is no longer in the tree: to compare
+// with it, build the 'read' measure against a library version that still has it
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = benchFiles (benchFiles (argv[2]), ".xml");
+	size_t bytes = 0, elements = 0;
+	for (size_t i = 0; i < files.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[i].c_str());
+		if (file && file->elements()) elements += count (file->elements());
+		bytes += fileSize (files[i]);
+	}
+	cout << files.size() << " files, " << bytes << " bytes, " << elements << " elements" << endl;
+
+	set<string> none;
+	none.insert ("");
+	double scan = best (kRuns, [&] () {
+		xmlreader r;
+		r.keepParts (none);
+		for (size_t i = 0; i < files.size(); i++) r.read (files[i].c_str());
+	});
+	report ("scan (parts skipped)", scan, double(bytes), "B");
+
+	double read = best (kRuns, [&] () {
+		xmlreader r;
+		for (size_t i = 0; i < files.size(); i++) r.read (files[i].c_str());
+	});
+	report ("read", read, double(bytes), "B");
+	report ("read", read, double(elements), "elts");
+	return 0;
+}
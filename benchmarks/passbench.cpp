@@ -0,0 +1,77 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <map>
+#include <sstream>
+
+#include "libmusicxml.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 7;
+
+//_______________________________________________________________________________
+// adds the CPU time of each pass, as reported by the -display-cpu-usage option
+// (lines like "Pass 3    translate MSR to LPSR    mandatory  0.000313")
+static void addPassesTimes (const string& log, map<string, double>& times)
+{
+	istringstream in (log);
+	string line;
+	while (getline (in, line)) {
+		if (line.compare (0, 5, "Pass ")) continue;
+		string pass = line.substr (0, line.find (' ', 5));
+		size_t last = line.find_last_not_of (' ');
+		size_t first = line.find_last_of (' ', last);
+		if ((last == string::npos) || (first == string::npos)) continue;
+		times[pass] += atof (line.substr (first + 1, last - first).c_str()) * 1000.;
+	}
+}
+
+//_______________________________________________________________________________
+// the time of each pass of the conversion to LilyPond, and in particular of the passes
+// that browse the MSR and LPSR scores (browseData): pass 3 (MSR to LPSR) and pass 4
+// (LPSR to LilyPond code), on the unofficial test suite.
+// the times are the best sums over the files of the CPU times measured by the converter
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> all = benchFiles (argv[2]), files;
+	for (size_t i = 0; i < all.size(); i++)
+		if (all[i].find ("UnofficialTestSuite") != string::npos) files.push_back (all[i]);
+
+	xml2lyContext context;
+	context.setOptions (optionsVector (1, "-display-cpu-usage"));
+	// the converter log, that includes the timings, is written to cerr
+	ostringstream log;
+	streambuf* cerrbuf = cerr.rdbuf (log.rdbuf());
+	map<string, double> minimum;
+	for (int n = 0; n < kRuns; n++) {
+		map<string, double> times;
+		for (size_t i = 0; i < files.size(); i++) {
+			ostringstream out;
+			musicxmlfile2lilypond (files[i].c_str(), context, out);
+			addPassesTimes (log.str(), times);
+			log.str ("");
+		}
+		for (map<string, double>::const_iterator i = times.begin(); i != times.end(); i++)
+			if (!n || (i->second < minimum[i->first])) minimum[i->first] = i->second;
+	}
+	cerr.rdbuf (cerrbuf);
+
+	cout << files.size() << " files" << endl;
+	for (map<string, double>::const_iterator i = minimum.begin(); i != minimum.end(); i++)
+		report (i->first, i->second);
+	return 0;
+}
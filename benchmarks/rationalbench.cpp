@@ -0,0 +1,69 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include "rational.h"
+#include "bench.h"
+
+using namespace std;
+
+static const int kRuns = 5;
+static const long kOps = 20000000;
+
+//_______________________________________________________________________________
+// the rational operations used to compute the notes positions:
+// the results are printed so that the loops are not optimized out
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+
+	// a single divisions value: the operands share their denominator
+	rational pos;
+	double same = best (kRuns, [&] () {
+		const rational step (1, 96), measure (384, 96);
+		pos = rational (0, 96);
+		for (long i = 0; i < kOps; i++) {
+			pos += step;
+			if (pos >= measure) pos -= measure;
+		}
+	});
+	report ("same denominator += -= >=", same, double(kOps), "ops");
+
+	// durations of different divisions, as with tuplets
+	rational mixed;
+	double add = best (kRuns, [&] () {
+		const rational steps[] = { rational(1, 2), rational(1, 3), rational(1, 4), rational(1, 6), rational(3, 8) };
+		const rational measure (4, 1);
+		mixed = rational (0, 1);
+		for (long i = 0; i < kOps; i++) {
+			mixed = mixed + steps[i % 5];
+			mixed.rationalise();
+			if (mixed >= measure) mixed -= measure;
+		}
+	});
+	report ("mixed denominators + rationalise", add, double(kOps), "ops");
+
+	// time modifications
+	double sum = 0;
+	double mul = best (kRuns, [&] () {
+		const rational ratio (2, 3);
+		sum = 0;
+		for (long i = 0; i < kOps; i++) {
+			rational r = rational (i % 7 + 1, 8) * ratio;
+			r.rationalise();
+			sum += r.getNumerator();
+		}
+	});
+	report ("products + rationalise", mul, double(kOps), "ops");
+
+	cout << "results: " << pos.toString() << " " << mixed.toString() << " " << long(sum) << endl;
+	return 0;
+}
@@ -0,0 +1,99 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "elements.h"
+#include "typedefs.h"
+#include "visitor.h"
+#include "xml.h"
+#include "xml_tree_browser.h"
+#include "xml2guidovisitor.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "bench.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kRuns = 5;
+
+//_______________________________________________________________________________
+// a visitor of a few element types: most of the elements are entered
+// and left without being visited
+class counter :
+	public visitor<S_note>,
+	public visitor<S_rest>,
+	public visitor<S_measure>
+{
+	public:
+		size_t fCount;
+				 counter() : fCount(0) {}
+		virtual ~counter() {}
+		virtual void visitStart ( S_note& elt )		{ fCount++; }
+		virtual void visitStart ( S_rest& elt )		{ fCount++; }
+		virtual void visitStart ( S_measure& elt )	{ fCount++; }
+};
+
+static size_t count (xmlelement* elt)
+{
+	size_t n = 1;
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++)
+		n += count (*i);
+	return n;
+}
+
+//_______________________________________________________________________________
+// the visitors dispatch cost: the parsed trees are browsed with a visitor
+// of a few element types and converted to guido
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = benchFiles (benchFiles (argv[2]), ".xml");
+	vector<Sxmlelement> scores;
+	size_t elements = 0;
+	for (size_t i = 0; i < files.size(); i++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[i].c_str());
+		if (file && file->elements() && (file->elements()->getType() == k_score_partwise)) {
+			scores.push_back (file->elements());
+			elements += count (file->elements());
+		}
+	}
+	cout << scores.size() << " scores, " << elements << " elements" << endl;
+
+	double browse = best (kRuns, [&] () {
+		for (size_t i = 0; i < scores.size(); i++) {
+			counter c;
+			xml_tree_browser browser (&c);
+			browser.browse (*scores[i]);
+		}
+	});
+	report ("browse", browse, double(elements), "elts");
+
+	// the converter warnings are discarded
+	ostringstream warnings;
+	streambuf* cerrbuf = cerr.rdbuf (warnings.rdbuf());
+	streambuf* coutbuf = cout.rdbuf (warnings.rdbuf());
+	double guido = best (kRuns, [&] () {
+		for (size_t i = 0; i < scores.size(); i++) {
+			ostringstream out;
+			xml2guidovisitor v(true, true, true);
+			v.convert (scores[i], out);
+			warnings.str ("");
+		}
+	});
+	cerr.rdbuf (cerrbuf);
+	cout.rdbuf (coutbuf);
+	report ("xml2guidovisitor::convert", guido, double(elements), "elts");
+	return 0;
+}
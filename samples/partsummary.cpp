@@ -19,7 +19,6 @@
 #include "xmlreader.h"
 #include "partsummary.h"
 #include "smartlist.h"
-#include "xml_tree_browser.h"
 
 using namespace std;
 using namespace MusicXML2;
@@ -28,14 +27,14 @@ using namespace MusicXML2;
 class mypartsummary : public partsummary
 {
 	public:
-		virtual void visitEnd ( S_part& elt);
+		void print (const string& partID);
 };
 
 
 //_______________________________________________________________________________
-void mypartsummary::visitEnd ( S_part& elt)
+void mypartsummary::print (const string& partID)
 {
-	cout << "summary for part " << elt->getAttributeValue("id") << endl;
+	cout << "summary for part " << partID << endl;
 	cout << "  staves count : " << countStaves() << endl;
 
 	smartlist<int>::ptr voices;
@@ -80,11 +79,14 @@ int main(int argc, char *argv[])
 	else
 		xmlfile= r.read(stdin);
 	if (xmlfile) {
-		Sxmlelement elt = xmlfile->elements();
-		if (elt) {
+		// the summaries are read from the score index: the score is not browsed
+		Sscoreindex index = xmlfile->getIndex();
+		if (index) {
 			mypartsummary nv;
-			xml_tree_browser browser(&nv);
-			browser.browse(*elt);
+			for (size_t i = 0; i < index->parts().size(); i++) {
+				nv.init (*index, i);
+				nv.print (index->parts()[i].fID);
+			}
 		}
 	}
 	else cerr << "error reading \"" << file << "\"" << endl;
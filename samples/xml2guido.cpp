@@ -32,6 +32,7 @@ static void usage() {
 	cerr << "       options: --autobars don't generates barlines" << endl;
 	cerr << "                --version print version and exit" << endl;
 	cerr << "                -o file   : write output to file" << endl;
+	cerr << "                -t n      : convert the parts using n threads" << endl;
 	cerr << "                -h --help : print this help" << endl;
 	exit(1);
 }
@@ -101,6 +102,7 @@ int main(int argc, char *argv[])
 	bool generateBars = checkOpt (argc, argv, "--autobars");
 	const char * file = argv[argc-1];
 	const char * outfile = fileOpt (argc, argv, "-o");
+	const char * threads = fileOpt (argc, argv, "-t");
 	ostream * out = &cout;
 	fstream fout;
 	if (outfile) {
@@ -116,7 +118,7 @@ int main(int argc, char *argv[])
 	if (!strcmp(file, "-"))
 		err = musicxmlfd2guido(stdin, generateBars, *out);
 	else
-		err = musicxmlfile2guido(file, generateBars, *out);
+		err = musicxmlfile2guidoThreaded(file, generateBars, threads ? atoi(threads) : 1, *out);
 	if (err == kUnsupported)
 		cerr << "unsupported xml format" << endl;
 	else if (err ) {
@@ -18,6 +18,7 @@
 #include "xmlfile.h"
 #include "xmlreader.h"
 #include "midicontextvisitor.h"
+#include "smfwriter.h"
 #include "unrolled_xml_tree_browser.h"
 
 using namespace std;
@@ -62,7 +63,15 @@ int main(int argc, char *argv[]) {
 		xmlfile = r.read(stdin);
 	if (xmlfile) {
 		Sxmlelement st = xmlfile->elements();
-		if (st) {
+		if (st && (argc > 2)) {		// writes a standard midi file
+			smfwriter writer(480);
+			writer.convert(xmlfile->getIndex());
+			if (!writer.write(argv[2])) {
+				cerr << "can't write " << argv[2] << endl;
+				return 1;
+			}
+		}
+		else if (st) {
 			mymidiwriter writer;
 			midicontextvisitor v(480, &writer);
 			unrolled_xml_tree_browser browser(&v);
@@ -0,0 +1,184 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+//======================================================================
+// DON'T MODIFY THIS FILE!
+// It is automatically generated from the MusicXML DTDs and from 
+// template files (located in the templates folder). 
+//======================================================================
+
+#include "xml.h"
+
+namespace MusicXML2 
+{
+
+// the attributes names, in the order of the attributes constants
+const char* xmlattribute::fNames[] = {
+	"",
+	"abbreviated",
+	"accelerate",
+	"additional",
+	"after-barline",
+	"alternate",
+	"approach",
+	"attack",
+	"attribute",
+	"beats",
+	"bezier-offset",
+	"bezier-offset2",
+	"bezier-x",
+	"bezier-x2",
+	"bezier-y",
+	"bezier-y2",
+	"blank-page",
+	"bottom-staff",
+	"bracket",
+	"bracket-degrees",
+	"cancel",
+	"cautionary",
+	"coda",
+	"color",
+	"dacapo",
+	"dalsegno",
+	"damper-pedal",
+	"dash-length",
+	"dashed-circle",
+	"default-x",
+	"default-y",
+	"departure",
+	"dir",
+	"direction",
+	"directive",
+	"divisions",
+	"dynamics",
+	"editorial",
+	"element",
+	"elevation",
+	"enclosure",
+	"end-dynamics",
+	"end-length",
+	"fan",
+	"filled",
+	"fine",
+	"first-beat",
+	"font-family",
+	"font-size",
+	"font-style",
+	"font-weight",
+	"forward-repeat",
+	"halign",
+	"hand",
+	"height",
+	"id",
+	"implicit",
+	"justify",
+	"last-beat",
+	"letter-spacing",
+	"line",
+	"line-end",
+	"line-height",
+	"line-length",
+	"line-shape",
+	"line-through",
+	"line-type",
+	"location",
+	"long",
+	"make-time",
+	"measure",
+	"member-of",
+	"name",
+	"new-page",
+	"new-system",
+	"niente",
+	"non-controlling",
+	"number",
+	"orientation",
+	"overline",
+	"page",
+	"page-number",
+	"pan",
+	"parentheses",
+	"parentheses-degrees",
+	"pizzicato",
+	"placement",
+	"plus-minus",
+	"port",
+	"position",
+	"print-dot",
+	"print-frame",
+	"print-leger",
+	"print-lyric",
+	"print-object",
+	"print-spacing",
+	"reference",
+	"relative-x",
+	"relative-y",
+	"release",
+	"repeater",
+	"rotation",
+	"second-beat",
+	"segno",
+	"separator",
+	"show-frets",
+	"show-number",
+	"show-type",
+	"sign",
+	"size",
+	"slash",
+	"slashes",
+	"smufl",
+	"soft-pedal",
+	"sostenuto-pedal",
+	"sound",
+	"source",
+	"space-length",
+	"spread",
+	"stack-degrees",
+	"staff-spacing",
+	"start-note",
+	"steal-time-following",
+	"steal-time-previous",
+	"string",
+	"substitution",
+	"symbol",
+	"tempo",
+	"text",
+	"text-x",
+	"text-y",
+	"time-only",
+	"times",
+	"tip",
+	"tocoda",
+	"top-staff",
+	"trill-step",
+	"two-note-turn",
+	"type",
+	"underline",
+	"unplayed",
+	"use-dots",
+	"use-stems",
+	"use-symbols",
+	"valign",
+	"value",
+	"version",
+	"width",
+	"winged",
+	"xlink:actuate",
+	"xlink:href",
+	"xlink:role",
+	"xlink:show",
+	"xlink:title",
+	"xlink:type",
+	"xml:lang",
+	"xml:space",
+};
+}
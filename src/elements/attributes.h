@@ -0,0 +1,189 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+//======================================================================
+// DON'T MODIFY THIS FILE!
+// It is automatically generated from the MusicXML DTDs and from 
+// template files (located in the templates folder). 
+//======================================================================
+
+#ifndef __attributes__
+#define __attributes__
+
+namespace MusicXML2 
+{
+
+// the names of the MusicXML attributes, see xmlattribute::id()
+enum {	
+	kNoAttribute,
+	a_abbreviated,
+	a_accelerate,
+	a_additional,
+	a_after_barline,
+	a_alternate,
+	a_approach,
+	a_attack,
+	a_attribute,
+	a_beats,
+	a_bezier_offset,
+	a_bezier_offset2,
+	a_bezier_x,
+	a_bezier_x2,
+	a_bezier_y,
+	a_bezier_y2,
+	a_blank_page,
+	a_bottom_staff,
+	a_bracket,
+	a_bracket_degrees,
+	a_cancel,
+	a_cautionary,
+	a_coda,
+	a_color,
+	a_dacapo,
+	a_dalsegno,
+	a_damper_pedal,
+	a_dash_length,
+	a_dashed_circle,
+	a_default_x,
+	a_default_y,
+	a_departure,
+	a_dir,
+	a_direction,
+	a_directive,
+	a_divisions,
+	a_dynamics,
+	a_editorial,
+	a_element,
+	a_elevation,
+	a_enclosure,
+	a_end_dynamics,
+	a_end_length,
+	a_fan,
+	a_filled,
+	a_fine,
+	a_first_beat,
+	a_font_family,
+	a_font_size,
+	a_font_style,
+	a_font_weight,
+	a_forward_repeat,
+	a_halign,
+	a_hand,
+	a_height,
+	a_id,
+	a_implicit,
+	a_justify,
+	a_last_beat,
+	a_letter_spacing,
+	a_line,
+	a_line_end,
+	a_line_height,
+	a_line_length,
+	a_line_shape,
+	a_line_through,
+	a_line_type,
+	a_location,
+	a_long,
+	a_make_time,
+	a_measure,
+	a_member_of,
+	a_name,
+	a_new_page,
+	a_new_system,
+	a_niente,
+	a_non_controlling,
+	a_number,
+	a_orientation,
+	a_overline,
+	a_page,
+	a_page_number,
+	a_pan,
+	a_parentheses,
+	a_parentheses_degrees,
+	a_pizzicato,
+	a_placement,
+	a_plus_minus,
+	a_port,
+	a_position,
+	a_print_dot,
+	a_print_frame,
+	a_print_leger,
+	a_print_lyric,
+	a_print_object,
+	a_print_spacing,
+	a_reference,
+	a_relative_x,
+	a_relative_y,
+	a_release,
+	a_repeater,
+	a_rotation,
+	a_second_beat,
+	a_segno,
+	a_separator,
+	a_show_frets,
+	a_show_number,
+	a_show_type,
+	a_sign,
+	a_size,
+	a_slash,
+	a_slashes,
+	a_smufl,
+	a_soft_pedal,
+	a_sostenuto_pedal,
+	a_sound,
+	a_source,
+	a_space_length,
+	a_spread,
+	a_stack_degrees,
+	a_staff_spacing,
+	a_start_note,
+	a_steal_time_following,
+	a_steal_time_previous,
+	a_string,
+	a_substitution,
+	a_symbol,
+	a_tempo,
+	a_text,
+	a_text_x,
+	a_text_y,
+	a_time_only,
+	a_times,
+	a_tip,
+	a_tocoda,
+	a_top_staff,
+	a_trill_step,
+	a_two_note_turn,
+	a_type,
+	a_underline,
+	a_unplayed,
+	a_use_dots,
+	a_use_stems,
+	a_use_symbols,
+	a_valign,
+	a_value,
+	a_version,
+	a_width,
+	a_winged,
+	a_xlink_actuate,
+	a_xlink_href,
+	a_xlink_role,
+	a_xlink_show,
+	a_xlink_title,
+	a_xlink_type,
+	a_xml_lang,
+	a_xml_space,
+	kEndAttribute
+};
+
+}
+#endif
+
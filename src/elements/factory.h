@@ -14,8 +14,7 @@
 #define __factory__
 
 #include <string>
-#include <map>
-#include "functor.h"
+#include <vector>
 #include "singleton.h"
 #include "xml.h"
 
@@ -29,14 +28,35 @@ namespace MusicXML2
 
 class EXP factory : public singleton<factory>{
 
-	std::map<std::string, functor<Sxmlelement>*> fMap;
-	std::map<int, const char*>	fType2Name;
+	public:
+		//! an element description: its name, its type and its constructor
+		typedef struct {
+			const char*	fName;
+			int			fType;
+			Sxmlelement	(*fCreate)(int inputLineNumber);
+		} element;
+
+	private:
+		static const element	fElements[];	// generated from the DTD
+		static const size_t		fElementsCount;
+		std::vector<const element*>	fTypes;		// the elements indexed by type
+		std::vector<const element*>	fHash;		// the elements indexed by name (open addressing hash table)
+		std::vector<std::string>	fNames;		// the elements names indexed by type, shared by the created elements
+
+		const element* find (const char* name, size_t len) const;
+
 	public:
 				 factory();
 		virtual ~factory() {}
 
+		//! the factory has no state apart its tables: it can be used concurrently.
+		//! the elements created by name or by type have no input line number (0)
 		Sxmlelement create(const std::string& elt) const;	
+		Sxmlelement create(const char* elt, size_t len, int inputLineNumber) const;	
 		Sxmlelement create(int type) const;	
+
+		//! returns the name of an element type, or 0 for an unknown type
+		const char* name(int type) const;
 };
 
 }
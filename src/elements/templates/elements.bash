@@ -5,6 +5,18 @@ function kname() {
   echo k_$1 | tr '-' '_'
 }
 
+function aname() {
+  echo a_$1 | tr '-' '_' | tr ':' '_'
+}
+
+function ktype() {
+  case $1 in
+    'comment') echo kComment ;;
+    'pi')      echo kProcessingInstruction ;;
+    *)         kname $1 ;;
+  esac
+}
+
 case $3 in
   'constants')
     # copy license and and the factory preamble
@@ -33,21 +45,55 @@ case $3 in
     # to standard output
     cat $2/license.txt $2/factory.txt
 
-    # generate fMap entries for the markups found in the DTD
-   for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+    # generate the elements table for the markups found in the DTD
+    # the table includes the comment and pi elements
+    for a in $( (echo comment; echo pi; cat $1 | cut -d' ' -f1) | LC_ALL=C sort -u)
     do
-      echo "	fMap[\"$a\"] 	= new newElementFunctor<$(kname $a)>;"
+      echo "	{ \"$a\", 	$(ktype $a), 	newElement<$(ktype $a)> },"
     done
+
+    # generate epiloque
+    echo '};'
     echo
+    echo 'const size_t factory::fElementsCount = sizeof(factory::fElements) / sizeof(factory::element);'
+    echo '}'
+    ;;
 
-    # generate fType2Name entries for the markups found in the DTD
-    for a in $(cat $1 | cut -d' ' -f1 | sort -u)
+
+  'attributes')
+    # copy license and and the attributes preamble
+    # to standard output
+    cat $2/license.txt $2/attributes.txt
+    for a in $(cat $1 | LC_ALL=C sort -u )
     do
-      echo "	fType2Name[$(kname $a)] 	= \"$a\";"
+      echo "	$(aname $a),"
     done
 
     # generate epiloque
-    echo '}'
+    cat << ! 
+	kEndAttribute
+};
+
+}
+#endif
+
+!
+    ;;
+
+
+  'attrnames')
+    # copy license and and the attributes names preamble
+    # to standard output
+    cat $2/license.txt $2/attrnames.txt
+
+    # generate the names table, in the order of the attributes constants
+    for a in $(cat $1 | LC_ALL=C sort -u )
+    do
+      echo "	\"$a\","
+    done
+
+    # generate epiloque
+    echo '};'
     echo '}'
     ;;
 
@@ -87,7 +133,7 @@ case $3 in
 
 
   *)
-    echo "usage: elements.bash eltsfile templatedir [constants | map | types]"
+    echo "usage: elements.bash eltsfile templatedir [constants | map | types | attributes | attrnames]"
     exit 1
     ;;
 esac  
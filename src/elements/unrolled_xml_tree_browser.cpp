@@ -151,6 +151,7 @@ void unrolled_xml_tree_browser::visitStart( S_part& elt)
 	fFirstMeasure = fForwardRepeat = iter;
 	fStoreIterator = 0;
 	fStoreDelay = 0;
+	fJump.current = fJump.next = kNoJump;
 
 	reset();
 
@@ -10,12 +10,18 @@
   research@grame.fr
 */
 
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
-#include <sstream>
 #include <iostream>
+#include <mutex>
 
 #include "xml.h"
+#include "attributes.h"
+#include "elements.h"
 #include "visitor.h"
 
 using namespace std;
@@ -28,32 +34,97 @@ namespace MusicXML2
 //______________________________________________________________________________
 Sxmlattribute xmlattribute::create() { xmlattribute * o = new xmlattribute; assert(o!=0); return o; }
 
+//______________________________________________________________________________
+static const string& emptyString ()
+{
+	static const string empty;
+	return empty;
+}
+
+//______________________________________________________________________________
+// FNV-1a hash of an attribute name
+static inline size_t namehash (const char* name, size_t len)
+{
+	unsigned int h = 2166136261u;
+	for (size_t i = 0; i < len; i++)
+		h = (h ^ (unsigned char)name[i]) * 16777619u;
+	return h;
+}
+
+// an open addressing hash table of the attributes ids
+class attrhash {
+	vector<int>	fTable;		// 0 (kNoAttribute) for empty slots
+	public:
+		attrhash (const char* names[]) {
+			size_t size = 1;
+			while (size < 3 * kEndAttribute) size <<= 1;
+			fTable.resize (size, kNoAttribute);
+			for (int id = kNoAttribute + 1; id < kEndAttribute; id++) {
+				size_t i = namehash (names[id], strlen(names[id])) & (size - 1);
+				while (fTable[i]) i = (i + 1) & (size - 1);
+				fTable[i] = id;
+			}
+		}
+		int find (const char* names[], const char* name, size_t len) const {
+			size_t mask = fTable.size() - 1;
+			for (size_t i = namehash (name, len) & mask; fTable[i]; i = (i + 1) & mask) {
+				const char* attrname = names[fTable[i]];
+				if (!strncmp (attrname, name, len) && !attrname[len]) return fTable[i];
+			}
+			return kNoAttribute;
+		}
+};
+
+int xmlattribute::id (const char* name, size_t len)
+{
+	static const attrhash table (fNames);
+	return table.find (fNames, name, len);
+}
+
+const string& xmlattribute::name (int id)
+{
+	static const vector<string> names (fNames, fNames + kEndAttribute);
+	return ((id > kNoAttribute) && (id < kEndAttribute)) ? names[id] : emptyString();
+}
+
+//______________________________________________________________________________
+// allocation free formatting of numbers, gives the same result than an ostream with the default settings
+class numstr {
+	char	fBuff[32];
+	int		fSize;
+	public:
+		numstr (long value)				{ fSize = snprintf (fBuff, sizeof(fBuff), "%ld", value); }
+		numstr (unsigned long value)	{ fSize = snprintf (fBuff, sizeof(fBuff), "%lu", value); }
+		numstr (float value)			{ fSize = snprintf (fBuff, sizeof(fBuff), "%g", double(value)); }
+		const char*	str () const		{ return fBuff; }
+		size_t		size () const		{ return fSize; }
+};
+
 //______________________________________________________________________________
 void xmlattribute::setName (const string& name) 		{ fName = name; }
+void xmlattribute::setName (const char* name, size_t len)	{ fName.assign (name, len); }
 void xmlattribute::setValue (const string& value) 		{ fValue = value; }
+void xmlattribute::setValue (const char* value, size_t len)	{ fValue.assign (value, len); }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s(value);
+	setValue (s.str(), s.size());
 }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (int value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s((long)value);
+	setValue (s.str(), s.size());
 }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (float value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s(value);
+	setValue (s.str(), s.size());
 }
 
 xmlattribute::operator int () const		{ return atoi(fValue.c_str()); }
@@ -63,44 +134,184 @@ xmlattribute::operator float () const	{ return (float)atof(fValue.c_str()); }
 //______________________________________________________________________________
 // xmlelement
 //______________________________________________________________________________
+xmlelement::xmlelement(int lineno) 
+	: fName(&emptyString()), fOwnedName(0), fAttributes(0), fIntValue(kNoIntValue), fType(0), fInputLineNumber(lineno) {}
+xmlelement::~xmlelement()							{ delete fOwnedName; delete fAttributes.load(); }
+
 Sxmlelement xmlelement::create(int lineno)			{ xmlelement * o = new xmlelement(lineno); assert(o!=0); return o; }
 void xmlelement::setValue (int value)				{ setValue((long)value); }
-void xmlelement::setValue (const string& value) 	{ fValue = value; }
-void xmlelement::setName (const string& name) 		{ fName = name; }
+void xmlelement::setValue (const string& value) 	{ fValue = value; parseValue(); }
+void xmlelement::setValue (const char* value, size_t len)	{ fValue.assign (value, len); parseValue(); }
+
+//______________________________________________________________________________
+// the elements types that are read as numbers by the visitors and converters
+static bool numericType (int type)
+{
+	switch (type) {
+		case k_actual_notes:
+		case k_alter:
+		case k_beat_type:
+		case k_beats:
+		case k_cancel:
+		case k_chromatic:
+		case k_clef_octave_change:
+		case k_diatonic:
+		case k_display_octave:
+		case k_divisions:
+		case k_duration:
+		case k_fifths:
+		case k_line:
+		case k_midi_bank:
+		case k_midi_channel:
+		case k_midi_program:
+		case k_midi_unpitched:
+		case k_normal_notes:
+		case k_octave:
+		case k_octave_change:
+		case k_offset:
+		case k_per_minute:
+		case k_staff:
+		case k_staff_distance:
+		case k_staff_lines:
+		case k_staves:
+		case k_voice:
+		case k_volume:
+			return true;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+// integer values are parsed once when the value is set: for a complete integer string,
+// atol and atof give the same value than strtol
+const int xmlelement::kNoIntValue = INT_MIN;
+
+void xmlelement::parseValue ()
+{
+	fIntValue = kNoIntValue;
+	if (numericType (fType) && !fValue.empty()) {
+		const char* str = fValue.c_str();
+		char* end;
+		errno = 0;
+		long value = strtol (str, &end, 10);
+		if (!*end && !errno && (value > INT_MIN) && (value <= INT_MAX))
+			fIntValue = int(value);
+	}
+}
+
+//______________________________________________________________________________
+void xmlelement::setName (const string& name)
+{
+	if (fOwnedName) *fOwnedName = name;
+	else fOwnedName = new string(name);
+	fName = fOwnedName;
+}
+
+//______________________________________________________________________________
+void xmlelement::setSharedName (const string& name)
+{
+	delete fOwnedName;
+	fOwnedName = 0;
+	fName = &name;
+}
 //______________________________________________________________________________
 void xmlelement::setValue (long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s(value);
+	setValue (s.str(), s.size());
 }
 
 //______________________________________________________________________________
 void xmlelement::setValue (unsigned long value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s(value);
+	setValue (s.str(), s.size());
 }
 
 //______________________________________________________________________________
 void xmlelement::setValue (float value)
 {
-	stringstream s;
-	s << value;
-	s >> fValue;
+	numstr s(value);
+	setValue (s.str(), s.size());
 }
 
 //______________________________________________________________________________
 long xmlelement::add (const Sxmlattribute& attr)
 { 
-	fAttributes.push_back(attr);
-	return long(fAttributes.size()-1);
+	materialize();
+	vector<attribute>().swap(fAttrs);		// no longer used
+	vector<Sxmlattribute>* attributes = fAttributes;
+	attributes->push_back(attr);
+	return long(attributes->size()-1);
+}
+
+//______________________________________________________________________________
+long xmlelement::add (int attrId, const char* value, size_t len)
+{
+	if ((attrId <= kNoAttribute) || (attrId >= kEndAttribute)) return -1;
+	if (fAttributes) {
+		Sxmlattribute attr = xmlattribute::create();
+		attr->setName (xmlattribute::name(attrId));
+		attr->setValue (value, len);
+		return add (attr);
+	}
+	fAttrs.push_back (attribute());
+	attribute& attr = fAttrs.back();
+	attr.fId = attrId;
+	attr.fValue.assign (value, len);
+	return long(fAttrs.size()-1);
+}
+
+//______________________________________________________________________________
+// the xmlattribute objects are created from the heap, whatever the arena of the calling thread,
+// and published once complete: the readers that don't see them yet keep on using fAttrs
+void xmlelement::materialize () const
+{
+	if (fAttributes) return;
+	static mutex lock;
+	lock_guard<mutex> guard (lock);
+	if (fAttributes) return;
+
+	arena::scope heap (0);
+	vector<Sxmlattribute>* attributes = new vector<Sxmlattribute>;
+	attributes->reserve (fAttrs.size());
+	for (size_t i = 0; i < fAttrs.size(); i++) {
+		Sxmlattribute attr = xmlattribute::create();
+		attr->setName (xmlattribute::name(fAttrs[i].fId));
+		attr->setValue (fAttrs[i].fValue);
+		attributes->push_back (attr);
+	}
+	fAttributes = attributes;
+}
+
+//______________________________________________________________________________
+const vector<Sxmlattribute>& xmlelement::attributes () const
+{
+	materialize();
+	return *fAttributes.load();
+}
+
+size_t xmlelement::attributesSize () const
+{
+	const vector<Sxmlattribute>* attributes = fAttributes;
+	return attributes ? attributes->size() : fAttrs.size();
+}
+
+const string& xmlelement::attributeName (size_t index) const
+{
+	const vector<Sxmlattribute>* attributes = fAttributes;
+	return attributes ? (*attributes)[index]->getName() : xmlattribute::name(fAttrs[index].fId);
+}
+
+const string& xmlelement::attributeValue (size_t index) const
+{
+	const vector<Sxmlattribute>* attributes = fAttributes;
+	return attributes ? (*attributes)[index]->getValue() : fAttrs[index].fValue;
 }
 
 //______________________________________________________________________________
 void xmlelement::acceptIn(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = v.cast<visitor<Sxmlelement> >(kNoElement);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitStart (xml);
@@ -109,7 +320,7 @@ void xmlelement::acceptIn(basevisitor& v) {
 
 //______________________________________________________________________________
 void xmlelement::acceptOut(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = v.cast<visitor<Sxmlelement> >(kNoElement);
 	if (p) {
 		Sxmlelement xml = this;
 		p->visitEnd (xml);
@@ -119,6 +330,7 @@ void xmlelement::acceptOut(basevisitor& v) {
 //______________________________________________________________________________
 const Sxmlattribute xmlelement::getAttribute(const string& attrname) const 
 {
+	if (!findAttribute(attrname)) return 0;		// avoids creating the attributes objects
 	vector<Sxmlattribute>::const_iterator it;
 	for (it = attributes().begin(); it != attributes().end(); it++) {
 		if ((*it)->getName() == attrname)
@@ -128,36 +340,87 @@ const Sxmlattribute xmlelement::getAttribute(const string& attrname) const
 }
 
 //______________________________________________________________________________
-const string xmlelement::getAttributeValue (const string& attrname) const
+const string* xmlelement::findAttribute (const string& attrname) const
 {
-	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? attribute->getValue() : "";
+	const vector<Sxmlattribute>* attributes = fAttributes;
+	if (attributes) {
+		vector<Sxmlattribute>::const_iterator it;
+		for (it = attributes->begin(); it != attributes->end(); it++) {
+			if ((*it)->getName() == attrname)
+				return &(*it)->getValue();
+		}
+		return 0;
+	}
+	for (size_t i = 0; i < fAttrs.size(); i++) {
+		if (xmlattribute::name(fAttrs[i].fId) == attrname)
+			return &fAttrs[i].fValue;
+	}
+	return 0;
+}
+
+const string* xmlelement::findAttribute (int attrId) const
+{
+	if (fAttributes) return attrId ? findAttribute (xmlattribute::name(attrId)) : 0;
+	for (size_t i = 0; i < fAttrs.size(); i++) {
+		if (fAttrs[i].fId == attrId)
+			return &fAttrs[i].fValue;
+	}
+	return 0;
 }
 
 //______________________________________________________________________________
+const string xmlelement::getAttributeValue (const string& attrname) const
+{
+	const string* value = findAttribute(attrname);
+	return value ? *value : "";
+}
+
 long xmlelement::getAttributeLongValue (const string& attrname, long defaultvalue) const
 {
-	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atol(attribute->getValue().c_str()) : defaultvalue;
+	const string* value = findAttribute(attrname);
+	return value ? atol(value->c_str()) : defaultvalue;
 }
 
-//______________________________________________________________________________
 int xmlelement::getAttributeIntValue (const string& attrname, int defaultvalue) const
 {
-	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? atoi(attribute->getValue().c_str()) : defaultvalue;
+	const string* value = findAttribute(attrname);
+	return value ? atoi(value->c_str()) : defaultvalue;
 }
 
-//______________________________________________________________________________
 float xmlelement::getAttributeFloatValue (const string& attrname, float defaultvalue) const
 {
-	Sxmlattribute attribute = getAttribute(attrname);
-	return attribute ? (float)atof(attribute->getValue().c_str()) : defaultvalue;
+	const string* value = findAttribute(attrname);
+	return value ? (float)atof(value->c_str()) : defaultvalue;
+}
+
+//______________________________________________________________________________
+const string& xmlelement::getAttributeValue (int attrId) const
+{
+	const string* value = findAttribute(attrId);
+	return value ? *value : emptyString();
+}
+
+long xmlelement::getAttributeLongValue (int attrId, long defaultvalue) const
+{
+	const string* value = findAttribute(attrId);
+	return value ? atol(value->c_str()) : defaultvalue;
+}
+
+int xmlelement::getAttributeIntValue (int attrId, int defaultvalue) const
+{
+	const string* value = findAttribute(attrId);
+	return value ? atoi(value->c_str()) : defaultvalue;
+}
+
+float xmlelement::getAttributeFloatValue (int attrId, float defaultvalue) const
+{
+	const string* value = findAttribute(attrId);
+	return value ? (float)atof(value->c_str()) : defaultvalue;
 }
 
-xmlelement::operator int () const	{ return atoi(fValue.c_str()); }
-xmlelement::operator long () const	{ return atol(fValue.c_str()); }
-xmlelement::operator float () const { return (float)atof(fValue.c_str()); }
+xmlelement::operator int () const	{ return (fIntValue != kNoIntValue) ? fIntValue : atoi(fValue.c_str()); }
+xmlelement::operator long () const	{ return (fIntValue != kNoIntValue) ? fIntValue : atol(fValue.c_str()); }
+xmlelement::operator float () const { return (fIntValue != kNoIntValue) ? float(fIntValue) : (float)atof(fValue.c_str()); }
 
 //______________________________________________________________________________
 bool xmlelement::operator ==(const xmlelement& elt) const
@@ -165,17 +428,11 @@ bool xmlelement::operator ==(const xmlelement& elt) const
 	if (getType() != elt.getType()) return false;
 	if (getName() != elt.getName()) return false;
 	if (getValue()!= elt.getValue()) return false;
-	const vector<Sxmlattribute>& attr1 = attributes();
-	const vector<Sxmlattribute>& attr2 = elt.attributes();
-	if (attr1.size() != attr2.size()) return false;
-
-	vector<Sxmlattribute>::const_iterator iter1 = attr1.begin();
-	vector<Sxmlattribute>::const_iterator iter2 = attr2.begin();
-	while (iter1 != attr1.end()) {
-		if (iter2 == attr2.end()) return false;
-		if ((*iter1)->getName() != (*iter2)->getName()) return false;
-		if ((*iter1)->getValue() != (*iter2)->getValue()) return false;
-		iter1++; iter2++;
+	size_t n = attributesSize();
+	if (n != elt.attributesSize()) return false;
+	for (size_t i = 0; i < n; i++) {
+		if (attributeName(i) != elt.attributeName(i)) return false;
+		if (attributeValue(i) != elt.attributeValue(i)) return false;
 	}
 	return true;
 }
@@ -13,6 +13,7 @@
 #ifndef __xml__
 #define __xml__
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,7 @@
 #include "exports.h"
 #include "ctree.h"
 #include "smartpointer.h"
+#include "arena.h"
 
 namespace MusicXML2
 {
@@ -42,21 +44,32 @@ typedef SMARTP<xmlelement> 		Sxmlelement;
 \brief A generic xml attribute representation.
 
 	An attribute is represented by its name and its value.
+	Attributes are allocated from the current arena when there is one (see arenaobject).
 */
 //______________________________________________________________________________
-class EXP xmlattribute : public smartable {
+class EXP xmlattribute : public smartable, public arenaobject {
 	//! the attribute name
 	std::string	fName;
 	//! the attribute value
 	std::string 	fValue;
+	//! the MusicXML attributes names, indexed by id (see attributes.h)
+	static const char* fNames[];
     protected:
 		xmlattribute() {}
 		virtual ~xmlattribute() {}
     public:
 		static SMARTP<xmlattribute> create();
 
+		//! gives the id of a MusicXML attribute name (see attributes.h), kNoAttribute for unknown names
+		static int					id   (const char* name, size_t len);
+		static int					id   (const std::string& name)	{ return id (name.data(), name.size()); }
+		//! gives the name of an attribute id
+		static const std::string&	name (int id);
+
 		void setName (const std::string& name);
+		void setName (const char* name, size_t len);
 		void setValue (const std::string& value);
+		void setValue (const char* value, size_t len);
 		void setValue (long value);
 		void setValue (int value);
 		void setValue (float value);
@@ -79,18 +92,44 @@ class EXP xmlattribute : public smartable {
 	An element is represented by its name, its value,
 	the lists of its attributes and its enclosed elements.
 	Attributes and elements must be added in the required
-	order.
+	order. Elements are allocated from the current arena when there is one (see arenaobject).
 */
 //______________________________________________________________________________
-class EXP xmlelement : public ctree<xmlelement>, public visitable
+class EXP xmlelement : public ctree<xmlelement>, public visitable, public arenaobject
 {
 	private:
-		//! the element name
-		std::string fName;
+		//! the element name: shared by all the elements of a given type (see setSharedName)
+		//! or owned by the element (see setName)
+		const std::string* fName;
+		//! the element name when owned by the element, null otherwise
+		std::string* fOwnedName;
 		//! the element value
 		std::string fValue;
-		//! list of the element attributes
-		std::vector<Sxmlattribute> fAttributes;
+		//! an attribute stored by name id
+		struct attribute {
+			int			fId;
+			std::string	fValue;
+						attribute() : fId(0) {}
+		};
+		//! the element attributes, stored by id in a single array until they are requested as xmlattribute objects
+		std::vector<attribute> fAttrs;
+		//! the element attributes as xmlattribute objects, null until they are requested (see attributes())
+		mutable std::atomic<std::vector<Sxmlattribute>*> fAttributes;
+
+		//! converts the attributes stored by id into xmlattribute objects.
+		//! the const accessors may be called concurrently: the conversion is made under a lock
+		//! and leaves fAttrs unchanged
+		void				materialize () const;
+
+		//! the element value as an integer, for the types with numeric values and an integer value,
+		//! kNoIntValue otherwise (the numeric operators then convert the string value)
+		int		fIntValue;
+		static const int kNoIntValue;
+		//! parses the integer value of the elements with numeric types
+		void	parseValue ();
+
+				 xmlelement (const xmlelement&);
+		xmlelement& operator= (const xmlelement&);
 
 	protected:
 		// the element type
@@ -98,8 +137,8 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		// the input line number for messages to the user
 		int fInputLineNumber;
 
-				 xmlelement (int inputLineNumber) : fType(0), fInputLineNumber(inputLineNumber) {}
-		virtual ~xmlelement() {}
+				 xmlelement (int inputLineNumber);
+		virtual ~xmlelement();
 
 	public:
 		typedef ctree<xmlelement>::iterator     iterator;
@@ -110,16 +149,20 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		virtual void acceptOut (basevisitor& visitor);
 
 		int getInputLineNumber () { return fInputLineNumber; }
+		void setInputLineNumber (int inputLineNumber) { fInputLineNumber = inputLineNumber; }
 
 		void setValue (unsigned long value);
 		void setValue (long value);
 		void setValue (int value);
 		void setValue (float value);
 		void setValue (const std::string& value);
+		void setValue (const char* value, size_t len);
 		void setName  (const std::string& name);
+		//! sets the element name without copy: name must remain valid for the element lifetime
+		void setSharedName (const std::string& name);
 
 		int                 getType () const    { return fType; }
-		const std::string&  getName () const    { return fName; }
+		const std::string&  getName () const    { return *fName; }
 
 		//! returns the element value as a string
 		const std::string& getValue () const    { return fValue; }
@@ -136,9 +179,26 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 
 		//! adds an attribute to the element
 		long add (const Sxmlattribute& attr);
+		//! adds an attribute to the element using its name id (see attributes.h)
+		long add (int attrId, const char* value, size_t len);
+		long add (int attrId, const std::string& value)		{ return add (attrId, value.data(), value.size()); }
 
 		// getting information about attributes
-		const std::vector<Sxmlattribute>& attributes() const { return fAttributes; }
+		//! the attributes as xmlattribute objects: they are created at the first call.
+		//! concurrent readers should prefer the accessors below, which don't copy any smart pointer
+		const std::vector<Sxmlattribute>& attributes() const;
+		size_t				attributesSize () const;
+		const std::string&	attributeName  (size_t index) const;
+		const std::string&	attributeValue (size_t index) const;
+
+		//! gives an attribute value using its name id (see attributes.h), null when the attribute is missing
+		const std::string*	findAttribute (int attrId) const;
+		const std::string*	findAttribute (const std::string& attrname) const;
+		const std::string&	getAttributeValue		(int attrId) const;
+		long				getAttributeLongValue	(int attrId, long defaultvalue) const;
+		int					getAttributeIntValue	(int attrId, int defaultvalue) const;
+		float				getAttributeFloatValue	(int attrId, float defaultvalue) const;
+
 		const Sxmlattribute getAttribute      (const std::string& attrname) const;
 		const std::string   getAttributeValue   (const std::string& attrname) const;
 		long                getAttributeLongValue (const std::string& attrname, long defaultvalue) const;
@@ -18,11 +18,7 @@ namespace MusicXML2
 {
 
 void xml_tree_browser::browse (xmlelement& t) {
-	enter(t);
-	ctree<xmlelement>::literator iter;
-	for (iter = t.lbegin(); iter != t.lend(); iter++)
-		browse(**iter);
-	leave(t);
+	tree_browser<xmlelement>::browse (t);
 }
 
 
@@ -0,0 +1,160 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <map>
+
+#include "elements.h"
+#include "scoreindex.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+Sscoreindex scoreindex::create (const Sxmlelement& score)
+{
+	scoreindex* o = new scoreindex(score); assert(o!=0); return o;
+}
+
+//______________________________________________________________________________
+scoreindex::scoreindex (const Sxmlelement& score) : fScore(score), fPartList(0)
+{
+	if (fScore) build();
+}
+
+//______________________________________________________________________________
+size_t scoreindex::find (const xmlelement* elt) const
+{
+	for (size_t i = 0; i < fParts.size(); i++)
+		if (fParts[i].fElement == elt) return i;
+	return fParts.size();
+}
+
+size_t scoreindex::find (const std::string& partID) const
+{
+	for (size_t i = 0; i < fParts.size(); i++)
+		if (fParts[i].fID == partID) return i;
+	return fParts.size();
+}
+
+//______________________________________________________________________________
+// the parts and measures are direct children of the score and of the parts,
+// notes, attributes and print elements are direct children of the measures:
+// the remaining of the tree is not traversed
+void scoreindex::build ()
+{
+	for (ctree<xmlelement>::literator i = fScore->lbegin(); i != fScore->lend(); i++) {
+		switch ((*i)->getType()) {
+			case k_part_list:
+				fPartList = *i;
+				break;
+			case k_part:
+				addPart (*i);
+				break;
+		}
+	}
+}
+
+//______________________________________________________________________________
+void scoreindex::addPart (xmlelement* elt)
+{
+	part p;
+	p.fElement = elt;
+	p.fID = elt->getAttributeValue("id");
+	p.fStaves = 1;
+	p.fMeasures.fFirst = fMeasures.size();
+	p.fNotes.fFirst = fNotes.size();
+	p.fVoices.fFirst = fVoices.size();
+	p.fLayouts.fFirst = fLayouts.size();
+
+	long divisions = 0;
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++) {
+		if ((*i)->getType() == k_measure)
+			addMeasure (*i, p, divisions);
+	}
+	p.fMeasures.fCount = fMeasures.size() - p.fMeasures.fFirst;
+	p.fNotes.fCount = fNotes.size() - p.fNotes.fFirst;
+	p.fLayouts.fCount = fLayouts.size() - p.fLayouts.fFirst;
+
+	// the count of notes per staff and voice
+	map<pair<int, int>, int> voices;
+	for (size_t i = p.fNotes.fFirst; i < p.fNotes.end(); i++)
+		voices[make_pair(fNotes[i].fStaff, fNotes[i].fVoice)]++;
+	for (map<pair<int, int>, int>::const_iterator i = voices.begin(); i != voices.end(); i++) {
+		voice v = { i->first.first, i->first.second, i->second };
+		fVoices.push_back (v);
+	}
+	p.fVoices.fCount = voices.size();
+	fParts.push_back (p);
+}
+
+//______________________________________________________________________________
+void scoreindex::addMeasure (xmlelement* elt, part& p, long& divisions)
+{
+	measure m;
+	m.fElement = elt;
+	m.fPart = fParts.size();
+	m.fDivisions = divisions;
+	m.fNotes.fFirst = fNotes.size();
+	for (ctree<xmlelement>::literator i = elt->lbegin(); i != elt->lend(); i++) {
+		xmlelement* e = *i;
+		switch (e->getType()) {
+			case k_note: {
+				note n = { e, 0, 0 };
+				for (ctree<xmlelement>::literator c = e->lbegin(); c != e->lend(); c++) {
+					int type = (*c)->getType();
+					if (type == k_staff) n.fStaff = int(**c);
+					else if (type == k_voice) n.fVoice = int(**c);
+				}
+				fNotes.push_back (n);
+				break;
+			}
+			case k_attributes:
+				for (ctree<xmlelement>::literator c = e->lbegin(); c != e->lend(); c++) {
+					int type = (*c)->getType();
+					if (type == k_divisions) divisions = long(**c);
+					else if (type == k_staves) p.fStaves = int(**c);
+				}
+				break;
+			case k_print:
+				addLayouts (e, p);
+				break;
+		}
+	}
+	m.fNotes.fCount = fNotes.size() - m.fNotes.fFirst;
+	fMeasures.push_back (m);
+}
+
+//______________________________________________________________________________
+// keeps the greatest distance of each staff, as partsummary does
+void scoreindex::addLayouts (xmlelement* print, part& p)
+{
+	for (ctree<xmlelement>::iterator i = print->find(k_staff_layout); i != print->end(); i = print->find(k_staff_layout, ++i)) {
+		int staff = i->getAttributeIntValue("number", 0) - 1;
+		int distance = i->getIntValue(k_staff_distance, 0);
+		vector<layout>::iterator l = fLayouts.begin() + p.fLayouts.fFirst;
+		while ((l != fLayouts.end()) && (l->fStaff != staff)) l++;
+		if (l == fLayouts.end()) {
+			layout entry = { staff, distance };
+			fLayouts.push_back (entry);
+		}
+		else if (l->fDistance < distance) l->fDistance = distance;
+	}
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __scoreindex__
+#define __scoreindex__
+
+#include <string>
+#include <vector>
+
+#include "exports.h"
+#include "smartpointer.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief The structure of a partwise score, computed once.
+
+	The index is built in a single pass over the score: parts, measures and notes
+	are stored in flat arrays, in document order. A part refers to a contiguous
+	range of measures, notes, voices and staff layouts, a measure to a contiguous
+	range of notes. Staff and voice numbers are the ones seen by notevisitor
+	(0 when the note doesn't specify them).
+	The index refers to the tree elements: it must be rebuilt when the tree is modified.
+*/
+//______________________________________________________________________________
+class EXP scoreindex : public smartable
+{
+	public:
+		struct range {
+			size_t	fFirst;
+			size_t	fCount;
+			size_t	end () const	{ return fFirst + fCount; }
+		};
+		struct part {
+			xmlelement*	fElement;
+			std::string	fID;
+			int			fStaves;		// the staves count, 1 when not specified
+			range		fMeasures;
+			range		fNotes;
+			range		fVoices;		// the voices per staff, sorted by staff then voice
+			range		fLayouts;		// the staff distances from the print elements
+		};
+		struct measure {
+			xmlelement*	fElement;
+			size_t		fPart;
+			long		fDivisions;		// the divisions at the beginning of the measure, 0 when not yet specified
+			range		fNotes;
+		};
+		struct note {
+			xmlelement*	fElement;
+			int			fStaff;
+			int			fVoice;
+		};
+		struct voice {
+			int			fStaff;
+			int			fVoice;
+			int			fNotes;			// the count of notes of the voice on the staff
+		};
+		struct layout {
+			int			fStaff;			// the staff-layout number - 1
+			int			fDistance;		// the greatest staff-distance
+		};
+
+	private:
+		Sxmlelement				fScore;
+		xmlelement*				fPartList;
+		std::vector<part>		fParts;
+		std::vector<measure>	fMeasures;
+		std::vector<note>		fNotes;
+		std::vector<voice>		fVoices;
+		std::vector<layout>		fLayouts;
+
+		void	build		();
+		void	addPart		(xmlelement* elt);
+		void	addMeasure	(xmlelement* elt, part& p, long& divisions);
+		void	addLayouts	(xmlelement* print, part& p);
+
+	protected:
+				 scoreindex (const Sxmlelement& score);
+		virtual ~scoreindex () {}
+
+	public:
+		static SMARTP<scoreindex> create (const Sxmlelement& score);
+
+		Sxmlelement			getScore () const		{ return fScore; }
+		//! the part-list element, 0 when there is none
+		xmlelement*			getPartList () const	{ return fPartList; }
+
+		const std::vector<part>&	parts () const		{ return fParts; }
+		const std::vector<measure>&	measures () const	{ return fMeasures; }
+		const std::vector<note>&	notes () const		{ return fNotes; }
+		const std::vector<voice>&	voices () const		{ return fVoices; }
+		const std::vector<layout>&	layouts () const	{ return fLayouts; }
+
+		//! returns the index of a part element or of a part id, parts().size() when not found
+		size_t	find (const xmlelement* part) const;
+		size_t	find (const std::string& partID) const;
+};
+typedef SMARTP<scoreindex> Sscoreindex;
+
+}
+
+#endif
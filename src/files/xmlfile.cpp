@@ -23,6 +23,13 @@ namespace MusicXML2
 //______________________________________________________________________________
 SXMLFile TXMLFile::create ()  { TXMLFile* o = new TXMLFile; assert(o!=0); return o; }
 
+//______________________________________________________________________________
+Sscoreindex TXMLFile::getIndex ()
+{
+	if (!fIndex && fXMLTree) fIndex = scoreindex::create (fXMLTree);
+	return fIndex;
+}
+
 //______________________________________________________________________________
 TDocType::TDocType (const string start) : fStartElement(start), fPublic(true) 
 {
@@ -18,6 +18,8 @@
 #include "exports.h"
 #include "xml.h"
 #include "ctree.h"
+#include "arena.h"
+#include "scoreindex.h"
 
 namespace MusicXML2 
 {
@@ -72,6 +74,8 @@ class EXP TXMLFile : public smartable
     TXMLDecl*             fXMLDecl;
     TDocType*             fDocType;
     Sxmlelement           fXMLTree;
+    Sarena                fArena;		// the arena of the document elements, when allocated from an arena
+    Sscoreindex           fIndex;		// the score index, computed on demand
   
   protected:
 			 TXMLFile () : fXMLDecl(0), fDocType(0) {}
@@ -84,10 +88,19 @@ class EXP TXMLFile : public smartable
     TXMLDecl* 		getXMLDecl ()			{ return fXMLDecl; }
     TDocType* 		getDocType ()			{ return fDocType; }
     Sxmlelement		elements () 			{ return fXMLTree; }
-
-    void 			set (Sxmlelement root)	{ fXMLTree = root; }
+    Sarena			getArena ()				{ return fArena; }
+    // the score index is computed at the first call and shared by the subsequent calls
+    // it must not be called concurrently the first time
+    // the index refers to the tree elements: it is dropped when a new tree is set,
+    // but the tree can also be modified in place, then invalidateIndex must be called
+    Sscoreindex		getIndex ();
+    // drops the score index, that is rebuilt by the next getIndex call
+    void			invalidateIndex ()		{ fIndex = (scoreindex*)0; }
+
+    void 			set (Sxmlelement root)	{ fXMLTree = root; invalidateIndex(); }
     void 			set (TXMLDecl * dec)	{ fXMLDecl = dec; }
     void 			set (TDocType * dt)		{ fDocType = dt; }
+    void 			set (Sarena a)			{ fArena = a; }
 
     void 			print (std::ostream& s);
 };
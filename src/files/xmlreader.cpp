@@ -15,20 +15,18 @@
 #endif
 
 #include <iostream>
+#include <stdlib.h>
+#include <string.h>
 #include "xmlreader.h"
+#include "xmlparser.h"
 #include "factory.h"
+#include "elements.h"
 
 using namespace std;
 
 namespace MusicXML2
 {
 
-extern "C" {
-bool readfile   (const char * file, reader * r);
-bool readstream (FILE * file, reader * r);
-bool readbuffer (const char * buffer, reader * r);
-}
-
 #if 0
 #define debug(str,val)	cerr << str << " - " << val << endl
 #else
@@ -36,82 +34,274 @@ bool readbuffer (const char * buffer, reader * r);
 #endif
 
 //_______________________________________________________________________________
-SXMLFile xmlreader::readbuff(const char* buffer)
+int xmlreader::lineno() const
+{
+	return fParser ? fParser->lineno() : 0;
+}
+
+//_______________________________________________________________________________
+void xmlreader::reset()
 {
 	fFile = TXMLFile::create();
+	if (fUseArena) fFile->set (arena::create());
+	fStack.clear();
+	fInRange = true;
+	fBefore = false;
+	fSkipped = (void*)0;
+	fSkippedMeasure = (void*)0;
+	fPart.clear();
+	fAttributes.clear();
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readbuff(const char* buffer)
+{
+	reset();
+	debug("read buffer", '-');
+	arena::scope s (fFile->getArena());
+	xmlparser p(this);
+	fParser = &p;
+	bool ret = p.readbuffer (buffer);
+	fParser = 0;
+	return ret ? fFile : 0;
+}
+
+SXMLFile xmlreader::readbuff(const char* buffer, size_t size)
+{
+	reset();
 	debug("read buffer", '-');
-	return readbuffer (buffer, this) ? fFile : 0;
+	arena::scope s (fFile->getArena());
+	xmlparser p(this);
+	fParser = &p;
+	bool ret = p.readbuffer (buffer, size);
+	fParser = 0;
+	return ret ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(const char* file)
 {
-	fFile = TXMLFile::create();
+	reset();
 	debug("read", file);
-	return readfile (file, this) ? fFile : 0;
+	arena::scope s (fFile->getArena());
+	xmlparser p(this);
+	fParser = &p;
+	bool ret = p.readfile (file);
+	fParser = 0;
+	return ret ? fFile : 0;
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::mapRead(const char* file)
+{
+	reset();
+	debug("mapRead", file);
+	arena::scope s (fFile->getArena());
+	xmlparser p(this);
+	fParser = &p;
+	bool ret = p.mapfile (file);
+	fParser = 0;
+	return ret ? fFile : 0;
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(FILE* file)
 {
-	fFile = TXMLFile::create();
-	return readstream (file, this) ? fFile : 0;
+	reset();
+	arena::scope s (fFile->getArena());
+	xmlparser p(this);
+	fParser = &p;
+	bool ret = p.readstream (file);
+	fParser = 0;
+	return ret ? fFile : 0;
 }
 
 //_______________________________________________________________________________
-void xmlreader::newComment (const char* comment)
+void xmlreader::newComment (const char* comment)				{ newComment (comment, strlen(comment)); }
+void xmlreader::newProcessingInstruction (const char* pi)		{ newProcessingInstruction (pi, strlen(pi)); }
+bool xmlreader::newElement (const char* eltName)				{ return newElement (eltName, strlen(eltName)); }
+bool xmlreader::endElement (const char* eltName)				{ return endElement (eltName, strlen(eltName)); }
+void xmlreader::setValue (const char* value)					{ setValue (value, strlen(value)); }
+bool xmlreader::newAttribute (const char* name, const char *value)	{ return newAttribute (name, strlen(name), value, strlen(value)); }
+
+//_______________________________________________________________________________
+void xmlreader::newComment (const char* comment, size_t len)
 {
-	Sxmlelement elt = factory::instance().create("comment");
-	elt->setValue(comment);
+	Sxmlelement elt = factory::instance().create(kComment);
+	elt->setInputLineNumber (lineno());
+	elt->setValue(comment, len);
 	// comments outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.back()->push(elt);
 }
 
 //_______________________________________________________________________________
-void xmlreader::newProcessingInstruction (const char* pi)
+void xmlreader::newProcessingInstruction (const char* pi, size_t len)
 {
-	Sxmlelement elt = factory::instance().create("pi");
-	elt->setValue(pi);
+	Sxmlelement elt = factory::instance().create(kProcessingInstruction);
+	elt->setInputLineNumber (lineno());
+	elt->setValue(pi, len);
 	// processing instructions outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.back()->push(elt);
 }
 
 //_______________________________________________________________________________
-bool xmlreader::newElement (const char* eltName)
+bool xmlreader::newElement (const char* eltName, size_t len)
 {
-	debug("newElement", eltName);
-	Sxmlelement elt = factory::instance().create(eltName);
+	debug("newElement", string(eltName, len));
+	Sxmlelement elt = factory::instance().create(eltName, len, lineno());
 	if (!elt) return false;
 	if (!fFile->elements()) {
-	debug("first element", eltName);
+	debug("first element", string(eltName, len));
 		fFile->set(elt);
 	}
 	else {
-	debug("push element", eltName);
-		fStack.top()->push(elt);
+	debug("push element", string(eltName, len));
+		fStack.back()->push(elt);
 	}
-	fStack.push(elt);
+	fStack.push_back(elt);
 	return true;
 }
 
 //_______________________________________________________________________________
-bool xmlreader::endElement (const char* eltName)
+bool xmlreader::endElement (const char* eltName, size_t len)
 {
-	debug("endElement", eltName);
-	Sxmlelement top = fStack.top();
-	fStack.pop();
-	return top->getName() == eltName;
+	debug("endElement", string(eltName, len));
+	if (fStack.empty()) return false;
+	Sxmlelement top = fStack.back();
+	fStack.pop_back();
+	if (top == fSkipped) {		// the end of a skipped measure: keeps its attributes
+		ctree<xmlelement>::branchs& elts = top->elements();
+		for (size_t i = 0; i < elts.size(); i++)
+			if (elts[i]->getType() == k_attributes) fAttributes[fPart].push_back (elts[i]);
+		fSkipped = (void*)0;
+	}
+	else if (top == fSkippedMeasure)
+		fSkippedMeasure = (void*)0;
+	return top->getName().compare (0, string::npos, eltName, len) == 0;
 }
 
 //_______________________________________________________________________________
-bool xmlreader::newAttribute (const char* name, const char *value)
+// parts and measures filtering
+//_______________________________________________________________________________
+void xmlreader::filtering ()
 {
-	debug("newAttribute", name);
+	fFiltering = fParts.size() || (fFirstMeasure > INT_MIN) || (fLastMeasure < INT_MAX);
+}
+
+//_______________________________________________________________________________
+// removes the current element from its parent: it is not part of the tree
+void xmlreader::drop ()
+{
+	size_t n = fStack.size();
+	if (n > 1) fStack[n-2]->elements().pop_back();
+}
+
+//_______________________________________________________________________________
+bool xmlreader::skipPart (const Sxmlelement& part) const
+{
+	if (fParts.empty()) return false;
+	bool listed = fParts.find (part->getAttributeValue("id")) != fParts.end();
+	return listed != fKeepParts;
+}
+
+//_______________________________________________________________________________
+// moves the attributes of the skipped measures of the current part to elt,
+// the first selected measure of the part, or the part of the first selected timewise measure
+void xmlreader::carry (const Sxmlelement& elt)
+{
+	map<string, vector<Sxmlelement> >::iterator i = fAttributes.find (fPart);
+	if (i == fAttributes.end()) return;
+	for (size_t n = 0; n < i->second.size(); n++)
+		elt->push (i->second[n]);
+	fAttributes.erase (i);
+}
+
+//_______________________________________________________________________________
+// measures without a numeric number share the state of the previous measure
+bool xmlreader::skipMeasure (const Sxmlelement& measure)
+{
+	string number = measure->getAttributeValue("number");
+	char* end;
+	long num = strtol (number.c_str(), &end, 10);
+	if (end != number.c_str()) {
+		fInRange = (num >= fFirstMeasure) && (num <= fLastMeasure);
+		fBefore = num < fFirstMeasure;
+	}
+	size_t n = fStack.size();
+	int parent = (n > 1) ? fStack[n-2]->getType() : 0;
+	if (fInRange) {
+		if (parent == k_part) carry (measure);		// in timewise scores, the attributes are carried to the parts
+		return false;
+	}
+	drop();
+	if (fBefore && (parent == k_part)) {
+		fSkipped = measure;			// scanned for its attributes
+		return false;
+	}
+	if (fBefore && (parent == k_score_timewise)) {
+		fSkippedMeasure = measure;	// scanned for its parts attributes
+		return false;
+	}
+	return true;
+}
+
+//_______________________________________________________________________________
+bool xmlreader::skipElement ()
+{
+	if (!fFiltering) return false;
+	const Sxmlelement& elt = fStack.back();
+	xmlelement* parent = (fStack.size() > 1) ? (xmlelement*)fStack[fStack.size()-2] : 0;
+	int type = elt->getType();
+	if (fSkipped) {
+		// only the attributes of a skipped measure are read
+		if ((parent == (xmlelement*)fSkipped) && (type != k_attributes)) {
+			drop();
+			return true;
+		}
+		return false;
+	}
+	if (fSkippedMeasure) {
+		// only the parts of a skipped timewise measure are read, for their attributes
+		if ((type == k_part) && !skipPart (elt)) {
+			fPart = elt->getAttributeValue("id");
+			fSkipped = elt;
+			return false;
+		}
+		drop();
+		return true;
+	}
+	if (type == k_part) {
+		if (skipPart (elt)) {
+			drop();
+			return true;
+		}
+		fPart = elt->getAttributeValue("id");
+		if (parent && (parent->getType() == k_measure))		// a part of a selected timewise measure
+			carry (elt);
+		else {
+			fInRange = true;
+			fBefore = false;
+			fAttributes.erase (fPart);
+		}
+	}
+	else if (type == k_measure)
+		return skipMeasure (elt);
+	return false;
+}
+
+//_______________________________________________________________________________
+bool xmlreader::newAttribute (const char* name, size_t len, const char *value, size_t vlen)
+{
+	debug("newAttribute", string(name, len));
+	int id = xmlattribute::id (name, len);
+	if (id) return fStack.back()->add (id, value, vlen) >= 0;
+
+	// attributes not defined by MusicXML
 	Sxmlattribute attr = xmlattribute::create();
 	if (attr) {
-		attr->setName(name);
-		attr->setValue(value);
-		fStack.top()->add(attr);
+		attr->setName(name, len);
+		attr->setValue(value, vlen);
+		fStack.back()->add(attr);
 		return true;
 	}
 	return false;
@@ -136,10 +326,10 @@ bool xmlreader::docType (const char* start, bool status, const char *pub, const
 }
 
 //_______________________________________________________________________________
-void xmlreader::setValue (const char* value)
+void xmlreader::setValue (const char* value, size_t len)
 {
-	debug("setValue", value);
-	fStack.top()->setValue(value);
+	debug("setValue", string(value, len));
+	fStack.back()->setValue(value, len);
 }
 
 //_______________________________________________________________________________
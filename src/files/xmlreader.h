@@ -13,28 +13,88 @@
 #ifndef __xmlreader__
 #define __xmlreader__
 
-#include <stack>
+#include <limits.h>
+#include <map>
+#include <set>
 #include <stdio.h>
+#include <string>
+#include <vector>
 #include "exports.h"
 #include "xmlfile.h"
 #include "reader.h"
 
+class xmlparser;
+
 namespace MusicXML2 
 {
 
 //______________________________________________________________________________
+/*!
+\brief Builds a MusicXML tree from a file, a stream or a string.
+
+	Parsing is reentrant: distinct xmlreader instances can be used concurrently
+	from different threads. A given instance must not be shared between threads.
+	When useArena is set, the elements and attributes of each document are allocated
+	from an arena owned by the TXMLFile (see arena).
+	Parts and measures can be filtered out while reading: the content of the skipped
+	elements is scanned but not built. The attributes elements of the measures skipped
+	before the selected range are moved to the first selected measure of the part
+	(to the part of the first selected measure in score-timewise files),
+	so that divisions, clefs, keys etc. remain defined. The part-list is left unchanged.
+*/
 class EXP xmlreader : public reader
 { 
-	std::stack<Sxmlelement>	fStack;
+	std::vector<Sxmlelement>	fStack;
 	SXMLFile				fFile;
+	const xmlparser*		fParser;		// the current parser, used to get the input line numbers
+	bool					fUseArena;		// allocates the elements from an arena owned by the file
+
+	// parts and measures filtering
+	std::set<std::string>	fParts;			// the parts to skip, or to keep when fKeepParts is set
+	bool					fKeepParts;
+	int						fFirstMeasure, fLastMeasure;	// the measures to keep
+	bool					fFiltering;		// true when a filter is set
+	bool					fInRange;		// true when the current measure is kept
+	bool					fBefore;		// true when the current measure comes before the range
+	Sxmlelement				fSkipped;		// a skipped measure, or part of a timewise measure, scanned for its attributes
+	Sxmlelement				fSkippedMeasure;	// a skipped timewise measure, scanned for its parts
+	std::string				fPart;			// the id of the current part
+	std::map<std::string, std::vector<Sxmlelement> >	fAttributes;	// the attributes of the skipped measures, by part id
+
+	void	reset ();
+	int		lineno () const;
+	void	drop ();
+	bool	skipPart (const Sxmlelement& part) const;
+	bool	skipMeasure (const Sxmlelement& measure);
+	void	carry (const Sxmlelement& elt);
+	void	filtering ();
 
 	public:
-				 xmlreader() {}
+				 xmlreader() : fParser(0), fUseArena(false), fKeepParts(false),
+					fFirstMeasure(INT_MIN), fLastMeasure(INT_MAX), fFiltering(false), fInRange(true), fBefore(false) {}
 		virtual ~xmlreader() {}
 		
+		//! reads a null terminated buffer, UTF-16 data must start with a byte order mark
+		//! and end with two null bytes: use the sized variant for a std::string
 		SXMLFile readbuff(const char* file);
+		//! reads size bytes of a buffer, e.g. UTF-16 data that contain null bytes
+		SXMLFile readbuff(const char* buffer, size_t size);
 		SXMLFile read(const char* file);
 		SXMLFile read(FILE* file);
+		//! reads a file using a memory mapping, with a fallback to read() when the file can't be mapped
+		SXMLFile mapRead(const char* file);
+
+		//! allocates the next documents from an arena (false by default)
+		void	useArena (bool state)		{ fUseArena = state; }
+
+		//! the parts with these ids are skipped by the next reads
+		void	skipParts (const std::set<std::string>& ids)	{ fParts = ids; fKeepParts = false; filtering(); }
+		//! only the parts with these ids are read by the next reads, an empty set reads all the parts
+		void	keepParts (const std::set<std::string>& ids)	{ fParts = ids; fKeepParts = true; filtering(); }
+		//! only the measures numbered from first to last are read by the next reads
+		void	keepMeasures (int first, int last)				{ fFirstMeasure = first; fLastMeasure = last; filtering(); }
+		//! removes the parts and measures filters
+		void	clearFilters ()		{ fParts.clear(); fFirstMeasure = INT_MIN; fLastMeasure = INT_MAX; filtering(); }
 
 		bool	xmlDecl (const char* version, const char *encoding, int standalone);
 		bool	docType (const char* start, bool status, const char *pub, const char *sys);
@@ -46,6 +106,14 @@ class EXP xmlreader : public reader
 		void	setValue (const char* value);
 		bool	endElement (const char* eltName);
 		void	error (const char* s, int lineno);
+
+		void	newComment (const char* comment, size_t len);
+		void	newProcessingInstruction (const char* pi, size_t len);
+		bool	newElement (const char* eltName, size_t len);
+		bool	newAttribute (const char* eltName, size_t len, const char *val, size_t vlen);
+		void	setValue (const char* value, size_t len);
+		bool	endElement (const char* eltName, size_t len);
+		bool	skipElement ();
 };
 
 }
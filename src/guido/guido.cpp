@@ -40,13 +40,22 @@ Sguidotag guidotag::create(string name)	{ guidotag* o = new guidotag(name); asse
 Sguidotag guidotag::create(string name, string sep)	{ guidotag* o = new guidotag(name, sep); assert(o!=0); return o;}
 
 //______________________________________________________________________________
-guidonotestatus* guidonotestatus::fInstances[kMaxInstances] = { 0 };
+// the status instances are allocated per thread: concurrent conversions don't share them
+namespace {
+struct statustable {
+	guidonotestatus * fInstances[guidonotestatus::kMaxInstances];
+	 statustable()	{ for (int i=0; i<guidonotestatus::kMaxInstances; i++) fInstances[i] = 0; }
+	~statustable()	{ for (int i=0; i<guidonotestatus::kMaxInstances; i++) delete fInstances[i]; }
+};
+}
+static thread_local statustable gStatus;
+
 guidonotestatus* guidonotestatus::get (unsigned short voice)
 { 
     if (voice < kMaxInstances) {
-        if (!fInstances[voice])
-            fInstances[voice] = new guidonotestatus; 
-        return fInstances[voice];
+        if (!gStatus.fInstances[voice])
+            gStatus.fInstances[voice] = new guidonotestatus; 
+        return gStatus.fInstances[voice];
     }
     return 0;
 }
@@ -54,15 +63,15 @@ guidonotestatus* guidonotestatus::get (unsigned short voice)
 void guidonotestatus::resetall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        if (fInstances[i]) fInstances[i]->reset();
+        if (gStatus.fInstances[i]) gStatus.fInstances[i]->reset();
     }
 }
 
 void guidonotestatus::freeall ()
 { 
     for (int i=0; i<kMaxInstances; i++) {
-        delete fInstances[i];
-		fInstances[i] = 0;
+        delete gStatus.fInstances[i];
+		gStatus.fInstances[i] = 0;
     }
 }
 
@@ -148,20 +157,34 @@ void guidochord::print(ostream& os) const
 //______________________________________________________________________________
 void guidoelement::print(ostream& os) const
 {
-    os << fName;
-	printparams (os);
-	
     // print the enclosed elements
     if (!fElements.empty()) {
-        os << fStartList;
-		string sep = " ";
-		for (auto e: fElements) {
-			os << sep << e;
-		}
-		os << fEndList << endl;
+		printStart (os);
+		printEnd (os);
+	}
+	else {
+		os << fName;
+		printparams (os);
 	}
 }
 
+//______________________________________________________________________________
+void guidoelement::printStart(ostream& os) const
+{
+    os << fName;
+	printparams (os);
+	os << fStartList;
+	string sep = " ";
+	for (auto e: fElements) {
+		os << sep << e;
+	}
+}
+
+void guidoelement::printEnd(ostream& os) const
+{
+	os << fEndList << endl;
+}
+
 //______________________________________________________________________________
 ostream& operator<< (ostream& os, const Sguidoelement& elt)
 {
@@ -77,6 +77,10 @@ class EXP guidoelement : public smartable {
 		long add (Sguidoparam& param);
 		long add (Sguidoparam param);
 		virtual void print (std::ostream& os) const;
+		//! prints the element name, parameters and enclosed elements, but not the end marker
+		void printStart (std::ostream& os) const;
+		//! prints the enclosed elements end marker, used to terminate printStart
+		void printEnd (std::ostream& os) const;
 
 		//! the element name
 		void 	setName (std::string name)			{ fName = name; }
@@ -190,9 +194,9 @@ typedef SMARTP<guidonote> Sguidonote;
     sequence or chord, or assumed to have standard values.
 \n
 	The object is defined as a multi-voices singleton: a single
-    object is allocated for a specific voice and thus it will
-	not operate correctly on a same voice parrallel formatting 
-    operations.
+    object is allocated for a specific voice and a specific thread,
+	thus it will not operate correctly on a same voice parrallel
+    formatting operations within a thread.
 
 \todo handling the current beat value for \e *num duration form.
 */
@@ -216,8 +220,6 @@ class EXP guidonotestatus {
 
 	protected:
 		guidonotestatus() :	fOctave(defoctave), fDur(defnum, defdenom, 0) {}
-	private:
-		static guidonotestatus * fInstances[kMaxInstances];
 };
 
 /*!
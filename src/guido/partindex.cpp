@@ -0,0 +1,209 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include "elements.h"
+#include "partindex.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//________________________________________________________________________
+void partindex::visitStart ( S_part& elt)
+{
+	partsummary::visitStart (elt);
+	fPart = elt;
+	fNotes.clear();
+	fDirections.clear();
+	fBuckets.clear();
+}
+
+//________________________________________________________________________
+void partindex::visitEnd ( S_part& elt)
+{
+	dispatch();
+}
+
+//________________________________________________________________________
+void partindex::init (const scoreindex& index, size_t part)
+{
+	partsummary::init (index, part);
+	fPart = 0;
+	fNotes.clear();
+	fDirections.clear();
+	fBuckets.clear();
+	if (part >= index.parts().size()) return;
+
+	fPart = index.parts()[part].fElement;
+	const scoreindex::range& notes = index.parts()[part].fNotes;
+	fNotes.reserve (notes.fCount);
+	for (size_t i = notes.fFirst; i < notes.end(); i++)
+		add (index.notes()[i].fElement, index.notes()[i].fVoice);
+	dispatch();
+}
+
+//________________________________________________________________________
+void partindex::visitEnd ( S_note& elt)
+{
+	partsummary::visitEnd (elt);
+	add (elt, notevisitor::getVoice());
+}
+
+//________________________________________________________________________
+void partindex::add (xmlelement* note, int voice)
+{
+	noteentry entry;
+	entry.fNote = note;
+	entry.fVoice = voice;
+	for (ctree<xmlelement>::iterator i = note->begin(); i != note->end(); i++) {
+		switch ((*i)->getType()) {
+			case k_chord:
+			case k_grace:
+			case k_duration:
+			case k_voice:
+			case k_dynamics:
+				entry.fTiming.push_back (*i);
+				break;
+		}
+	}
+	fNotes.push_back (entry);
+}
+
+//________________________________________________________________________
+void partindex::add (xmlelement* direction)
+{
+	directionentry entry;
+	entry.fDirection = direction;
+	entry.fStaff = direction->getIntValue(k_staff, 0);
+	for (ctree<xmlelement>::iterator i = direction->begin(); i != direction->end(); i++) {
+		if ((*i)->getType() == k_sound)
+			entry.fSounds.push_back (*i);
+	}
+	fDirections.push_back (entry);
+}
+
+//________________________________________________________________________
+// distributes the part events to the voices buckets, in a single pass over the measures
+void partindex::dispatch ()
+{
+	fBuckets.clear();
+	if (!fPart) return;
+
+	smartlist<int>::ptr voices = getVoices();
+	size_t count = voices->size();
+	vector<int> staves (count);
+	vector<bucket*> buckets (count);
+	for (size_t v = 0; v < count; v++) {
+		staves[v] = getMainStaff ((*voices)[v]);
+		buckets[v] = &fBuckets[(*voices)[v]];
+	}
+
+	event e;
+	e.fEntry = 0;
+	size_t note = 0;
+	e.fElement = fPart; e.fKind = kEnter;
+	for (size_t v = 0; v < count; v++) buckets[v]->push_back (e);
+	for (ctree<xmlelement>::literator m = fPart->lbegin(); m != fPart->lend(); m++) {
+		e.fElement = *m; e.fKind = ((*m)->getType() == k_measure) ? kEnter : kBrowse;
+		for (size_t v = 0; v < count; v++) buckets[v]->push_back (e);
+		if (e.fKind == kBrowse) continue;
+
+		for (ctree<xmlelement>::literator i = (*m)->lbegin(); i != (*m)->lend(); i++) {
+			e.fElement = *i;
+			int type = (*i)->getType();
+			if ((type == k_note) && (note < fNotes.size()) && (fNotes[note].fNote == *i)) {
+				e.fEntry = note++;
+				int voice = fNotes[e.fEntry].fVoice;
+				for (size_t v = 0; v < count; v++) {
+					e.fKind = ((*voices)[v] == voice) ? kBrowse : kNote;
+					buckets[v]->push_back (e);
+				}
+			}
+			else if (type == k_direction) {
+				add (*i);
+				e.fEntry = fDirections.size() - 1;
+				e.fKind = kDirection;
+				const directionentry& entry = fDirections.back();
+				for (size_t v = 0; v < count; v++) {
+					// the directions of the other staves are only visited for their sounds
+					if ((entry.fStaff == staves[v]) || entry.fSounds.size())
+						buckets[v]->push_back (e);
+				}
+			}
+			else {
+				e.fKind = kBrowse;
+				for (size_t v = 0; v < count; v++) buckets[v]->push_back (e);
+			}
+		}
+		e.fElement = *m; e.fKind = kLeave;
+		for (size_t v = 0; v < count; v++) buckets[v]->push_back (e);
+	}
+	e.fElement = fPart; e.fKind = kLeave;
+	for (size_t v = 0; v < count; v++) buckets[v]->push_back (e);
+}
+
+//________________________________________________________________________
+const partindex::bucket& partindex::getBucket (int voice) const
+{
+	static const bucket empty;
+	map<int, bucket>::const_iterator i = fBuckets.find (voice);
+	return (i == fBuckets.end()) ? empty : i->second;
+}
+
+//________________________________________________________________________
+void voice_browser::browse (int voice, int staff, bool notesonly)
+{
+	const partindex::bucket& events = fIndex.getBucket (voice);
+	for (partindex::bucket::const_iterator e = events.begin(); e != events.end(); e++) {
+		switch (e->fKind) {
+			case partindex::kEnter:
+				enter (*e->fElement);
+				break;
+			case partindex::kLeave:
+				leave (*e->fElement);
+				break;
+			case partindex::kBrowse:
+				tree_browser<xmlelement>::browse (*e->fElement);
+				break;
+			case partindex::kNote: {
+					const vector<xmlelement*>& timing = fIndex.getNotes()[e->fEntry].fTiming;
+					enter (*e->fElement);
+					for (vector<xmlelement*>::const_iterator i = timing.begin(); i != timing.end(); i++) {
+						enter (**i);
+						leave (**i);
+					}
+					leave (*e->fElement);
+				}
+				break;
+			case partindex::kDirection: {
+					const partindex::directionentry& entry = fIndex.getDirections()[e->fEntry];
+					if (!notesonly && (entry.fStaff == staff)) {
+						tree_browser<xmlelement>::browse (*e->fElement);
+					}
+					else if (entry.fSounds.size()) {
+						enter (*e->fElement);
+						for (vector<xmlelement*>::const_iterator i = entry.fSounds.begin(); i != entry.fSounds.end(); i++)
+							tree_browser<xmlelement>::browse (**i);
+						leave (*e->fElement);
+					}
+				}
+				break;
+		}
+	}
+}
+
+}
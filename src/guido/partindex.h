@@ -0,0 +1,137 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __partindex__
+#define __partindex__
+
+#include <map>
+#include <vector>
+
+#include "exports.h"
+#include "partsummary.h"
+#include "tree_browser.h"
+#include "xml.h"
+
+namespace MusicXML2
+{
+
+/*!
+\ingroup visitors guido
+@{
+*/
+
+/*!
+\brief A part summary that also indexes the part events by voice.
+
+	The index is built in the same traversal than the summary, or it is read
+	from a score index. For each note,
+	it keeps the voice and the few sub elements that still matter when the
+	note is seen from another voice: the elements that make the time move
+	(chord, grace, duration, voice) and the dynamics, that xmlpart2guido
+	collects whatever the note voice. For each direction, it keeps the staff
+	and the sound elements, that xmlpart2guido handles whatever the direction
+	staff.
+
+	At the end of the part, the events of the measures are dispatched to one
+	bucket per voice, in document order (see getBucket).
+*/
+//______________________________________________________________________________
+class EXP partindex : public partsummary
+{
+	public:
+		struct noteentry {
+			xmlelement*					fNote;		// the note element
+			int							fVoice;		// the note voice
+			std::vector<xmlelement*>	fTiming;	// the sub elements visited from the other voices
+		};
+		typedef std::vector<noteentry>	notes;
+
+		struct directionentry {
+			xmlelement*					fDirection;	// the direction element
+			int							fStaff;		// the direction staff, 0 when not specified
+			std::vector<xmlelement*>	fSounds;	// the sub elements visited from the other staves
+		};
+		typedef std::vector<directionentry>	directions;
+
+		enum { kEnter, kLeave, kBrowse, kNote, kDirection };
+		struct event {
+			xmlelement*	fElement;
+			int			fKind;		// what to do with the element (see voice_browser)
+			size_t		fEntry;		// the note or direction entry for kNote and kDirection
+		};
+		typedef std::vector<event>	bucket;
+
+				 partindex() : fPart(0) {}
+		virtual ~partindex() {}
+
+		//! initializes the summary and the index from a score index
+		virtual void init (const scoreindex& index, size_t part);
+
+		//! returns the part notes in document order
+		const notes& getNotes () const				{ return fNotes; }
+		//! returns the part directions in document order
+		const directions& getDirections () const	{ return fDirections; }
+
+		//! returns the events of a voice:
+		//! the notes of the voice and the elements that are not notes nor directions are browsed,
+		//! the notes of the other voices are reduced to their entry, and so are the directions.
+		//! The directions that are not on the voice main staff and that have no sound are left out.
+		const bucket& getBucket (int voice) const;
+
+	protected:
+		virtual void visitStart ( S_part& elt);
+		virtual void visitEnd   ( S_part& elt);
+		virtual void visitEnd   ( S_note& elt);
+
+	private:
+		xmlelement*				fPart;
+		notes					fNotes;
+		directions				fDirections;
+		std::map<int, bucket>	fBuckets;
+
+		void	add			(xmlelement* note, int voice);
+		void	add			(xmlelement* direction);
+		void	dispatch	();
+};
+
+/*!
+\brief A browser that visits a single voice of a part, from its partindex bucket.
+
+	The notes of the target voice are browsed as usual, the notes of the other
+	voices are reduced to their index entry (see partindex): the visitor sees
+	the note and its timing elements only. The directions are browsed when
+	they are on the target staff, unless the browse is for notes only: the
+	visitor sees the sound elements of the other directions only.
+	The output of the visit is the same than with a full browse of the part,
+	provided the visitor ignores the notes of the other voices and the
+	directions of the other staves, which is the case of xmlpart2guido.
+*/
+//______________________________________________________________________________
+class EXP voice_browser : public tree_browser<xmlelement>
+{
+	const partindex&	fIndex;
+
+	public:
+				 voice_browser(basevisitor* v, const partindex& index)
+					: tree_browser<xmlelement>(v), fIndex(index) {}
+		virtual ~voice_browser() {}
+
+		using tree_browser<xmlelement>::browse;
+		//! browses the bucket of a voice, staff is the target staff
+		virtual void browse (int voice, int staff, bool notesonly);
+};
+
+/*! @} */
+
+}
+
+#endif
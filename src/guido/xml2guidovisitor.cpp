@@ -14,11 +14,13 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
 
-#include "partsummary.h"
+#include "parallel.h"
+#include "partindex.h"
 #include "rational.h"
 #include "xml_tree_browser.h"
 #include "xml2guidovisitor.h"
@@ -34,9 +36,8 @@ namespace MusicXML2
     xml2guidovisitor::xml2guidovisitor(bool generateComments, bool generateStem, bool generateBar, int partNum) :
     fGenerateComments(generateComments), fGenerateStem(generateStem),
     fGenerateBars(generateBar), fGeneratePositions(true),
-    fCurrentStaffIndex(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum), defaultStaffDistance(0), defaultGuidoStaffDistance(1)
+    fCurrentStaffIndex(0), fThreads(1), fOut(0), fStreamedVoices(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum), defaultStaffDistance(0), defaultGuidoStaffDistance(1)
     {
-        timePositions.clear();
     }
     
     //______________________________________________________________________________
@@ -44,13 +45,50 @@ namespace MusicXML2
     {
         Sguidoelement gmn;
         if (xml) {
-            tree_browser<xmlelement> browser(this);
-            browser.browse(*xml);
+            browseScore(xml);
+            convertParts();
             gmn = current();
         }
         return gmn;
     }
     
+    //______________________________________________________________________________
+    void xml2guidovisitor::convert (const Sxmlelement& xml, ostream& out)
+    {
+        if (xml) {
+            fOut = &out;
+            fStreamedVoices = 0;
+            browseScore(xml);
+            convertParts();
+            if (fStack.size()) out << current()->getEnd();
+            fOut = 0;
+        }
+    }
+    
+    //______________________________________________________________________________
+    // collects the header elements and the parts to convert
+    // when the score is indexed, the part-list is taken from the index and the content of the parts is not browsed:
+    // the parts are converted afterwards (see convertParts)
+    void xml2guidovisitor::browseScore (const Sxmlelement& xml)
+    {
+        tree_browser<xmlelement> browser(this);
+        if (!fScoreIndex || (fScoreIndex->getScore() != xml)) {
+            browser.browse(*xml);
+            return;
+        }
+        xml->acceptIn (*this);
+        for (ctree<xmlelement>::literator i = xml->lbegin(); i != xml->lend(); i++) {
+            if ((*i)->getType() == k_part) {
+                (*i)->acceptIn (*this);
+                (*i)->acceptOut (*this);
+            }
+            else if ((*i)->getType() == k_part_list)
+                partlistvisitor::init(*fScoreIndex);
+            else browser.browse(**i);
+        }
+        xml->acceptOut (*this);
+    }
+    
     //______________________________________________________________________________
     // the score header contains information like title, author etc..
     // it must be written only once, at the beginning of the first guido voice
@@ -164,6 +202,7 @@ namespace MusicXML2
     {
         Sguidoelement chord = guidochord ::create();
         start(chord);
+        if (fOut) *fOut << chord->getStart();	// the score voices are streamed (see flushPart)
     }
     
     void xml2guidovisitor::visitStart( S_defaults& elt)
@@ -202,36 +241,128 @@ namespace MusicXML2
                 return;
             }
         }
+        fParts.push_back (elt);		// parts are converted at the end of the score browse (see convertParts)
+    }
+    
+    //______________________________________________________________________________
+    // parts don't share any conversion state apart the guido staff indexes
+    // and the header elements: the parts are indexed and converted concurrently,
+    // staff indexes are computed and the results are stitched in score order
+    //______________________________________________________________________________
+    void xml2guidovisitor::convertParts ()
+    {
+        if (fThreads <= 1) {
+            // converts the parts one by one: only one part conversion is kept in memory
+            for (size_t i = 0; i < fParts.size(); i++) {
+                partjob job;
+                job.fPart = fParts[i];
+                indexPart (job);
+                planVoices (job);
+                convertVoices (job);
+                flushPart (job);
+            }
+            fParts.clear();
+            return;
+        }
         
-        partsummary ps;
-        xml_tree_browser browser(&ps);
-        browser.browse(*elt);
+        vector<partjob> jobs (fParts.size());
+        for (size_t i = 0; i < jobs.size(); i++)
+            jobs[i].fPart = fParts[i];
+        fParts.clear();
         
-        smartlist<int>::ptr voices = ps.getVoices ();
+        parallel (jobs.size(), fThreads, [this, &jobs] (size_t i) { indexPart (jobs[i]); });
+        for (size_t i = 0; i < jobs.size(); i++)
+            planVoices (jobs[i]);
+        parallel (jobs.size(), fThreads, [this, &jobs] (size_t i) { convertVoices (jobs[i]); });
+        for (size_t i = 0; i < jobs.size(); i++)
+            flushPart (jobs[i]);
+    }
+    
+    //______________________________________________________________________________
+    void xml2guidovisitor::indexPart ( partjob& job ) const
+    {
+        if (fScoreIndex) {
+            size_t part = fScoreIndex->find (job.fPart);
+            if (part < fScoreIndex->parts().size()) {
+                job.fIndex.init (*fScoreIndex, part);
+                return;
+            }
+        }
+        xml_tree_browser browser(&job.fIndex);
+        browser.browse(*job.fPart);
+    }
+    
+    //______________________________________________________________________________
+    void xml2guidovisitor::planVoices ( partjob& job )
+    {
+        smartlist<int>::ptr voices = job.fIndex.getVoices ();
         int targetStaff = 0xffff;	// initialized to a value we'll unlikely encounter
-        bool notesOnly = false;
-        rational currentTimeSign (0,1);
-        
-        staffClefMap.clear();
-        //timePositions.clear();
         
         // browse the parts voice by voice: allows to describe voices that spans over several staves
         for (unsigned int i = 0; i < voices->size(); i++) {
-            int targetVoice = (*voices)[i];
-            int mainstaff = ps.getMainStaff(targetVoice);
+            partvoice v;
+            v.fVoice = (*voices)[i];
+            int mainstaff = job.fIndex.getMainStaff(v.fVoice);
             if (targetStaff == mainstaff) {
-                notesOnly = true;
+                v.fNotesOnly = true;
             }
             else {
-                notesOnly = false;
+                v.fNotesOnly = false;
                 targetStaff = mainstaff;
                 fCurrentStaffIndex++;
-                /// Clear timePositions so that we only track voices on a specific Staff
-                timePositions.clear();
             }
+            v.fStaff = targetStaff;
+            v.fStaffIndex = fCurrentStaffIndex;
+            v.fHasLyrics = false;
+            job.fVoices.push_back (v);
+        }
+    }
+    
+    //______________________________________________________________________________
+    void xml2guidovisitor::convertVoices ( partjob& job ) const
+    {
+        rational currentTimeSign (0,1);
+        /// multimap containing <staff-num, measureNum, position, clef type>
+        std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
+        /// Containing default-x positions on a fCurrentVoicePosition (rational) of measure(int)
+        std::map< int, std::map< rational, std::vector<int> > > timePositions;
+        
+        // each voice is browsed from its bucket: the notes of the other voices are reduced
+        // to their timing elements and the directions of the other staves to their sounds (see partindex)
+        for (vector<partvoice>::iterator v = job.fVoices.begin(); v != job.fVoices.end(); v++) {
+            /// Clear timePositions so that we only track voices on a specific Staff
+            if (!v->fNotesOnly) timePositions.clear();
+            
+            v->fContent = guidoseq::create();
+            stringstream text;
+            xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
+            pv.generatePositions (fGeneratePositions);
+            if (fOut) pv.streamTo (&text);
+            voice_browser browser(&pv, job.fIndex);
+            pv.initialize(v->fContent, v->fStaff, v->fStaffIndex, v->fVoice, v->fNotesOnly, currentTimeSign);
+            pv.staffClefMap = staffClefMap;
+            pv.timePositions = timePositions;
+            browser.browse(v->fVoice, v->fStaff, v->fNotesOnly);
+            currentTimeSign = pv.getTimeSign();
+            v->fHasLyrics = pv.hasLyrics();
+            staffClefMap = pv.staffClefMap;
+            timePositions = pv.timePositions;
+            v->fText = text.str();
+        }
+    }
+    
+    //______________________________________________________________________________
+    void xml2guidovisitor::flushPart ( partjob& job )
+    {
+        Sxmlelement elt = job.fPart;
+        partindex& ps = job.fIndex;
+        for (vector<partvoice>::iterator v = job.fVoices.begin(); v != job.fVoices.end(); v++) {
+            int targetStaff = v->fStaff;
+            fCurrentStaffIndex = v->fStaffIndex;
             
             Sguidoelement seq = guidoseq::create();
-            push (seq);
+            if (fOut) start (seq);		// streamed: the sequence is not kept in the score
+            else push (seq);
             
             Sguidoelement tag = guidotag::create("staff");
             tag->add (guidoparam::create(fCurrentStaffIndex, false));
@@ -313,19 +444,33 @@ namespace MusicXML2
             
             ////
             
-            //// Browse XML and convert
-            xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
-            pv.generatePositions (fGeneratePositions);
-            xml_tree_browser browser(&pv);
-            pv.initialize(seq, targetStaff, fCurrentStaffIndex, targetVoice, notesOnly, currentTimeSign);
-            pv.staffClefMap = staffClefMap;
-            pv.timePositions = timePositions;
-            browser.browse(*elt);
+            //// Append the voice content, converted by xmlpart2guido
+            const vector<Sguidoparam>& params = v->fContent->parameters();
+            for (vector<Sguidoparam>::const_iterator i = params.begin(); i != params.end(); i++)
+                seq->add (*i);
+            if (fOut) {
+                // the score is a chord of sequences, see guidochord::print for the separators
+                ostream& out = *fOut;
+                if (fStreamedVoices++) out << ", \n";
+                seq->printStart (out);
+                out << v->fText;
+                const vector<Sguidoelement>& content = v->fContent->elements();
+                for (vector<Sguidoelement>::const_iterator i = content.begin(); i != content.end(); i++)
+                    out << " " << *i;
+                seq->printEnd (out);
+                out << " ";
+            }
+            else {
+                const vector<Sguidoelement>& content = v->fContent->elements();
+                for (vector<Sguidoelement>::const_iterator i = content.begin(); i != content.end(); i++) {
+                    Sguidoelement e = *i;
+                    seq->add (e);
+                }
+            }
+            v->fContent = (void*)0;
+            v->fText.clear();
             pop();
-            currentTimeSign = pv.getTimeSign();
-            previousStaffHasLyrics = pv.hasLyrics();
-            staffClefMap = pv.staffClefMap;
-            timePositions = pv.timePositions;
+            previousStaffHasLyrics = v->fHasLyrics;
         }
     }
     
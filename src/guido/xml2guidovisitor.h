@@ -17,6 +17,7 @@
 #include <stack>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "exports.h"
 #include "guido.h"
@@ -26,7 +27,9 @@
 #include "rational.h"
 
 
+#include "partindex.h"
 #include "partlistvisitor.h"
+#include "scoreindex.h"
 
 
 namespace MusicXML2 
@@ -70,12 +73,40 @@ class EXP xml2guidovisitor :
 	//partHeaderMap	fPartHeaders;	// musicxml score-part elements (should be flushed at the beginning of each part)
 	std::string		fCurrentPartID;
 	int				fCurrentStaffIndex;		// the index of the current guido staff
+	int				fThreads;				// the number of threads used to convert the parts
+	std::ostream*	fOut;					// the streaming output (see convert)
+	int				fStreamedVoices;		// the count of voices written to the streaming output
+	Sscoreindex		fScoreIndex;			// the score structure, when known (see setIndex)
+
+	// a part voice: the voice content is converted independently of the other parts
+	struct partvoice {
+		int				fVoice;			// the target voice
+		int				fStaff;			// the voice main staff
+		int				fStaffIndex;	// the corresponding guido staff index
+		bool			fNotesOnly;		// true when the staff is already described by a previous voice
+		bool			fHasLyrics;
+		Sguidoelement	fContent;		// the sequence produced by xmlpart2guido
+		std::string		fText;			// the streamed part of the sequence
+	};
+	struct partjob {
+		Sxmlelement				fPart;
+		partindex				fIndex;
+		std::vector<partvoice>	fVoices;
+	};
+	std::vector<Sxmlelement>	fParts;		// the parts to convert, collected while browsing the score
 
 	void start (Sguidoelement& elt)		{ fStack.push(elt); }
 	void add (Sguidoelement& elt)		{ if (fStack.size()) fStack.top()->add(elt); }
 	void push (Sguidoelement& elt)		{ add(elt); fStack.push(elt); }
 	void pop ()							{ fStack.pop(); }
 
+	void browseScore	(const Sxmlelement& xml);
+	void convertParts	();
+	void indexPart		( partjob& job ) const;
+	void planVoices		( partjob& job );
+	void convertVoices	( partjob& job ) const;
+	void flushPart		( partjob& job );
+
 	void flushHeader	 ( scoreHeader& header );
 	void flushPartHeader ( partHeader& header );
     void flushPartGroup (std::string partID);
@@ -99,13 +130,6 @@ class EXP xml2guidovisitor :
     
     int defaultStaffDistance;   // xml staff-distance value in defaults
     int defaultGuidoStaffDistance;  // the above converted to Guido value
-    
-    /// multimap containing <staff-num, measureNum, position, clef type>
-    //std::multimap<int, std::pair< rational, string > > staffClefMap;
-    std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
-
-    /// Containing default-x positions on a fCurrentVoicePosition (rational) of measure(int)
-    std::map< int, std::map< rational, std::vector<int> > > timePositions;
 
 
     public:
@@ -113,10 +137,19 @@ class EXP xml2guidovisitor :
 		virtual ~xml2guidovisitor() {}
 
 		Sguidoelement convert (const Sxmlelement& xml);
+		// streaming conversion: writes the same guido code than printing the result of
+		// convert(xml), but without building the guido representation of the whole score
+		void convert (const Sxmlelement& xml, std::ostream& out);
 
 		// this is to control exact positionning of elements when information is present
 		// ie converts relative-x/-y into dx/dy attributes
 		void generatePositions (bool state)		{ fGeneratePositions = state; }
+		// the parts are converted concurrently when count is greater than 1
+		// the output is the same whatever the number of threads
+		void setThreads (int count)				{ fThreads = count; }
+		// the parts are summarized from the score index instead of being browsed
+		// the index must be the index of the converted score (see TXMLFile::getIndex)
+		void setIndex (const Sscoreindex& index)	{ fScoreIndex = index; }
 
     static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset);
 	static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset, int xoffset);
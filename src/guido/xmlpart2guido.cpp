@@ -34,7 +34,7 @@ namespace MusicXML2
     fGenerateComments(generateComments), //fGenerateStem(generateStem),
     fGenerateBars(generateBar),
     fNotesOnly(false), fCurrentStaffIndex(0), fCurrentStaff(0),
-    fTargetStaff(0), fTargetVoice(0)
+    fTargetStaff(0), fTargetVoice(0), fOut(0)
     {
         fGeneratePositions = true;
         fGenerateAutoMeasureNum = true;
@@ -86,6 +86,17 @@ namespace MusicXML2
         start (seq);
     }
     
+    //________________________________________________________________________
+    // writes the elements of the sequence to the streaming output
+    // the sequence is the single element of the stack: its elements are complete
+    void xmlpart2guido::stream ()
+    {
+        vector<Sguidoelement>& elts = fStack.top()->elements();
+        for (vector<Sguidoelement>::const_iterator i = elts.begin(); i != elts.end(); i++)
+            *fOut << " " << *i;
+        elts.clear();
+    }
+    
     //________________________________________________________________________
     // some code for the delayed elements management
     // delayed elements are elements enclosed in a <direction> element that
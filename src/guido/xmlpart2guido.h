@@ -117,12 +117,17 @@ class EXP xmlpart2guido :
 	int		fCurrentStemDirection;	// the current stems direction, used for stem direction changes
 	int		fPendingPops;			// elements to be popped at chord exit (like fermata, articulations...)
 
+	std::ostream*	fOut;			// the streaming output (see streamTo)
+
 	void start (Sguidoelement& elt)		{ fStack.push(elt); }
-	void add  (Sguidoelement& elt)		{ if (fStack.size()) fStack.top()->add(elt); }
+	void add  (Sguidoelement& elt)		{ if (fStack.size()) fStack.top()->add(elt); flush(); }
 	void addDelayed (Sguidoelement elt, long offset);	// adding elements to the delayed elements
 	void checkDelayed (long time);						// checks the delayed elements for ready elements 
-	void push (Sguidoelement& elt)		{ add(elt); fStack.push(elt); }
-	void pop ()							{ fStack.pop(); }
+	void push (Sguidoelement& elt)		{ if (fStack.size()) fStack.top()->add(elt); fStack.push(elt); }
+	void pop ()							{ fStack.pop(); flush(); }
+	// when streaming, writes and drops the elements of the sequence once no element is open
+	void flush ()						{ if (fOut && (fStack.size() == 1)) stream(); }
+	void stream ();
 
 	void moveMeasureTime (int duration, bool moveVoiceToo=false, int x_default = 0);
 	void reset ();
@@ -222,6 +227,10 @@ class EXP xmlpart2guido :
 		Sguidoelement& current ()					{ return fStack.top(); }
 		void	initialize (Sguidoelement seq, int staff, int guidostaff, int voice, bool notesonly, rational defaultTimeSign);
 		void	generatePositions (bool state)		{ fGeneratePositions = state; }
+		// streaming mode: the elements of the sequence given to initialize are written to 'out'
+		// as soon as they are complete, instead of being kept in the sequence.
+		// elements still open at the end of the conversion remain in the sequence.
+		void	streamTo (std::ostream* out)		{ fOut = out; }
 		const rational& getTimeSign () const		{ return fCurrentTimeSign; }
         bool fHasLyrics;
         bool hasLyrics() const {return fHasLyrics;}
@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <stdio.h>
 
 #include "exports.h"
@@ -92,6 +93,18 @@ EXP const char*   musicxml2lilypondVersionStr();
 */
 EXP xmlErr      musicxmlfile2guido  (const char *file, bool generateBars, std::ostream& out);
 
+/*!
+  \brief Converts a MusicXML representation to the Guido format using several threads.
+  
+  The parts are converted concurrently, the output is the same whatever the number of threads.
+  \param file a file name 
+  \param generateBars a boolean to force barlines generation
+  \param threads the number of threads (1 to convert on the calling thread only)
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlfile2guidoThreaded (const char *file, bool generateBars, int threads, std::ostream& out);
+
 /*!
   \brief Converts a MusicXML representation to the Guido format.
   \param fd a file descriptor 
@@ -103,13 +116,24 @@ EXP xmlErr      musicxmlfd2guido  (FILE* fd, bool generateBars, std::ostream& ou
 
 /*!
   \brief Converts a MusicXML representation to the Guido format.
-  \param buff a string containing MusicXML code
+  \param buff a string containing MusicXML code, UTF-16 code must start with a byte order mark
+  and end with two null bytes (use the buffer variant e.g. for a std::string)
   \param generateBars a boolean to force barlines generation
   \param out the output stream
   \return an error code (\c kNoErr when success)
 */
 EXP xmlErr      musicxmlstring2guido(const char *buff, bool generateBars, std::ostream& out);
 
+/*!
+  \brief Converts a MusicXML representation to the Guido format.
+  \param buff a buffer containing MusicXML code, that may contain null bytes (e.g. UTF-16)
+  \param size the buffer size in bytes
+  \param generateBars a boolean to force barlines generation
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlbuffer2guido(const char *buff, size_t size, bool generateBars, std::ostream& out);
+
 /*!
  \brief Converts a MusicXML representation to the Guido format ONLY on asked Part number ID
  
@@ -122,6 +146,118 @@ EXP xmlErr      musicxmlstring2guido(const char *buff, bool generateBars, std::o
  */
 EXP xmlErr      musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out);
 
+/*!
+ \brief Converts a MusicXML representation to the Guido format ONLY on asked Part number ID
+ \param buff a buffer containing MusicXML code, that may contain null bytes (e.g. UTF-16)
+ \param size the buffer size in bytes
+ \param generateBars a boolean to force barlines generation
+ \param out the output stream
+ \return an error code (\c kNoErr when success)
+ */
+EXP xmlErr      musicxmlbuffer2guidoOnPart(const char * buffer, size_t size, bool generateBars, int partFilter, std::ostream& out);
+
+/*! @} */
+
+
+/*!
+\addtogroup Converting MusicXML to LilyPond format
+
+The library includes a high level API to convert from the MusicXML format to the
+LilyPond format, using the same options than the xml2ly tool.
+The options and the state of the conversions are held by an xml2lyContext:
+conversions can run concurrently on distinct threads, with distinct contexts.
+@{
+*/
+
+//! the converter options, as on the xml2ly command line (e.g. "-q", "--absolute")
+typedef std::vector<std::string> optionsVector;
+
+class xml2lyContextState;
+
+/*!
+  \brief The options and the state of MusicXML to LilyPond conversions.
+
+  The context holds the converter options and what the conversions use and produce:
+  the options groups, the indentation, the passes timing and the warnings and errors
+  input line numbers.
+  A context can be used for successive conversions, by one thread at a time.
+*/
+class EXP xml2lyContext
+{
+	public:
+				 xml2lyContext();
+		virtual ~xml2lyContext();
+
+		/*!
+		  \brief Sets the converter options.
+		  \param options the options, without input source
+		  \return \c kUnsupported when the options are invalid (they are then left unchanged)
+		*/
+		xmlErr	setOptions (const optionsVector& options);
+
+		/*!
+		  \brief Sets the converter options and the input source from an xml2ly command line.
+		  \param argc the arguments count
+		  \param argv the arguments, argv[0] being the tool name
+		  \return \c kUnsupported when the command line is invalid or only asks for information (e.g. -help)
+		*/
+		xmlErr	setCommandLine (int argc, char* argv[]);
+
+		//! the converter options
+		const optionsVector&	getOptions() const;
+		//! the input source given by the command line, '-' for the standard input
+		const std::string&		getInputSourceName() const;
+		//! the output file name set by the options, empty for the output stream
+		std::string				getOutputFileName() const;
+		//! the status xml2ly exits with after the last operation: 0 when success, -1 when it aborts
+		int						getExitStatus() const;
+
+	private:
+		friend class xml2lyConverter;
+		xml2lyContextState*	fState;
+
+				 xml2lyContext(const xml2lyContext&);
+		xml2lyContext& operator= (const xml2lyContext&);
+};
+
+/*!
+  \brief Converts a MusicXML representation to the LilyPond format.
+  \param file a file name 
+  \param context the converter options and state
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlfile2lilypond  (const char *file, xml2lyContext& context, std::ostream& out);
+
+/*!
+  \brief Converts a MusicXML representation to the LilyPond format.
+  \param fd a file descriptor 
+  \param context the converter options and state
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlfd2lilypond  (FILE* fd, xml2lyContext& context, std::ostream& out);
+
+/*!
+  \brief Converts a MusicXML representation to the LilyPond format.
+  \param buff a string containing MusicXML code, UTF-16 code must start with a byte order mark
+  and end with two null bytes (use the buffer variant e.g. for a std::string)
+  \param context the converter options and state
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlstring2lilypond(const char *buff, xml2lyContext& context, std::ostream& out);
+
+/*!
+  \brief Converts a MusicXML representation to the LilyPond format.
+  \param buff a buffer containing MusicXML code, that may contain null bytes (e.g. UTF-16)
+  \param size the buffer size in bytes
+  \param context the converter options and state
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlbuffer2lilypond(const char *buff, size_t size, xml2lyContext& context, std::ostream& out);
+
 /*! @} */
 
 
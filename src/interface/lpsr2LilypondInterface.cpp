@@ -51,7 +51,7 @@ void generateLilypondCodeFromLpsrScore (
     "%--------------------------------------------------------------";
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     logIOstream <<
       endl <<
       separator <<
@@ -79,7 +79,7 @@ void generateLilypondCodeFromLpsrScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 4",
     "translate LPSR to LilyPond",
     timingItem::kMandatory,
@@ -52,7 +52,7 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
   clock_t startClock = clock ();
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -80,7 +80,7 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 3",
     "translate MSR to LPSR",
     timingItem::kMandatory,
@@ -130,7 +130,7 @@ void displayLpsrScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the LPSR",
     timingItem::kOptional,
@@ -14,18 +14,8 @@
 # pragma warning (disable : 4786)
 #endif
 
-#include <string.h> // for strlen()
-#include <regex>
-
 #include <iomanip> // for setw()
 
-#ifdef WIN32
-  // JMI
-#else
-  #include <unistd.h> // for pipe(), fork(), ...
-  #include <stdio.h> // for popen()
-#endif
-
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
@@ -119,300 +109,6 @@ void displayDocumentType (
   gIndenter--;
 }
 
-//_______________________________________________________________________________
-string uncompressMXLFile (
-  string           mxlFileName,
-  indentedOstream& logIOstream)
-{
-  string fileBaseName = baseName (mxlFileName);
-
-  logIOstream <<
-    "The compressed file name is '" <<
-    mxlFileName <<
-    "'" <<
-    endl <<
-    endl;
-    
-  string uncompressedFileName;
-
-#ifdef WIN32
-  // JMI
-#else
-  {
-    // build shell command to list the contents of the uncompress file
-    stringstream s1;
-  
-    s1 <<
-      "unzip -l " <<
-      mxlFileName;
-  
-    string listContentsShellCommand = s1.str ();
-              
-    if (true) {
-      logIOstream <<
-        "Listing the contents of the compressed file '" <<
-        mxlFileName <<
-        "' with command:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        listContentsShellCommand <<
-        endl <<
-        endl;
-      
-      gIndenter--;
-    }
-
-      // create a stream to receive the result of listContentsShellCommand
-    FILE* inputStream =
-      popen (
-        listContentsShellCommand.c_str (),
-        "r");
-  
-    if (inputStream == nullptr) {
-      stringstream s;
-  
-      s <<
-        "Cannot list the contents of compressed file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-              
-      msrInternalError (
-        gXml2lyOptions->fInputSourceName,
-        0, // inputLineNumber
-        __FILE__, __LINE__,
-        s.str ());
-    }
-  
-    else {
-      string contentsList;
-      
-      // read the list from inputStream 
-      char tampon [1024];
-      
-      while (
-        ! feof (inputStream)
-          &&
-        ! ferror (inputStream)
-          &&
-        fgets (tampon, sizeof (tampon), inputStream) != NULL
-        ) {
-        // append the contents of tampon to contentsList
-        contentsList += tampon;
-      } // while
-      // terminate the string in tampon
-      tampon [strlen (tampon) -1] = '\0';
-    
-      // close the stream
-      if (pclose (inputStream) < 0) {
-        msrInternalError (
-          gXml2lyOptions->fInputSourceName,
-          0, // inputLineNumber
-          __FILE__, __LINE__,
-          "Cannot close the input stream after 'popen ()'");
-      }
-
-      logIOstream <<
-        "The contents of the compressed file '" <<
-        mxlFileName <<
-        "' is:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        contentsList <<
-        endl;
-      
-      gIndenter--;
-
-      // analyze the contents list      
-      list<string> linesList;
-    
-      istringstream inputStream (contentsList);
-      string        currentLine;
-      
-      while (getline (inputStream, currentLine)) {
-
-        if (inputStream.eof ()) break;
-              
-#ifdef TRACE_OPTIONS
-        {
-          logIOstream <<
-            "*** currentLine:" <<
-            endl;
-
-          gIndenter++;
-          
-          logIOstream <<
-            currentLine <<
-            endl;
-            
-          gIndenter--;
-        }
-#endif
-
-        /*
-        user@lilydev: ~/libmusicxml-git/files/samples/musicxml > unzip -l UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-        Archive:  UnofficialTestSuite/90a-Compressed-MusicXML.mxl
-          Length      Date    Time    Name
-        ---------  ---------- -----   ----
-                0  2007-11-14 16:04   META-INF/
-              246  2007-11-14 16:02   META-INF/container.xml
-             2494  2008-11-14 23:03   20a-Compressed-MusicXML.xml
-            30903  2007-11-14 15:51   20a-Compressed-MusicXML.pdf
-        ---------                     -------
-            33643                     4 files
-        */
-
-        string regularExpression (
-          "[[:space:]]*"
-          ".*"   // length
-          "[[:space:]]+"
-          ".*"   // date
-          "[[:space:]]+"
-          ".*"   // time
-          "[[:space:]]+"
-          "(.*)" // name
-          );
-        
-        regex  e (regularExpression);
-        smatch sm;
-  
-        regex_match (currentLine, sm, e);
-  
-        if (sm.size ()) {
-#ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTracePasses) { // JMI ???
-            logIOstream <<
-              "There are " << sm.size () - 1 << " match(es) " <<
-              "with regex '" << regularExpression <<
-              "':" <<
-              endl;
-  
-            for (unsigned i = 1; i < sm.size (); ++i) {
-              logIOstream <<
-                "[" << sm [i] << "] " <<
-                endl;
-            } // for
-          
-            logIOstream <<
-              endl <<
-              endl;
-          }
-#endif
-  
-          string stringFromLine = sm [1];
-              
-          // has stringFromLine a ".xml" suffix?    
-          size_t
-            posInString =
-              stringFromLine.rfind (".xml");
-                
-          // JMI if (posInString == stringFromLine.size () - 4) {
-          if (posInString != stringFromLine.npos) {  // JMI STRANGISSIMO!!!
-    //      if (posInString != stringFromLine.npos && stringFromLine != "files") {  // JMI STRANGISSIMO!!!
-            // yes, this is a MusicXML file
-
-            // is this file part of META-INF?
-            size_t
-              posInString =
-                stringFromLine.find ("META-INF");
-                  
-            if (posInString == stringFromLine.npos) {
-              // no, this is an actual MusicXML file
-
-              if (uncompressedFileName.size ()) {
-                stringstream s;
-        
-                s <<
-                  "Compressed file '" << mxlFileName <<
-                  "' contains multiple MusicMXL files" <<
-                  ", found '" << uncompressedFileName <<
-                  "' and then '" << stringFromLine << "'";
-                  
-                msrInternalError (
-                  gXml2lyOptions->fInputSourceName,
-                  0, // inputLineNumber
-                  __FILE__, __LINE__,
-                  s.str ());
-              }
-              
-              else {
-                // we've got the uncompressed file name
-                uncompressedFileName = stringFromLine;
-          
-                logIOstream <<
-                  "The uncompressed file name is '" <<
-                  uncompressedFileName <<
-                  "'" <<
-                  endl <<
-                  endl;
-              }
-            }
-          }
-        }
-      } // while
-    }
-  }
-
-  {
-    // build shell command to uncompress the file
-    stringstream s2;
-  
-    s2 <<
-      "unzip -u -d /tmp " <<
-      mxlFileName;
-  
-    string uncompressShellCommand = s2.str ();
-              
-    if (true) {
-      logIOstream <<
-        "Uncompressing '" <<
-        mxlFileName <<
-        "' into '/tmp/" <<
-        uncompressedFileName <<
-        "' with command:" <<
-        endl;
-  
-      gIndenter++;
-      
-      logIOstream <<
-        uncompressShellCommand <<
-        endl <<
-        endl;
-      
-      gIndenter--;
-    }
-  
-    // create a stream to receive the result of uncompressShellCommand
-    FILE* inputStream =
-      popen (
-        uncompressShellCommand.c_str (),
-        "r");
-  
-    if (inputStream == nullptr) {
-      stringstream s;
-  
-      s <<
-        "Cannot uncompress the file '" <<
-        mxlFileName <<
-        "' with 'popen ()'";
-              
-      msrInternalError (
-        gXml2lyOptions->fInputSourceName,
-        0, // inputLineNumber
-        __FILE__, __LINE__,
-        s.str ());
-    }
-  }
-#endif
-
-  return uncompressedFileName;
-}
-
 //_______________________________________________________________________________
 EXP Sxmlelement musicXMLFile2mxmlTree (
   const char*       fileName,
@@ -424,7 +120,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   string fileNameAsString = fileName;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -447,38 +143,24 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
       fileNameAsString.rfind (".mxl");
         
   if (posInString == fileNameAsString.size () - 4) {
- // JMI  if (posInString != fileNameAsString.npos) {
-    // yes, this is a compressed file
-
-    /* JMI OS dependent
-    string uncompressedFileName =
-      uncompressMXLFile (
-        fileNameAsString,
-        logIOstream);
-
-    // the incompressed file in /tmp will be handled
-    // instead of the compressed one 
-    fileName = uncompressedFileName.c_str ();
-    */
-
-    stringstream s;
-    
-    s <<
-      "you should uncompress this file prior to running xml2ly";
-          
-    msrMusicXMLError (
-      gXml2lyOptions->fInputSourceName,
-      1, // inputLineNumber,
-      __FILE__, __LINE__,
-      s.str ());
-
-    exit (333);
+    // yes, this is a compressed file:
+    // the reader inflates it in memory, see mxlfile
+#ifdef TRACE_OPTIONS
+    if (gTraceFlags [kTracePassesFlag]) {
+      logIOstream <<
+        "The compressed file name is '" <<
+        fileNameAsString <<
+        "'" <<
+        endl <<
+        endl;
+    }
+#endif
   }
 
   // read the input MusicXML data from the file
   xmlreader r;
   
-  SXMLFile xmlFile = r.read (fileName);
+  SXMLFile xmlFile = r.mapRead (fileName);
 
   // has there been a problem?
   if (! xmlFile) {
@@ -486,7 +168,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       endl <<
       "!!!!! xmlFile contents from file:" <<
@@ -505,7 +187,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   TXMLDecl * xmlDecl = xmlFile->getXMLDecl ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       endl <<
       "!!!!! xmlDecl contents from file:" <<
@@ -523,7 +205,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   // get the docType
   TDocType * docType = xmlFile->getDocType ();
   
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       endl <<
       "!!!!! docType from file:" <<
@@ -548,7 +230,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   
   if (encoding == desiredEncoding) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceFlags [kTracePassesFlag]) {
       logIOstream <<
         "% MusicXML data uses \"" <<
         desiredEncoding <<
@@ -591,7 +273,7 @@ EXP Sxmlelement musicXMLFile2mxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 1",
     "build xmlelement tree from file",
     timingItem::kMandatory,
@@ -610,7 +292,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -637,7 +319,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       "!!!!! xmlFile contents from stream:" <<
       endl;
@@ -651,7 +333,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   TXMLDecl *xmlDecl = xmlFile->getXMLDecl ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       endl <<
       "xmlDecl contents:" <<
@@ -669,7 +351,7 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
   // get the docType
   TDocType * docType = xmlFile->getDocType ();
   
-  if (gTraceOptions->fTraceEncoding) {
+  if (gTraceFlags [kTraceEncodingFlag]) {
     logIOstream <<
       endl <<
       "!!!!! docType from stream:" <<
@@ -711,13 +393,13 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
       __FILE__, __LINE__,
       s.str ());
 
-    exit (444);
+    throw msrException (444);
   }
 
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 1",
     "build xmlelement tree from standard input",
     timingItem::kMandatory,
@@ -731,15 +413,16 @@ EXP Sxmlelement musicXMLFd2mxmlTree (
 }
 
 //_______________________________________________________________________________
-EXP Sxmlelement musicXMLString2mxmlTree (
-  const char*       buffer,
-  S_musicXMLOptions mxmlOpts,
-  indentedOstream&  logIOstream) 
+// the buffer variants only differ by the way they read the buffer
+template <typename T>
+static Sxmlelement buffer2mxmlTree (
+  T                 readBuffer,
+  indentedOstream&  logIOstream)
 {
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -757,12 +440,12 @@ EXP Sxmlelement musicXMLString2mxmlTree (
   
   xmlreader r;
   
-  SXMLFile xmlFile = r.readbuff (buffer);
+  SXMLFile xmlFile = readBuffer (r);
 
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 1",
     "build xmlelement tree from buffer",
     timingItem::kMandatory,
@@ -770,10 +453,36 @@ EXP Sxmlelement musicXMLString2mxmlTree (
     endClock);
   
   // fetch mxmlTree
-  Sxmlelement mxmlTree = xmlFile->elements();
+  Sxmlelement mxmlTree;
+  if (xmlFile) {
+    mxmlTree = xmlFile->elements();
+  }
 
   return mxmlTree;
 }
 
+EXP Sxmlelement musicXMLString2mxmlTree (
+  const char*       buffer,
+  S_musicXMLOptions mxmlOpts,
+  indentedOstream&  logIOstream) 
+{
+  return
+    buffer2mxmlTree (
+      [buffer] (xmlreader& r) { return r.readbuff (buffer); },
+      logIOstream);
+}
+
+EXP Sxmlelement musicXMLString2mxmlTree (
+  const char*       buffer,
+  size_t            size,
+  S_musicXMLOptions mxmlOpts,
+  indentedOstream&  logIOstream) 
+{
+  return
+    buffer2mxmlTree (
+      [buffer, size] (xmlreader& r) { return r.readbuff (buffer, size); },
+      logIOstream);
+}
+
 
 } // namespace
@@ -64,6 +64,20 @@ EXP Sxmlelement musicXMLString2mxmlTree (
   S_musicXMLOptions mxmlOpts,
   indentedOstream&  logIOstream);
 
+/*!
+  \brief Converts a MusicXML representation to an MSR.
+  \param buff a buffer containing MusicXML code, that may contain null bytes (e.g. UTF-16)
+  \param size the buffer size in bytes
+  \param msrOpts the MSR options to be used
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP Sxmlelement musicXMLString2mxmlTree (
+  const char*       buffer,
+  size_t            size,
+  S_musicXMLOptions mxmlOpts,
+  indentedOstream&  logIOstream);
+
 
 /*! @} */
 
@@ -15,6 +15,8 @@
 #endif
 
 #include <iostream>
+#include <set>
+#include <sstream>
 #include "libmusicxml.h"
 #include "xml.h"
 #include "xmlfile.h"
@@ -27,14 +29,15 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file)
+static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, ostream& out, const char* file, int threads=1)
 {
 	Sxmlelement st = xmlfile->elements();
 	if (st) {
 		if (st->getName() == "score-timewise") return kUnsupported;
 		
 		xml2guidovisitor v(true, true, generateBars, partFilter);
-		Sguidoelement gmn = v.convert(st);
+		v.setThreads (threads);
+		v.setIndex (xmlfile->getIndex());
 		if (file) {
 			out << "(*\n  gmn code converted from '" << file << "'"
 				<< "\n  using libmusicxml v." << musicxmllibVersionStr();
@@ -42,7 +45,8 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 		else out << "(*\n  gmn code converted using libmusicxml v." << musicxmllibVersionStr();
 		out << "\n  and the embedded xml2guido converter v." << musicxml2guidoVersionStr()
 			<< "\n*)" << endl;
-		out << gmn << endl;
+		v.convert(st, out);		// streaming conversion, doesn't keep the guido score in memory
+		out << endl;
 		return kNoErr;
 	}
 	return kInvalidFile;
@@ -50,12 +54,19 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 
 //_______________________________________________________________________________
 EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, ostream& out) 
+{
+	return musicxmlfile2guidoThreaded(file, generateBars, 1, out);
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfile2guidoThreaded(const char *file, bool generateBars, int threads, ostream& out) 
 {
 	xmlreader r;
+	r.useArena (true);		// the tree is dropped after the conversion
 	SXMLFile xmlfile;
-	xmlfile = r.read(file);
+	xmlfile = r.mapRead(file);
 	if (xmlfile) {
-		return xml2guido(xmlfile, generateBars, 0, out, file);
+		return xml2guido(xmlfile, generateBars, 0, out, file, threads);
 	}
 	return kInvalidFile;
 }
@@ -64,6 +75,7 @@ EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, ostream& out)
 EXP xmlErr musicxmlfd2guido(FILE * fd, bool generateBars, ostream& out) 
 {
 	xmlreader r;
+	r.useArena (true);		// the tree is dropped after the conversion
 	SXMLFile xmlfile;
 	xmlfile = r.read(fd);
 	if (xmlfile) {
@@ -73,6 +85,27 @@ EXP xmlErr musicxmlfd2guido(FILE * fd, bool generateBars, ostream& out)
 }
 
 //_______________________________________________________________________________
+// reads a buffer with readBuffer, building only the filtered part
+template <typename T>
+static xmlErr buffer2guido(T readBuffer, bool generateBars, int partFilter, std::ostream& out)
+{
+	xmlreader r;
+	r.useArena (true);		// the tree is dropped after the conversion
+	if (partFilter) {		// the other parts are not built
+		stringstream id;
+		id << "P" << partFilter;
+		set<string> parts;
+		parts.insert (id.str());
+		r.keepParts (parts);
+	}
+	SXMLFile xmlfile;
+	xmlfile = readBuffer(r);
+	if (xmlfile) {
+		return xml2guido(xmlfile, generateBars, partFilter, out, 0);
+	}
+	return kInvalidFile;
+}
+
     //  partFilter: 0 to get all parts, 1 to get only "P1", etc.
 EXP xmlErr musicxmlstring2guido(const char * buffer, bool generateBars, ostream& out)
     {
@@ -81,13 +114,17 @@ EXP xmlErr musicxmlstring2guido(const char * buffer, bool generateBars, ostream&
 
 EXP xmlErr musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out)
 {
-	xmlreader r;
-	SXMLFile xmlfile;
-	xmlfile = r.readbuff(buffer);
-	if (xmlfile) {
-		return xml2guido(xmlfile, generateBars, partFilter, out, 0);
-	}
-	return kInvalidFile;
+	return buffer2guido([buffer] (xmlreader& r) { return r.readbuff(buffer); }, generateBars, partFilter, out);
+}
+
+EXP xmlErr musicxmlbuffer2guido(const char * buffer, size_t size, bool generateBars, ostream& out)
+{
+	return musicxmlbuffer2guidoOnPart(buffer, size, generateBars, 0, out);
+}
+
+EXP xmlErr musicxmlbuffer2guidoOnPart(const char * buffer, size_t size, bool generateBars, int partFilter, std::ostream& out)
+{
+	return buffer2guido([buffer, size] (xmlreader& r) { return r.readbuff(buffer, size); }, generateBars, partFilter, out);
 }
     
 
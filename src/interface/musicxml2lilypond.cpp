@@ -0,0 +1,466 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include "libmusicxml.h"
+#include "utilities.h"
+#include "messagesHandling.h"
+#include "version.h"
+
+#include "msr.h"
+#include "lpsr.h"
+
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
+#include "generalOptions.h"
+#include "musicXMLOptions.h"
+#include "msrOptions.h"
+#include "lpsrOptions.h"
+#include "lilypondOptions.h"
+#include "extraOptions.h"
+#include "xml2lyOptionsHandling.h"
+
+#include "musicXML2mxmlTreeInterface.h"
+#include "mxmlTree2MsrSkeletonBuilderInterface.h"
+#include "mxmlTree2MsrTranslatorInterface.h"
+#include "msr2LpsrInterface.h"
+#include "lpsr2LilypondInterface.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//_______________________________________________________________________________
+/*
+	the options and the state of the conversions of an xml2lyContext.
+	the converter reads them from thread local variables, that are exchanged
+	with the context state for the duration of each operation (see contextBinder).
+	the options are deciphered once, when they are set: fOptionsHandler is null
+	until they are, and after invalid options.
+*/
+class xml2lyContextState
+{
+	public:
+		optionsVector			fOptions;
+		string					fInputSourceName;
+		int						fExitStatus;
+
+		S_xml2lyOptionsHandler	fOptionsHandler;
+		S_xml2lyOptions			fXml2lyOptions;
+#ifdef TRACE_OPTIONS
+		S_traceOptions			fTraceOptions, fTraceOptionsUserChoices, fTraceOptionsWithDetailedTrace;
+		traceFlags				fTraceFlags;
+#endif
+		S_generalOptions		fGeneralOptions, fGeneralOptionsUserChoices;
+		S_musicXMLOptions		fMusicXMLOptions, fMusicXMLOptionsUserChoices, fMusicXMLOptionsWithDetailedTrace;
+		S_msrOptions			fMsrOptions, fMsrOptionsUserChoices, fMsrOptionsWithDetailedTrace;
+		S_lpsrOptions			fLpsrOptions, fLpsrOptionsUserChoices, fLpsrOptionsWithDetailedTrace;
+		S_lilypondOptions		fLilypondOptions, fLilypondOptionsUserChoices, fLilypondOptionsWithDetailedTrace;
+		S_extraOptions			fExtraOptions, fExtraOptionsUserChoices, fExtraOptionsWithDetailedTrace;
+
+		indenter				fIndenter;
+		timing					fTiming;
+		set<int>				fWarningsInputLineNumbers;
+		set<int>				fErrorsInputLineNumbers;
+
+		xml2lyContextState() : fInputSourceName ("-"), fExitStatus (0) {}
+};
+
+//_______________________________________________________________________________
+// binds a context state to the calling thread for the lifetime of the binder
+class contextBinder
+{
+	public:
+		 contextBinder (xml2lyContextState& state) : fState (state) { exchange(); }
+		~contextBinder ()	{ exchange(); }
+
+	private:
+		xml2lyContextState& fState;
+
+		void exchange ()
+		{
+			swap (fState.fXml2lyOptions, gXml2lyOptions);
+#ifdef TRACE_OPTIONS
+			swap (fState.fTraceOptions, gTraceOptions);
+			swap (fState.fTraceOptionsUserChoices, gTraceOptionsUserChoices);
+			swap (fState.fTraceOptionsWithDetailedTrace, gTraceOptionsWithDetailedTrace);
+			swap (fState.fTraceFlags, gTraceFlags);
+#endif
+			swap (fState.fGeneralOptions, gGeneralOptions);
+			swap (fState.fGeneralOptionsUserChoices, gGeneralOptionsUserChoices);
+			swap (fState.fMusicXMLOptions, gMusicXMLOptions);
+			swap (fState.fMusicXMLOptionsUserChoices, gMusicXMLOptionsUserChoices);
+			swap (fState.fMusicXMLOptionsWithDetailedTrace, gMusicXMLOptionsWithDetailedTrace);
+			swap (fState.fMsrOptions, gMsrOptions);
+			swap (fState.fMsrOptionsUserChoices, gMsrOptionsUserChoices);
+			swap (fState.fMsrOptionsWithDetailedTrace, gMsrOptionsWithDetailedTrace);
+			swap (fState.fLpsrOptions, gLpsrOptions);
+			swap (fState.fLpsrOptionsUserChoices, gLpsrOptionsUserChoices);
+			swap (fState.fLpsrOptionsWithDetailedTrace, gLpsrOptionsWithDetailedTrace);
+			swap (fState.fLilypondOptions, gLilypondOptions);
+			swap (fState.fLilypondOptionsUserChoices, gLilypondOptionsUserChoices);
+			swap (fState.fLilypondOptionsWithDetailedTrace, gLilypondOptionsWithDetailedTrace);
+			swap (fState.fExtraOptions, gExtraOptions);
+			swap (fState.fExtraOptionsUserChoices, gExtraOptionsUserChoices);
+			swap (fState.fExtraOptionsWithDetailedTrace, gExtraOptionsWithDetailedTrace);
+
+			swap (fState.fIndenter, gIndenter);
+			swap (fState.fTiming, gTiming);
+			swap (fState.fWarningsInputLineNumbers, gWarningsInputLineNumbers);
+			swap (fState.fErrorsInputLineNumbers, gErrorsInputLineNumbers);
+		}
+};
+
+//_______________________________________________________________________________
+// the converter runs the xml2ly passes with the state of a context bound to the calling thread.
+// it throws an msrException where xml2ly exits: the exit status is kept in the context.
+class xml2lyConverter
+{
+	public:
+		static xmlErr	setOptions (xml2lyContext& context, const optionsVector& options);
+		static xmlErr	setCommandLine (xml2lyContext& context, int argc, char* argv[]);
+
+		template <typename T>
+		static xmlErr	convert (xml2lyContext& context, const char* source, T readTree, ostream& out);
+
+	private:
+		static void		initialize ();
+		static void		reset (xml2lyContextState& state);
+		static void		prepare (xml2lyContextState& state, const string& source);
+		static void		decipher (xml2lyContextState& state, const vector<string>& args);
+		static void		decipher (xml2lyContextState& state, const optionsVector& options, const string& source);
+		static void		welcome (xml2lyContextState& state);
+		static void		checkIndentation (const char* pass);
+		static xmlErr	passes (Sxmlelement mxmlTree, ostream& out);
+};
+
+//_______________________________________________________________________________
+// the MSR and LPSR tables are thread local: they are built once per thread
+void xml2lyConverter::initialize ()
+{
+	static thread_local bool initialized = false;
+	if (!initialized) {
+		initializeMSR();
+		initializeLPSR();
+		initialized = true;
+	}
+}
+
+// clears what the previous operations have left in the context
+void xml2lyConverter::reset (xml2lyContextState& state)
+{
+	state.fExitStatus = 0;
+	gIndenter.resetToZero();
+	gTiming.clear();
+	gWarningsInputLineNumbers.clear();
+	gErrorsInputLineNumbers.clear();
+}
+
+// the options deciphered for the previous operations are reused with the new
+// input source, the default or last valid options are deciphered when there are none
+void xml2lyConverter::prepare (xml2lyContextState& state, const string& source)
+{
+	if (state.fOptionsHandler)
+		state.fOptionsHandler->setInputSourceName (source);
+	else
+		decipher (state, state.fOptions, source);
+	gXml2lyOptions->registerTranslationDate();
+}
+
+//_______________________________________________________________________________
+// creates the options groups from a command line, as xml2ly does
+void xml2lyConverter::decipher (xml2lyContextState& state, const vector<string>& args)
+{
+	vector<string> copy (args);
+	vector<char*> argv;
+	for (size_t i = 0; i < copy.size(); i++)
+		argv.push_back (&copy[i][0]);
+	argv.push_back (0);
+
+	state.fOptionsHandler = (xml2lyOptionsHandler*)0;		// until the options are valid
+	S_xml2lyOptionsHandler handler = xml2lyOptionsHandler::create (gOutputIOstream);
+	handler->decipherOptionsAndArguments (argv.size() - 1, &argv[0]);
+	if (gGeneralOptions->fQuiet)
+		handler->enforceOptionsHandlerQuietness();
+#ifdef TRACE_OPTIONS
+	refreshTraceFlags();
+#endif
+	state.fOptionsHandler = handler;
+}
+
+void xml2lyConverter::decipher (xml2lyContextState& state, const optionsVector& options, const string& source)
+{
+	vector<string> args;
+	args.push_back ("xml2ly");
+	args.insert (args.end(), options.begin(), options.end());
+	args.push_back (source);
+	decipher (state, args);
+}
+
+//_______________________________________________________________________________
+xmlErr xml2lyConverter::setOptions (xml2lyContext& context, const optionsVector& options)
+{
+	xml2lyContextState& state = *context.fState;
+	initialize();
+	contextBinder bind (state);
+	reset (state);
+	try {
+		decipher (state, options, state.fInputSourceName);
+	}
+	catch (msrException& e) {
+		state.fExitStatus = e.getExitStatus();
+		return kUnsupported;
+	}
+	state.fOptions = options;
+	return kNoErr;
+}
+
+//_______________________________________________________________________________
+xmlErr xml2lyConverter::setCommandLine (xml2lyContext& context, int argc, char* argv[])
+{
+	xml2lyContextState& state = *context.fState;
+	initialize();
+	contextBinder bind (state);
+	reset (state);
+	vector<string> args (argv, argv + argc);
+	try {
+		decipher (state, args);
+	}
+	catch (msrException& e) {
+		state.fExitStatus = e.getExitStatus();
+		return kUnsupported;
+	}
+	// the options are the command line without the tool name and the input source
+	state.fInputSourceName = gXml2lyOptions->fInputSourceName;
+	optionsVector options (args.begin() + 1, args.end());
+	optionsVector::reverse_iterator source = find (options.rbegin(), options.rend(), state.fInputSourceName);
+	if (source != options.rend())
+		options.erase (--source.base());
+	state.fOptions = options;
+	return kNoErr;
+}
+
+//_______________________________________________________________________________
+// the trace of the command line analysis, as xml2ly prints it
+void xml2lyConverter::welcome (xml2lyContextState& state)
+{
+#ifdef TRACE_OPTIONS
+	if (gTraceOptions->fTracePasses) {
+		const string& inputSourceName = gXml2lyOptions->fInputSourceName;
+		const string& outputFileName = gXml2lyOptions->fOutputFileName;
+
+		gLogIOstream <<
+			"This is xml2ly " << currentVersionNumber () <<
+			" from libmusicxml2 v" << musicxmllibVersionStr () <<
+			endl <<
+			"Launching conversion of " <<
+			(inputSourceName == "-" ? string ("standard input") : "\"" + inputSourceName + "\"") <<
+			" to LilyPond" <<
+			endl <<
+			"Time is " << gXml2lyOptions->fTranslationDate <<
+			endl <<
+			"LilyPond code will be written to " <<
+			(outputFileName.size () ? outputFileName : string ("the output stream")) <<
+			endl <<
+			endl <<
+			"The command line is:" <<
+			endl;
+
+		gIndenter++;
+		gLogIOstream << state.fOptionsHandler->getCommandLineWithLongOptions () << endl;
+		gIndenter--;
+		gLogIOstream << "or:" << endl;
+		gIndenter++;
+		gLogIOstream << state.fOptionsHandler->getCommandLineWithShortOptions () << endl << endl;
+		gIndenter--;
+	}
+
+	if (gTraceOptions->fDisplayOptionsValues) {
+		state.fOptionsHandler->printAllOptionsValues (gLogIOstream);
+		gLogIOstream << endl;
+	}
+
+	if (gTraceOptions->fTracePasses) {
+		gLogIOstream <<
+			"The command line options and arguments have been analyzed" <<
+			endl;
+	}
+#endif
+}
+
+//_______________________________________________________________________________
+// the indentation is back to 0 after each pass
+void xml2lyConverter::checkIndentation (const char* pass)
+{
+	if (gIndenter != 0) {
+		if (! gGeneralOptions->fQuiet) {
+			stringstream s;
+			s << "gIndenter value after " << pass << ": " << gIndenter.getIndent ();
+			msrMusicXMLWarning (gXml2lyOptions->fInputSourceName, 1, s.str ());
+		}
+		gIndenter.resetToZero ();
+	}
+}
+
+//_______________________________________________________________________________
+// runs passes 2 to 4 on a MusicXML tree
+xmlErr xml2lyConverter::passes (Sxmlelement mxmlTree, ostream& out)
+{
+	if (!mxmlTree) throw msrException (1);
+	if (mxmlTree->getName() == "score-timewise") return kUnsupported;
+
+	S_msrScore mScore = buildMsrSkeletonFromElementsTree (gMsrOptions, mxmlTree, gLogIOstream);
+	checkIndentation ("pass 2a");
+	if (! mScore) {
+		gLogIOstream << "### Conversion from MusicXML to an MSR skeleton failed ###" << endl << endl;
+		throw msrException (1);
+	}
+	if (gGeneralOptions->fExit2a) return kNoErr;
+
+	populateMsrSkeletonFromMxmlTree (gMsrOptions, mxmlTree, mScore, gLogIOstream);
+	checkIndentation ("pass 2b");
+	if (gGeneralOptions->fExit2b) return kNoErr;
+
+	if (gMsrOptions->fDisplayMsr) {
+		displayMSRPopulatedScore (gMsrOptions, mScore, gLogIOstream);
+		checkIndentation ("MSR score display");
+	}
+	if (gMsrOptions->fDisplayMsrSummary) {
+		displayMSRPopulatedScoreSummary (gMsrOptions, mScore, gLogIOstream);
+		throw msrException (444);
+	}
+	if (gMsrOptions->fDisplayMsrNames) {
+		displayMSRPopulatedScoreNames (gMsrOptions, mScore, gLogIOstream);
+		throw msrException (555);
+	}
+	if (gLilypondOptions->fNoLilypondCode) return kNoErr;
+
+	S_lpsrScore lpScore = buildLpsrScoreFromMsrScore (mScore, gMsrOptions, gLpsrOptions, gLogIOstream);
+	checkIndentation ("pass 3");
+	if (! lpScore) {
+		gLogIOstream << "### Conversion from MSR to LPSR failed ###" << endl << endl;
+		throw msrException (2);
+	}
+	if (gGeneralOptions->fExit3) return kNoErr;
+
+	if (gLpsrOptions->fDisplayLpsr) {
+		displayLpsrScore (lpScore, gMsrOptions, gLpsrOptions, gLogIOstream);
+		checkIndentation ("LPSR score display");
+	}
+
+	{
+		indentedOstream lilypondCodeOstream (out, gIndenter, indentedOstream::K_BUFFER_SIZE);
+		generateLilypondCodeFromLpsrScore (lpScore, gMsrOptions, gLpsrOptions, gLogIOstream, lilypondCodeOstream);
+	}
+	checkIndentation ("pass 4");
+	return kNoErr;
+}
+
+//_______________________________________________________________________________
+// invalid options are reported as kUnsupported, conversion errors as kInvalidFile
+template <typename T>
+xmlErr xml2lyConverter::convert (xml2lyContext& context, const char* source, T readTree, ostream& out)
+{
+	xml2lyContextState& state = *context.fState;
+	initialize();
+	contextBinder bind (state);
+	reset (state);
+	try {
+		prepare (state, source);
+	}
+	catch (msrException& e) {
+		state.fExitStatus = e.getExitStatus();
+		return kUnsupported;
+	}
+	try {
+		welcome (state);
+		xmlErr err = passes (readTree(), out);
+		if (err != kNoErr) state.fExitStatus = 1;
+
+		displayWarningsAndErrorsInputLineNumbers ();
+		if (gGeneralOptions->fDisplayCPUusage)
+			gTiming.print (gLogIOstream);
+		return err;
+	}
+	catch (msrException& e) {
+		state.fExitStatus = e.getExitStatus();
+		return kInvalidFile;
+	}
+	catch (std::exception& e) {
+		// the stack is unwound all the same: the LilyPond code generated so far is written
+		gLogIOstream << "#### " << e.what() << ", aborting." << endl;
+		state.fExitStatus = msrException::kAbort;
+		return kInvalidFile;
+	}
+}
+
+//_______________________________________________________________________________
+xml2lyContext::xml2lyContext()	: fState (new xml2lyContextState) {}
+xml2lyContext::~xml2lyContext()	{ delete fState; }
+
+xmlErr xml2lyContext::setOptions (const optionsVector& options)
+{
+	return xml2lyConverter::setOptions (*this, options);
+}
+
+xmlErr xml2lyContext::setCommandLine (int argc, char* argv[])
+{
+	return xml2lyConverter::setCommandLine (*this, argc, argv);
+}
+
+const optionsVector& xml2lyContext::getOptions() const	{ return fState->fOptions; }
+const string& xml2lyContext::getInputSourceName() const	{ return fState->fInputSourceName; }
+int xml2lyContext::getExitStatus() const				{ return fState->fExitStatus; }
+
+string xml2lyContext::getOutputFileName() const
+{
+	return fState->fXml2lyOptions ? fState->fXml2lyOptions->fOutputFileName : "";
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfile2lilypond(const char *file, xml2lyContext& context, ostream& out)
+{
+	return xml2lyConverter::convert (context, file, [&] () {
+		return musicXMLFile2mxmlTree (file, gMusicXMLOptions, gLogIOstream); }, out);
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfd2lilypond(FILE* fd, xml2lyContext& context, ostream& out)
+{
+	return xml2lyConverter::convert (context, "-", [&] () {
+		return musicXMLFd2mxmlTree (fd, gMusicXMLOptions, gLogIOstream); }, out);
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlstring2lilypond(const char *buffer, xml2lyContext& context, ostream& out)
+{
+	return xml2lyConverter::convert (context, "-", [&] () {
+		return musicXMLString2mxmlTree (buffer, gMusicXMLOptions, gLogIOstream); }, out);
+}
+
+EXP xmlErr musicxmlbuffer2lilypond(const char *buffer, size_t size, xml2lyContext& context, ostream& out)
+{
+	return xml2lyConverter::convert (context, "-", [&] () {
+		return musicXMLString2mxmlTree (buffer, size, gMusicXMLOptions, gLogIOstream); }, out);
+}
+
+}
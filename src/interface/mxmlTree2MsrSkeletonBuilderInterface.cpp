@@ -55,7 +55,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -90,7 +90,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 2a",
     "build the MSR skeleton",
     timingItem::kMandatory,
@@ -140,7 +140,7 @@ void displayMsrSkeleton (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the MSR skeleton",
     timingItem::kOptional,
@@ -163,7 +163,7 @@ void displayMsrSkeletonSummary (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -191,7 +191,7 @@ void displayMsrSkeletonSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR skeleton summary",
     timingItem::kOptional,
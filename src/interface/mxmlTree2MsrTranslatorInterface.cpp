@@ -59,7 +59,7 @@ void populateMsrSkeletonFromMxmlTree (
   clock_t startClock = clock ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
   
@@ -90,7 +90,7 @@ void populateMsrSkeletonFromMxmlTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 2b",
     "build the MSR",
     timingItem::kMandatory,
@@ -129,7 +129,7 @@ void displayMSRPopulatedScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the MSR",
     timingItem::kOptional,
@@ -151,7 +151,7 @@ void displayMSRPopulatedScoreSummary (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -180,7 +180,7 @@ void displayMSRPopulatedScoreSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR summary",
     timingItem::kOptional,
@@ -202,7 +202,7 @@ void displayMSRPopulatedScoreNames (
   clock_t startClock = clock ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePassesFlag]) {
     string separator =
       "%--------------------------------------------------------------";
     
@@ -231,7 +231,7 @@ void displayMSRPopulatedScoreNames (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR names",
     timingItem::kOptional,
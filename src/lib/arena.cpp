@@ -0,0 +1,93 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <cstddef>
+#include <new>
+#include <stdint.h>
+#include "arena.h"
+
+namespace MusicXML2 
+{
+
+static thread_local arena* gCurrentArena = 0;
+
+// the alignment of the arena allocations, that is also the alignment of the heap allocations
+static const uintptr_t kAlign = alignof(std::max_align_t);
+
+//______________________________________________________________________________
+// arena
+//______________________________________________________________________________
+SMARTP<arena> arena::create(size_t blockSize) { arena * o = new arena(blockSize); assert(o!=0); return o; }
+
+arena::~arena()
+{
+	for (size_t i = 0; i < fBlocks.size(); i++)
+		delete [] fBlocks[i];
+}
+
+void* arena::alloc (size_t size)
+{
+	size = (size + kAlign - 1) & ~(kAlign - 1);
+	size_t pad = (kAlign - ((uintptr_t)fPtr & (kAlign - 1))) & (kAlign - 1);
+	if (size + pad > fAvail) {
+		size_t bsize = (size > fBlockSize) ? size : fBlockSize;
+		char* block = new char[bsize + kAlign];			// room to align the first allocation
+		fBlocks.push_back (block);
+		fSize += bsize + kAlign;
+		pad = (kAlign - ((uintptr_t)block & (kAlign - 1))) & (kAlign - 1);
+		if (bsize > fBlockSize)		// dedicated block: keep the current one
+			return block + pad;
+		fPtr = block;
+		fAvail = bsize + kAlign;
+	}
+	void* ptr = fPtr + pad;
+	fPtr += pad + size;
+	fAvail -= pad + size;
+	return ptr;
+}
+
+arena*	arena::current ()			{ return gCurrentArena; }
+
+arena::scope::scope (arena* a) : fPrevious(gCurrentArena)	{ gCurrentArena = a; }
+arena::scope::~scope ()										{ gCurrentArena = fPrevious; }
+
+//______________________________________________________________________________
+// arenaobject
+//______________________________________________________________________________
+// every object is placed right after a header that gives its arena, 0 for heap objects
+// the header size keeps the objects aligned as the heap allocations are
+struct alignas(alignof(std::max_align_t)) header {
+	arena*	fArena;
+};
+
+void* arenaobject::operator new (size_t size)
+{
+	arena* a = gCurrentArena;
+	header* h;
+	if (a) {
+		h = (header*)a->alloc (size + sizeof(header));
+		a->addReference();
+	}
+	else h = (header*)::operator new (size + sizeof(header));
+	h->fArena = a;
+	return h + 1;
+}
+
+void arenaobject::operator delete (void* ptr)
+{
+	if (!ptr) return;
+	header* h = (header*)ptr - 1;
+	if (h->fArena) h->fArena->removeReference();
+	else ::operator delete (h);
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __arena__
+#define __arena__
+
+#include <stddef.h>
+#include <vector>
+#include "exports.h"
+#include "smartpointer.h"
+
+namespace MusicXML2 
+{
+
+/*!
+\brief a memory arena
+
+	An arena allocates memory by large blocks and releases all the blocks
+	at once, when it is no longer referenced. Objects allocated from an arena
+	hold a reference to it (see arenaobject) so that the memory remains
+	valid as long as one of them is alive.
+	Memory of the individual objects is never reused.
+*/
+class EXP arena : public smartable
+{
+	std::vector<char*>	fBlocks;
+	size_t				fBlockSize;
+	char*				fPtr;		// the free space in the current block
+	size_t				fAvail;		// the size of the free space
+	size_t				fSize;		// the total size of the blocks
+
+	protected:
+				 arena(size_t blockSize) : fBlockSize(blockSize), fPtr(0), fAvail(0), fSize(0) {}
+		virtual ~arena();
+
+	public:
+		static SMARTP<arena> create(size_t blockSize = 64 * 1024);
+
+		void*	alloc (size_t size);
+		//! the total size of the memory allocated by the arena
+		size_t	size () const		{ return fSize; }
+
+		//! the arena of the calling thread, used by arenaobject allocations
+		static arena*	current ();
+
+		//! makes an arena the current one for the calling thread, during the lifetime of the scope object
+		class EXP scope {
+			arena*	fPrevious;
+			public:
+						 scope (arena* a);
+						~scope ();
+		};
+};
+typedef SMARTP<arena> Sarena;
+
+/*!
+\brief a base class for objects allocated from the current arena
+
+	Objects are allocated from the current arena of the calling thread
+	when there is one, and from the standard heap otherwise.
+	Every allocation carries a header that gives its arena (0 for the heap),
+	the size of the header keeps the objects aligned as heap objects are.
+	Note that the arena only holds the objects themselves: their destructors
+	still run one by one and the memory they own (names, values, attributes
+	vectors) is still taken from the heap.
+*/
+class EXP arenaobject
+{
+	public:
+		static void* operator new (size_t size);
+		static void  operator delete (void* ptr);
+};
+
+}
+
+#endif
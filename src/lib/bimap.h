@@ -31,10 +31,10 @@ class bimap {
 		bimap(const T1 tbl1[], const T2 tbl2[], int n);
 		virtual ~bimap() {}
 		
-		//! returns the second type value indexed by the first type
-		const T2 operator[] (const T1 key) 		{ return fT1Map[key]; }
-		//! returns the first type value indexed by the second type
-		const T1 operator[] (const T2 key)		{ return fT2Map[key]; }
+		//! returns the second type value indexed by the first type (a default value when not found)
+		const T2 operator[] (const T1 key) const	{ return get(fT1Map, key); }
+		//! returns the first type value indexed by the second type (a default value when not found)
+		const T1 operator[] (const T2 key) const	{ return get(fT2Map, key); }
 		//! returns the map size
 		long size()		{ return fT1Map.size(); }
 
@@ -45,6 +45,10 @@ class bimap {
 	private:
 		map<T1, T2> fT1Map;
 		map<T2, T1> fT2Map;
+
+		// lookup without insertion: the shared conversion tables remain safe to read concurrently
+		template <typename K, typename V> static V get (const map<K, V>& m, const K& key)
+			{ typename map<K, V>::const_iterator i = m.find(key); return (i == m.end()) ? V() : i->second; }
 };
 
 template <typename T1, typename T2>
@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <stack>
+#include <type_traits>
 #include <vector>
 #include <iterator>
 
@@ -29,13 +30,20 @@ namespace MusicXML2
 {
 
 //______________________________________________________________________________
+/*!
+\brief a depth first tree iterator
+
+	The iterator keeps an explicit stack of the parents of the current element.
+	The stack holds raw pointers: the parents are kept alive by the root element.
+*/
 template <typename T> class EXP treeIterator : public std::iterator<std::input_iterator_tag, T>
 {
 	protected:
 		typedef typename std::vector<T>::iterator nodes_iterator;
-		typedef std::pair<nodes_iterator, T> state;
+		typedef typename std::remove_reference<decltype(*T())>::type node;
+		typedef std::pair<nodes_iterator, node*> state;
 
-		std::stack<state>	fStack;
+		std::vector<state>	fStack;
 		T					fRootElement;
 		nodes_iterator		fCurrentIterator;
 
@@ -44,7 +52,10 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 				 treeIterator(const T& t, bool end=false) {
 					 fRootElement = t;
 					 if (end) fCurrentIterator = t->elements().end();
-					 else forward_down (t);
+					 else {
+						 fStack.reserve (16);
+						 forward_down (t);
+					 }
 				 }
 				 treeIterator(const treeIterator& a)  { *this = a; }
 		virtual ~treeIterator() {}
@@ -53,28 +64,27 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		T operator ->() const	{ return *fCurrentIterator; } 
 		
 		//________________________________________________________________________
-		T getParent() const		{ return fStack.size() ? fStack.top().second : fRootElement; }
+		T getParent() const		{ return fStack.size() ? T(fStack.back().second) : fRootElement; }
 		
 		//________________________________________________________________________
 		// current element has sub-elements: go down to sub-elements first			
 		virtual void forward_down(const T& t) {
 			fCurrentIterator = t->elements().begin();
 			if (fCurrentIterator != t->elements().end())
-				fStack.push( make_pair(fCurrentIterator+1, t));
+				fStack.push_back( state(fCurrentIterator+1, (node*)t));
 		}
 
 		//________________________________________________________________________
 		// current element is empty: go up to parent element and possibly down to neighbor element
 		void forward_up() {
 			while (fStack.size()) {
-				state s = fStack.top();
-				fStack.pop();
-
+				state& s = fStack.back();
 				fCurrentIterator = s.first;
 				if (fCurrentIterator != s.second->elements().end()) {
-					fStack.push( make_pair(fCurrentIterator+1, s.second));
+					s.first = fCurrentIterator+1;
 					return;
 				}
+				fStack.pop_back();
 			}
 		}
 		
@@ -91,9 +101,9 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		treeIterator& erase() {
 			T parent = getParent();
 			fCurrentIterator = parent->elements().erase(fCurrentIterator);
-			if (fStack.size()) fStack.pop();
+			if (fStack.size()) fStack.pop_back();
 			if (fCurrentIterator != parent->elements().end()) {
-				fStack.push( make_pair(fCurrentIterator+1, parent));
+				fStack.push_back( state(fCurrentIterator+1, (node*)parent));
 			}
 			else forward_up();
 			return *this; 
@@ -103,8 +113,8 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		treeIterator& insert(const T& value) {
 			T parent = getParent();
 			fCurrentIterator = parent->elements().insert(fCurrentIterator, value);
-			if (fStack.size()) fStack.pop();
-			fStack.push( make_pair(fCurrentIterator+1, parent));
+			if (fStack.size()) fStack.pop_back();
+			fStack.push_back( state(fCurrentIterator+1, (node*)parent));
 			return *this;
 		}
 
@@ -136,8 +146,8 @@ template <typename T> class EXP ctree : virtual public smartable
 		virtual int  size  () const				{ return int(fElements.size()); }
 		virtual bool empty () const				{ return fElements.size()==0; }
 
-		iterator begin()			{ treePtr start=dynamic_cast<T*>(this); return iterator(start); }
-		iterator end()				{ treePtr start=dynamic_cast<T*>(this); return iterator(start, true); }
+		iterator begin()			{ treePtr start=static_cast<T*>(this); return iterator(start); }
+		iterator end()				{ treePtr start=static_cast<T*>(this); return iterator(start, true); }
 		iterator erase(iterator i)	{ return i.erase(); }
 		iterator insert(iterator before, const treePtr& value)	{ return before.insert(value); }
 		
@@ -146,7 +156,28 @@ template <typename T> class EXP ctree : virtual public smartable
 
 	protected:
 				 ctree() {}
-		virtual ~ctree() {}
+		//! the sub elements are released iteratively: deep trees don't exhaust the call stack
+		virtual ~ctree() {
+			if (fElements.empty()) return;
+			typedef std::pair<branchs, size_t> pending;		// sub elements waiting to be released and the next one
+			std::vector<pending> stack (1);
+			stack.back().first.swap (fElements);
+			stack.back().second = 0;
+			while (stack.size()) {
+				pending& p = stack.back();
+				if (p.second == p.first.size()) { stack.pop_back(); continue; }
+				treePtr& next = p.first[p.second];
+				ctree<T>* elt = (T*)next;
+				if ((elt->refs() == 1) && elt->fElements.size()) {	// elt is about to be deleted: release its sub elements first
+					stack.push_back (pending(branchs(), 0));
+					stack.back().first.swap (elt->fElements);
+				}
+				else {
+					next = (T*)0;
+					p.second++;
+				}
+			}
+		}
 
 	private:
 		branchs	 fElements;
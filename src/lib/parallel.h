@@ -0,0 +1,67 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __parallel__
+#define __parallel__
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// calls f(0) ... f(n-1) using up to 'threads' threads, the calling thread included
+// each call must only write to its own data
+// the first exception thrown by f stops the remaining calls and is rethrown
+// to the caller once all the threads are joined
+template <typename F> void parallel (size_t n, int threads, F f)
+{
+	size_t count = (threads > 1) ? std::min(n, size_t(threads)) : 1;
+	if (count <= 1) {
+		for (size_t i = 0; i < n; i++) f(i);
+		return;
+	}
+	std::atomic<size_t> next (0);
+	std::exception_ptr error;
+	std::mutex errorLock;
+	auto worker = [&next, n, &f, &error, &errorLock] () {
+		try {
+			for (size_t i = next++; i < n; i = next++) f(i);
+		}
+		catch (...) {
+			next = n;
+			std::lock_guard<std::mutex> lock (errorLock);
+			if (!error) error = std::current_exception();
+		}
+	};
+	std::vector<std::thread> pool;
+	pool.reserve (count - 1);	// no reallocation may throw once threads are started
+	try {
+		for (size_t i = 1; i < count; i++)
+			pool.emplace_back (worker);
+	}
+	catch (const std::system_error&) {}	// less threads: the remaining calls are made by the others
+	worker();
+	for (size_t i = 0; i < pool.size(); i++)
+		pool[i].join();
+	if (error) std::rethrow_exception (error);
+}
+
+}
+
+#endif
@@ -11,6 +11,7 @@
 */
 
 #include "rational.h"
+#include <iostream>
 #include <sstream>
 #include <cmath>
 #include <stdlib.h>
@@ -28,104 +29,80 @@ rational::rational (const string &str)
     if (denom) fDenominator = atol(denom);
 }
 
-rational::rational(long int num, long int denom) : fNumerator(num), fDenominator(denom)
-{
-    // don't allow zero denominators!
-    if (fDenominator == 0) fDenominator = 1;
-}
-
-rational::rational(const rational& d)
-{
-    fNumerator = d.fNumerator;
-    fDenominator = d.fDenominator;
-}
-
 //______________________________________________________________________________
-rational rational::operator +(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator + dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
-}
-
-rational rational::operator -(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator - dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
-}
-
-rational rational::operator *(const rational &dur) const {
-    return rational(fNumerator * dur.fNumerator, fDenominator * dur.fDenominator);
-}
-
-rational rational::operator /(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator, fDenominator * dur.fNumerator);
-}
-
-rational rational::operator *(int num) const {
-	return rational(fNumerator * num, fDenominator);
-}
-
-rational rational::operator /(int num) const {
-	return rational(fNumerator, fDenominator * num);
-}
-
-rational& rational::operator +=(const rational &dur)
-{
-    if(fDenominator == dur.fDenominator) {
-		fNumerator += dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator + dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
+// x is approximated by the last convergent of its continued fraction whose
+// denominator doesn't exceed kMaxApproxDenominator, values out of range are saturated
+rational rational::approximate (double x)
+{
+	if (x != x) return rational (0);		// NaN
+	if (x >= (double) LONG_MAX) return rational (LONG_MAX);
+	if (x <= (double) -LONG_MAX) return rational (-LONG_MAX);
+
+	bool negative = x < 0;
+	double r = negative ? -x : x;
+	long int h0 = 0, h1 = 1;		// the numerators of the last two convergents
+	long int k0 = 1, k1 = 0;		// and their denominators
+	for (int i = 0; i < 64; i++) {
+		double a = floor (r);
+		long int h, k;
+		if (mulOverflows ((long int) a, h1, h) || addOverflows (h, h0, h)
+			|| mulOverflows ((long int) a, k1, k) || addOverflows (k, k0, k)
+			|| (k > kMaxApproxDenominator))
+			break;
+		h0 = h1; h1 = h;
+		k0 = k1; k1 = k;
+		double f = r - a;
+		if ((f <= 0) || ((double) h1 / k1 == r)) break;
+		r = 1 / f;
+		if (r >= (double) LONG_MAX) break;
 	}
-    return (*this);
-}
-
-rational& rational::operator -=(const rational &dur)
-{
-	if(fDenominator == dur.fDenominator) {
-		fNumerator -= dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator - dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
-    }
-	return (*this);
-}
-
-rational& rational::operator *=(const rational &dur)
-{
-    fNumerator   *= dur.fNumerator;
-    fDenominator *= dur.fDenominator;
-    return (*this);
-}
-
-rational& rational::operator /=(const rational &dur)
-{
-    fNumerator   *= dur.fDenominator;
-    fDenominator *= dur.fNumerator;
-    return (*this);
-}
-
-rational& rational::operator = (const rational& rat) {
-  fNumerator   = rat.fNumerator;
-  fDenominator = rat.fDenominator;
-  return (*this);
+	return rational (negative ? -h1 : h1, k1);
 }
 
 //______________________________________________________________________________
-bool rational::operator > (const rational &rat) const
-{
-  // a/b > c/d if and only if a * d > b * c.
-  return ((fNumerator * rat.fDenominator) > (fDenominator * rat.fNumerator));
+// slow paths: gcd(b, d) is factored out of the denominators before adding
+// and the cross factors are simplified before multiplying, which keeps
+// the intermediate products within range for all practical scores
+rational rational::addReduced (const rational& r1, const rational& r2, bool subtract)
+{
+	long int g  = gcd (r1.fDenominator, r2.fDenominator);
+	long int b  = r1.fDenominator / g;
+	long int d  = r2.fDenominator / g;
+	long int n1, n2, n, den;
+	if (mulOverflows (r1.fNumerator, d, n1) || mulOverflows (r2.fNumerator, b, n2)
+		|| (subtract ? subOverflows (n1, n2, n) : addOverflows (n1, n2, n))
+		|| mulOverflows (b, r2.fDenominator, den)) {
+		return approximate (r1.toDouble() + (subtract ? -r2.toDouble() : r2.toDouble()));
+	}
+	rational result (n, den);
+	result.rationalise ();
+	return result;
 }
 
-bool rational::operator < (const rational &rat) const
+rational rational::mulReduced (long int n1, long int d1, long int n2, long int d2)
 {
-  // a/b < c/d if and only if a * d < b * c.
-  return ((fNumerator * rat.fDenominator) < (fDenominator * rat.fNumerator));
+	long int g1 = gcd (n1, d2);
+	long int g2 = gcd (n2, d1);
+	long int n, d;
+	if (mulOverflows (n1 / g1, n2 / g2, n) || mulOverflows (d1 / g2, d2 / g1, d)) {
+		return d1 && d2 ? approximate ((double) n1 / d1 * ((double) n2 / d2)) : rational (0);
+	}
+	return rational (n, d);
 }
 
-bool rational::operator == (const rational &rat) const
+int rational::compareReduced (const rational& r1, const rational& r2)
 {
-  // a/b < c/d if and only if a * d < b * c.
-	return ((fNumerator * rat.fDenominator) == (fDenominator * rat.fNumerator));
+	long int g  = gcd (r1.fDenominator, r2.fDenominator);
+	long int a, b;
+	if (mulOverflows (r1.fNumerator, r2.fDenominator / g, a) || mulOverflows (r1.fDenominator / g, r2.fNumerator, b)) {
+		// out of range: the values are far enough apart for doubles to tell
+		double x = r1.toDouble (), y = r2.toDouble ();
+		return (x > y) - (x < y);
+	}
+	return (a > b) - (a < b);
 }
 
+//______________________________________________________________________________
 bool rational::operator > (double num) const 	{ return (toDouble() > num); }
 bool rational::operator >= (double num) const	{ return (toDouble() >= num); }
 bool rational::operator < (double num) const	{ return (toDouble() < num); }
@@ -133,37 +110,55 @@ bool rational::operator <= (double num) const	{ return (toDouble() <= num); }
 bool rational::operator == (double num) const	{ return (toDouble() == num); }
 
 //______________________________________________________________________________
-// gcd(a, b) calculates the gcd of a and b using Euclid's algorithm.
+// gcd(a, b) calculates the gcd of a and b using the binary GCD algorithm,
+// trading Euclid's divisions for shifts and subtractions.
+// The result is always strictly positive.
 long int rational::gcd (long int a1, long int b1)
 {
-  long int r;
-
-  long int a = labs(a1);
-  long int b = labs(b1);
-
-  if (! (a == 0) || (b == 0)) {
-    while (b > 0){
-      r = a % b;
-      a = b;
-      b = r;
-    } // while
-    
-    return a;
+  unsigned long int a = a1 < 0 ? 0 - (unsigned long int) a1 : a1;
+  unsigned long int b = b1 < 0 ? 0 - (unsigned long int) b1 : b1;
+
+  if (a == 0 || b == 0) {
+    unsigned long int r = a | b;
+    return r ? (long int) r : 1;
   }
-  
-  return 1;
+
+#if defined(__GNUC__) || defined(__clang__)
+  int shift = __builtin_ctzl (a | b);
+  a >>= __builtin_ctzl (a);
+  do {
+    b >>= __builtin_ctzl (b);
+    if (a > b) { unsigned long int t = b; b = a; a = t; }
+    b -= a;
+  } while (b != 0);
+#else
+  int shift = 0;
+  while (((a | b) & 1) == 0) { a >>= 1; b >>= 1; ++shift; }
+  while ((a & 1) == 0) a >>= 1;
+  do {
+    while ((b & 1) == 0) b >>= 1;
+    if (a > b) { unsigned long int t = b; b = a; a = t; }
+    b -= a;
+  } while (b != 0);
+#endif
+
+  return (long int) (a << shift);
 }
 
 //______________________________________________________________________________
 void rational::rationalise ()
 {
+  if (fNumerator == 0) {
+    fDenominator = 1;
+    return;
+  }
+  if (fDenominator == 1)
+    return;
+
   long int g = gcd (fNumerator, fDenominator);
   
   fNumerator /= g;
   fDenominator /= g;
-  
-  if (fNumerator == 0)
-    fDenominator = 1;
 }
 
 //______________________________________________________________________________
@@ -13,6 +13,8 @@
 #ifndef __rational__
 #define __rational__
 
+#include <climits>
+#include <utility>
 #include <string>
 #include "exports.h"
 
@@ -20,6 +22,11 @@ using namespace std;
 
 /*!
 \brief	Rational number representation.
+
+	The arithmetic operations are exact as long as the reduced result fits
+	in a long int. Otherwise the result is silently approximated by the
+	closest rational with a denominator within the doubles precision,
+	saturated to +/-LONG_MAX when its magnitude is out of range.
 */
 
 class EXP rational {
@@ -30,12 +37,32 @@ class EXP rational {
         long int fDenominator;        
         
         // Used by rationalise()
-        long int gcd(long int a, long int b); 
+        static long int gcd(long int a, long int b);
+
+        // Overflow checked products and sums, true on overflow
+        static bool mulOverflows (long int a, long int b, long int& result);
+        static bool addOverflows (long int a, long int b, long int& result);
+        static bool subOverflows (long int a, long int b, long int& result);
+
+        // Slow paths, taken when an intermediate product overflows:
+        // the operands are reduced by their common factors first
+        static rational	addReduced (const rational& r1, const rational& r2, bool subtract);
+        static rational	mulReduced (long int n1, long int d1, long int n2, long int d2);
+        static int		compareReduced (const rational& r1, const rational& r2);
+
+        // The closest rational to x with a denominator within the doubles
+        // precision, used when an exact result is out of range
+        static const long int kMaxApproxDenominator = LONG_MAX >> 11;
+        static rational	approximate (double x);
+
+        int compare (const rational& dur) const;
  
     public:    
 	
-        rational(long int num = 0, long int denom = 1);
-        rational(const rational& d);
+        rational(long int num = 0, long int denom = 1)
+                : fNumerator(num), fDenominator(denom ? denom : 1) {} // don't allow zero denominators!
+        rational(const rational& d)
+                : fNumerator(d.fNumerator), fDenominator(d.fDenominator) {}
         rational(const string &str);
     
         long int getNumerator()	const		{ return fNumerator; }
@@ -61,17 +88,18 @@ class EXP rational {
         rational& operator /=(const rational &dur);
         // (i.e. dur * 3/2 or dur * 7/4)
 
-        rational& operator *=(long int num) { fNumerator *= num; return *this; }
-        rational& operator /=(long int num) { fDenominator *= num; return *this; }
+        rational& operator *=(long int num);
+        rational& operator /=(long int num);
  
-        rational& operator =(const rational& dur);
+        rational& operator =(const rational& dur)
+                    { fNumerator = dur.fNumerator; fDenominator = dur.fDenominator; return *this; }
     
-        bool operator >(const rational &dur) const;
+        bool operator >(const rational &dur) const	{return compare(dur) > 0;}
         bool operator >=(const rational &dur) const 	{return !(*this < dur);}
-        bool operator <(const rational &dur) const;
+        bool operator <(const rational &dur) const	{return compare(dur) < 0;}
         bool operator <=(const rational &dur) const 	{return !(*this > dur);}
             
-        bool operator ==(const rational &dur) const;
+        bool operator ==(const rational &dur) const	{return compare(dur) == 0;}
         bool operator !=(const rational &dur) const	{return !(*this == dur);}
       
         bool operator >	(double num) const;
@@ -98,4 +126,124 @@ class EXP rational {
 
 EXP ostream& operator<< (ostream& os, const rational& rat);
 
+//______________________________________________________________________________
+// The arithmetic and comparison operators are inlined: note positions and
+// durations go through them all the time. Most scores use a single
+// 'divisions' value, hence operands sharing the same denominator are
+// handled without any multiplication. The products are overflow checked,
+// the out of line slow paths reducing the operands first.
+
+inline bool rational::mulOverflows (long int a, long int b, long int& result)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_mul_overflow (a, b, &result);
+#else
+	result = (long int) ((unsigned long int) a * (unsigned long int) b);
+	return a != 0 && ((a == -1 && b == LONG_MIN) || result / a != b);
+#endif
+}
+
+inline bool rational::addOverflows (long int a, long int b, long int& result)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_add_overflow (a, b, &result);
+#else
+	result = (long int) ((unsigned long int) a + (unsigned long int) b);
+	return (a >= 0) == (b >= 0) && (result >= 0) != (a >= 0);
+#endif
+}
+
+inline bool rational::subOverflows (long int a, long int b, long int& result)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_sub_overflow (a, b, &result);
+#else
+	result = (long int) ((unsigned long int) a - (unsigned long int) b);
+	return (a >= 0) != (b >= 0) && (result >= 0) != (a >= 0);
+#endif
+}
+
+inline rational rational::operator +(const rational &dur) const {
+	if (fDenominator == dur.fDenominator) {
+		long int n;
+		if (! addOverflows (fNumerator, dur.fNumerator, n)) return rational(n, fDenominator);
+	}
+	else {
+		long int n1, n2, n, d;
+		if (! (mulOverflows (fNumerator, dur.fDenominator, n1)
+			|| mulOverflows (dur.fNumerator, fDenominator, n2)
+			|| addOverflows (n1, n2, n)
+			|| mulOverflows (fDenominator, dur.fDenominator, d)))
+			return rational(n, d);
+	}
+	return addReduced (*this, dur, false);
+}
+
+inline rational rational::operator -(const rational &dur) const {
+	if (fDenominator == dur.fDenominator) {
+		long int n;
+		if (! subOverflows (fNumerator, dur.fNumerator, n)) return rational(n, fDenominator);
+	}
+	else {
+		long int n1, n2, n, d;
+		if (! (mulOverflows (fNumerator, dur.fDenominator, n1)
+			|| mulOverflows (dur.fNumerator, fDenominator, n2)
+			|| subOverflows (n1, n2, n)
+			|| mulOverflows (fDenominator, dur.fDenominator, d)))
+			return rational(n, d);
+	}
+	return addReduced (*this, dur, true);
+}
+
+inline rational rational::operator *(const rational &dur) const {
+	long int n, d;
+	if (mulOverflows (fNumerator, dur.fNumerator, n) || mulOverflows (fDenominator, dur.fDenominator, d))
+		return mulReduced (fNumerator, fDenominator, dur.fNumerator, dur.fDenominator);
+	return rational(n, d);
+}
+
+inline rational rational::operator /(const rational &dur) const {
+	long int n, d;
+	if (mulOverflows (fNumerator, dur.fDenominator, n) || mulOverflows (fDenominator, dur.fNumerator, d))
+		return mulReduced (fNumerator, fDenominator, dur.fDenominator, dur.fNumerator);
+	return rational(n, d);
+}
+
+inline rational rational::operator *(int num) const	{ return *this * rational(num); }
+inline rational rational::operator /(int num) const	{ return *this / rational(num); }
+
+inline rational& rational::operator +=(const rational &dur)	{ return *this = *this + dur; }
+inline rational& rational::operator -=(const rational &dur)	{ return *this = *this - dur; }
+inline rational& rational::operator *=(const rational &dur)	{ return *this = *this * dur; }
+inline rational& rational::operator /=(const rational &dur)	{ return *this = *this / dur; }
+
+inline rational& rational::operator *=(long int num) {
+	long int n;
+	if (mulOverflows (fNumerator, num, n)) return *this = mulReduced (fNumerator, fDenominator, num, 1);
+	fNumerator = n;
+	return *this;
+}
+
+inline rational& rational::operator /=(long int num) {
+	long int d;
+	if (mulOverflows (fDenominator, num, d)) return *this = mulReduced (fNumerator, fDenominator, 1, num);
+	fDenominator = d;
+	return *this;
+}
+
+inline int rational::compare (const rational& dur) const
+{
+	long int a, b;
+	if (fDenominator == dur.fDenominator) {
+		// a/d < c/d if and only if a < c, for a positive d
+		a = fNumerator;
+		b = dur.fNumerator;
+		if (fDenominator < 0) std::swap (a, b);
+	}
+	// a/b < c/d if and only if a * d < b * c.
+	else if (mulOverflows (fNumerator, dur.fDenominator, a) || mulOverflows (fDenominator, dur.fNumerator, b))
+		return compareReduced (*this, dur);
+	return (a > b) - (a < b);
+}
+
 #endif
@@ -13,6 +13,7 @@
 #ifndef __tree_browser__
 #define __tree_browser__
 
+#include <vector>
 #include "exports.h"
 #include "basevisitor.h"
 #include "browser.h"
@@ -37,12 +38,25 @@ template <typename T> class EXP tree_browser : public browser<T>
 		virtual ~tree_browser() {}
 
 		virtual void set (basevisitor* v)	{  fVisitor = v; }
+		//! depth first traversal using an explicit stack: deep trees don't exhaust the call stack
 		virtual void browse (T& t) {
+			typedef std::pair<T*, typename ctree<T>::literator> state;	// a node and its next sub element
+			std::vector<state> stack;
+			stack.reserve (32);
 			enter(t);
-			typename ctree<T>::literator iter;
-			for (iter = t.lbegin(); iter != t.lend(); iter++)
-				browse(**iter);
-			leave(t);
+			stack.push_back (state(&t, t.lbegin()));
+			while (stack.size()) {
+				state& s = stack.back();
+				if (s.second == s.first->lend()) {
+					leave(*s.first);
+					stack.pop_back();
+				}
+				else {
+					T* elt = *s.second++;
+					enter(*elt);
+					stack.push_back (state(elt, elt->lbegin()));
+				}
+			}
 		}
 };
 
@@ -16,6 +16,7 @@
 
 #include "version.h"
 #include "utilities.h"
+#include "messagesHandling.h"
 
 #include "extraOptions.h"
 
@@ -346,9 +347,9 @@ ostream& operator<< (ostream& os, const S_optionsShowChordAnalysisItem& elt)
 
 //_______________________________________________________________________________
 
-S_extraOptions gExtraOptions;
-S_extraOptions gExtraOptionsUserChoices;
-S_extraOptions gExtraOptionsWithDetailedTrace;
+thread_local S_extraOptions gExtraOptions;
+thread_local S_extraOptions gExtraOptionsUserChoices;
+thread_local S_extraOptions gExtraOptionsWithDetailedTrace;
 
 S_extraOptions extraOptions::create (
   S_optionsHandler optionsHandler)
@@ -613,7 +614,7 @@ S_optionsItem extraOptions::handleOptionsItem (
       printAllChordsStructures (os);
 
     // exit
-    exit (0);
+    throw msrException (0);
   }
   
   else if (
@@ -720,7 +721,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
         break;
   
@@ -764,7 +765,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
     } // switch
 
@@ -775,7 +776,7 @@ void extraOptions::handleOptionsItemValue (
       semiTonesPitchKind);
 
   // exit
-  exit (23);
+  throw msrException (23);
   }
   
   else if (
@@ -849,7 +850,7 @@ void extraOptions::handleOptionsItemValue (
         showChordDetailsItem->
           getOptionsSubGroupUplink ());
           
-      exit (4);
+      throw msrException (4);
     }
 
     string
@@ -889,7 +890,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
         break;
   
@@ -933,7 +934,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
     } // switch
 
@@ -950,7 +951,7 @@ void extraOptions::handleOptionsItemValue (
       harmonyKind);
 
     // exit
-    exit (23);
+    throw msrException (23);
   }
   
   else if (
@@ -1026,7 +1027,7 @@ void extraOptions::handleOptionsItemValue (
         showChordAnalysisItem->
           getOptionsSubGroupUplink ());
           
-      exit (4);
+      throw msrException (4);
     }
 
     string
@@ -1077,7 +1078,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
         break;
   
@@ -1121,7 +1122,7 @@ void extraOptions::handleOptionsItemValue (
             
           optionError (s.str ());
                     
-          exit (4);
+          throw msrException (4);
         }
     } // switch
 
@@ -1143,7 +1144,7 @@ void extraOptions::handleOptionsItemValue (
         
       optionError (s.str ());
                 
-      exit (4);
+      throw msrException (4);
     }
     
     // print the chord analysis
@@ -1154,7 +1155,7 @@ void extraOptions::handleOptionsItemValue (
       inversion);
       
     // exit
-    exit (23);
+    throw msrException (23);
   }
 }
 
@@ -23,8 +23,8 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_generalOptions gGeneralOptions;
-S_generalOptions gGeneralOptionsUserChoices;
+thread_local S_generalOptions gGeneralOptions;
+thread_local S_generalOptions gGeneralOptionsUserChoices;
 
 S_generalOptions generalOptions::create (
   S_optionsHandler optionsHandler)
@@ -200,6 +200,10 @@ R"(Write information about CPU usage to standard error.)",
   {
     // variables  
   
+    fExit2a = false;
+    fExit2b = false;
+    fExit3  = false;
+
     // options
   
     S_optionsSubGroup
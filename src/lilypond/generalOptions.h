@@ -111,9 +111,9 @@ class generalOptions : public optionsGroup
 typedef SMARTP<generalOptions> S_generalOptions;
 EXP ostream& operator<< (ostream& os, const S_generalOptions& elt);
 
-EXP extern S_generalOptions gGeneralOptions;
-EXP extern S_generalOptions gGeneralOptionsUserChoices;
-EXP extern S_generalOptions gGeneralOptionsWithDetailedTrace;
+extern thread_local S_generalOptions gGeneralOptions;
+extern thread_local S_generalOptions gGeneralOptionsUserChoices;
+extern thread_local S_generalOptions gGeneralOptionsWithDetailedTrace;
 
 //______________________________________________________________________________
 void initializeGeneralOptionsHandling (
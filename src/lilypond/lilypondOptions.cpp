@@ -16,6 +16,7 @@
 #include <regex>
 
 #include "utilities.h"
+#include "messagesHandling.h"
 
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
@@ -212,9 +213,9 @@ ostream& operator<< (ostream& os, const S_optionsMidiTempoItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lilypondOptions gLilypondOptions;
-S_lilypondOptions gLilypondOptionsUserChoices;
-S_lilypondOptions gLilypondOptionsWithDetailedTrace;
+thread_local S_lilypondOptions gLilypondOptions;
+thread_local S_lilypondOptions gLilypondOptionsUserChoices;
+thread_local S_lilypondOptions gLilypondOptionsWithDetailedTrace;
 
 S_lilypondOptions lilypondOptions::create (
   S_optionsHandler optionsHandler)
@@ -1867,7 +1868,7 @@ void lilypondOptions::handleOptionsItemValue (
       
       printHelpSummary (os);
       
-      exit (4);
+      throw msrException (4);
     }
   
     accidentalStyleKindItem->
@@ -1936,7 +1937,7 @@ void lilypondOptions::handleOptionsItemValue (
         midiTempoItem->
           getOptionsSubGroupUplink ());
           
-      exit (4);
+      throw msrException (4);
     }
 
     string midiTempoDuration  = sm [1];
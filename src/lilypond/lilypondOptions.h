@@ -478,9 +478,9 @@ pickCopyright
 typedef SMARTP<lilypondOptions> S_lilypondOptions;
 EXP ostream& operator<< (ostream& os, const S_lilypondOptions& elt);
 
-EXP extern S_lilypondOptions gLilypondOptions;
-EXP extern S_lilypondOptions gLilypondOptionsUserChoices;
-EXP extern S_lilypondOptions gLilypondOptionsWithDetailedTrace;
+extern thread_local S_lilypondOptions gLilypondOptions;
+extern thread_local S_lilypondOptions gLilypondOptionsUserChoices;
+extern thread_local S_lilypondOptions gLilypondOptionsWithDetailedTrace;
 
 //______________________________________________________________________________
 void initializeLilypondOptionsHandling (
@@ -235,7 +235,7 @@ string lpsr2LilypondTranslator::absoluteOctaveAsLilypondString (
   string result;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     fLilypondCodeIOstream <<
       endl <<
       "%{ absoluteOctave = " << absoluteOctave << " %} " <<
@@ -390,7 +390,7 @@ string lpsr2LilypondTranslator::lilypondRelativeOctave (
       referenceDiatonicPitchKind - kC;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     const int fieldWidth = 28;
 
     fLilypondCodeIOstream << left <<
@@ -476,7 +476,7 @@ string lpsr2LilypondTranslator::stringTuningAsLilypondString (
         stringTuningAlterationKind);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceScordaturas) {
+  if (gTraceFlags [kTraceScordaturasFlag]) {
     int
       getStringTuningNumber =
         stringTuning->
@@ -581,7 +581,7 @@ string lpsr2LilypondTranslator::notePitchAsLilypondString (
     ! fRelativeOctaveReference;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     int noteAbsoluteDisplayOctave =
       note->getNoteDisplayOctave ();
   
@@ -722,8 +722,10 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
 //    quarterTonesDisplayPitchAsString;
     
   // in MusicXML, octave number is 4 for the octave starting with middle C
+#ifdef TRACE_OPTIONS
   int noteAbsoluteOctave =
     note->getNoteOctave ();
+#endif
     
   // should an absolute octave be generated?
   bool generateAbsoluteOctave =
@@ -735,7 +737,7 @@ string lpsr2LilypondTranslator::pitchedRestAsLilypondString (
     note->getNoteDisplayOctave ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     const int fieldWidth = 28;
 
     fLilypondCodeIOstream << left <<
@@ -852,7 +854,7 @@ void lpsr2LilypondTranslator::generateNote (
             } // switch
 
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceLigatures) {
+            if (gTraceFlags [kTraceLigaturesFlag]) {
               fLogOutputStream <<
                 "Ligature vertical flipping factore for note '" <<
                 note->asString () <<
@@ -2557,6 +2559,11 @@ void lpsr2LilypondTranslator::generateCodeForSpannerAfterNote (
                 spanner->
                   getSpannerOtherEndSidelink ();
 
+            // sanity check
+            msrAssert (
+              spannerStartEnd != nullptr,
+              "wavy line spanner stop has no start end");
+
             // has the start end a trill ornament?
             if (spannerStartEnd->getSpannerNoteUplink ()->getNoteTrillOrnament ()) {
               fLilypondCodeIOstream <<
@@ -2721,7 +2728,7 @@ string lpsr2LilypondTranslator::singleTremoloDurationAsLilypondString (
   }
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     fLogOutputStream <<
       "singleTremoloDurationAsLilypondString()" <<
       ", line " << singleTremolo->getInputLineNumber () <<
@@ -3331,12 +3338,14 @@ string lpsr2LilypondTranslator::generateMultilineName (string theString)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrScore" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   // initial empty line in LilyPond code
   // to help copy/paste it
@@ -3345,12 +3354,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrScore& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrScore" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // final empty line in LilyPond code
   // to help copy/paste it
@@ -3585,12 +3596,14 @@ void lpsr2LilypondTranslator::generateLpsrVarValsListAssocValues (
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVarValAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (elt->getComment ().size ()) {
     fLilypondCodeIOstream <<
@@ -3687,23 +3700,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrVarValAssoc& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVarValsListAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // the largest variable name length in a header is 18 JMI
   int fieldWidth;
@@ -3735,23 +3752,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrVarValsListAssoc& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVarValsListAssoc& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeVariable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrSchemeVariable" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (elt->getComment ().size ()) {
     fLilypondCodeIOstream <<
@@ -3784,23 +3805,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeVariable& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeVariable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrSchemeVariable" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrHeader& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrHeader" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\header" << " {" <<
@@ -3958,12 +3983,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrHeader& elt)
 
   gIndenter--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrHeader" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "}" <<
@@ -3973,12 +4000,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrHeader& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrPaper& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPaper" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\paper" << " {" <<
@@ -4227,12 +4256,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPaper& elt)
 {
   gIndenter--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPaper" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
       
   fLilypondCodeIOstream <<
     "}" <<
@@ -4242,12 +4273,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPaper& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrLayout& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\layout {" <<
@@ -4277,12 +4310,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrLayout& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (gLilypondOptions->fRepeatBrackets) {
     fLilypondCodeIOstream <<
@@ -4341,12 +4376,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrLayout& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrScoreBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrScoreBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\score {" <<
@@ -4367,12 +4404,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrScoreBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrScoreBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* JMI
   if (elt->getScoreBlockElements ().size ()) {
@@ -4396,12 +4435,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrScoreBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrParallelMusicBLock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   fNumberOfPartGroupBlocks =
     elt->
@@ -4431,12 +4472,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrParallelMusicBLock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrParallelMusicBLock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrParallelMusicBLock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
     
   fLilypondCodeIOstream <<
     endl;
@@ -4470,7 +4513,8 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
     partGroup =
       elt->getPartGroup ();
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPartGroupBlock for '" <<
       partGroup->asShortString () <<
@@ -4478,6 +4522,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fPartGroupBlocksCounter++;
 
@@ -4695,12 +4740,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartGroupBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrPartGroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPartGroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // fetch part group
   S_msrPartGroup
@@ -4747,13 +4794,15 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrPartBlock& elt)
     part =
       elt->getPart ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrPartBlock for '" <<
       part->asShortString () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fPartGroupBlockElementsCounter++;
 
@@ -4836,12 +4885,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartBlock& elt)
     part =
       elt->getPart ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrPartBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (part->getPartStavesMap ().size () > 1) {
     // don't generate code for a part with only one stave
@@ -4872,12 +4923,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrPartBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fStaffBlocksCounter++;
   
@@ -5112,12 +5165,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrStaffBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -5145,7 +5200,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrStaffBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffgroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewStaffgroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5161,7 +5216,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffgroupBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffgroupBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewStaffgroupBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5178,7 +5233,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffgroupBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5190,7 +5245,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrNewStaffBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewStaffBlock" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5204,12 +5259,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrNewStaffBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrUseVoiceCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   S_msrVoice
     voice = elt->getVoice ();
@@ -5322,23 +5379,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrUseVoiceCommand& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrUseVoiceCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrUseVoiceCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
   
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrNewLyricsBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrNewLyricsBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (! gLilypondOptions->fNoLilypondLyrics) {
     S_msrStanza stanza = elt->getStanza ();
@@ -5377,12 +5438,14 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrNewLyricsBlock& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrNewLyricsBlock& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrNewLyricsBlock" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (! gLilypondOptions->fNoLilypondLyrics) {
     // JMI
@@ -5392,24 +5455,28 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrNewLyricsBlock& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrVariableUseCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrVariableUseCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrVariableUseCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrVariableUseCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 }
@@ -5417,12 +5484,14 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrVariableUseCommand& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrChordNamesContext" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   string
     contextTypeKindAsString =
@@ -5465,23 +5534,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrChordNamesContext& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrChordNamesContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrChordNamesContext" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
   
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrFiguredBassContext" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   string
     contextTypeKindAsString =
@@ -5524,35 +5597,41 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrFiguredBassContext& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrFiguredBassContext& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrFiguredBassContext" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
   
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrBarCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrBarCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrBarCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrBarCommand" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 }
@@ -5561,7 +5640,7 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrBarCommand& elt)
 /* JMI
 void lpsr2LilypondTranslator::visitStart (S_lpsrMelismaCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrMelismaCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5580,7 +5659,7 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrMelismaCommand& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrMelismaCommand& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrMelismaCommand" <<
       ", line " << elt->getInputLineNumber () <<
@@ -5592,86 +5671,102 @@ void lpsr2LilypondTranslator::visitEnd (S_lpsrMelismaCommand& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrScore" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrScore& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrScore" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrCredit& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrCredit& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitStart (S_msrCreditWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrCreditWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartGroup" <<
       ", line " << elt->getInputLineNumber () <<
       elt->getPartGroupCombinedName () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPartGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPartGroup" <<
       elt->getPartGroupCombinedName () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -5681,16 +5776,18 @@ void lpsr2LilypondTranslator::visitStart (S_msrPart& elt)
     partCombinedName =
       elt->getPartCombinedName ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPart" <<
       partCombinedName <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partCombinedName << "\"" <<
@@ -5707,13 +5804,15 @@ void lpsr2LilypondTranslator::visitStart (S_msrPart& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPart" <<
       elt->getPartCombinedName () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPart = nullptr;
 }
@@ -5721,7 +5820,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrPart& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStaff& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStaff \"" <<
       elt->getStaffName () <<
@@ -5729,13 +5829,15 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaff& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   fOnGoingStaff = true;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStaff& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStaff \"" <<
       elt->getStaffName () <<
@@ -5743,17 +5845,20 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStaff& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   fOnGoingStaff = false;
 }
 
 void lpsr2LilypondTranslator::visitStart (S_msrStaffTuning& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrStaffTuning" <<
       endl;
   }
+#endif
 
 /* JMI
   list<S_msrStaffTuning>
@@ -5793,11 +5898,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaffTuning& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrStaffDetails& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrStaffDetails" <<
       endl;
   }
+#endif
 
   // fetch staff lines number
   int
@@ -5820,7 +5927,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrStaffDetails& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrVoice \"" <<
       elt->getVoiceName () <<
@@ -5828,6 +5936,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoice& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoice = elt;
   
@@ -5962,7 +6071,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
 {
   gIndenter--;
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrVoice \"" <<
       elt->getVoiceName () <<
@@ -5970,6 +6080,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   if (
     fCurrentVoice->getVoiceContainsMultipleRests ()
@@ -6034,13 +6145,15 @@ void lpsr2LilypondTranslator::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrVoiceStaffChange& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrVoiceStaffChange '" <<
       elt->asString () << "'" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     endl <<
@@ -6061,7 +6174,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrVoiceStaffChange& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -6072,10 +6186,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies) {
+    if (gTraceFlags [kTraceHarmoniesFlag]) {
       fLilypondCodeIOstream <<
         "%{ " << elt->asString () << " %}" <<
         endl;
@@ -6114,7 +6229,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarmony& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -6122,10 +6238,11 @@ void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   if (fOnGoingNote) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFrames) {
+    if (gTraceFlags [kTraceFramesFlag]) {
       fLilypondCodeIOstream <<
         "%{ " << elt->asString () << " %}" <<
         endl;
@@ -6141,7 +6258,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrFrame& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -6149,6 +6267,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFiguredBass = elt;
   
@@ -6189,7 +6308,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrFiguredBass& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrFigure& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFigure '" <<
       elt->asString () <<
@@ -6197,6 +6317,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrFigure& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFiguredBassFiguresCounter++;
   
@@ -6294,7 +6415,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrFigure& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrFiguredBass& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -6302,6 +6424,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrFiguredBass& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     ">" <<
@@ -6315,12 +6438,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrFiguredBass& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSegment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       endl;
   }
+#endif
 
   if (gLilypondOptions->fComments) {
     fLilypondCodeIOstream << left <<
@@ -6336,12 +6461,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrSegment& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSegment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       endl;
   }
+#endif
 
   if (gLilypondOptions->fComments) {
     gIndenter--;
@@ -6372,7 +6499,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
       elt->getMeasureNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     fLogOutputStream <<
       endl <<
       "% <!--=== measure '" << measureNumber <<
@@ -6415,7 +6542,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
     measureKind =
       elt->getMeasureKind ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasure " <<
       measureNumber <<
@@ -6424,6 +6552,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasure& elt)
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (gLilypondOptions->fComments) {
     fLilypondCodeIOstream << left <<
@@ -6528,7 +6657,7 @@ else
         ratioToFullLength.rationalise ();
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasuresDetails) {
+        if (gTraceFlags [kTraceMeasuresDetailsFlag]) {
           const int fieldWidth = 27;
           
           fLilypondCodeIOstream << left <<
@@ -6654,7 +6783,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
       elt->getNextMeasureNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     fLogOutputStream <<
       endl <<
       "% <!--=== measure '" << measureNumber <<
@@ -6673,7 +6802,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
     measureKind =
       elt->getMeasureKind ();
       
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMeasure " <<
       measureNumber <<
@@ -6682,6 +6812,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
  // JMI if (! fOnGoingMultipleRestMeasures) {}
   {
@@ -6799,7 +6930,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasure& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -6807,6 +6939,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (! gLilypondOptions->fNoLilypondLyrics) {
     // don't generate code for the stanza inside the code for the voice
@@ -6827,7 +6960,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrStanza& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -6835,6 +6969,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (! gLilypondOptions->fNoLilypondLyrics) {
     if (fGenerateCodeForOngoingNonEmptyStanza) {
@@ -6854,7 +6989,8 @@ void lpsr2LilypondTranslator::visitEnd (S_msrStanza& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSyllable '" <<
       elt->asString () <<
@@ -6862,6 +6998,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (! gLilypondOptions->fNoLilypondLyrics) {
     if (fGenerateCodeForOngoingNonEmptyStanza) {
@@ -6875,7 +7012,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableSingle %} ";
           }
@@ -6891,7 +7028,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " -- ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableBegin %} ";
           }
@@ -6907,7 +7044,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " -- ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableMiddle %} ";
           }
@@ -6923,7 +7060,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableEnd %} ";
           }
@@ -6938,7 +7075,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
             elt->syllableWholeNotesAsMsrString () <<
             " ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableSkip %} ";
           }
@@ -6996,7 +7133,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           fLilypondCodeIOstream <<
             "__ ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendSingle %} ";
           }
@@ -7009,7 +7146,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           fLilypondCodeIOstream <<
             "__ ";
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendStart %} ";
           }
@@ -7018,7 +7155,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           
         case msrSyllable::kSyllableExtendContinue:
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendContinue %} ";
           }
@@ -7027,7 +7164,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
           
         case msrSyllable::kSyllableExtendStop:
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceLyrics) {
+          if (gTraceFlags [kTraceLyricsFlag]) {
             fLilypondCodeIOstream <<
               "%{ kSyllableExtendStop %} ";
           }
@@ -7049,7 +7186,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrSyllable& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSyllable& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSyllable '" <<
       elt->asString () <<
@@ -7057,12 +7195,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrSyllable& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrClef '" <<
       elt->asString () <<
@@ -7070,6 +7210,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   msrClef::msrClefKind
     clefKind =
@@ -7169,7 +7310,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrClef& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrClef& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrClef '" <<
       elt->asString () <<
@@ -7177,12 +7319,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrClef& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrKey '" <<
       elt->asString () <<
@@ -7190,6 +7334,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   switch (elt->getKeyKind ()) {
     case msrKey::kTraditionalKind:
@@ -7279,7 +7424,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrKey& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrKey& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrKey '" <<
       elt->asString () <<
@@ -7287,18 +7433,21 @@ void lpsr2LilypondTranslator::visitEnd (S_msrKey& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTime " <<
       elt->asString () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   msrTime::msrTimeSymbolKind
     timeSymbolKind =
@@ -7465,24 +7614,28 @@ void lpsr2LilypondTranslator::visitStart (S_msrTime& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTime& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTime " <<
       elt->asString () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTranspose& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int inputLineNumber =
     elt->getInputLineNumber ();
@@ -7920,7 +8073,7 @@ If the double element is present, it indicates that the music is doubled one oct
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions) {
+  if (gTraceFlags [kTraceTranspositionsFlag]) {
     fLilypondCodeIOstream << // JMI
       "Handlling transpose '" <<
       elt->transposeAsString () <<
@@ -7954,23 +8107,27 @@ If the double element is present, it indicates that the music is doubled one oct
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTranspose& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartNameDisplay& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartNameDisplay" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   string partNameDisplayValue =
     elt->getPartNameDisplayValue ();
@@ -7993,12 +8150,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrPartNameDisplay& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPartAbbreviationDisplay" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   string partAbbreviationDisplayValue =
     elt->getPartAbbreviationDisplayValue ();
@@ -8012,12 +8171,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int inputLineNumber =
     elt->getInputLineNumber ();
@@ -8295,12 +8456,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempo& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoRelationshipElements& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoRelationshipElements" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\fixed b' {" <<
@@ -8311,12 +8474,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoRelationshipElements& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempoRelationshipElements& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempoRelationshipElements" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -8328,12 +8493,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTempoRelationshipElements& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoNote" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "b" <<
@@ -8345,12 +8512,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoNote& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrTempoTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTempoTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\tuplet " <<
@@ -8361,12 +8530,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrTempoTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempoTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempoTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "}";
@@ -8374,23 +8545,27 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTempoTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTempo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrArticulation& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the articulation here,
   // the note or chord will do it in its visitEnd () method
@@ -8398,23 +8573,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrArticulation& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrArticulation& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrFermata& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
 Articulations can be attached to rests as well as notes but they cannot be attached to multi-measure rests. A special predefined command, \fermataMarkup, is available for at- taching a fermata to a multi-measure rest (and only a multi-measure rest). This creates a MultiMeasureRestText object.
@@ -8464,23 +8643,27 @@ Articulations can be attached to rests as well as notes but they cannot be attac
 
 void lpsr2LilypondTranslator::visitEnd (S_msrFermata& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* VIRER JMI
   */
@@ -8488,23 +8671,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrArpeggiato& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrNonArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* VIRER JMI
   */
@@ -8512,23 +8699,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrNonArpeggiato& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrNonArpeggiato& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnical& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the technical here,
   // the note or chord will do it in its visitEnd () method
@@ -8536,18 +8727,21 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnical& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnical& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithInteger" <<
       ", fOnGoingChord = " <<
@@ -8555,6 +8749,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithInteger& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the technicalWithInteger here,
   // the note or chord will do it in its visitEnd () method
@@ -8562,18 +8757,21 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithFloat" <<
       ", fOnGoingChord = " <<
@@ -8581,6 +8779,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithFloat& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the technicalWithFloat here,
   // the note or chord will do it in its visitEnd () method
@@ -8588,23 +8787,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithString& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the technicalWithString here,
   // the note or chord will do it in its visitEnd () method
@@ -8612,23 +8815,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrTechnicalWithString& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTechnicalWithString& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOrnament& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the ornament here,
   // the note or chord will do it in its visitEnd () method
@@ -8636,23 +8843,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrOrnament& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOrnament& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrGlissando& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the glissando here,
   // the note or chord will do it in its visitEnd () method
@@ -8660,23 +8871,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrGlissando& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrGlissando& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSlide& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the slide here,
   // the note or chord will do it in its visitEnd () method
@@ -8684,23 +8899,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrSlide& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSlide& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSingleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't generate the singleTremolo here,
   // the note or chord will do it in its visitEnd () method
@@ -8708,30 +8927,34 @@ void lpsr2LilypondTranslator::visitStart (S_msrSingleTremolo& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSingleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrDoubleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // get double tremolo number of repeats
   int numberOfRepeats =
     elt->getDoubleTremoloNumberOfRepeats ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     fLilypondCodeIOstream <<
       "% visitStart (S_msrDoubleTremolo&)" <<
       endl;
@@ -8767,12 +8990,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrDoubleTremolo& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrDoubleTremolo& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
   
@@ -8784,127 +9009,151 @@ void lpsr2LilypondTranslator::visitEnd (S_msrDoubleTremolo& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOtherDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOtherDynamics& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrWords& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSlur& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrSlur& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrLigature& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrLigature& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrWedge& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrWedge& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -9127,24 +9376,28 @@ void lpsr2LilypondTranslator::generateGraceNotesGroup (
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingGraceNotesGroup = true;
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingGraceNotesGroup = false;
 }
@@ -9152,12 +9405,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAfterGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
  // JMI exists? if (elt->getGraceNotesGroupIsSlashed ()) {}
   fLilypondCodeIOstream <<
@@ -9166,12 +9421,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroup& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroupContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAfterGraceNotesGroupContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // write a first closing right bracket right now
   fLilypondCodeIOstream <<
@@ -9184,12 +9441,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrAfterGraceNotesGroupContents& elt
 
 void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroupContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrAfterGraceNotesGroupContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "} ";
@@ -9197,18 +9456,21 @@ void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroupContents& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrAfterGraceNotesGroup& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrAfterGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting " <<
       msrNote::noteKindAsString (elt->getNoteKind ()) <<
@@ -9216,6 +9478,7 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // is this a multiple rest to be ignored?
   switch (elt->getNoteKind ()) {
@@ -9231,16 +9494,16 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
         
           if (inhibitMultipleRestMeasuresBrowsing) {
             if (
-              gMsrOptions->fTraceMsrVisitors
+              gTraceFlags [kTraceMsrVisitorsFlag]
                 ||
-              gTraceOptions->fTraceRepeats) {
+              gTraceFlags [kTraceRepeatsFlag]) {
               gLogIOstream <<
                 "% ==> visiting multiple rest measure is ignored" <<
                 endl;
             }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     gLogIOstream <<
       "% ==> returning from visitStart (S_msrNote&)" <<
     endl;
@@ -9254,9 +9517,9 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
         ) {
           gLogIOstream <<
             "% ==> start visiting multiple rest measure is ignored" <<
@@ -9272,9 +9535,9 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
       if (elt->getNoteGraceNotesGroupUplink ()) {
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceNotes
+          gTraceFlags [kTraceNotesFlag]
         ) {
           gLogIOstream <<
             "% ==> start visiting skip notes is ignored" <<
@@ -9289,9 +9552,9 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
     case msrNote::kGraceNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceGraceNotes
+          gTraceFlags [kTraceGraceNotesFlag]
         ) {
           gLogIOstream <<
             "% ==> start visiting grace notes is ignored" <<
@@ -9305,9 +9568,9 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
     case msrNote::kGraceChordMemberNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceGraceNotes
+          gTraceFlags [kTraceGraceNotesFlag]
         ) {
           gLogIOstream <<
             "% ==> start visiting chord grace notes is ignored" <<
@@ -10033,7 +10296,8 @@ void lpsr2LilypondTranslator::visitStart (S_msrNote& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting " <<
       msrNote::noteKindAsString (elt->getNoteKind ()) <<
@@ -10041,6 +10305,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // is this a multiple rest to be ignored?
   switch (elt->getNoteKind ()) {
@@ -10056,9 +10321,9 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
           if (inhibitMultipleRestMeasuresBrowsing) {
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceNotes
+              gTraceFlags [kTraceNotesFlag]
                 ||
-              gTraceOptions->fTraceRepeats
+              gTraceFlags [kTraceRepeatsFlag]
             ) {
               gLogIOstream <<
                 "% ==> end visiting multiple rest measure is ignored" <<
@@ -10067,7 +10332,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
 #endif
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     gLogIOstream <<
       "% ==> returning from visitEnd (S_msrNote&)" <<
       endl;
@@ -10084,9 +10349,9 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
       if (elt->getNoteGraceNotesGroupUplink ()) {
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceNotes
+          gTraceFlags [kTraceNotesFlag]
         ) {
           gLogIOstream <<
             "% ==> end visiting skip notes is ignored" <<
@@ -10101,9 +10366,9 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
     case msrNote::kGraceNote:
 #ifdef TRACE_OPTIONS
         if (
-          gMsrOptions->fTraceMsrVisitors
+          gTraceFlags [kTraceMsrVisitorsFlag]
             ||
-          gTraceOptions->fTraceGraceNotes) {
+          gTraceFlags [kTraceGraceNotesFlag]) {
           gLogIOstream <<
             "% ==> end visiting grace notes is ignored" <<
             endl;
@@ -10878,33 +11143,39 @@ void lpsr2LilypondTranslator::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrOctaveShift& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrOctaveShift& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrAccordionRegistration& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrAccordionRegistration" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int highDotsNumber =
     elt->getHighDotsNumber ();
@@ -10948,12 +11219,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrAccordionRegistration& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrHarpPedalsTuning" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   map<msrDiatonicPitchKind, msrAlterationKind>
     harpPedalsAlterationKindsMap =
@@ -10991,43 +11264,51 @@ void lpsr2LilypondTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrStem& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrStem& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBeam& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBeam& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -11793,26 +12074,30 @@ void lpsr2LilypondTranslator::generateChord (S_msrChord chord)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrChord& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
+#ifdef TRACE_OPTIONS
   int chordInputLineNumber =
     elt->getInputLineNumber ();
+#endif
     
-#ifdef TRACE_OPTIONS
   if (fOnGoingGraceNotesGroup) {
+#ifdef TRACE_OPTIONS
     msrInternalWarning (
       gXml2lyOptions->fInputSourceName,
       chordInputLineNumber,
       "% ==> Start visiting grace chords is ignored");
+#endif
 
     return;
   }
-#endif
   
   // print the chord's grace notes before if any,
   // but not ??? JMI
@@ -12075,26 +12360,28 @@ void lpsr2LilypondTranslator::visitStart (S_msrChord& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrChord& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int chordInputLineNumber =
     elt->getInputLineNumber ();
     
-#ifdef TRACE_OPTIONS
   if (fOnGoingGraceNotesGroup) {
+#ifdef TRACE_OPTIONS
     msrInternalWarning (
       gXml2lyOptions->fInputSourceName,
       chordInputLineNumber,
       "% ==> End visiting grace chords is ignored");
+#endif
 
     return;
   }
-#endif
   
   // generate the end of the chord
   fLilypondCodeIOstream <<
@@ -12606,12 +12893,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrChord& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int inputLineNumber =
     elt->getInputLineNumber ();
@@ -12765,12 +13054,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrTuplet& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTuplet& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -12804,12 +13095,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrTuplet& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrTie& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   switch (elt->getTieKind ()) {
     case msrTie::kTieNone:
@@ -12826,23 +13119,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrTie& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrTie& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrSegno& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrSegno" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\mark \\markup { \\musicglyph #\"scripts.segno\" }" <<
@@ -12851,12 +13148,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrSegno& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrCoda& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrCoda" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\mark \\markup { \\musicglyph #\"scripts.coda\" }" <<
@@ -12866,12 +13165,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrCoda& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrEyeGlasses& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting eyeGlasses" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "^\\markup {\\eyeglasses} ";
@@ -12879,12 +13180,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrEyeGlasses& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrScordatura& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting scordatura" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* JMI
   const list<S_msrStringTuning>&
@@ -12949,12 +13252,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrPedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting pedal" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
       
   fLilypondCodeIOstream <<
     endl;
@@ -13002,12 +13307,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrPedal& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrDamp& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting damp" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "^\\markup {\\damp} ";
@@ -13015,12 +13322,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrDamp& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrDampAll& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting dampAll" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "^\\markup {\\dampAll} ";
@@ -13029,13 +13338,15 @@ void lpsr2LilypondTranslator::visitStart (S_msrDampAll& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       endl <<
       "% --> Start visiting msrBarline" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int inputLineNumber =
     elt->getInputLineNumber ();
@@ -13150,24 +13461,28 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarline& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarline& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       endl <<
       "% --> End visiting msrBarline" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
       
   string nextBarNumber =
     elt->getNextBarNumber ();
@@ -13180,23 +13495,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarCheck& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // MusicXML bar numbers cannot be relied upon for a LilyPond bar number check
   fLilypondCodeIOstream <<
@@ -13208,23 +13527,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrBarNumberCheck& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrLineBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\myBreak | % " << elt->getNextBarNumber () <<
@@ -13234,23 +13557,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrLineBreak& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrLineBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrPageBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "\\myPageBreak " <<
@@ -13260,23 +13587,27 @@ void lpsr2LilypondTranslator::visitStart (S_msrPageBreak& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrPageBreak& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int repeatEndingsNumber =
     elt->getRepeatEndings ().size ();
@@ -13329,12 +13660,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeat& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   /*
     CAUTION:
@@ -13368,33 +13701,39 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeat& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeatCommonPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fRepeatsDescrStack.back ()->
     incrementRepeatEndingsCounter ();
@@ -13502,12 +13841,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrRepeatEnding& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -13546,7 +13887,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLilypondCodeIOstream <<
       "% ===**** fRepeatsDescrStack.back () = '" <<
       fRepeatsDescrStack.back ()->repeatDescrAsString () <<
@@ -13582,12 +13923,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrRepeatEnding& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrComment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrComment" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     "% " << elt->getContents () <<
@@ -13599,23 +13942,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrComment& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrComment& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrComment" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeFunction& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting lpsrSchemeFunction" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     endl <<
@@ -13630,23 +13977,27 @@ void lpsr2LilypondTranslator::visitStart (S_lpsrSchemeFunction& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_lpsrSchemeFunction& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting lpsrSchemeFunction" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrRehearsal& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fLilypondCodeIOstream <<
     endl;
@@ -13706,35 +14057,41 @@ void lpsr2LilypondTranslator::visitStart (S_msrRehearsal& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrRehearsal& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
+#ifdef TRACE_OPTIONS
   int repeatMeasuresNumber =
     elt->measuresRepeatPatternMeasuresNumber ();
 
   int replicasMeasuresNumber =
     elt->measuresRepeatReplicasMeasuresNumber ();
+#endif
     
   int replicasNumber =
     elt->measuresRepeatReplicasNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceRepeatsFlag]) {
     fLilypondCodeIOstream <<
       "% measure repeat, line " << elt->getInputLineNumber () << ":" <<
       endl;
@@ -13779,12 +14136,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeat& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
   
@@ -13810,11 +14169,13 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMeasuresRepeatPattern" <<
       endl;
   }
+#endif
 
   gIndenter++;
 
@@ -13823,22 +14184,26 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatPattern& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMeasuresRepeatPattern" <<
       endl;
   }
+#endif
 
   gIndenter--;
 }
   
 void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMeasuresRepeatReplicas" <<
       endl;
   }
+#endif
 
   // output the start of the ending
   if (gLilypondOptions->fComments) {  
@@ -13859,11 +14224,13 @@ void lpsr2LilypondTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMeasuresRepeatReplicas" <<
       endl;
   }
+#endif
 
   gIndenter--;
 }
@@ -13871,12 +14238,14 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMultipleRest" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // generate the code now:
   // waiting until visitEnd (S_msrMultipleRest&)
@@ -13951,12 +14320,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMultipleRest& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMultipleRest" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
     
   // now we can generate the bar check
   fLilypondCodeIOstream <<    
@@ -13990,7 +14361,7 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
     elt->multipleRestContentsMeasuresNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceRepeatsFlag]) {
     fLilypondCodeIOstream <<
       "% multiple rest, line " << inputLineNumber << ":" <<
       endl;
@@ -14055,31 +14426,37 @@ void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRest& elt)
 
 void lpsr2LilypondTranslator::visitStart (S_msrMultipleRestContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> Start visiting msrMultipleRestContents" <<
       endl;
   }
+#endif
 }
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMultipleRestContents& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "%--> End visiting msrMultipleRestContents" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void lpsr2LilypondTranslator::visitStart (S_msrMidi& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> Start visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (gLilypondOptions->fNoMidi) {
     fLilypondCodeIOstream <<
@@ -14124,12 +14501,14 @@ void lpsr2LilypondTranslator::visitStart (S_msrMidi& elt)
 
 void lpsr2LilypondTranslator::visitEnd (S_msrMidi& elt)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     fLilypondCodeIOstream <<
       "% --> End visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 
@@ -12,6 +12,11 @@
 
 #include "lpsrBarNumbers.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -45,44 +50,52 @@ lpsrBarNumberCheck::~lpsrBarNumberCheck ()
 
 void lpsrBarNumberCheck::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrBarNumberCheck::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
+      v->cast<visitor<S_lpsrBarNumberCheck> > (msrVisitorKey<S_lpsrBarNumberCheck> ())) {
         S_lpsrBarNumberCheck elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrBarNumberCheck::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrBarNumberCheck::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrBarNumberCheck::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_lpsrBarNumberCheck>*> (v)) {
+      v->cast<visitor<S_lpsrBarNumberCheck> > (msrVisitorKey<S_lpsrBarNumberCheck> ())) {
         S_lpsrBarNumberCheck elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrBarNumberCheck::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -124,44 +137,52 @@ lpsrBarCommand::~lpsrBarCommand ()
 
 void lpsrBarCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrBarCommand::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrBarCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
+      v->cast<visitor<S_lpsrBarCommand> > (msrVisitorKey<S_lpsrBarCommand> ())) {
         S_lpsrBarCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrBarCommand::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrBarCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrBarCommand::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrBarCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrBarCommand>*> (v)) {
+      v->cast<visitor<S_lpsrBarCommand> > (msrVisitorKey<S_lpsrBarCommand> ())) {
         S_lpsrBarCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrBarCommand::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
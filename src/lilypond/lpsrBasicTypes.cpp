@@ -566,7 +566,7 @@ void writeTextsListAsLilypondString (
 // accidental styles
 //______________________________________________________________________________
 
-map<string, lpsrAccidentalStyleKind>
+thread_local map<string, lpsrAccidentalStyleKind>
   gLpsrAccidentalStyleKindsMap;
 
 string lpsrAccidentalStyleKindAsString (
@@ -753,7 +753,7 @@ string existingLpsrAccidentalStyleKinds ()
 // chords languages
 //______________________________________________________________________________
 
-map<string, lpsrChordsLanguageKind>
+thread_local map<string, lpsrChordsLanguageKind>
   gLpsrChordsLanguageKindsMap;
 
 void initializeLpsrChordsLanguageKindsMap ()
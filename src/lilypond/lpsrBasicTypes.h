@@ -45,7 +45,7 @@ string lpsrAccidentalStyleKindAsString (
 string lpsrAccidentalStyleKindAsLilypondString (
   lpsrAccidentalStyleKind styleKind);
 
-extern map<string, lpsrAccidentalStyleKind>
+extern thread_local map<string, lpsrAccidentalStyleKind>
   gLpsrAccidentalStyleKindsMap;
 
 string existingLpsrAccidentalStyleKinds ();
@@ -61,7 +61,7 @@ enum lpsrChordsLanguageKind {
 string lpsrChordsLanguageKindAsString (
   lpsrChordsLanguageKind languageKind);
 
-extern map<string, lpsrChordsLanguageKind>
+extern thread_local map<string, lpsrChordsLanguageKind>
   gLpsrChordsLanguageKindsMap;
 
 string existingLpsrChordsLanguageKinds ();
@@ -16,6 +16,11 @@
   #include "traceOptions.h"
 #endif
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -52,44 +57,52 @@ lpsrComment::~lpsrComment ()
 
 void lpsrComment::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrComment::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrComment>*
     p =
-      dynamic_cast<visitor<S_lpsrComment>*> (v)) {
+      v->cast<visitor<S_lpsrComment> > (msrVisitorKey<S_lpsrComment> ())) {
         S_lpsrComment elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrComment::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrComment::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrComment::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrComment>*
     p =
-      dynamic_cast<visitor<S_lpsrComment>*> (v)) {
+      v->cast<visitor<S_lpsrComment> > (msrVisitorKey<S_lpsrComment> ())) {
         S_lpsrComment elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrComment::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
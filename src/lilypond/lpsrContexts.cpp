@@ -12,6 +12,11 @@
 
 #include "lpsrContexts.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -54,44 +59,52 @@ lpsrContext::~lpsrContext ()
 
 void lpsrContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrContext::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrContext>*
     p =
-      dynamic_cast<visitor<S_lpsrContext>*> (v)) {
+      v->cast<visitor<S_lpsrContext> > (msrVisitorKey<S_lpsrContext> ())) {
         S_lpsrContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrContext::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrContext::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrContext>*
     p =
-      dynamic_cast<visitor<S_lpsrContext>*> (v)) {
+      v->cast<visitor<S_lpsrContext> > (msrVisitorKey<S_lpsrContext> ())) {
         S_lpsrContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrContext::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -221,44 +234,52 @@ lpsrChordNamesContext::~lpsrChordNamesContext ()
 
 void lpsrChordNamesContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrChordNamesContext::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrChordNamesContext>*
     p =
-      dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
+      v->cast<visitor<S_lpsrChordNamesContext> > (msrVisitorKey<S_lpsrChordNamesContext> ())) {
         S_lpsrChordNamesContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrChordNamesContext::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrChordNamesContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrChordNamesContext::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrChordNamesContext>*
     p =
-      dynamic_cast<visitor<S_lpsrChordNamesContext>*> (v)) {
+      v->cast<visitor<S_lpsrChordNamesContext> > (msrVisitorKey<S_lpsrChordNamesContext> ())) {
         S_lpsrChordNamesContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrChordNamesContext::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -372,44 +393,52 @@ lpsrFiguredBassContext::~lpsrFiguredBassContext ()
 
 void lpsrFiguredBassContext::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrFiguredBassContext::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrFiguredBassContext>*
     p =
-      dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
+      v->cast<visitor<S_lpsrFiguredBassContext> > (msrVisitorKey<S_lpsrFiguredBassContext> ())) {
         S_lpsrFiguredBassContext elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrFiguredBassContext::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrFiguredBassContext::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrFiguredBassContext::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrFiguredBassContext>*
     p =
-      dynamic_cast<visitor<S_lpsrFiguredBassContext>*> (v)) {
+      v->cast<visitor<S_lpsrFiguredBassContext> > (msrVisitorKey<S_lpsrFiguredBassContext> ())) {
         S_lpsrFiguredBassContext elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrFiguredBassContext::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -12,6 +12,11 @@
 
 #include "lpsrElements.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -41,44 +46,52 @@ lpsrElement::~lpsrElement ()
 
 void lpsrElement::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrElement::acceptIn ()" <<
       endl;
   }
+#endif
   
   if (visitor<S_lpsrElement>*
     p =
-      dynamic_cast<visitor<S_lpsrElement>*> (v)) {
+      v->cast<visitor<S_lpsrElement> > (msrVisitorKey<S_lpsrElement> ())) {
         S_lpsrElement elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrElement::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrElement::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrElement::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrElement>*
     p =
-      dynamic_cast<visitor<S_lpsrElement>*> (v)) {
+      v->cast<visitor<S_lpsrElement> > (msrVisitorKey<S_lpsrElement> ())) {
         S_lpsrElement elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrElement::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
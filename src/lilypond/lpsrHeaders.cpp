@@ -414,7 +414,7 @@ void lpsrHeader::addRights (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding right \"" <<
       value <<
@@ -440,7 +440,7 @@ void lpsrHeader::addComposer (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding composer \"" <<
       value <<
@@ -466,7 +466,7 @@ void lpsrHeader::addArranger (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding arranger \"" <<
       value <<
@@ -492,7 +492,7 @@ void lpsrHeader::addLyricist (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding lyricist \"" <<
       value <<
@@ -518,7 +518,7 @@ void lpsrHeader::addPoet (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding poet \"" <<
       value <<
@@ -544,7 +544,7 @@ void lpsrHeader::addTranslator (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding translator \"" <<
       value <<
@@ -570,7 +570,7 @@ void lpsrHeader::addSoftware (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding software \"" <<
       value <<
@@ -849,44 +849,52 @@ int lpsrHeader::maxLilypondVariablesNamesLength ()
 
 void lpsrHeader::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrHeader::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrHeader>*
     p =
-      dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
+      v->cast<visitor<S_lpsrHeader> > (msrVisitorKey<S_lpsrHeader> ())) {
         S_lpsrHeader elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrHeader::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrHeader::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrHeader::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrHeader>*
     p =
-      dynamic_cast<visitor<S_lpsrHeader>*> (v)) {
+      v->cast<visitor<S_lpsrHeader> > (msrVisitorKey<S_lpsrHeader> ())) {
         S_lpsrHeader elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrHeader::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -16,6 +16,11 @@
 
 #include "lpsrScheme.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -47,44 +52,52 @@ lpsrLayout::~lpsrLayout ()
 
 void lpsrLayout::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrLayout::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrLayout>*
     p =
-      dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
+      v->cast<visitor<S_lpsrLayout> > (msrVisitorKey<S_lpsrLayout> ())) {
         S_lpsrLayout elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrLayout::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrLayout::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrLayout::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrLayout>*
     p =
-      dynamic_cast<visitor<S_lpsrLayout>*> (v)) {
+      v->cast<visitor<S_lpsrLayout> > (msrVisitorKey<S_lpsrLayout> ())) {
         S_lpsrLayout elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrLayout::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -12,6 +12,11 @@
 
 #include "lpsrLyrics.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -49,44 +54,52 @@ lpsrNewLyricsBlock::~lpsrNewLyricsBlock ()
 
 void lpsrNewLyricsBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewLyricsBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrNewLyricsBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewLyricsBlock> > (msrVisitorKey<S_lpsrNewLyricsBlock> ())) {
         S_lpsrNewLyricsBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewLyricsBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrNewLyricsBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewLyricsBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrNewLyricsBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewLyricsBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewLyricsBlock> > (msrVisitorKey<S_lpsrNewLyricsBlock> ())) {
         S_lpsrNewLyricsBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewLyricsBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
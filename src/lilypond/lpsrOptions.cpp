@@ -14,6 +14,7 @@
 #include <iomanip>      // setw, setprecision, ...
 
 #include "utilities.h"
+#include "messagesHandling.h"
 
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
@@ -208,9 +209,9 @@ ostream& operator<< (ostream& os, const S_optionsLpsrChordsLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lpsrOptions gLpsrOptions;
-S_lpsrOptions gLpsrOptionsUserChoices;
-S_lpsrOptions gLpsrOptionsWithDetailedTrace;
+thread_local S_lpsrOptions gLpsrOptions;
+thread_local S_lpsrOptions gLpsrOptionsUserChoices;
+thread_local S_lpsrOptions gLpsrOptionsWithDetailedTrace;
 
 S_lpsrOptions lpsrOptions::create (
   S_optionsHandler optionsHandler)
@@ -371,6 +372,8 @@ This may come in handy when MusicXML data has been obtained from scanned images.
       optionError (s.str ());
     }
   
+    fLpsrChordsLanguageKind = k_IgnatzekChords; // LilyPond default
+
     // options
     
     S_optionsSubGroup
@@ -688,7 +691,7 @@ void lpsrOptions::handleOptionsItemValue (
       optionError (s.str ());
       
  //     exit (4); // JMI
-      abort ();
+      throw msrException (msrException::kAbort);
     }
   
     pitchesLanguageKindItem->
@@ -741,7 +744,7 @@ void lpsrOptions::handleOptionsItemValue (
       
       printHelpSummary (os);
       
-      exit (4);
+      throw msrException (4);
     }
   
     LpsrChordsLanguageItem->
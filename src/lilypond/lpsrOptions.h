@@ -267,9 +267,9 @@ class lpsrOptions : public optionsGroup
 typedef SMARTP<lpsrOptions> S_lpsrOptions;
 EXP ostream& operator<< (ostream& os, const S_lpsrOptions& elt);
 
-EXP extern S_lpsrOptions gLpsrOptions;
-EXP extern S_lpsrOptions gLpsrOptionsUserChoices;
-EXP extern S_lpsrOptions gLpsrOptionsWithDetailedTrace;
+extern thread_local S_lpsrOptions gLpsrOptions;
+extern thread_local S_lpsrOptions gLpsrOptionsUserChoices;
+extern thread_local S_lpsrOptions gLpsrOptionsWithDetailedTrace;
 
 //______________________________________________________________________________
 EXP  void initializeLpsrOptionsHandling (
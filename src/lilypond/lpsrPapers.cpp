@@ -63,7 +63,7 @@ lpsrPaper::~lpsrPaper ()
 void lpsrPaper::setIndent (float val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceFlags [kTraceGeometryFlag]) {
     gLogIOstream <<
       "Setting paper indent to " << val <<
       endl;
@@ -76,7 +76,7 @@ void lpsrPaper::setIndent (float val)
 void lpsrPaper::setShortIndent (float val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceFlags [kTraceGeometryFlag]) {
     gLogIOstream <<
       "Setting paper short indent to " << val <<
       endl;
@@ -88,44 +88,52 @@ void lpsrPaper::setShortIndent (float val)
 
 void lpsrPaper::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrPaper::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrPaper>*
     p =
-      dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
+      v->cast<visitor<S_lpsrPaper> > (msrVisitorKey<S_lpsrPaper> ())) {
         S_lpsrPaper elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrPaper::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrPaper::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrPaper::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrPaper>*
     p =
-      dynamic_cast<visitor<S_lpsrPaper>*> (v)) {
+      v->cast<visitor<S_lpsrPaper> > (msrVisitorKey<S_lpsrPaper> ())) {
         S_lpsrPaper elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrPaper::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
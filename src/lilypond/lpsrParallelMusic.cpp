@@ -25,6 +25,11 @@
 
 #include "lpsrContexts.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -59,55 +64,65 @@ lpsrParallelMusicBLock::~lpsrParallelMusicBLock ()
 
 void lpsrParallelMusicBLock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrParallelMusicBLock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrParallelMusicBLock>*
     p =
-      dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
+      v->cast<visitor<S_lpsrParallelMusicBLock> > (msrVisitorKey<S_lpsrParallelMusicBLock> ())) {
         S_lpsrParallelMusicBLock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrParallelMusicBLock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrParallelMusicBLock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrParallelMusicBLock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrParallelMusicBLock>*
     p =
-      dynamic_cast<visitor<S_lpsrParallelMusicBLock>*> (v)) {
+      v->cast<visitor<S_lpsrParallelMusicBLock> > (msrVisitorKey<S_lpsrParallelMusicBLock> ())) {
         S_lpsrParallelMusicBLock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrParallelMusicBLock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void lpsrParallelMusicBLock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrParallelMusicBLock::browseData ()" <<
       endl;
   }
+#endif
   
   for (
     list<S_lpsrPartGroupBlock>::const_iterator i =
@@ -119,11 +134,13 @@ void lpsrParallelMusicBLock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== lpsrParallelMusicBLock::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void lpsrParallelMusicBLock::print (ostream& os)
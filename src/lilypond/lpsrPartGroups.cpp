@@ -12,6 +12,11 @@
 
 #include "lpsrPartGroups.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -42,55 +47,65 @@ lpsrPartGroupBlock::~lpsrPartGroupBlock ()
 
 void lpsrPartGroupBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrPartGroupBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrPartGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
+      v->cast<visitor<S_lpsrPartGroupBlock> > (msrVisitorKey<S_lpsrPartGroupBlock> ())) {
         S_lpsrPartGroupBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrPartGroupBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrPartGroupBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrPartGroupBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrPartGroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrPartGroupBlock>*> (v)) {
+      v->cast<visitor<S_lpsrPartGroupBlock> > (msrVisitorKey<S_lpsrPartGroupBlock> ())) {
         S_lpsrPartGroupBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrPartGroupBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void lpsrPartGroupBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrPartGroupBlock::browseData ()" <<
       endl;
   }
+#endif
 
   for (
     list<S_msrElement>::const_iterator i = fPartGroupBlockElements.begin ();
@@ -101,11 +116,13 @@ void lpsrPartGroupBlock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== lpsrPartGroupBlock::browseData ()" <<
       endl;
   }
+#endif
 }
 
 ostream& operator<< (ostream& os, const S_lpsrPartGroupBlock& scr)
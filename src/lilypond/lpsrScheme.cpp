@@ -16,6 +16,11 @@
 
 #include "lpsrVarValAssocs.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 
 using namespace std;
 
@@ -103,44 +108,52 @@ string lpsrSchemeVariable::endlKindAsString (
 
 void lpsrSchemeVariable::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrSchemeVariable::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrSchemeVariable>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
+      v->cast<visitor<S_lpsrSchemeVariable> > (msrVisitorKey<S_lpsrSchemeVariable> ())) {
         S_lpsrSchemeVariable elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrSchemeVariable::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrSchemeVariable::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrSchemeVariable::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrSchemeVariable>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeVariable>*> (v)) {
+      v->cast<visitor<S_lpsrSchemeVariable> > (msrVisitorKey<S_lpsrSchemeVariable> ())) {
         S_lpsrSchemeVariable elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrSchemeVariable::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -237,44 +250,52 @@ lpsrSchemeFunction::~lpsrSchemeFunction ()
 
 void lpsrSchemeFunction::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrSchemeFunction::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrSchemeFunction>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
+      v->cast<visitor<S_lpsrSchemeFunction> > (msrVisitorKey<S_lpsrSchemeFunction> ())) {
         S_lpsrSchemeFunction elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrSchemeFunction::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrSchemeFunction::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrSchemeFunction::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrSchemeFunction>*
     p =
-      dynamic_cast<visitor<S_lpsrSchemeFunction>*> (v)) {
+      v->cast<visitor<S_lpsrSchemeFunction> > (msrVisitorKey<S_lpsrSchemeFunction> ())) {
         S_lpsrSchemeFunction elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrSchemeFunction::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
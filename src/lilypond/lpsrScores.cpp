@@ -70,7 +70,7 @@ void lpsrScoreBlock::appendPartGroupBlockToScoreBlock (
   S_lpsrPartGroupBlock partGroupBlock)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Appending part group block " <<
        partGroupBlock-> getPartGroup ()-> getPartGroupCombinedName () <<
@@ -91,7 +91,7 @@ void lpsrScoreBlock::appendVoiceUseToParallelMusicBLock (
   S_lpsrUseVoiceCommand voiceUse)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending the use of voice \"" <<
        voiceUse-> getVoice ()-> getVoiceName () <<
@@ -110,7 +110,7 @@ void lpsrScoreBlock::appendLyricsUseToParallelMusicBLock (
   S_lpsrNewLyricsBlock lyricsUse)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending the use of stanza " <<
        lyricsUse-> getStanza ()-> getStanzaName () <<
@@ -126,55 +126,65 @@ void lpsrScoreBlock::appendLyricsUseToParallelMusicBLock (
 
 void lpsrScoreBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScoreBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrScoreBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
+      v->cast<visitor<S_lpsrScoreBlock> > (msrVisitorKey<S_lpsrScoreBlock> ())) {
         S_lpsrScoreBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrScoreBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrScoreBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScoreBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrScoreBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrScoreBlock>*> (v)) {
+      v->cast<visitor<S_lpsrScoreBlock> > (msrVisitorKey<S_lpsrScoreBlock> ())) {
         S_lpsrScoreBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrScoreBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void lpsrScoreBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScoreBlock::browseData ()" <<
       endl;
   }
+#endif
 
   {
     // browse the score command parallel music
@@ -204,11 +214,13 @@ void lpsrScoreBlock::browseData (basevisitor* v)
     browser.browse (*fScoreBlockMidi);
   }
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== lpsrScoreBlock::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void lpsrScoreBlock::print (ostream& os)
@@ -371,10 +383,24 @@ lpsrScore::lpsrScore (
       "Comment or adapt next line as needed (default is 20)",
       lpsrSchemeVariable::kWithEndlTwice);
 
+  // initialize files includes and Scheme modules informations
+  fJianpuFileIncludeIsNeeded                 = false;
+  fScmAndAccregSchemeModulesAreNeeded        = false;
+
   // initialize Scheme functions informations
   fTongueSchemeFunctionIsNeeded              = false;
   fCustomShortBarLineSchemeFunctionIsNeeded  = false;
   fEditorialAccidentalSchemeFunctionIsNeeded = false;
+  fDynamicsSchemeFunctionIsNeeded            = false;
+  fTupletsCurvedBracketsSchemeFunctionIsNeeded = false;
+  fAfterSchemeFunctionIsNeeded               = false;
+  fTempoRelationshipSchemeFunctionIsNeeded   = false;
+  fGlissandoWithTextSchemeFunctionIsNeeded   = false;
+
+  // initialize markups informations
+  fDampMarkupIsNeeded                        = false;
+  fDampAllMarkupIsNeeded                     = false;
+  fWhiteNoteHeadsIsNeeded                    = false;
 
   if (gLilypondOptions->fLilypondCompileDate) {
     // create the date and time functions
@@ -741,11 +767,13 @@ R"(
 #(define modTimeAsString (strftime "%d/%m/%Y - %H:%M:%S" (localtime modTime)))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -777,11 +805,13 @@ R"(
 \pointAndClickOff
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -959,11 +989,13 @@ glissandoTextOn =
 glissandoTextOff = \revert Glissando.stencil
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme functions for '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1010,11 +1042,13 @@ R"(
 )";
 
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Including Jianpu definition file '" << schemeModulesName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1047,11 +1081,13 @@ R"(
 \include "jianpu10a.ly"
 )";
   
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Including Jianpu definition file '" << schemeModulesName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1083,11 +1119,13 @@ R"(
 #(use-modules (scm accreg))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Using Scheme modules '" << schemeModulesName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1134,11 +1172,13 @@ tongue =
      script))
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1179,11 +1219,13 @@ editorialAccidental =
   #})
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1221,11 +1263,13 @@ fffff = #(make-dynamic-script "fffff")
 ffffff = #(make-dynamic-script "ffffff")
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1311,11 +1355,13 @@ tupletsCurvedBrackets = {
 }
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1355,11 +1401,13 @@ after =
    #})
 )";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1457,11 +1505,13 @@ tempoRelationship =
      #}))
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1509,11 +1559,13 @@ damp = \markup {
 }
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1555,11 +1607,13 @@ dampAll = \markup
 }
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1606,11 +1660,13 @@ whiteNoteHeads =
    )
 )!";
 
-  if (gLpsrOptions->fTraceSchemeFunctions) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceSchemeFunctionsFlag]) {
     gLogIOstream <<
       "Creating Scheme function '" << schemeFunctionName << "'" <<
       endl;
   }
+#endif
 
   // create the Scheme function
   S_lpsrSchemeFunction
@@ -1655,55 +1711,65 @@ void lpsrScore::appendLyricsUseToStoreCommand (S_msrStanza stanza)
 
 void lpsrScore::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScore::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrScore>*
     p =
-      dynamic_cast<visitor<S_lpsrScore>*> (v)) {
+      v->cast<visitor<S_lpsrScore> > (msrVisitorKey<S_lpsrScore> ())) {
         S_lpsrScore elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrScore::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrScore::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScore::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrScore>*
     p =
-      dynamic_cast<visitor<S_lpsrScore>*> (v)) {
+      v->cast<visitor<S_lpsrScore> > (msrVisitorKey<S_lpsrScore> ())) {
         S_lpsrScore elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrScore::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void lpsrScore::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrScore::browseData ()" <<
       endl;
   }
+#endif
 
   {
     // browse the score LilyPond version
@@ -1818,11 +1884,13 @@ void lpsrScore::browseData (basevisitor* v)
     browser.browse (*fScoreBlock);
   }
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== lpsrScore::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void lpsrScore::print (ostream& os)
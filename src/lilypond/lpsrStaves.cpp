@@ -15,6 +15,11 @@
 #include "lpsrVoices.h"
 #include "lpsrLyrics.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -44,44 +49,52 @@ lpsrNewStaffgroupBlock::~lpsrNewStaffgroupBlock ()
 
 void lpsrNewStaffgroupBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffgroupBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrNewStaffgroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffgroupBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffgroupBlock> > (msrVisitorKey<S_lpsrNewStaffgroupBlock> ())) {
         S_lpsrNewStaffgroupBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffgroupBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrNewStaffgroupBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffgroupBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrNewStaffgroupBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffgroupBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffgroupBlock> > (msrVisitorKey<S_lpsrNewStaffgroupBlock> ())) {
         S_lpsrNewStaffgroupBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffgroupBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -135,44 +148,52 @@ lpsrNewStaffTuningBlock::~lpsrNewStaffTuningBlock ()
 
 void lpsrNewStaffTuningBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffTuningBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrNewStaffTuningBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffTuningBlock> > (msrVisitorKey<S_lpsrNewStaffTuningBlock> ())) {
         S_lpsrNewStaffTuningBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffTuningBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrNewStaffTuningBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffTuningBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrNewStaffTuningBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffTuningBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffTuningBlock> > (msrVisitorKey<S_lpsrNewStaffTuningBlock> ())) {
         S_lpsrNewStaffTuningBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffTuningBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -219,44 +240,52 @@ lpsrNewStaffBlock::~lpsrNewStaffBlock ()
 
 void lpsrNewStaffBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrNewStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffBlock> > (msrVisitorKey<S_lpsrNewStaffBlock> ())) {
         S_lpsrNewStaffBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrNewStaffBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrNewStaffBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrNewStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrNewStaffBlock>*> (v)) {
+      v->cast<visitor<S_lpsrNewStaffBlock> > (msrVisitorKey<S_lpsrNewStaffBlock> ())) {
         S_lpsrNewStaffBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrNewStaffBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -343,55 +372,65 @@ void lpsrStaffBlock::appendLyricsUseToStaffBlock (S_msrStanza stanza)
 
 void lpsrStaffBlock::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrStaffBlock::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
+      v->cast<visitor<S_lpsrStaffBlock> > (msrVisitorKey<S_lpsrStaffBlock> ())) {
         S_lpsrStaffBlock elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrStaffBlock::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrStaffBlock::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrStaffBlock::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrStaffBlock>*
     p =
-      dynamic_cast<visitor<S_lpsrStaffBlock>*> (v)) {
+      v->cast<visitor<S_lpsrStaffBlock> > (msrVisitorKey<S_lpsrStaffBlock> ())) {
         S_lpsrStaffBlock elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrStaffBlock::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void lpsrStaffBlock::browseData (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrStaffBlock::browseData ()" <<
       endl;
   }
+#endif
 
   for (
     list<S_msrElement>::const_iterator i = fStaffBlockElements.begin ();
@@ -402,11 +441,13 @@ void lpsrStaffBlock::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== lpsrStaffBlock::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void lpsrStaffBlock::print (ostream& os)
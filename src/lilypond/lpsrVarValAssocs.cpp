@@ -273,44 +273,52 @@ string lpsrVarValAssoc::endlKindAsString (
 
 void lpsrVarValAssoc::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVarValAssoc::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrVarValAssoc>*
     p =
-      dynamic_cast<visitor<S_lpsrVarValAssoc>*> (v)) {
+      v->cast<visitor<S_lpsrVarValAssoc> > (msrVisitorKey<S_lpsrVarValAssoc> ())) {
         S_lpsrVarValAssoc elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVarValAssoc::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrVarValAssoc::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVarValAssoc::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrVarValAssoc>*
     p =
-      dynamic_cast<visitor<S_lpsrVarValAssoc>*> (v)) {
+      v->cast<visitor<S_lpsrVarValAssoc> > (msrVisitorKey<S_lpsrVarValAssoc> ())) {
         S_lpsrVarValAssoc elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVarValAssoc::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -494,44 +502,52 @@ string lpsrVarValsListAssoc::lilyPondVarValsListAssocValuesAsString () const
 
 void lpsrVarValsListAssoc::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVarValsListAssoc::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrVarValsListAssoc>*
     p =
-      dynamic_cast<visitor<S_lpsrVarValsListAssoc>*> (v)) {
+      v->cast<visitor<S_lpsrVarValsListAssoc> > (msrVisitorKey<S_lpsrVarValsListAssoc> ())) {
         S_lpsrVarValsListAssoc elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVarValsListAssoc::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrVarValsListAssoc::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVarValsListAssoc::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrVarValsListAssoc>*
     p =
-      dynamic_cast<visitor<S_lpsrVarValsListAssoc>*> (v)) {
+      v->cast<visitor<S_lpsrVarValsListAssoc> > (msrVisitorKey<S_lpsrVarValsListAssoc> ())) {
         S_lpsrVarValsListAssoc elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVarValsListAssoc::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
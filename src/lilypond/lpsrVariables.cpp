@@ -12,6 +12,11 @@
 
 #include "lpsrVariables.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -45,44 +50,52 @@ lpsrVariableUseCommand::~lpsrVariableUseCommand()
 
 void lpsrVariableUseCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVariableUseCommand::acceptIn()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrVariableUseCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
+      v->cast<visitor<S_lpsrVariableUseCommand> > (msrVisitorKey<S_lpsrVariableUseCommand> ())) {
         S_lpsrVariableUseCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVariableUseCommand::visitStart()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrVariableUseCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrVariableUseCommand::acceptOut()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrVariableUseCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrVariableUseCommand>*> (v)) {
+      v->cast<visitor<S_lpsrVariableUseCommand> > (msrVisitorKey<S_lpsrVariableUseCommand> ())) {
         S_lpsrVariableUseCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrVariableUseCommand::visitEnd()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
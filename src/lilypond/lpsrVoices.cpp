@@ -12,6 +12,11 @@
 
 #include "lpsrVoices.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "lpsrOptions.h"
 
 
@@ -46,44 +51,52 @@ lpsrUseVoiceCommand::~lpsrUseVoiceCommand ()
 
 void lpsrUseVoiceCommand::acceptIn (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrUseVoiceCommand::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_lpsrUseVoiceCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
+      v->cast<visitor<S_lpsrUseVoiceCommand> > (msrVisitorKey<S_lpsrUseVoiceCommand> ())) {
         S_lpsrUseVoiceCommand elem = this;
         
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrUseVoiceCommand::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void lpsrUseVoiceCommand::acceptOut (basevisitor* v)
 {
-  if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> lpsrUseVoiceCommand::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_lpsrUseVoiceCommand>*
     p =
-      dynamic_cast<visitor<S_lpsrUseVoiceCommand>*> (v)) {
+      v->cast<visitor<S_lpsrUseVoiceCommand> > (msrVisitorKey<S_lpsrUseVoiceCommand> ())) {
         S_lpsrUseVoiceCommand elem = this;
       
-        if (gLpsrOptions->fTraceLpsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceLpsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching lpsrUseVoiceCommand::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -34,7 +34,7 @@ void msrAssert (
       ", aborting." <<
       endl;
      
-    abort ();
+    throw msrException (msrException::kAbort);
   }
 }
 
@@ -139,10 +139,10 @@ void msrMusicXMLError (
 
   if (! gGeneralOptions->fIgnoreErrors) {
     if (gGeneralOptions->fAbortOnErrors) {
-      abort ();
+      throw msrException (msrException::kAbort);
     }
     else {
-      exit (15);
+      throw msrException (15);
     }
   }
 }
@@ -164,7 +164,7 @@ void lpsrMusicXMLError (
     message);
 
   if (! gGeneralOptions->fIgnoreErrors) {
-    exit (16);
+    throw msrException (16);
   }
 }
 
@@ -184,7 +184,7 @@ void msrInternalError (
     sourceCodeLineNumber,
     message);
 
-  abort ();
+  throw msrException (msrException::kAbort);
 }
 
 void msrLimitation (
@@ -206,7 +206,7 @@ void msrLimitation (
       inputSourceName << ":" << inputLineNumber << ": " << message <<
       endl;
 
-    abort ();
+    throw msrException (msrException::kAbort);
   }
 }
 
@@ -230,7 +230,7 @@ void msrStreamsError (
       endl;
   }
 
-  abort ();
+  throw msrException (msrException::kAbort);
 }
 
 void msrStreamsWarning (
@@ -253,12 +253,12 @@ void msrStreamsWarning (
       endl;
   }
 
-  abort ();
+  throw msrException (msrException::kAbort);
 }
 
 //______________________________________________________________________________
-std::set<int> gWarningsInputLineNumbers;
-std::set<int> gErrorsInputLineNumbers;
+thread_local std::set<int> gWarningsInputLineNumbers;
+thread_local std::set<int> gErrorsInputLineNumbers;
 
 void displayWarningsAndErrorsInputLineNumbers ()
 {
@@ -13,6 +13,7 @@
 #ifndef ___messagesHandling___
 #define ___messagesHandling___
 
+#include <exception>
 #include <iomanip> // for 'setw()'
 #include <set>     // for 'setw()'
 
@@ -22,6 +23,36 @@
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+/*
+  msrException is thrown where the converter stops:
+  xml2ly exits with the exit status or aborts, while
+  musicxmlfile2lilypond and musicxmlstring2lilypond return an error code
+*/
+class EXP msrException : public std::exception
+{
+  public:
+
+    enum { kAbort = -1 };
+
+    msrException (int exitStatus)
+      : fExitStatus (exitStatus)
+        {}
+
+    int                   getExitStatus () const
+                              { return fExitStatus; }
+
+    bool                  isAbort () const
+                              { return fExitStatus == kAbort; }
+
+    virtual const char*   what () const throw ()
+                              { return "msrException"; }
+
+  private:
+
+    int                   fExitStatus;
+};
+
 //______________________________________________________________________________
 EXP void msrAssert (
   bool   condition,
@@ -107,8 +138,8 @@ EXP void msrStreamsWarning (
   std::string message);
 
 //______________________________________________________________________________
-EXP extern std::set<int> gWarningsInputLineNumbers;
-EXP extern std::set<int> gErrorsInputLineNumbers;
+extern thread_local std::set<int> gWarningsInputLineNumbers;
+extern thread_local std::set<int> gErrorsInputLineNumbers;
 
 EXP void displayWarningsAndErrorsInputLineNumbers ();
 
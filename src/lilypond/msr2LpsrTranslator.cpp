@@ -155,13 +155,15 @@ void msr2LpsrTranslator::setPaperIndentsIfNeeded (
   }
 
   // get the paper width
+#ifdef TRACE_OPTIONS
   float paperWidth = pageGeometry->getPaperWidth ();
+#endif
   
   // heuristics to determine the number of characters per centimeter
   float charactersPerCemtimeter = 4.0;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceFlags [kTraceGeometryFlag]) {
     fLogOutputStream <<
       "setPaperIndentsIfNeeded():" <<
       endl;
@@ -231,7 +233,7 @@ void msr2LpsrTranslator::prependSkipGraceNotesGroupToPartOtherVoices (
   S_msrGraceNotesGroup skipGraceNotesGroup)
 {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes) {
+    if (gTraceFlags [kTraceGraceNotesFlag]) {
       fLogOutputStream <<
         "--> prepending a skip graceNotesGroup clone " <<
         skipGraceNotesGroup->asShortString () <<
@@ -286,12 +288,14 @@ void msr2LpsrTranslator::visitStart (S_msrScore& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrScore" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create an empty clone of fVisitedMsrScore for use by the LPSR score
   // not sharing the visitiged MSR score allows cleaner data handling
@@ -397,12 +401,14 @@ void msr2LpsrTranslator::visitEnd (S_msrScore& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrScore" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fWorkTitleKnown && fMovementTitleKnown) {
     string
@@ -490,12 +496,14 @@ void msr2LpsrTranslator::visitEnd (S_msrScore& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrIdentification& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrIdentification" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 
@@ -513,23 +521,27 @@ void msr2LpsrTranslator::visitEnd (S_msrIdentification& elt)
   
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrIdentification" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPageGeometry" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 
@@ -619,24 +631,28 @@ void msr2LpsrTranslator::visitEnd (S_msrPageGeometry& elt)
 {  
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrPageGeometry" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrCredit& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentCredit = elt;
 
@@ -648,24 +664,28 @@ void msr2LpsrTranslator::visitStart (S_msrCredit& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrCredit& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrCredit" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentCredit = nullptr;
 }
 
 void msr2LpsrTranslator::visitStart (S_msrCreditWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // don't append it to the current credit, since the latter is no clone
   /* JMI
@@ -677,24 +697,28 @@ void msr2LpsrTranslator::visitStart (S_msrCreditWords& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrCreditWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrCreditWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPartGroup " <<
       elt->getPartGroupCombinedName () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create a partGroup clone
   // current partGroup clone, i.e. the top of the stack,
@@ -711,7 +735,7 @@ void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
   // push it onto this visitors's stack,
   // making it the current partGroup block
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Pushing part group clone " <<
       partGroupClone->getPartGroupCombinedName () <<
@@ -751,13 +775,15 @@ void msr2LpsrTranslator::visitStart (S_msrPartGroup& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrPartGroup " <<
       elt->getPartGroupCombinedName () <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   S_msrPartGroup
     currentPartGroup =
@@ -768,7 +794,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
     // if it is the top-level one, i.e it's alone in the stack
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceFlags [kTracePartGroupsFlag]) {
       fLogOutputStream <<
         "Adding part group clone " <<
         currentPartGroup->getPartGroupCombinedName () <<
@@ -787,7 +813,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
 
     // pop current partGroup from this visitors's stack
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceFlags [kTracePartGroupsFlag]) {
       fLogOutputStream <<
         "Popping part group clone " <<
         fPartGroupsStack.top ()->getPartGroupCombinedName () <<
@@ -819,7 +845,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
     // if it is the top-level one, i.e it's alone in the stack
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceFlags [kTracePartGroupsFlag]) {
       fLogOutputStream <<
         "Adding part group block clone for part group " <<
         currentPartGroupBlock->
@@ -845,7 +871,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
   else {
     // pop current partGroup block from this visitors's stack
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroups) {
+    if (gTraceFlags [kTracePartGroupsFlag]) {
       fLogOutputStream <<
         "Popping part group block clone for part group " <<
         currentPartGroupBlock->
@@ -869,23 +895,27 @@ void msr2LpsrTranslator::visitEnd (S_msrPartGroup& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPart& elt)
 {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     elt->getInputLineNumber ();
+#endif
     
   string
     partCombinedName =
       elt->getPartCombinedName ();
       
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPart " <<
       partCombinedName <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePartsFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partCombinedName << "\"" <<
@@ -903,7 +933,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
 
   // add it to the partGroup clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Adding part clone " <<
       fCurrentPartClone->getPartCombinedName () <<
@@ -924,7 +954,7 @@ void msr2LpsrTranslator::visitStart (S_msrPart& elt)
 
   // append it to the current partGroup block
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Appending part block " <<
       fPartGroupsStack.top ()->getPartGroupCombinedName () <<
@@ -945,13 +975,15 @@ void msr2LpsrTranslator::visitEnd (S_msrPart& elt)
     
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrPart " <<
       elt->getPartCombinedName () <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     partInstrumentAbbreviation =
@@ -989,7 +1021,7 @@ void msr2LpsrTranslator::visitEnd (S_msrPart& elt)
 /* JMI
 void msr2LpsrTranslator::visitStart (S_msrStaffLinesNumber& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStaffLinesNumber" <<
       ", line " << inputLineNumber <<
@@ -1006,12 +1038,14 @@ void msr2LpsrTranslator::visitStart (S_msrStaffLinesNumber& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaffTuning& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStaffTuning" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   // create a staff tuning clone
   fCurrentStaffTuningClone =
@@ -1022,24 +1056,28 @@ void msr2LpsrTranslator::visitStart (S_msrStaffTuning& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaffDetails& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStaffDetails" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentStaffTuningClone      = nullptr;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrStaffDetails& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrStaffDetails" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the staff details to the current staff clone
   fCurrentStaffClone->
@@ -1069,13 +1107,15 @@ void msr2LpsrTranslator::visitEnd (S_msrStaffDetails& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStaff \"" <<
       elt->getStaffName () << "\"" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 
@@ -1179,13 +1219,15 @@ void msr2LpsrTranslator::visitEnd (S_msrStaff& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_msrStaff \"" <<
       elt->getStaffName () << "\"" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   switch (elt->getStaffKind ()) {
     case msrStaff::kRegularStaff:
@@ -1216,13 +1258,15 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrVoice \"" <<
       elt->getVoiceName () << "\"" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentVoiceOriginal = elt;
   
@@ -1294,7 +1338,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
               getPartCombinedName ();
                           
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceFlags [kTraceHarmoniesFlag]) {
             fLogOutputStream <<
               "Creating a ChordNames context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1312,7 +1356,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   
           // append it to the current part block
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceFlags [kTraceHarmoniesFlag]) {
             fLogOutputStream <<
               "Appending the ChordNames context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1376,7 +1420,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
               getPartCombinedName ();
                           
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceFlags [kTraceHarmoniesFlag]) {
             fLogOutputStream <<
               "Creating a FiguredBass context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1394,7 +1438,7 @@ void msr2LpsrTranslator::visitStart (S_msrVoice& elt)
   
           // append it to the current part block
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceHarmonies) {
+          if (gTraceFlags [kTraceHarmoniesFlag]) {
             fLogOutputStream <<
               "Appending the FiguredBass context for \"" << voiceName <<
               "\" in part " << partCombinedName <<
@@ -1422,13 +1466,15 @@ void msr2LpsrTranslator::visitEnd (S_msrVoice& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrVoice \"" <<
       elt->getVoiceName () << "\"" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   switch (elt->getVoiceKind ()) {
     case msrVoice::kRegularVoice:
@@ -1448,13 +1494,15 @@ void msr2LpsrTranslator::visitEnd (S_msrVoice& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrVoiceStaffChange& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrVoiceStaffChange '" <<
       elt->asString () << "'" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create a voice staff change clone
   S_msrVoiceStaffChange
@@ -1471,13 +1519,15 @@ void msr2LpsrTranslator::visitStart (S_msrVoiceStaffChange& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* JMI
 
@@ -1505,13 +1555,15 @@ void msr2LpsrTranslator::visitStart (S_msrSegment& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSegment '" <<
       elt->getSegmentAbsoluteNumber () << "'" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // forget current segment clone
   fCurrentSegmentClonesStack.pop ();
@@ -1520,7 +1572,8 @@ void msr2LpsrTranslator::visitEnd (S_msrSegment& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrHarmony& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrHarmony '" <<
       elt->asString () <<
@@ -1530,6 +1583,7 @@ void msr2LpsrTranslator::visitStart (S_msrHarmony& elt)
       "', line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create a harmony new born clone
   fCurrentHarmonyClone =
@@ -1560,7 +1614,8 @@ void msr2LpsrTranslator::visitStart (S_msrHarmony& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrHarmonyDegree& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_msrHarmonyDegree '" <<
       elt->asString () <<
@@ -1570,6 +1625,7 @@ void msr2LpsrTranslator::visitStart (S_msrHarmonyDegree& elt)
       "', line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the harmony degree to the current harmony clone
   fCurrentHarmonyClone->
@@ -1579,7 +1635,8 @@ void msr2LpsrTranslator::visitStart (S_msrHarmonyDegree& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrHarmony& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrHarmony '" <<
       elt->asString () <<
@@ -1587,12 +1644,14 @@ void msr2LpsrTranslator::visitEnd (S_msrHarmony& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFrame& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrFrame '" <<
       elt->asString () <<
@@ -1600,6 +1659,7 @@ void msr2LpsrTranslator::visitStart (S_msrFrame& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     // register the frame in the current non-grace note clone
@@ -1611,7 +1671,8 @@ void msr2LpsrTranslator::visitStart (S_msrFrame& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFiguredBass& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -1619,6 +1680,7 @@ void msr2LpsrTranslator::visitStart (S_msrFiguredBass& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create a deep copy of the figured bass
   fCurrentFiguredBass =
@@ -1652,7 +1714,8 @@ void msr2LpsrTranslator::visitStart (S_msrFiguredBass& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrFigure& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrFigure '" <<
       elt->asString () <<
@@ -1660,6 +1723,7 @@ void msr2LpsrTranslator::visitStart (S_msrFigure& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the figure to the current figured bass
   fCurrentFiguredBass->
@@ -1669,7 +1733,8 @@ void msr2LpsrTranslator::visitStart (S_msrFigure& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrFiguredBass& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrFiguredBass '" <<
       elt->asString () <<
@@ -1677,6 +1742,7 @@ void msr2LpsrTranslator::visitEnd (S_msrFiguredBass& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFiguredBass = nullptr;
 }
@@ -1684,15 +1750,18 @@ void msr2LpsrTranslator::visitEnd (S_msrFiguredBass& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasure& elt)
 {    
+#ifdef TRACE_OPTIONS
   int
     inputLineNumber =
       elt->getInputLineNumber ();
+#endif
 
   string
     measureNumber =
       elt->getMeasureNumber ();
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMeasure '" <<
       measureNumber <<
@@ -1700,6 +1769,7 @@ void msr2LpsrTranslator::visitStart (S_msrMeasure& elt)
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /* JMI
   {
@@ -1711,7 +1781,7 @@ void msr2LpsrTranslator::visitStart (S_msrMeasure& elt)
      */
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure '" << measureNumber <<
@@ -1766,11 +1836,13 @@ void msr2LpsrTranslator::finalizeCurrentMeasureClone (
           getSegmentVoiceUplink ();
     
   // fetch the part measure position high tide
+#ifdef TRACE_OPTIONS
   rational
     partMeasureLengthHighTide = // JMI
       fCurrentMeasureClone->
         fetchMeasurePartUplink ()->
           getPartMeasureLengthHighTide ();
+#endif
 
   // get the measure number
   string
@@ -1791,7 +1863,7 @@ void msr2LpsrTranslator::finalizeCurrentMeasureClone (
         getMeasureFullLength ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     fLogOutputStream <<
       "Finalizing measure " << measureNumber <<
       " in voice \"" << voice->getVoiceName () <<
@@ -1868,7 +1940,8 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMeasure '" <<
       elt->getMeasureNumber () <<
@@ -1876,6 +1949,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     measureNumber =
@@ -1966,7 +2040,8 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasure& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -1974,6 +2049,7 @@ void msr2LpsrTranslator::visitStart (S_msrStanza& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 
@@ -2002,7 +2078,8 @@ void msr2LpsrTranslator::visitEnd (S_msrStanza& elt)
 {
   gIndenter--;
   
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrStanza \"" <<
       elt->getStanzaName () <<
@@ -2010,6 +2087,7 @@ void msr2LpsrTranslator::visitEnd (S_msrStanza& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // forget about this stanza
   fCurrentStanzaClone = nullptr;
@@ -2023,12 +2101,14 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSyllable" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the syllable clone
   fCurrentSyllableClone =
@@ -2063,7 +2143,7 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   
         // create the words
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceWords) {
+        if (gTraceFlags [kTraceLyricsFlag] || gTraceFlags [kTraceWordsFlag]) {
           fLogOutputStream <<
             "Changing lyrics '" <<
             wordsValue <<
@@ -2091,7 +2171,7 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
   
         // append it to the current non-grace note
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceWords) {
+        if (gTraceFlags [kTraceLyricsFlag] || gTraceFlags [kTraceWordsFlag]) {
           fLogOutputStream <<
             "Appending words '" <<
             words->asShortString () <<
@@ -2129,23 +2209,27 @@ void msr2LpsrTranslator::visitStart (S_msrSyllable& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSyllable" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrClef" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendClefToVoice (elt);
@@ -2153,23 +2237,27 @@ void msr2LpsrTranslator::visitStart (S_msrClef& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrClef" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrKey" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendKeyToVoice (elt);
@@ -2177,23 +2265,27 @@ void msr2LpsrTranslator::visitStart (S_msrKey& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrKey" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTime" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append time to voice clone
   fCurrentVoiceClone->
@@ -2202,23 +2294,27 @@ void msr2LpsrTranslator::visitStart (S_msrTime& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTime" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTranspose& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append transpose to voice clone
   fCurrentVoiceClone->
@@ -2227,23 +2323,27 @@ void msr2LpsrTranslator::visitStart (S_msrTranspose& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTranspose& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTranspose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartNameDisplay& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPartNameDisplay" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append part name display to voice clone
   fCurrentVoiceClone->
@@ -2253,12 +2353,14 @@ void msr2LpsrTranslator::visitStart (S_msrPartNameDisplay& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPartAbbreviationDisplay" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append part abbreviation display to voice clone
   fCurrentVoiceClone->
@@ -2268,12 +2370,14 @@ void msr2LpsrTranslator::visitStart (S_msrPartAbbreviationDisplay& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   switch (elt->getTempoKind ()) {
     case msrTempo::k_NoTempoKind:
@@ -2298,23 +2402,27 @@ void msr2LpsrTranslator::visitStart (S_msrTempo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTempo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRehearsal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendRehearsalToVoice (elt);
@@ -2322,23 +2430,27 @@ void msr2LpsrTranslator::visitStart (S_msrRehearsal& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrRehearsal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrRehearsal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2352,23 +2464,27 @@ void msr2LpsrTranslator::visitStart (S_msrArticulation& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrArticulation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrFermata& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrFermata" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // a fermata is an articulation
   
@@ -2385,12 +2501,14 @@ void msr2LpsrTranslator::visitStart (S_msrFermata& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrArpeggiato& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // an arpeggiato is an articulation
   
@@ -2407,12 +2525,14 @@ void msr2LpsrTranslator::visitStart (S_msrArpeggiato& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrNonArpeggiato& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrNonArpeggiato" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // an nonArpeggiato is an articulation
   
@@ -2429,12 +2549,14 @@ void msr2LpsrTranslator::visitStart (S_msrNonArpeggiato& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnical& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2488,23 +2610,27 @@ void msr2LpsrTranslator::visitStart (S_msrTechnical& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnical& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTechnical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2518,23 +2644,27 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithInteger& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithInteger& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithInteger" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2548,23 +2678,27 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithFloat& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithFloat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithFloat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTechnicalWithString& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2589,23 +2723,27 @@ void msr2LpsrTranslator::visitStart (S_msrTechnicalWithString& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTechnicalWithString& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTechnicalWithString" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOrnament& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2619,23 +2757,27 @@ void msr2LpsrTranslator::visitStart (S_msrOrnament& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOrnament& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrOrnament" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSpanner& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSpanner" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   switch (elt->getSpannerTypeKind ()) {
     case kSpannerTypeStart:
@@ -2661,23 +2803,27 @@ void msr2LpsrTranslator::visitStart (S_msrSpanner& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSpanner& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSpanner" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrGlissando& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2697,23 +2843,27 @@ void msr2LpsrTranslator::visitStart (S_msrGlissando& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrGlissando& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrGlissando" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlide& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2727,23 +2877,27 @@ void msr2LpsrTranslator::visitStart (S_msrSlide& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSlide& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSlide" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSingleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2757,23 +2911,27 @@ void msr2LpsrTranslator::visitStart (S_msrSingleTremolo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSingleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrDoubleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrDoubleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create a double tremolo clone from the two elements
   fCurrentDoubleTremoloClone = elt; // JMI FIX THAT
@@ -2790,12 +2948,14 @@ void msr2LpsrTranslator::visitStart (S_msrDoubleTremolo& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrDoubleTremolo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSingleTremolo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the current double tremolo clone to the current voice clone
   fCurrentVoiceClone->
@@ -2811,12 +2971,14 @@ void msr2LpsrTranslator::visitEnd (S_msrDoubleTremolo& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2855,23 +3017,27 @@ void msr2LpsrTranslator::visitStart (S_msrDynamics& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOtherDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2885,23 +3051,27 @@ void msr2LpsrTranslator::visitStart (S_msrOtherDynamics& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOtherDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrOtherDynamics" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2915,23 +3085,27 @@ void msr2LpsrTranslator::visitStart (S_msrWords& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrWords& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrWords" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   /*
     Only the  first note of the chord should get the slur notation.
@@ -2964,23 +3138,27 @@ void msr2LpsrTranslator::visitStart (S_msrSlur& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrSlur" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLigature& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -2994,23 +3172,27 @@ void msr2LpsrTranslator::visitStart (S_msrLigature& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrLigature& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrLigature" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSlash& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSlash" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -3026,12 +3208,14 @@ void msr2LpsrTranslator::visitStart (S_msrSlash& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -3046,12 +3230,14 @@ void msr2LpsrTranslator::visitStart (S_msrWedge& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrWedge" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -3060,19 +3246,21 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   int inputLineNumber =
     elt->getInputLineNumber () ;
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrGraceNotesGroup" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   bool doCreateAGraceNoteClone = true; // JMI
 
   if (doCreateAGraceNoteClone) {
     // create a clone of this graceNotesGroup
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
       fLogOutputStream <<
         "Creating a clone of grace notes group '" << 
         elt->asShortString () <<
@@ -3108,7 +3296,7 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     fLogOutputStream <<
       "+++++++++++++++++++++++++ 1" <<
       endl <<
@@ -3152,11 +3340,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
   // is noteNotesGroupIsAttachedTo the first one in its voice?
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceGraceNotes
+    gTraceFlags [kTraceGraceNotesFlag]
       ||
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
   ) {
     fLogOutputStream <<
       "The noteNotesGroupIsAttachedTo voice clone PEOJIOFEIOJEF '" <<
@@ -3179,11 +3367,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceGraceNotes
+    gTraceFlags [kTraceGraceNotesFlag]
       ||
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
   ) {
     fLogOutputStream <<
       "The first note of voice clone KLJWLPOEF '" <<
@@ -3218,11 +3406,11 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
       // create the skip grace notes group
   #ifdef TRACE_OPTIONS
         if (
-            gTraceOptions->fTraceGraceNotes
+            gTraceFlags [kTraceGraceNotesFlag]
               ||
-            gTraceOptions->fTraceNotes
+            gTraceFlags [kTraceNotesFlag]
               ||
-            gTraceOptions->fTraceVoices
+            gTraceFlags [kTraceVoicesFlag]
         ) {
           fLogOutputStream <<
             "Creating a skip clone of grace notes group '" <<
@@ -3381,15 +3569,17 @@ void msr2LpsrTranslator::visitStart (S_msrGraceNotesGroup& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrGraceNotesGroup" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     fLogOutputStream <<
       "+++++++++++++++++++++++++ 2" <<
       endl <<
@@ -3442,7 +3632,8 @@ void msr2LpsrTranslator::visitEnd (S_msrGraceNotesGroup& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrNote '" <<
       elt->asString () <<
@@ -3450,6 +3641,7 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
     
   // create the note clone
   S_msrNote
@@ -3464,7 +3656,7 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
   // but as the current grace note clone instead
 /* JMI
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
           fLogOutputStream <<
             "The first note of voice clone GFFF '" <<
             fCurrentVoiceClone->getVoiceName () <<
@@ -3501,7 +3693,7 @@ void msr2LpsrTranslator::visitStart (S_msrNote& elt)
           fCurrentNonGraceNoteClone;
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
           fLogOutputStream <<
             "The first note of voice clone RJIRWR '" <<
             fCurrentVoiceClone->getVoiceName () <<
@@ -3553,16 +3745,18 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrNote " <<
       elt->asString () <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     fLogOutputStream <<
       "FAA fCurrentNonGraceNoteClone = " <<
       endl;
@@ -3598,7 +3792,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kRestNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Appending rest note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3614,7 +3808,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kSkipNote: // JMI
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Appending skip note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3630,7 +3824,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kUnpitchedNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Appending unpitched note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3646,7 +3840,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       
     case msrNote::kStandaloneNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Appending standalone note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "' to voice clone " <<
@@ -3665,7 +3859,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
         
         if (fCurrentNonGraceNoteClone->getNoteIsFirstNoteInADoubleTremolo ()) {
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes) {
+          if (gTraceFlags [kTraceNotesFlag]) {
             fLogOutputStream <<
               "Setting note '" <<
               fCurrentNonGraceNoteClone->asString () <<
@@ -3685,7 +3879,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
         
         else if (fCurrentNonGraceNoteClone->getNoteIsSecondNoteInADoubleTremolo ()) {
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes) {
+          if (gTraceFlags [kTraceNotesFlag]) {
             fLogOutputStream <<
               "Setting note '" <<
               fCurrentNonGraceNoteClone->asString () <<
@@ -3757,7 +3951,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Appending grace note '" <<
             fCurrentGraceNoteClone->asShortString () <<
@@ -3777,7 +3971,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
     /* JMI ???
       if (fCurrentGraceNotesGroupClone) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Appending note '" <<
             fCurrentNonGraceNoteClone->asShortString () <<
@@ -3794,7 +3988,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
 
       else if (fPendingAfterGraceNotes) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Appending note '" <<
             fCurrentNonGraceNoteClone->asShortString () <<
@@ -3880,7 +4074,7 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
     case msrNote::kGraceTupletMemberNote:
     case msrNote::kTupletMemberUnpitchedNote:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Appending note clone '" <<
           fCurrentNonGraceNoteClone->asShortString () << "'' to voice clone " <<
@@ -3959,12 +4153,14 @@ void msr2LpsrTranslator::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrOctaveShift& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     setNoteOctaveShift (elt);
@@ -3972,23 +4168,27 @@ void msr2LpsrTranslator::visitStart (S_msrOctaveShift& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrOctaveShift& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrOctaveShift" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrAccordionRegistration& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrAccordionRegistration" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the accordion registration to the voice clone
   fCurrentVoiceClone->
@@ -4002,12 +4202,14 @@ void msr2LpsrTranslator::visitStart (S_msrAccordionRegistration& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrHarpPedalsTuning" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the harp pedals tuning to the voice clone
   fCurrentVoiceClone->
@@ -4017,12 +4219,14 @@ void msr2LpsrTranslator::visitStart (S_msrHarpPedalsTuning& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingNote) {
     fCurrentNonGraceNoteClone->
@@ -4036,18 +4240,21 @@ void msr2LpsrTranslator::visitStart (S_msrStem& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrStem" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
@@ -4055,6 +4262,7 @@ void msr2LpsrTranslator::visitStart (S_msrBeam& elt)
 // JMI      ", fOnGoingChord = " << booleanAsString (fOnGoingChord) <<
       endl;
   }
+#endif
 
   // a beam may be present at the same time
   // in a note or grace note and the chord the latter belongs to
@@ -4076,12 +4284,14 @@ void msr2LpsrTranslator::visitStart (S_msrBeam& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrBeam" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -4090,12 +4300,14 @@ void msr2LpsrTranslator::visitStart (S_msrChord& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrChord" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentChordClone =
     elt->createChordNewbornClone (
@@ -4157,12 +4369,14 @@ void msr2LpsrTranslator::visitStart (S_msrChord& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrChord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingChord = false;
 }
@@ -4170,12 +4384,14 @@ void msr2LpsrTranslator::visitEnd (S_msrChord& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // create the tuplet clone
   S_msrTuplet
@@ -4184,7 +4400,7 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
   // register it in this visitor
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "++> pushing tuplet '" <<
       tupletClone->asString () <<
@@ -4197,6 +4413,7 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
   switch (elt->getTupletLineShapeKind ()) {
     case msrTuplet::kTupletLineShapeStraight:
+      break;
     case msrTuplet::kTupletLineShapeCurved:
       fLpsrScore->
         // this score needs the 'tuplets curved brackets' Scheme function
@@ -4207,15 +4424,17 @@ void msr2LpsrTranslator::visitStart (S_msrTuplet& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTuplet" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "Popping tuplet '" <<
       elt->asString () <<
@@ -4229,7 +4448,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
   if (fTupletClonesStack.size ()) {
     // tuplet is a nested tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "Adding nested tuplet '" <<
       elt->asString () <<
@@ -4248,7 +4467,7 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
     // tuplet is a top level tuplet
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "Adding top level tuplet '" <<
       elt->asString () <<
@@ -4266,12 +4485,14 @@ void msr2LpsrTranslator::visitEnd (S_msrTuplet& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrTie& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     setNoteTie (elt);
@@ -4279,23 +4500,27 @@ void msr2LpsrTranslator::visitStart (S_msrTie& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrTie& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrTie" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrSegno& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrSegno" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendSegnoToVoice (elt);
@@ -4303,12 +4528,14 @@ void msr2LpsrTranslator::visitStart (S_msrSegno& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrCoda& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrCoda" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendCodaToVoice (elt);
@@ -4317,12 +4544,14 @@ void msr2LpsrTranslator::visitStart (S_msrCoda& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrEyeGlasses& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting eyeGlasses" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     appendEyeGlassesToNote (elt);
@@ -4330,12 +4559,14 @@ void msr2LpsrTranslator::visitStart (S_msrEyeGlasses& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrScordatura& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting scordatura" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     appendScordaturaToNote (elt);
@@ -4343,12 +4574,14 @@ void msr2LpsrTranslator::visitStart (S_msrScordatura& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrPedal& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting pedal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     appendPedalToNote (elt);
@@ -4356,12 +4589,14 @@ void msr2LpsrTranslator::visitStart (S_msrPedal& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrDamp& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting damp" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     appendDampToNote (elt);
@@ -4373,12 +4608,14 @@ void msr2LpsrTranslator::visitStart (S_msrDamp& elt)
 
 void msr2LpsrTranslator::visitStart (S_msrDampAll& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting dampAll" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNonGraceNoteClone->
     appendDampAllToNote (elt);
@@ -4391,12 +4628,14 @@ void msr2LpsrTranslator::visitStart (S_msrDampAll& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBarCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendBarCheckToVoice (elt);
@@ -4404,23 +4643,27 @@ void msr2LpsrTranslator::visitStart (S_msrBarCheck& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrBarCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendBarNumberCheckToVoice (elt);
@@ -4428,23 +4671,27 @@ void msr2LpsrTranslator::visitStart (S_msrBarNumberCheck& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrBarNumberCheck" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendLineBreakToVoice (elt);
@@ -4452,23 +4699,27 @@ void msr2LpsrTranslator::visitStart (S_msrLineBreak& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrLineBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrPageBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceClone->
     appendPageBreakToVoice (elt);
@@ -4476,12 +4727,14 @@ void msr2LpsrTranslator::visitStart (S_msrPageBreak& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrPageBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrPageBreak" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -4490,12 +4743,14 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrRepeat" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /* JMI
   fLogOutputStream <<
@@ -4511,7 +4766,7 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
     */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Preparing for repeat in part clone" <<
       fCurrentPartClone->getPartCombinedName () <<
@@ -4532,7 +4787,7 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
 /* JMI
   // create a repeat clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Creating a repeat newborn clone" <<
       ", line " << inputLineNumber <<
@@ -4556,20 +4811,22 @@ void msr2LpsrTranslator::visitStart (S_msrRepeat& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrRepeat& elt)
 {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrRepeat" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /* JMI
   // append the repeat clone to the current part clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a repeat to part clone " <<
       fCurrentPartClone->getPartCombinedName () << "\"" <<
@@ -4592,12 +4849,14 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeat& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRepeatCommonPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrRepeatCommonPart" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
@@ -4605,16 +4864,18 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrRepeatCommonPart" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create a repeat and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a repeat to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4622,7 +4883,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
       endl;
   }
 
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       endl <<
       "*********>> msrRepeatCommonPart GGG " <<
@@ -4649,12 +4910,14 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatCommonPart& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrRepeatEnding& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrRepeatEnding" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
@@ -4662,16 +4925,18 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrRepeatEnding" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create a repeat ending clone and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a repeat ending clone to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4679,7 +4944,7 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
       endl;
   }
 
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       endl <<
       "*********>> msrRepeatEnding HHH " <<
@@ -4704,30 +4969,34 @@ void msr2LpsrTranslator::visitEnd (S_msrRepeatEnding& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
   // set last segment as the measure repeat pattern segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceFlags [kTraceMultipleRestsFlag]) {
     fLogOutputStream <<
       "Setting current last segment as measure repeat pattern segment in voice \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4740,12 +5009,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeat& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeatPattern& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeatPattern" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
@@ -4755,12 +5026,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeatPattern" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -4771,7 +5044,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 
   // create a measures repeat and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasureRepeats) {
+  if (gTraceFlags [kTraceMeasureRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a measures repeat to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4795,12 +5068,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatPattern& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMeasuresRepeatReplicas& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMeasuresRepeatReplicas" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
@@ -4810,18 +5085,20 @@ void msr2LpsrTranslator::visitEnd (S_msrMeasuresRepeatReplicas& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMeasuresRepeatReplicas" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   gIndenter--;
 
   // create a measures repeat replica clone and append it to voice clone
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a repeat replica clone to voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4844,15 +5121,17 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMultipleRest" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceFlags [kTraceMultipleRestsFlag]) {
     fLogOutputStream <<
       "Preparing for multiple rest in voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4871,12 +5150,14 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMultipleRest" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the multiple rest clone
   S_msrMultipleRest
@@ -4893,11 +5174,11 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
   // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceMultipleRests
+    gTraceFlags [kTraceMultipleRestsFlag]
       ||
-    gTraceOptions->fTraceSegments
+    gTraceFlags [kTraceSegmentsFlag]
       ||
-    gTraceOptions->fTraceVoices) {
+    gTraceFlags [kTraceVoicesFlag]) {
     fLogOutputStream <<
       "Creating a new last segment for the remainder of voice \"" <<
       fCurrentVoiceClone->getVoiceName () << "\"" <<
@@ -4929,18 +5210,20 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRest& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMultipleRestContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceFlags [kTraceMultipleRestsFlag]) {
     fLogOutputStream <<
       "Preparing for multiple rest in voice clone \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -4957,7 +5240,7 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
       /* JMI
   // create a new last segment to collect the multiple rest contents
 #ifdef TRACE_OPTIONS
-  if (fTraceMultipleRests || gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+  if (fTraceMultipleRests || gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     fLogOutputStream <<
       "Creating a new last segment for a multiple rest contents for voice \"" <<
       fCurrentVoiceClone->getVoiceName () << "\"" <<
@@ -4973,12 +5256,14 @@ void msr2LpsrTranslator::visitStart (S_msrMultipleRestContents& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrMultipleRestContents& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMultipleRestContents" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -4989,7 +5274,7 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRestContents& elt)
 
   // set last segment as the multiple rest contents segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMultipleRests) {
+  if (gTraceFlags [kTraceMultipleRestsFlag]) {
     fLogOutputStream <<
       "Setting current last segment as multiple rest contents segment in voice \"" <<
       fCurrentVoiceClone->getVoiceName () <<
@@ -5007,18 +5292,20 @@ void msr2LpsrTranslator::visitEnd (S_msrMultipleRestContents& elt)
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrBarline& elt)
 {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrBarline" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines) {
+  if (gTraceFlags [kTraceBarlinesFlag]) {
     fLogOutputStream <<
       "Handling '" <<
       msrBarline::barlineCategoryKindAsString (
@@ -5068,12 +5355,14 @@ void msr2LpsrTranslator::visitStart (S_msrBarline& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrBarline" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -5082,12 +5371,14 @@ void msr2LpsrTranslator::visitStart (S_msrVarValAssoc& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   msrVarValAssoc::msrVarValAssocKind
     varValAssocKind =
@@ -5200,12 +5491,14 @@ void msr2LpsrTranslator::visitStart (S_msrVarValAssoc& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -5214,12 +5507,14 @@ void msr2LpsrTranslator::visitStart (S_msrVarValsListAssoc& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   msrVarValsListAssoc::msrVarValsListAssocKind
     varValsListAssocKind =
@@ -5321,23 +5616,27 @@ void msr2LpsrTranslator::visitStart (S_msrVarValsListAssoc& elt)
 
 void msr2LpsrTranslator::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrLayout& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   gIndenter++;
 }
@@ -5346,33 +5645,39 @@ void msr2LpsrTranslator::visitEnd (S_msrLayout& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrLayout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2LpsrTranslator::visitStart (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void msr2LpsrTranslator::visitEnd (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting msrMidi" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 
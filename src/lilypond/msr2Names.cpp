@@ -16,6 +16,11 @@
 
 #include <iomanip>      // setw, setprecision, ...
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 #include "msr2Names.h"
@@ -67,11 +72,13 @@ void msr2NamesVisitor::printNamesFromMsrScore (
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrScore& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrScore" <<
       endl;
   }
+#endif
   
   fMsrNamesOutputStream <<
     "Score contains " <<
@@ -92,11 +99,13 @@ void msr2NamesVisitor::visitEnd (S_msrScore& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrScore" <<
       endl;
   }
+#endif
   
   fMsrNamesOutputStream <<
     "The score contains:" <<
@@ -141,11 +150,13 @@ void msr2NamesVisitor::visitEnd (S_msrScore& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrPartGroup" <<
       endl;
   }
+#endif
 
   fPartGroupsCounter++;
 
@@ -191,21 +202,25 @@ void msr2NamesVisitor::visitEnd (S_msrPartGroup& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrPartGroup" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrPart" <<
       endl;
   }
+#endif
 
   fPartsCounter++;
   
@@ -257,21 +272,25 @@ void msr2NamesVisitor::visitEnd (S_msrPart& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrPart" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrStaff" <<
       endl;
   }
+#endif
 
   fStavesCounter++;
   
@@ -316,11 +335,13 @@ void msr2NamesVisitor::visitEnd (S_msrStaff& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrStaff" <<
       endl;
   }
+#endif
 
   fOnGoingStaff = false;
 }
@@ -328,11 +349,13 @@ void msr2NamesVisitor::visitEnd (S_msrStaff& elt)
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVoice& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVoice" <<
       endl;
   }
+#endif
 
   fVoicesCounter++;
 
@@ -369,21 +392,25 @@ void msr2NamesVisitor::visitEnd (S_msrVoice& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVoice" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       endl;
   }
+#endif
 
   fMsrNamesOutputStream <<
     "VarValAssoc" <<
@@ -412,21 +439,25 @@ void msr2NamesVisitor::visitStart (S_msrVarValAssoc& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2NamesVisitor::visitStart (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       endl;
   }
+#endif
 
   fMsrNamesOutputStream <<
     "VarValsListAssoc" <<
@@ -455,11 +486,13 @@ void msr2NamesVisitor::visitStart (S_msrVarValsListAssoc& elt)
 
 void msr2NamesVisitor::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrNamesOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       endl;
   }
+#endif
 }
 
 
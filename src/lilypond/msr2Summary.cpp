@@ -16,6 +16,11 @@
 
 #include <iomanip>      // setw, setprecision, ...
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 #include "msr2Summary.h"
@@ -86,11 +91,13 @@ void msr2SummaryVisitor::printSummaryFromMsrScore (
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrScore& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrScore" <<
       endl;
   }
+#endif
   
   fMsrSummaryOutputStream <<
     "Score contains " <<
@@ -111,11 +118,13 @@ void msr2SummaryVisitor::visitEnd (S_msrScore& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrScore" <<
       endl;
   }
+#endif
   
   fMsrSummaryOutputStream <<
     "The score contains:" <<
@@ -253,11 +262,13 @@ void msr2SummaryVisitor::visitEnd (S_msrScore& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPartGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPartGroup" <<
       endl;
   }
+#endif
 
   fPartGroupsCounter++;
 
@@ -331,21 +342,25 @@ void msr2SummaryVisitor::visitEnd (S_msrPartGroup& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPartGroup" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPart& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPart" <<
       endl;
   }
+#endif
 
   fPartsCounter++;
   
@@ -405,21 +420,25 @@ void msr2SummaryVisitor::visitEnd (S_msrPart& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPart" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStaff& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStaff" <<
       endl;
   }
+#endif
 
   fStavesCounter++;
   
@@ -465,11 +484,13 @@ void msr2SummaryVisitor::visitEnd (S_msrStaff& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStaff" <<
       endl;
   }
+#endif
 
   fOnGoingStaff = false;
 }
@@ -477,11 +498,13 @@ void msr2SummaryVisitor::visitEnd (S_msrStaff& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVoice& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVoice" <<
       endl;
   }
+#endif
 
   fVoicesCounter++;
 
@@ -532,21 +555,25 @@ void msr2SummaryVisitor::visitEnd (S_msrVoice& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVoice" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStanza" <<
       endl;
   }
+#endif
 
   fStanzasCounter++;
   
@@ -571,40 +598,48 @@ void msr2SummaryVisitor::visitStart (S_msrStanza& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrStanza& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStanza" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSyllable" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrSyllable& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSyllable" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrClef" <<
       endl;
   }
+#endif
 
   if (! fOnGoingStaff) {
     fMsrSummaryOutputStream <<
@@ -615,21 +650,25 @@ void msr2SummaryVisitor::visitStart (S_msrClef& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrClef& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrClef" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrKey" <<
       endl;
   }
+#endif
 
   if (! fOnGoingStaff) {
     fMsrSummaryOutputStream <<
@@ -640,21 +679,25 @@ void msr2SummaryVisitor::visitStart (S_msrKey& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrKey& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrKey" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTime" <<
       endl;
   }
+#endif
 
   if (! fOnGoingStaff) {    
     fMsrSummaryOutputStream <<
@@ -665,21 +708,25 @@ void msr2SummaryVisitor::visitStart (S_msrTime& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrTime& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTime" <<
     endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTempo" <<
        endl;
   }
+#endif
 
   fMsrSummaryOutputStream <<
     "Tempo" << " " <<
@@ -689,108 +736,131 @@ void msr2SummaryVisitor::visitStart (S_msrTempo& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrTempo& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTempo" <<
     endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSegment" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrSegment& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSegment" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrArticulation" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrArticulation& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrArticulation" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrDynamics" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrDynamics& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrDynamics" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrWedge" << endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrWedge& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrWedge" << endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrGraceNotesGroup" << endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrGraceNotesGroup& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrGraceNotesGroup" << endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting " <<
       msrNote::noteKindAsString (
@@ -798,6 +868,7 @@ void msr2SummaryVisitor::visitStart (S_msrNote& elt)
       " msrNote" <<
       endl;
   }
+#endif
 
   switch (elt->getNoteKind ()) {
     case msrNote::k_NoNoteKind:
@@ -834,7 +905,8 @@ void msr2SummaryVisitor::visitStart (S_msrNote& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrNote& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting " <<
       msrNote::noteKindAsString (
@@ -842,6 +914,7 @@ void msr2SummaryVisitor::visitEnd (S_msrNote& elt)
       " msrNote" <<
       endl;
   }
+#endif
 
   switch (elt->getNoteKind ()) { // JMI
     case msrNote::k_NoNoteKind:
@@ -871,184 +944,222 @@ void msr2SummaryVisitor::visitEnd (S_msrNote& elt)
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrStem" << endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrStem& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrStem" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBeam" << endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrBeam& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBeam" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrChord" <<
       endl;
   }
+#endif
 
   fScoreChordsCounter++;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrChord& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrChord" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrTuplet" <<
       endl;
   }
+#endif
 
   fScoreTupletsCounter++;
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrTuplet& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrTuplet" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrSlur" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrSlur& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrSlur" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBarline" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrBarline& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBarline" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrBarNumberCheck" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrBarNumberCheck& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrBarNumberCheck" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrLineBreak" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrLineBreak& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrLineBreak" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrRepeat" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrRepeat& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrRepeat" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVarValAssoc" <<
       endl;
   }
+#endif
 
   fMsrSummaryOutputStream <<
     "VarValAssoc" <<
@@ -1077,21 +1188,25 @@ void msr2SummaryVisitor::visitStart (S_msrVarValAssoc& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrVarValAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVarValAssoc" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrVarValsListAssoc" <<
       endl;
   }
+#endif
 
   fMsrSummaryOutputStream <<
     "VarValsListAssoc" <<
@@ -1120,21 +1235,25 @@ void msr2SummaryVisitor::visitStart (S_msrVarValsListAssoc& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrVarValsListAssoc& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrVarValsListAssoc" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrPageGeometry" <<
       endl;
   }
+#endif
 
   fMsrSummaryOutputStream <<
     elt;
@@ -1142,21 +1261,25 @@ void msr2SummaryVisitor::visitStart (S_msrPageGeometry& elt)
 
 void msr2SummaryVisitor::visitEnd (S_msrPageGeometry& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrPageGeometry" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrLayout& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrLayout" <<
       endl;
   }
+#endif
 
   fMsrSummaryOutputStream << "Layout" << endl;
 
@@ -1167,30 +1290,36 @@ void msr2SummaryVisitor::visitEnd (S_msrLayout& elt)
 {
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrLayout" <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
 void msr2SummaryVisitor::visitStart (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> Start visiting msrMidi" <<
       endl;
   }
+#endif
 }
 
 void msr2SummaryVisitor::visitEnd (S_msrMidi& elt)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     fMsrSummaryOutputStream <<
       "--> End visiting msrMidi" <<
       endl;
   }
+#endif
 }
 
 
@@ -19,6 +19,11 @@
 
 #include "msrArticulations.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -136,44 +141,52 @@ string msrArticulation::articulationPlacementKindAsString () const
 
 void msrArticulation::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrArticulation::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrArticulation>*
     p =
-      dynamic_cast<visitor<S_msrArticulation>*> (v)) {
+      v->cast<visitor<S_msrArticulation> > (msrVisitorKey<S_msrArticulation> ())) {
         S_msrArticulation elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrArticulation::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrArticulation::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrArticulation::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrArticulation>*
     p =
-      dynamic_cast<visitor<S_msrArticulation>*> (v)) {
+      v->cast<visitor<S_msrArticulation> > (msrVisitorKey<S_msrArticulation> ())) {
         S_msrArticulation elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrArticulation::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -231,44 +244,52 @@ msrFermata::~msrFermata ()
 
 void msrFermata::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFermata::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrFermata>*
     p =
-      dynamic_cast<visitor<S_msrFermata>*> (v)) {
+      v->cast<visitor<S_msrFermata> > (msrVisitorKey<S_msrFermata> ())) {
         S_msrFermata elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFermata::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrFermata::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFermata::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrFermata>*
     p =
-      dynamic_cast<visitor<S_msrFermata>*> (v)) {
+      v->cast<visitor<S_msrFermata> > (msrVisitorKey<S_msrFermata> ())) {
         S_msrFermata elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFermata::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -387,44 +408,52 @@ string msrArpeggiato::arpeggiatoDirectionKindAsString () const
 
 void msrArpeggiato::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrArpeggiato::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
+      v->cast<visitor<S_msrArpeggiato> > (msrVisitorKey<S_msrArpeggiato> ())) {
         S_msrArpeggiato elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrArpeggiato::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrArpeggiato::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrArpeggiato::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrArpeggiato>*> (v)) {
+      v->cast<visitor<S_msrArpeggiato> > (msrVisitorKey<S_msrArpeggiato> ())) {
         S_msrArpeggiato elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrArpeggiato::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -516,44 +545,52 @@ string msrNonArpeggiato::nonArpeggiatoTypeKindAsString () const
 
 void msrNonArpeggiato::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrNonArpeggiato::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrNonArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
+      v->cast<visitor<S_msrNonArpeggiato> > (msrVisitorKey<S_msrNonArpeggiato> ())) {
         S_msrNonArpeggiato elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrNonArpeggiato::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrNonArpeggiato::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrNonArpeggiato::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrNonArpeggiato>*
     p =
-      dynamic_cast<visitor<S_msrNonArpeggiato>*> (v)) {
+      v->cast<visitor<S_msrNonArpeggiato> > (msrVisitorKey<S_msrNonArpeggiato> ())) {
         S_msrNonArpeggiato elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrNonArpeggiato::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
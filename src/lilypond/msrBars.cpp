@@ -59,7 +59,7 @@ msrBarCheck::msrBarCheck (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a bar check without next bar number" <<
       endl;
@@ -75,7 +75,7 @@ msrBarCheck::msrBarCheck (
   fNextBarNumber = nextBarNumber; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a bar check with next bar number '" <<
       fNextBarNumber <<
@@ -91,7 +91,7 @@ msrBarCheck::~msrBarCheck ()
 void msrBarCheck::setNextBarNumber (string number)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting bar check next bar number to '" <<
       number <<
@@ -105,44 +105,52 @@ void msrBarCheck::setNextBarNumber (string number)
 
 void msrBarCheck::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarCheck::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrBarCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
+      v->cast<visitor<S_msrBarCheck> > (msrVisitorKey<S_msrBarCheck> ())) {
         S_msrBarCheck elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarCheck::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrBarCheck::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarCheck::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrBarCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarCheck>*> (v)) {
+      v->cast<visitor<S_msrBarCheck> > (msrVisitorKey<S_msrBarCheck> ())) {
         S_msrBarCheck elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarCheck::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -200,44 +208,52 @@ msrBarNumberCheck::~msrBarNumberCheck ()
 
 void msrBarNumberCheck::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarNumberCheck::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
+      v->cast<visitor<S_msrBarNumberCheck> > (msrVisitorKey<S_msrBarNumberCheck> ())) {
         S_msrBarNumberCheck elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarNumberCheck::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrBarNumberCheck::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarNumberCheck::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrBarNumberCheck>*
     p =
-      dynamic_cast<visitor<S_msrBarNumberCheck>*> (v)) {
+      v->cast<visitor<S_msrBarNumberCheck> > (msrVisitorKey<S_msrBarNumberCheck> ())) {
         S_msrBarNumberCheck elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarNumberCheck::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -338,44 +354,52 @@ msrBarline::~msrBarline ()
 
 void msrBarline::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarline::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrBarline>*
     p =
-      dynamic_cast<visitor<S_msrBarline>*> (v)) {
+      v->cast<visitor<S_msrBarline> > (msrVisitorKey<S_msrBarline> ())) {
         S_msrBarline elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarline::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrBarline::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBarline::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrBarline>*
     p =
-      dynamic_cast<visitor<S_msrBarline>*> (v)) {
+      v->cast<visitor<S_msrBarline> > (msrVisitorKey<S_msrBarline> ())) {
         S_msrBarline elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBarline::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
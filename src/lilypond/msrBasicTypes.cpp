@@ -8691,21 +8691,21 @@ void printChordStructuresMap ()
 // notes names languages
 // ------------------------------------------------------
 
-map<string, msrQuarterTonesPitchesLanguageKind>
+thread_local map<string, msrQuarterTonesPitchesLanguageKind>
   gQuarterTonesPitchesLanguageKindsMap;
 
-map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
-map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
+thread_local map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
 
 void initializeQuarterTonesPitchesLanguageKinds ()
 {
@@ -12888,7 +12888,7 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   S_msrChordInterval otherChordInterval)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
+  if (gTraceFlags [kTraceExtraChordsFlag]) {
     gLogIOstream <<
       endl <<
       "--> computing intervalDifference betwwen '" <<
@@ -12915,7 +12915,7 @@ S_msrChordInterval msrChordInterval::intervalDifference (
     normalizeInterval ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
+  if (gTraceFlags [kTraceExtraChordsFlag]) {
     gLogIOstream <<
       "--> normalized operands are '" <<
       operand1->asShortString () <<
@@ -12974,7 +12974,7 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
+  if (gTraceFlags [kTraceExtraChordsFlag]) {
     gLogIOstream <<
       "--> permuteRelativeOctaves = " <<
       booleanAsString (permuteRelativeOctaves) <<
@@ -14152,7 +14152,7 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
+  if (gTraceFlags [kTraceExtraChordsFlag]) {
     gLogIOstream <<
       "--> base resultIntervalKind = '" <<
       msrIntervalKindAsString (resultIntervalKind) <<
@@ -14185,7 +14185,7 @@ S_msrChordInterval msrChordInterval::intervalDifference (
   result->deNormalizeInterval ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceExtraChords) {
+  if (gTraceFlags [kTraceExtraChordsFlag]) {
     gLogIOstream <<
       "--> result = '" <<
       result->asShortString () <<
@@ -15336,7 +15336,7 @@ S_msrChordInterval msrChordInterval::intervalSum (
 
 /* JMI
 void msrChordInterval::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordInterval::acceptIn ()" <<
       endl;
@@ -15344,10 +15344,10 @@ void msrChordInterval::acceptIn (basevisitor* v) {
       
   if (visitor<S_msrChordInterval>*
     p =
-      dynamic_cast<visitor<S_msrChordInterval>*> (v)) {
+      v->cast<visitor<S_msrChordInterval> > (msrVisitorKey<S_msrChordInterval> ())) {
         S_msrChordInterval elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordInterval::visitStart ()" <<
              endl;
@@ -15356,7 +15356,7 @@ void msrChordInterval::acceptIn (basevisitor* v) {
 }
 
 void msrChordInterval::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordInterval::acceptOut ()" <<
       endl;
@@ -15364,10 +15364,10 @@ void msrChordInterval::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrChordInterval>*
     p =
-      dynamic_cast<visitor<S_msrChordInterval>*> (v)) {
+      v->cast<visitor<S_msrChordInterval> > (msrVisitorKey<S_msrChordInterval> ())) {
         S_msrChordInterval elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordInterval::visitEnd ()" <<
             endl;
@@ -15444,7 +15444,7 @@ void msrChordInterval::print (ostream& os)
 }
 
 //______________________________________________________________________________
-map<msrHarmonyKind, S_msrChordStructure>
+thread_local map<msrHarmonyKind, S_msrChordStructure>
   gChordStructuresMap;
 
 S_msrChordStructure msrChordStructure::createBare (
@@ -16388,7 +16388,7 @@ string msrChordStructure::chordStructureAsString () const
 
 /* JMI
 void msrChordStructure::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordStructure::acceptIn ()" <<
       endl;
@@ -16396,10 +16396,10 @@ void msrChordStructure::acceptIn (basevisitor* v) {
       
   if (visitor<S_msrChordStructure>*
     p =
-      dynamic_cast<visitor<S_msrChordStructure>*> (v)) {
+      v->cast<visitor<S_msrChordStructure> > (msrVisitorKey<S_msrChordStructure> ())) {
         S_msrChordStructure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordStructure::visitStart ()" <<
              endl;
@@ -16408,7 +16408,7 @@ void msrChordStructure::acceptIn (basevisitor* v) {
 }
 
 void msrChordStructure::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordStructure::acceptOut ()" <<
       endl;
@@ -16416,10 +16416,10 @@ void msrChordStructure::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrChordStructure>*
     p =
-      dynamic_cast<visitor<S_msrChordStructure>*> (v)) {
+      v->cast<visitor<S_msrChordStructure> > (msrVisitorKey<S_msrChordStructure> ())) {
         S_msrChordStructure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordStructure::visitEnd ()" <<
             endl;
@@ -16745,7 +16745,7 @@ string msrChordPitch::chordPitchAsString () const
 
 /* JMI
 void msrChordPitch::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordPitch::acceptIn ()" <<
       endl;
@@ -16753,10 +16753,10 @@ void msrChordPitch::acceptIn (basevisitor* v) {
       
   if (visitor<S_msrChordPitch>*
     p =
-      dynamic_cast<visitor<S_msrChordPitch>*> (v)) {
+      v->cast<visitor<S_msrChordPitch> > (msrVisitorKey<S_msrChordPitch> ())) {
         S_msrChordPitch elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordPitch::visitStart ()" <<
              endl;
@@ -16765,7 +16765,7 @@ void msrChordPitch::acceptIn (basevisitor* v) {
 }
 
 void msrChordPitch::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordPitch::acceptOut ()" <<
       endl;
@@ -16773,10 +16773,10 @@ void msrChordPitch::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrChordPitch>*
     p =
-      dynamic_cast<visitor<S_msrChordPitch>*> (v)) {
+      v->cast<visitor<S_msrChordPitch> > (msrVisitorKey<S_msrChordPitch> ())) {
         S_msrChordPitch elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordPitch::visitEnd ()" <<
             endl;
@@ -17073,7 +17073,7 @@ void msrChordContents::printAllChordsContents (
 
 /* JMI
 void msrChordContents::acceptIn (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordContents::acceptIn ()" <<
       endl;
@@ -17081,10 +17081,10 @@ void msrChordContents::acceptIn (basevisitor* v) {
       
   if (visitor<S_msrChordContents>*
     p =
-      dynamic_cast<visitor<S_msrChordContents>*> (v)) {
+      v->cast<visitor<S_msrChordContents> > (msrVisitorKey<S_msrChordContents> ())) {
         S_msrChordContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordContents::visitStart ()" <<
              endl;
@@ -17093,7 +17093,7 @@ void msrChordContents::acceptIn (basevisitor* v) {
 }
 
 void msrChordContents::acceptOut (basevisitor* v) {
-  if (gMsrOptions->fTraceMsrVisitors) {
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChordContents::acceptOut ()" <<
       endl;
@@ -17101,10 +17101,10 @@ void msrChordContents::acceptOut (basevisitor* v) {
 
   if (visitor<S_msrChordContents>*
     p =
-      dynamic_cast<visitor<S_msrChordContents>*> (v)) {
+      v->cast<visitor<S_msrChordContents> > (msrVisitorKey<S_msrChordContents> ())) {
         S_msrChordContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChordContents::visitEnd ()" <<
             endl;
@@ -1103,28 +1103,28 @@ string msrScoreNotationKindAsString (
 //______________________________________________________________________________
 // global variables
 
-extern map<msrHarmonyKind, S_msrChordStructure>
+extern thread_local map<msrHarmonyKind, S_msrChordStructure>
   gChordStructuresMap;
 
 void initializeChordStructuresMap ();
 
 void printChordStructuresMap ();
 
-extern map<string, msrQuarterTonesPitchesLanguageKind>
+extern thread_local map<string, msrQuarterTonesPitchesLanguageKind>
   gQuarterTonesPitchesLanguageKindsMap;
 
-extern map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
-extern map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gEnglishPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gEspanolPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gFrancaisPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gItalianoPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gNorskPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gPortuguesPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gSuomiPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gSvenskaPitchNamesMap;
+extern thread_local map<msrQuarterTonesPitchKind, string> gVlaamsPitchNamesMap;
 
 void initializeQuarterTonesPitchesLanguageKinds ();
 
@@ -54,7 +54,7 @@ msrBeam::msrBeam (
   fBeamKind   = beamKind; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams) {
+  if (gTraceFlags [kTraceBeamsFlag]) {
     gLogIOstream <<
       "Creating beam '" <<
       this->asString () <<
@@ -69,44 +69,52 @@ msrBeam::~msrBeam ()
 
 void msrBeam::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBeam::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrBeam>*
     p =
-      dynamic_cast<visitor<S_msrBeam>*> (v)) {
+      v->cast<visitor<S_msrBeam> > (msrVisitorKey<S_msrBeam> ())) {
         S_msrBeam elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBeam::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrBeam::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrBeam::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrBeam>*
     p =
-      dynamic_cast<visitor<S_msrBeam>*> (v)) {
+      v->cast<visitor<S_msrBeam> > (msrVisitorKey<S_msrBeam> ())) {
         S_msrBeam elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrBeam::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
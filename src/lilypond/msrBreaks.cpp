@@ -51,7 +51,7 @@ msrLineBreak::msrLineBreak (
   fNextBarNumber = nextBarNumber; 
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a break before measure " << fNextBarNumber <<
       endl;
@@ -75,44 +75,52 @@ string msrLineBreak::asString () const
 
 void msrLineBreak::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLineBreak::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrLineBreak>*
     p =
-      dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
+      v->cast<visitor<S_msrLineBreak> > (msrVisitorKey<S_msrLineBreak> ())) {
         S_msrLineBreak elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLineBreak::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrLineBreak::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLineBreak::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrLineBreak>*
     p =
-      dynamic_cast<visitor<S_msrLineBreak>*> (v)) {
+      v->cast<visitor<S_msrLineBreak> > (msrVisitorKey<S_msrLineBreak> ())) {
         S_msrLineBreak elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLineBreak::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -149,7 +157,7 @@ msrPageBreak::msrPageBreak (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a page break" <<
       endl;
@@ -172,44 +180,52 @@ string msrPageBreak::asString () const
 
 void msrPageBreak::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPageBreak::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPageBreak>*
     p =
-      dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
+      v->cast<visitor<S_msrPageBreak> > (msrVisitorKey<S_msrPageBreak> ())) {
         S_msrPageBreak elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPageBreak::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPageBreak::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPageBreak::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPageBreak>*
     p =
-      dynamic_cast<visitor<S_msrPageBreak>*> (v)) {
+      v->cast<visitor<S_msrPageBreak> > (msrVisitorKey<S_msrPageBreak> ())) {
         S_msrPageBreak elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPageBreak::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrClefs.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -85,44 +90,52 @@ bool msrClef::isEqualTo (S_msrClef otherClef) const
 
 void msrClef::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrClef::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrClef>*
     p =
-      dynamic_cast<visitor<S_msrClef>*> (v)) {
+      v->cast<visitor<S_msrClef> > (msrVisitorKey<S_msrClef> ())) {
         S_msrClef elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrClef::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrClef::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrClef::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrClef>*
     p =
-      dynamic_cast<visitor<S_msrClef>*> (v)) {
+      v->cast<visitor<S_msrClef> > (msrVisitorKey<S_msrClef> ())) {
         S_msrClef elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrClef::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
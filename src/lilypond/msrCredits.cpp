@@ -20,6 +20,11 @@
 
 #include "msrCredits.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -82,44 +87,52 @@ msrCreditWords::~msrCreditWords ()
 
 void msrCreditWords::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCreditWords::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrCreditWords>*
     p =
-      dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
+      v->cast<visitor<S_msrCreditWords> > (msrVisitorKey<S_msrCreditWords> ())) {
         S_msrCreditWords elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCreditWords::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrCreditWords::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCreditWords::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrCreditWords>*
     p =
-      dynamic_cast<visitor<S_msrCreditWords>*> (v)) {
+      v->cast<visitor<S_msrCreditWords> > (msrVisitorKey<S_msrCreditWords> ())) {
         S_msrCreditWords elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCreditWords::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -218,44 +231,52 @@ void msrCredit::appendCreditWordsToCredit (
 
 void msrCredit::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCredit::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrCredit>*
     p =
-      dynamic_cast<visitor<S_msrCredit>*> (v)) {
+      v->cast<visitor<S_msrCredit> > (msrVisitorKey<S_msrCredit> ())) {
         S_msrCredit elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCredit::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrCredit::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCredit::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrCredit>*
     p =
-      dynamic_cast<visitor<S_msrCredit>*> (v)) {
+      v->cast<visitor<S_msrCredit> > (msrVisitorKey<S_msrCredit> ())) {
         S_msrCredit elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCredit::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -50,7 +50,7 @@ S_msrDivisions msrDivisions::create (
 S_msrDivisions msrDivisions::createDivisionsNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
- if (gTraceOptions->fTraceDivisions) {
+ if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of divisions '" <<
       divisionsAsString () <<
@@ -83,7 +83,7 @@ msrDivisions::msrDivisions (
 void msrDivisions::initializeDivisions ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
   gLogIOstream <<
     "Initializing divisions" <<
     ", divisionsPerQuarterNote = " << fDivisionsPerQuarterNote <<
@@ -146,7 +146,7 @@ void msrDivisions::initializeDivisions ()
 
   // print the durations divisions if needed
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     printDurationKindsDivisions (gLogIOstream);
   }
 #endif
@@ -254,10 +254,10 @@ string msrDivisions::divisionsAsMsrString (
   // the result is a base duration, followed by a suffix made of
   // either a sequence of dots or a multiplication factor
 
+#ifdef TRACE_OPTIONS
   const int fieldWidth = 22;
   
-#ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream <<
      "--> divisionsAsMsrString ():" <<
       endl <<
@@ -307,7 +307,7 @@ string msrDivisions::divisionsAsMsrString (
         msrDurationKindAsString (baseDurationKind);
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
+      if (gTraceFlags [kTraceDivisionsFlag]) {
         gLogIOstream <<
             gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -342,7 +342,7 @@ string msrDivisions::divisionsAsMsrString (
       baseDurationDivisions / 2;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions) {
+    if (gTraceFlags [kTraceDivisionsFlag]) {
       gLogIOstream <<
         gTab << setw (fieldWidth) <<
         "divisions" << " = " << divisions <<
@@ -368,7 +368,7 @@ string msrDivisions::divisionsAsMsrString (
       r.rationalise ();
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) { // JMI
+      if (gTraceFlags [kTraceDivisionsFlag]) { // JMI
         gLogIOstream <<
           gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -396,7 +396,7 @@ string msrDivisions::divisionsAsMsrString (
         nextDivisionsInList /= 2;
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceDivisions) {
+        if (gTraceFlags [kTraceDivisionsFlag]) {
           gLogIOstream <<
             gTab << setw (fieldWidth) <<
             "divisions" << " = " << divisions <<
@@ -423,7 +423,7 @@ string msrDivisions::divisionsAsMsrString (
       } // while
   
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
+      if (gTraceFlags [kTraceDivisionsFlag]) {
         gLogIOstream <<
           gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -455,7 +455,7 @@ string msrDivisions::divisionsAsMsrString (
   numberOfDotsNeeded = dotsNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream <<
       "<-- divisionsAsMsrString (): returns " << result <<
       endl <<
@@ -480,7 +480,7 @@ string msrDivisions::wholeNotesAsMsrString (
   const int fieldWidth = 22;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream << left <<
       endl <<
       "--> wholeNotesAsMsrString ():" <<
@@ -508,7 +508,7 @@ string msrDivisions::wholeNotesAsMsrString (
     wholeNotes.getDenominator ();      
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream << left <<
       gTab << "divisions" << " = " << divisions <<
       endl;
@@ -552,7 +552,7 @@ string msrDivisions::wholeNotesAsMsrString (
         msrDurationKindAsString (baseDurationKind);
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
+      if (gTraceFlags [kTraceDivisionsFlag]) {
         gLogIOstream << left <<
           gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -590,7 +590,7 @@ string msrDivisions::wholeNotesAsMsrString (
       baseDurationDivisions / 2;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions) {
+    if (gTraceFlags [kTraceDivisionsFlag]) {
       gLogIOstream << left <<
         gTab << setw (fieldWidth) <<
         "divisions" << " = " << divisions <<
@@ -616,7 +616,7 @@ string msrDivisions::wholeNotesAsMsrString (
       r.rationalise ();
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
+      if (gTraceFlags [kTraceDivisionsFlag]) {
         gLogIOstream << left <<
           gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -644,7 +644,7 @@ string msrDivisions::wholeNotesAsMsrString (
         nextDivisionsInList /= 2;
   
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceDivisions) {
+        if (gTraceFlags [kTraceDivisionsFlag]) {
           gLogIOstream << left <<
             gTab << setw (fieldWidth) <<
             "divisions" << " = " << divisions <<
@@ -671,7 +671,7 @@ string msrDivisions::wholeNotesAsMsrString (
       } // while
   
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceDivisions) {
+      if (gTraceFlags [kTraceDivisionsFlag]) {
         gLogIOstream << left <<
           gTab << setw (fieldWidth) <<
           "divisions" << " = " << divisions <<
@@ -703,7 +703,7 @@ string msrDivisions::wholeNotesAsMsrString (
   numberOfDotsNeeded = dotsNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream <<
       "<-- wholeNotesAsMsrString (): returns " << result <<
       endl <<
@@ -772,44 +772,52 @@ msrDivisions::~msrDivisions ()
 
 void msrDivisions::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDivisions::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrDivisions>*
     p =
-      dynamic_cast<visitor<S_msrDivisions>*> (v)) {
+      v->cast<visitor<S_msrDivisions> > (msrVisitorKey<S_msrDivisions> ())) {
         S_msrDivisions elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDivisions::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrDivisions::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDivisions::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrDivisions>*
     p =
-      dynamic_cast<visitor<S_msrDivisions>*> (v)) {
+      v->cast<visitor<S_msrDivisions> > (msrVisitorKey<S_msrDivisions> ())) {
         S_msrDivisions elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDivisions::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -20,6 +20,11 @@
 
 #include "msrDynamics.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -156,44 +161,52 @@ string msrDynamics::dynamicsPlacementKindAsString () const
 
 void msrDynamics::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDynamics::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrDynamics>*
     p =
-      dynamic_cast<visitor<S_msrDynamics>*> (v)) {
+      v->cast<visitor<S_msrDynamics> > (msrVisitorKey<S_msrDynamics> ())) {
         S_msrDynamics elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDynamics::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrDynamics::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDynamics::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrDynamics>*
     p =
-      dynamic_cast<visitor<S_msrDynamics>*> (v)) {
+      v->cast<visitor<S_msrDynamics> > (msrVisitorKey<S_msrDynamics> ())) {
         S_msrDynamics elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDynamics::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -257,44 +270,52 @@ string msrOtherDynamics::otherDynamicsPlacementKindAsString () const
 
 void msrOtherDynamics::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOtherDynamics::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrOtherDynamics>*
     p =
-      dynamic_cast<visitor<S_msrOtherDynamics>*> (v)) {
+      v->cast<visitor<S_msrOtherDynamics> > (msrVisitorKey<S_msrOtherDynamics> ())) {
         S_msrOtherDynamics elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOtherDynamics::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrOtherDynamics::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOtherDynamics::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrOtherDynamics>*
     p =
-      dynamic_cast<visitor<S_msrOtherDynamics>*> (v)) {
+      v->cast<visitor<S_msrOtherDynamics> > (msrVisitorKey<S_msrOtherDynamics> ())) {
         S_msrOtherDynamics elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOtherDynamics::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -408,44 +429,52 @@ string msrWedge::wedgeNienteKindAsString (
 
 void msrWedge::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrWedge::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrWedge>*
     p =
-      dynamic_cast<visitor<S_msrWedge>*> (v)) {
+      v->cast<visitor<S_msrWedge> > (msrVisitorKey<S_msrWedge> ())) {
         S_msrWedge elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrWedge::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrWedge::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrWedge::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrWedge>*
     p =
-      dynamic_cast<visitor<S_msrWedge>*> (v)) {
+      v->cast<visitor<S_msrWedge> > (msrVisitorKey<S_msrWedge> ())) {
         S_msrWedge elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrWedge::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -14,9 +14,11 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <atomic>
 #include <iostream>
 #include <sstream>
 
+#include "elements.h"
 #include "msrElements.h"
 
 #include "setTraceOptionsIfDesired.h"
@@ -31,6 +33,14 @@ using namespace std;
 
 namespace MusicXML2 {
 
+//______________________________________________________________________________
+int msrNewVisitorKey ()
+{
+  static atomic<int> nextKey (kEndElement);
+
+  return nextKey++;
+}
+
 //______________________________________________________________________________
 msrElement::msrElement (
   int inputLineNumber)
@@ -43,44 +53,52 @@ msrElement::~msrElement ()
 
 void msrElement::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrElement::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrElement>*
     p =
-      dynamic_cast<visitor<S_msrElement>*> (v)) {
+      v->cast<visitor<S_msrElement> > (msrVisitorKey<S_msrElement> ())) {
         S_msrElement elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrElement::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrElement::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrElement::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrElement>*
     p =
-      dynamic_cast<visitor<S_msrElement>*> (v)) {
+      v->cast<visitor<S_msrElement> > (msrVisitorKey<S_msrElement> ())) {
         S_msrElement elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrElement::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -20,6 +20,18 @@
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+// the MSR and LPSR element types get their keys in the basevisitor casts cache
+// on demand, after the MusicXML element types
+EXP int msrNewVisitorKey ();
+
+template <typename T> int msrVisitorKey ()
+{
+  static const int key = msrNewVisitorKey ();
+  
+  return key;
+}
+
 //______________________________________________________________________________
 class msrElement : public smartable
 {
@@ -57,7 +57,7 @@ void msrIdentification::setWorkNumber (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting workNumber to \"" << val << "\"" <<
       endl;
@@ -75,7 +75,7 @@ void msrIdentification::setWorkTitle (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting workTitle to \"" << val << "\"" <<
       endl;
@@ -93,7 +93,7 @@ void msrIdentification::setMovementNumber (
   string val)
   {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting movementNumber to \"" << val << "\"" <<
       endl;
@@ -111,7 +111,7 @@ void msrIdentification::setMovementTitle (
   string val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting movementTitle to \"" << val << "\"" <<
       endl;
@@ -129,7 +129,7 @@ void msrIdentification::setEncodingDate (
   string val)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting encodingDate to \"" << val << "\"" <<
       endl;
@@ -147,7 +147,7 @@ void msrIdentification::setScoreInstrument (
   string val)
 {
  #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting scoreInstrument to \"" << val << "\"" <<
       endl;
@@ -165,7 +165,7 @@ void msrIdentification::setMiscellaneousField (
   string val)
 {
  #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting workTitle to \"" << val << "\"" <<
       endl;
@@ -183,7 +183,7 @@ void msrIdentification::addRights (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding right \"" << value << "\"" <<
       endl;
@@ -206,7 +206,7 @@ void msrIdentification::addComposer (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding composer \"" << value << "\"" <<
       endl;
@@ -229,7 +229,7 @@ void msrIdentification::addArranger (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding arranger \"" << value << "\"" <<
       endl;
@@ -252,7 +252,7 @@ void msrIdentification::addLyricist (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding lyricist \"" << value << "\"" <<
       endl;
@@ -275,7 +275,7 @@ void msrIdentification::addPoet (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding poet \"" << value << "\"" <<
       endl;
@@ -298,7 +298,7 @@ void msrIdentification::addTranslator (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding translator \"" << value << "\"" <<
       endl;
@@ -321,7 +321,7 @@ void msrIdentification::addSoftware (
   string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Adding software \"" << value << "\"" <<
       endl;
@@ -341,44 +341,52 @@ void msrIdentification::addSoftware (
 
 void msrIdentification::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrIdentification::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrIdentification>*
     p =
-      dynamic_cast<visitor<S_msrIdentification>*> (v)) {
+      v->cast<visitor<S_msrIdentification> > (msrVisitorKey<S_msrIdentification> ())) {
         S_msrIdentification elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrIdentification::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrIdentification::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrIdentification::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrIdentification>*
     p =
-      dynamic_cast<visitor<S_msrIdentification>*> (v)) {
+      v->cast<visitor<S_msrIdentification> > (msrVisitorKey<S_msrIdentification> ())) {
         S_msrIdentification elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrIdentification::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -74,44 +74,52 @@ msrStringTuning::~msrStringTuning ()
 
 void msrStringTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStringTuning::acceptIn ()" <<
       endl;
   }
+#endif
   
   if (visitor<S_msrStringTuning>*
     p =
-      dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
+      v->cast<visitor<S_msrStringTuning> > (msrVisitorKey<S_msrStringTuning> ())) {
         S_msrStringTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStringTuning::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStringTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStringTuning::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStringTuning>*
     p =
-      dynamic_cast<visitor<S_msrStringTuning>*> (v)) {
+      v->cast<visitor<S_msrStringTuning> > (msrVisitorKey<S_msrStringTuning> ())) {
         S_msrStringTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStringTuning::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -181,44 +189,52 @@ void msrScordatura::addStringTuningToScordatura (
 
 void msrScordatura::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrScordatura::acceptIn ()" <<
       endl;
   }
+#endif
   
   if (visitor<S_msrScordatura>*
     p =
-      dynamic_cast<visitor<S_msrScordatura>*> (v)) {
+      v->cast<visitor<S_msrScordatura> > (msrVisitorKey<S_msrScordatura> ())) {
         S_msrScordatura elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrScordatura::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrScordatura::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrScordatura::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrScordatura>*
     p =
-      dynamic_cast<visitor<S_msrScordatura>*> (v)) {
+      v->cast<visitor<S_msrScordatura> > (msrVisitorKey<S_msrScordatura> ())) {
         S_msrScordatura elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrScordatura::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -297,44 +313,52 @@ msrAccordionRegistration::~msrAccordionRegistration ()
 
 void msrAccordionRegistration::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAccordionRegistration::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrAccordionRegistration>*
     p =
-      dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
+      v->cast<visitor<S_msrAccordionRegistration> > (msrVisitorKey<S_msrAccordionRegistration> ())) {
         S_msrAccordionRegistration elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAccordionRegistration::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrAccordionRegistration::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAccordionRegistration::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrAccordionRegistration>*
     p =
-      dynamic_cast<visitor<S_msrAccordionRegistration>*> (v)) {
+      v->cast<visitor<S_msrAccordionRegistration> > (msrVisitorKey<S_msrAccordionRegistration> ())) {
         S_msrAccordionRegistration elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAccordionRegistration::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -396,7 +420,7 @@ msrHarpPedalsTuning::~msrHarpPedalsTuning ()
 S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a " <<
       asString () <<
@@ -413,7 +437,7 @@ S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningNewbornClone ()
 S_msrHarpPedalsTuning msrHarpPedalsTuning::createHarpPedalsTuningDeepCopy ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a " <<
       asString () <<
@@ -460,44 +484,52 @@ void msrHarpPedalsTuning::addPedalTuning (
 
 void msrHarpPedalsTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarpPedalsTuning::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrHarpPedalsTuning>*
     p =
-      dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
+      v->cast<visitor<S_msrHarpPedalsTuning> > (msrVisitorKey<S_msrHarpPedalsTuning> ())) {
         S_msrHarpPedalsTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarpPedalsTuning::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrHarpPedalsTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarpPedalsTuning::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrHarpPedalsTuning>*
     p =
-      dynamic_cast<visitor<S_msrHarpPedalsTuning>*> (v)) {
+      v->cast<visitor<S_msrHarpPedalsTuning> > (msrVisitorKey<S_msrHarpPedalsTuning> ())) {
         S_msrHarpPedalsTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarpPedalsTuning::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -682,44 +714,52 @@ string msrPedal::pedalSignAsString ()
 
 void msrPedal::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPedal::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPedal>*
     p =
-      dynamic_cast<visitor<S_msrPedal>*> (v)) {
+      v->cast<visitor<S_msrPedal> > (msrVisitorKey<S_msrPedal> ())) {
         S_msrPedal elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPedal::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPedal::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPedal::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPedal>*
     p =
-      dynamic_cast<visitor<S_msrPedal>*> (v)) {
+      v->cast<visitor<S_msrPedal> > (msrVisitorKey<S_msrPedal> ())) {
         S_msrPedal elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPedal::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -768,44 +808,52 @@ msrDamp::~msrDamp ()
 
 void msrDamp::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDamp::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrDamp>*
     p =
-      dynamic_cast<visitor<S_msrDamp>*> (v)) {
+      v->cast<visitor<S_msrDamp> > (msrVisitorKey<S_msrDamp> ())) {
         S_msrDamp elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDamp::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrDamp::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDamp::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrDamp>*
     p =
-      dynamic_cast<visitor<S_msrDamp>*> (v)) {
+      v->cast<visitor<S_msrDamp> > (msrVisitorKey<S_msrDamp> ())) {
         S_msrDamp elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDamp::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -848,44 +896,52 @@ msrDampAll::~msrDampAll ()
 
 void msrDampAll::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDampAll::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrDampAll>*
     p =
-      dynamic_cast<visitor<S_msrDampAll>*> (v)) {
+      v->cast<visitor<S_msrDampAll> > (msrVisitorKey<S_msrDampAll> ())) {
         S_msrDampAll elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDampAll::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrDampAll::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDampAll::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrDampAll>*
     p =
-      dynamic_cast<visitor<S_msrDampAll>*> (v)) {
+      v->cast<visitor<S_msrDampAll> > (msrVisitorKey<S_msrDampAll> ())) {
         S_msrDampAll elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDampAll::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -50,7 +50,7 @@ msrHumdrumScotKeyItem::msrHumdrumScotKeyItem (
     : msrElement (inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
+  if (gTraceFlags [kTraceKeysFlag]) {
     gLogIOstream <<
       "Creating Humdrum/Scot key item" <<
       ", line = " << inputLineNumber <<
@@ -86,7 +86,7 @@ void msrHumdrumScotKeyItem::setKeyItemDiatonicPitchKind (
   msrDiatonicPitchKind diatonicPitchKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
+  if (gTraceFlags [kTraceKeysFlag]) {
     gLogIOstream <<
       "Setting Humdrum/Scot key item diatonic pitch to '" <<
       msrDiatonicPitchKindAsString (diatonicPitchKind) <<
@@ -102,7 +102,7 @@ void msrHumdrumScotKeyItem::setKeyItemAlterationKind (
   msrAlterationKind alterationKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
+  if (gTraceFlags [kTraceKeysFlag]) {
     gLogIOstream <<
       "Setting Humdrum/Scot key item alteration to '" <<
       msrAlterationKindAsString (alterationKind) <<
@@ -117,7 +117,7 @@ void msrHumdrumScotKeyItem::setKeyItemAlterationKind (
 void msrHumdrumScotKeyItem::setKeyItemOctave (int keyOctave)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
+  if (gTraceFlags [kTraceKeysFlag]) {
     gLogIOstream <<
       "Setting Humdrum/Scot key item octave to '" <<
       keyOctave <<
@@ -131,44 +131,52 @@ void msrHumdrumScotKeyItem::setKeyItemOctave (int keyOctave)
 
 void msrHumdrumScotKeyItem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHumdrumScotKeyItem::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrHumdrumScotKeyItem>*
     p =
-      dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
+      v->cast<visitor<S_msrHumdrumScotKeyItem> > (msrVisitorKey<S_msrHumdrumScotKeyItem> ())) {
         S_msrHumdrumScotKeyItem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHumdrumScotKeyItem::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrHumdrumScotKeyItem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHumdrumScotKeyItem::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrHumdrumScotKeyItem>*
     p =
-      dynamic_cast<visitor<S_msrHumdrumScotKeyItem>*> (v)) {
+      v->cast<visitor<S_msrHumdrumScotKeyItem> > (msrVisitorKey<S_msrHumdrumScotKeyItem> ())) {
         S_msrHumdrumScotKeyItem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHumdrumScotKeyItem::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -328,7 +336,7 @@ void msrKey::appendHumdrumScotKeyItem (
   S_msrHumdrumScotKeyItem item)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys) {
+  if (gTraceFlags [kTraceKeysFlag]) {
     gLogIOstream <<
       "Append item '" <<
       item->asString () <<
@@ -350,44 +358,52 @@ void msrKey::appendHumdrumScotKeyItem (
 
 void msrKey::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrKey::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrKey>*
     p =
-      dynamic_cast<visitor<S_msrKey>*> (v)) {
+      v->cast<visitor<S_msrKey> > (msrVisitorKey<S_msrKey> ())) {
         S_msrKey elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrKey::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrKey::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrKey::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrKey>*
     p =
-      dynamic_cast<visitor<S_msrKey>*> (v)) {
+      v->cast<visitor<S_msrKey> > (msrVisitorKey<S_msrKey> ())) {
         S_msrKey elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrKey::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrLayout.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -47,44 +52,52 @@ msrLayout::~msrLayout ()
 
 void msrLayout::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLayout::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrLayout>*
     p =
-      dynamic_cast<visitor<S_msrLayout>*> (v)) {
+      v->cast<visitor<S_msrLayout> > (msrVisitorKey<S_msrLayout> ())) {
         S_msrLayout elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLayout::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrLayout::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLayout::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrLayout>*
     p =
-      dynamic_cast<visitor<S_msrLayout>*> (v)) {
+      v->cast<visitor<S_msrLayout> > (msrVisitorKey<S_msrLayout> ())) {
         S_msrLayout elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLayout::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
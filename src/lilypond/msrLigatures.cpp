@@ -20,6 +20,11 @@
 
 #include "msrLigatures.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 #include "messagesHandling.h"
@@ -87,44 +92,52 @@ void msrLigature::setLigatureOtherEndSidelink (
 
 void msrLigature::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLigature::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrLigature>*
     p =
-      dynamic_cast<visitor<S_msrLigature>*> (v)) {
+      v->cast<visitor<S_msrLigature> > (msrVisitorKey<S_msrLigature> ())) {
         S_msrLigature elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLigature::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrLigature::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrLigature::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrLigature>*
     p =
-      dynamic_cast<visitor<S_msrLigature>*> (v)) {
+      v->cast<visitor<S_msrLigature> > (msrVisitorKey<S_msrLigature> ())) {
         S_msrLigature elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrLigature::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
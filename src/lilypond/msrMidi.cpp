@@ -20,6 +20,11 @@
 
 #include "msrMidi.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -57,44 +62,52 @@ msrMidi::~msrMidi ()
 
 void msrMidi::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMidi::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMidi>*
     p =
-      dynamic_cast<visitor<S_msrMidi>*> (v)) {
+      v->cast<visitor<S_msrMidi> > (msrVisitorKey<S_msrMidi> ())) {
         S_msrMidi elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMidi::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMidi::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMidi::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMidi>*
     p =
-      dynamic_cast<visitor<S_msrMidi>*> (v)) {
+      v->cast<visitor<S_msrMidi> > (msrVisitorKey<S_msrMidi> ())) {
         S_msrMidi elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMidi::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -166,44 +166,52 @@ string msrOrnament::ornamentAccidentalMarkAsString () const
 
 void msrOrnament::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOrnament::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrOrnament>*
     p =
-      dynamic_cast<visitor<S_msrOrnament>*> (v)) {
+      v->cast<visitor<S_msrOrnament> > (msrVisitorKey<S_msrOrnament> ())) {
         S_msrOrnament elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOrnament::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrOrnament::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOrnament::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrOrnament>*
     p =
-      dynamic_cast<visitor<S_msrOrnament>*> (v)) {
+      v->cast<visitor<S_msrOrnament> > (msrVisitorKey<S_msrOrnament> ())) {
         S_msrOrnament elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOrnament::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -289,7 +297,7 @@ S_msrDoubleTremolo msrDoubleTremolo::createDoubleTremoloNewbornClone (
   S_msrElement doubleTremoloSecondElement)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a double tremolo" <<
       endl;
@@ -339,7 +347,7 @@ msrDoubleTremolo::~msrDoubleTremolo ()
 void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Setting note " << note->asShortString () <<
       " as first element of double tremolo " <<
@@ -428,7 +436,7 @@ void msrDoubleTremolo::setDoubleTremoloNoteFirstElement (S_msrNote note)
     numberOfRepeatsAsRational.getNumerator ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Setting notes double tremolo number of repeats to '" <<
       fDoubleTremoloNumberOfRepeats <<
@@ -446,7 +454,7 @@ void msrDoubleTremolo::setDoubleTremoloNoteSecondElement (
   S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Setting note " << note->asShortString () <<
       " as second element of double tremolo " <<
@@ -480,7 +488,7 @@ void msrDoubleTremolo::setDoubleTremoloNoteSecondElement (
   // check that expected double tremolo sounding whole notes
   // match the known double tremolo sounding whole notes
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Checking notes double tremolo second note duration"<<
       ", doubleTremoloNumberOfRepeats = '" <<
@@ -533,7 +541,7 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
   S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Setting chord " << chord->asString () <<
       " as first element of double tremolo " <<
@@ -601,7 +609,7 @@ void msrDoubleTremolo::setDoubleTremoloChordFirstElement (
 void msrDoubleTremolo::setDoubleTremoloChordSecondElement (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Setting chord " << chord->asString () <<
       " as second element of double tremolo " <<
@@ -684,44 +692,52 @@ string msrDoubleTremolo::doubleTremoloPlacementKindAsString () const
 
 void msrDoubleTremolo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDoubleTremolo::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrDoubleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
+      v->cast<visitor<S_msrDoubleTremolo> > (msrVisitorKey<S_msrDoubleTremolo> ())) {
         S_msrDoubleTremolo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDoubleTremolo::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrDoubleTremolo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrDoubleTremolo::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrDoubleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrDoubleTremolo>*> (v)) {
+      v->cast<visitor<S_msrDoubleTremolo> > (msrVisitorKey<S_msrDoubleTremolo> ())) {
         S_msrDoubleTremolo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrDoubleTremolo::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -1036,44 +1052,52 @@ string msrSpanner::spannerPlacementKindAsString () const
 
 void msrSpanner::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSpanner::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSpanner>*
     p =
-      dynamic_cast<visitor<S_msrSpanner>*> (v)) {
+      v->cast<visitor<S_msrSpanner> > (msrVisitorKey<S_msrSpanner> ())) {
         S_msrSpanner elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSpanner::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSpanner::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSpanner::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSpanner>*
     p =
-      dynamic_cast<visitor<S_msrSpanner>*> (v)) {
+      v->cast<visitor<S_msrSpanner> > (msrVisitorKey<S_msrSpanner> ())) {
         S_msrSpanner elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSpanner::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -1173,7 +1197,7 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createGraceNotesGroupNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of grace notes group '" <<
       asShortString () <<
@@ -1232,7 +1256,7 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Creating a skip clone of grace notes group '" <<
       asShortString () <<
@@ -1326,7 +1350,7 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
 void msrGraceNotesGroup::appendNoteToGraceNotesGroup (S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Appending note '" <<
       note->asShortString () <<
@@ -1354,7 +1378,7 @@ void msrGraceNotesGroup::appendNoteToGraceNotesGroup (S_msrNote note)
 void msrGraceNotesGroup::appendChordToGraceNotesGroup (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Appending chord '" <<
       chord->asShortString () <<
@@ -1374,7 +1398,7 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Removing last note from grace notes group '" <<
       asShortString () <<
@@ -1391,7 +1415,7 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
     "fGraceNotesGroupElementsList.size () == 0");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Removing last note from grace notes '" <<
       asString () <<
@@ -1417,7 +1441,7 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
   }   
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "This last note from grace notes '" <<
       asString () <<
@@ -1435,44 +1459,52 @@ S_msrNote msrGraceNotesGroup::removeLastNoteFromGraceNotesGroup (
 
 void msrGraceNotesGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrGraceNotesGroup::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
+      v->cast<visitor<S_msrGraceNotesGroup> > (msrVisitorKey<S_msrGraceNotesGroup> ())) {
         S_msrGraceNotesGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrGraceNotesGroup::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrGraceNotesGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrGraceNotesGroup::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrGraceNotesGroup>*> (v)) {
+      v->cast<visitor<S_msrGraceNotesGroup> > (msrVisitorKey<S_msrGraceNotesGroup> ())) {
         S_msrGraceNotesGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrGraceNotesGroup::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -1692,7 +1724,7 @@ S_msrAfterGraceNotesGroupContents msrAfterGraceNotesGroupContents::createAfterGr
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of after grace notes group" <<
       endl;
@@ -1721,44 +1753,52 @@ void msrAfterGraceNotesGroupContents::appendNoteToAfterGraceNotesGroupContents (
 
 void msrAfterGraceNotesGroupContents::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAfterGraceNotesGroupContents::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrAfterGraceNotesGroupContents>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
+      v->cast<visitor<S_msrAfterGraceNotesGroupContents> > (msrVisitorKey<S_msrAfterGraceNotesGroupContents> ())) {
         S_msrAfterGraceNotesGroupContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAfterGraceNotesGroupContents::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrAfterGraceNotesGroupContents::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAfterGraceNotesGroupContents::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrAfterGraceNotesGroupContents>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroupContents>*> (v)) {
+      v->cast<visitor<S_msrAfterGraceNotesGroupContents> > (msrVisitorKey<S_msrAfterGraceNotesGroupContents> ())) {
         S_msrAfterGraceNotesGroupContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAfterGraceNotesGroupContents::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -1901,7 +1941,7 @@ S_msrAfterGraceNotesGroup msrAfterGraceNotesGroup::createAfterGraceNotesGroupNew
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of after grace notes group '" <<
       asShortString () <<
@@ -1941,44 +1981,52 @@ void msrAfterGraceNotesGroup::appendNoteToAfterGraceNotesGroupContents (
 
 void msrAfterGraceNotesGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAfterGraceNotesGroup::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrAfterGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
+      v->cast<visitor<S_msrAfterGraceNotesGroup> > (msrVisitorKey<S_msrAfterGraceNotesGroup> ())) {
         S_msrAfterGraceNotesGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAfterGraceNotesGroup::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrAfterGraceNotesGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrAfterGraceNotesGroup::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrAfterGraceNotesGroup>*
     p =
-      dynamic_cast<visitor<S_msrAfterGraceNotesGroup>*> (v)) {
+      v->cast<visitor<S_msrAfterGraceNotesGroup> > (msrVisitorKey<S_msrAfterGraceNotesGroup> ())) {
         S_msrAfterGraceNotesGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrAfterGraceNotesGroup::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -2224,7 +2272,7 @@ void msrNote::initializeNote ()
   // ------------------------------------------------------
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     gLogIOstream <<
       endl <<
       "Initializing a note" <<
@@ -2416,17 +2464,28 @@ void msrNote::initializeNote ()
 msrNote::~msrNote ()
 {}
 
+const msrNote::msrNoteAttachments msrNote::gNoNoteAttachments;
+
+msrNote::msrNoteAttachments& msrNote::getNoteAttachmentsToModify ()
+{
+  if (! fNoteAttachments) {
+    fNoteAttachments.reset (new msrNoteAttachments ());
+  }
+  
+  return *fNoteAttachments;
+}
+
 void msrNote::setNoteKind (msrNoteKind noteKind)
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
       ||
-    gTraceOptions->fTraceTuplets
+    gTraceFlags [kTraceTupletsFlag]
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceFlags [kTraceGraceNotesFlag]
   ) {
     gLogIOstream <<
       "Setting the kind of note '" <<
@@ -2471,7 +2530,7 @@ S_msrNote msrNote::createNoteNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of note '" <<
       asString () <<
@@ -2712,8 +2771,12 @@ S_msrNote msrNote::createNoteNewbornClone (
 S_msrNote msrNote::createNoteDeepCopy (
   S_msrVoice containingVoice)
 {
+  const msrNoteAttachments&
+    attachments =
+      getNoteAttachments ();
+
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Creating a deep copy of note " <<
       asString () <<
@@ -2842,10 +2905,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 /* JMI
   {
     list<S_msrSyllable>::const_iterator i;
-    for (i=fNoteSyllables.begin (); i!=fNoteSyllables.end (); i++) {
+    for (i=attachments.fNoteSyllables.begin (); i!=attachments.fNoteSyllables.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSyllables.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSyllables.push_back ((*i));
     } // for
   }
 */
@@ -2862,10 +2925,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrBeam>::const_iterator i;
-    for (i=fNoteBeams.begin (); i!=fNoteBeams.end (); i++) {
+    for (i=attachments.fNoteBeams.begin (); i!=attachments.fNoteBeams.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteBeams.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteBeams.push_back ((*i));
     } // for
   }
   
@@ -2874,12 +2937,12 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   for (
     list<S_msrArticulation>::const_iterator i=
-      fNoteArticulations.begin ();
-      i!=fNoteArticulations.end ();
+      attachments.fNoteArticulations.begin ();
+      i!=attachments.fNoteArticulations.end ();
       i++) {
     // share this data
     noteDeepCopy->
-      fNoteArticulations.push_back ((*i));
+      getNoteAttachmentsToModify ().fNoteArticulations.push_back ((*i));
   } // for
 
   // spanners
@@ -2887,12 +2950,12 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   for (
     list<S_msrSpanner>::const_iterator i=
-      fNoteSpanners.begin ();
-      i!=fNoteSpanners.end ();
+      attachments.fNoteSpanners.begin ();
+      i!=attachments.fNoteSpanners.end ();
       i++) {
     // share this data
     noteDeepCopy->
-      fNoteSpanners.push_back ((*i));
+      getNoteAttachmentsToModify ().fNoteSpanners.push_back ((*i));
   } // for
 
   // technicals
@@ -2901,36 +2964,36 @@ S_msrNote msrNote::createNoteDeepCopy (
   {
     list<S_msrTechnical>::const_iterator i;
     for (
-      i=fNoteTechnicals.begin ();
-      i!=fNoteTechnicals.end ();
+      i=attachments.fNoteTechnicals.begin ();
+      i!=attachments.fNoteTechnicals.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicals.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicals.push_back ((*i));
     } // for
   }
   
   {
     list<S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i=fNoteTechnicalWithIntegers.begin ();
-      i!=fNoteTechnicalWithIntegers.end ();
+      i=attachments.fNoteTechnicalWithIntegers.begin ();
+      i!=attachments.fNoteTechnicalWithIntegers.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicalWithIntegers.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicalWithIntegers.push_back ((*i));
     } // for
   }
   
   {
     list<S_msrTechnicalWithString>::const_iterator i;
     for (
-      i=fNoteTechnicalWithStrings.begin ();
-      i!=fNoteTechnicalWithStrings.end ();
+      i=attachments.fNoteTechnicalWithStrings.begin ();
+      i!=attachments.fNoteTechnicalWithStrings.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicalWithStrings.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicalWithStrings.push_back ((*i));
     } // for
   }
   
@@ -2939,10 +3002,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrOrnament>::const_iterator i;
-    for (i=fNoteOrnaments.begin (); i!=fNoteOrnaments.end (); i++) {
+    for (i=attachments.fNoteOrnaments.begin (); i!=attachments.fNoteOrnaments.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteOrnaments.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteOrnaments.push_back ((*i));
     } // for
   }
   
@@ -2951,10 +3014,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrGlissando>::const_iterator i;
-    for (i=fNoteGlissandos.begin (); i!=fNoteGlissandos.end (); i++) {
+    for (i=attachments.fNoteGlissandos.begin (); i!=attachments.fNoteGlissandos.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteGlissandos.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteGlissandos.push_back ((*i));
     } // for
   }
   
@@ -2963,10 +3026,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlide>::const_iterator i;
-    for (i=fNoteSlides.begin (); i!=fNoteSlides.end (); i++) {
+    for (i=attachments.fNoteSlides.begin (); i!=attachments.fNoteSlides.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlides.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlides.push_back ((*i));
     } // for
   }
   
@@ -3004,19 +3067,19 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDynamics>::const_iterator i;
-    for (i=fNoteDynamics.begin (); i!=fNoteDynamics.end (); i++) {
+    for (i=attachments.fNoteDynamics.begin (); i!=attachments.fNoteDynamics.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDynamics.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDynamics.push_back ((*i));
     } // for
   }
 
   {
     list<S_msrOtherDynamics>::const_iterator i;
-    for (i=fNoteOtherDynamics.begin (); i!=fNoteOtherDynamics.end (); i++) {
+    for (i=attachments.fNoteOtherDynamics.begin (); i!=attachments.fNoteOtherDynamics.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteOtherDynamics.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteOtherDynamics.push_back ((*i));
     } // for
   }
   
@@ -3025,10 +3088,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlash>::const_iterator i;
-    for (i=fNoteSlashes.begin (); i!=fNoteSlashes.end (); i++) {
+    for (i=attachments.fNoteSlashes.begin (); i!=attachments.fNoteSlashes.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlashes.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlashes.push_back ((*i));
     } // for
   }
   
@@ -3037,10 +3100,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrWedge>::const_iterator i;
-    for (i=fNoteWedges.begin (); i!=fNoteWedges.end (); i++) {
+    for (i=attachments.fNoteWedges.begin (); i!=attachments.fNoteWedges.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteWedges.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteWedges.push_back ((*i));
     } // for
   }
   
@@ -3049,10 +3112,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrEyeGlasses>::const_iterator i;
-    for (i=fNoteEyeGlasses.begin (); i!=fNoteEyeGlasses.end (); i++) {
+    for (i=attachments.fNoteEyeGlasses.begin (); i!=attachments.fNoteEyeGlasses.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteEyeGlasses.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteEyeGlasses.push_back ((*i));
     } // for
   }
   
@@ -3061,10 +3124,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDamp>::const_iterator i;
-    for (i=fNoteDamps.begin (); i!=fNoteDamps.end (); i++) {
+    for (i=attachments.fNoteDamps.begin (); i!=attachments.fNoteDamps.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDamps.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDamps.push_back ((*i));
     } // for
   }
   
@@ -3073,10 +3136,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDampAll>::const_iterator i;
-    for (i=fNoteDampAlls.begin (); i!=fNoteDampAlls.end (); i++) {
+    for (i=attachments.fNoteDampAlls.begin (); i!=attachments.fNoteDampAlls.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDampAlls.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDampAlls.push_back ((*i));
     } // for
   }
   
@@ -3085,10 +3148,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrScordatura>::const_iterator i;
-    for (i=fNoteScordaturas.begin (); i!=fNoteScordaturas.end (); i++) {
+    for (i=attachments.fNoteScordaturas.begin (); i!=attachments.fNoteScordaturas.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteScordaturas.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteScordaturas.push_back ((*i));
     } // for
   }
   
@@ -3097,10 +3160,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrWords>::const_iterator i;
-    for (i=fNoteWords.begin (); i!=fNoteWords.end (); i++) {
+    for (i=attachments.fNoteWords.begin (); i!=attachments.fNoteWords.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteWords.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteWords.push_back ((*i));
     } // for
   }
   
@@ -3109,10 +3172,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlur>::const_iterator i;
-    for (i=fNoteSlurs.begin (); i!=fNoteSlurs.end (); i++) {
+    for (i=attachments.fNoteSlurs.begin (); i!=attachments.fNoteSlurs.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlurs.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlurs.push_back ((*i));
     } // for
   }
   
@@ -3121,10 +3184,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   { 
     list<S_msrLigature>::const_iterator i;
-    for (i=fNoteLigatures.begin (); i!=fNoteLigatures.end (); i++) {
+    for (i=attachments.fNoteLigatures.begin (); i!=attachments.fNoteLigatures.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteLigatures.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteLigatures.push_back ((*i));
     } // for
   }
   
@@ -3133,10 +3196,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   { 
     list<S_msrPedal>::const_iterator i;
-    for (i=fNotePedals.begin (); i!=fNotePedals.end (); i++) {
+    for (i=attachments.fNotePedals.begin (); i!=attachments.fNotePedals.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNotePedals.push_back ((*i));
+        getNoteAttachmentsToModify ().fNotePedals.push_back ((*i));
     } // for
   }
 
@@ -3782,7 +3845,7 @@ void msrNote::setNoteStem (S_msrStem stem)
 void msrNote::setNoteBelongsToAChord ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Setting note '" <<
       asShortString () <<
@@ -3821,7 +3884,7 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
   */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Determining tuplet sounding from display whole notes" <<
       " for note '" <<
@@ -3844,7 +3907,7 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
   fNoteSoundingWholeNotes.rationalise ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "The result is: '" <<
       asShortString () <<
@@ -3856,7 +3919,7 @@ void msrNote::determineTupletMemberSoundingFromDisplayWholeNotes (
 void msrNote::appendBeamToNote (S_msrBeam beam)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceBeamsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding beam '" <<
       beam->asShortString () <<
@@ -3867,13 +3930,13 @@ void msrNote::appendBeamToNote (S_msrBeam beam)
   }
 #endif
 
-  fNoteBeams.push_back (beam);
+  getNoteAttachmentsToModify ().fNoteBeams.push_back (beam);
 }
 
 void msrNote::appendArticulationToNote (S_msrArticulation art)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceArticulations || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceArticulationsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding articulation '" <<
       art->asShortString () <<
@@ -3884,13 +3947,13 @@ void msrNote::appendArticulationToNote (S_msrArticulation art)
   }
 #endif
 
-  fNoteArticulations.push_back (art);
+  getNoteAttachmentsToModify ().fNoteArticulations.push_back (art);
 }
 
 void msrNote::appendSpannerToNote (S_msrSpanner spanner)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSpanners || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceSpannersFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding spanner '" <<
       spanner->spannerKindAsString () <<
@@ -3924,13 +3987,13 @@ void msrNote::appendSpannerToNote (S_msrSpanner spanner)
   } // switch
 
   // append spanner to note spanners
-  fNoteSpanners.push_back (spanner);
+  getNoteAttachmentsToModify ().fNoteSpanners.push_back (spanner);
 }
 
 void msrNote::appendTechnicalToNote (S_msrTechnical technical)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
     gLogIOstream <<
       "Adding technical '" <<
       technical->asString () <<
@@ -3941,14 +4004,14 @@ void msrNote::appendTechnicalToNote (S_msrTechnical technical)
 #endif
   
   // append the technical to the note technicals list
-  fNoteTechnicals.push_back (technical);
+  getNoteAttachmentsToModify ().fNoteTechnicals.push_back (technical);
 }
 
 void msrNote::appendTechnicalWithIntegerToNote (
   S_msrTechnicalWithInteger technicalWithInteger)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
     gLogIOstream <<
       "Adding technical with integer '" <<
       technicalWithInteger->asString () <<
@@ -3959,7 +4022,7 @@ void msrNote::appendTechnicalWithIntegerToNote (
 #endif
 
   // append the technical with integer to the note technicals with integers list
-  fNoteTechnicalWithIntegers.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithIntegers.push_back (
     technicalWithInteger);
 }
 
@@ -3967,7 +4030,7 @@ void msrNote::appendTechnicalWithFloatToNote (
   S_msrTechnicalWithFloat technicalWithFloat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
     gLogIOstream <<
       "Adding technical with float '" <<
       technicalWithFloat->asString () <<
@@ -3978,7 +4041,7 @@ void msrNote::appendTechnicalWithFloatToNote (
 #endif
 
   // append the technical with float to the note technicals with floats list
-  fNoteTechnicalWithFloats.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithFloats.push_back (
     technicalWithFloat);
 }
 
@@ -3986,7 +4049,7 @@ void msrNote::appendTechnicalWithStringToNote (
   S_msrTechnicalWithString technicalWithString)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
     gLogIOstream <<
       "Adding technical with string'" <<
       technicalWithString->asString () <<
@@ -3997,14 +4060,14 @@ void msrNote::appendTechnicalWithStringToNote (
 #endif
 
   // append the technical with string to the note technicals with strings list
-  fNoteTechnicalWithStrings.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithStrings.push_back (
     technicalWithString);
 }
 
 void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceOrnaments || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceOrnamentsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding ornament '" <<
       ornament->asShortString () <<
@@ -4016,7 +4079,7 @@ void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 #endif
 
   // append the ornament to the note ornaments list
-  fNoteOrnaments.push_back (ornament);
+  getNoteAttachmentsToModify ().fNoteOrnaments.push_back (ornament);
 
   switch (ornament->getOrnamentKind ()) {
     case msrOrnament::kOrnamentTrill:
@@ -4047,7 +4110,7 @@ void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 void msrNote::appendGlissandoToNote (S_msrGlissando glissando)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGlissandos || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceGlissandosFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding glissando '" <<
       glissando->asShortString () <<
@@ -4059,13 +4122,13 @@ void msrNote::appendGlissandoToNote (S_msrGlissando glissando)
 #endif
 
   // append the glissando to the note glissandos list
-  fNoteGlissandos.push_back (glissando);
+  getNoteAttachmentsToModify ().fNoteGlissandos.push_back (glissando);
 }
 
 void msrNote::appendSlideToNote (S_msrSlide slide)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlides || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceSlidesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding slide '" <<
       slide->asShortString () <<
@@ -4077,14 +4140,14 @@ void msrNote::appendSlideToNote (S_msrSlide slide)
 #endif
 
   // append the slide to the note glissandos list
-  fNoteSlides.push_back (slide);
+  getNoteAttachmentsToModify ().fNoteSlides.push_back (slide);
 }
 
 void msrNote::setNoteGraceNotesGroupBefore (
   S_msrGraceNotesGroup graceNotesGroupBefore)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Attaching grace notes group '" <<
       graceNotesGroupBefore->asString () <<
@@ -4108,7 +4171,7 @@ void msrNote::setNoteGraceNotesGroupAfter (
   S_msrGraceNotesGroup graceNotesGroupAfter)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Attaching grace notes group '" <<
       graceNotesGroupAfter->asString () <<
@@ -4132,7 +4195,7 @@ void msrNote::setNoteGraceNotesGroupAfter (
 void msrNote::setNoteAfterGraceNotesGroup (S_msrGraceNotesGroup afterGraceNotesGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Attaching afterGraceNotesGroup '" << afterGraceNotesGroup->asString () <<
       "' to note '" << asShortString () <<
@@ -4149,7 +4212,7 @@ void msrNote::setNoteAfterGraceNotesGroup (S_msrGraceNotesGroup afterGraceNotesG
 void msrNote::setNoteSingleTremolo (S_msrSingleTremolo trem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding singleTremolo '" << trem->asString () <<
       "' to note '" << asShortString () <<
@@ -4165,7 +4228,7 @@ void msrNote::setNoteSingleTremolo (S_msrSingleTremolo trem)
 void msrNote::appendDynamicsToNote (S_msrDynamics dynamics)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceDynamics || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceGraceDynamicsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Attaching dynamics '" <<
       dynamics->asString () <<
@@ -4176,22 +4239,22 @@ void msrNote::appendDynamicsToNote (S_msrDynamics dynamics)
   }
 #endif
 
-  fNoteDynamics.push_back (dynamics);
+  getNoteAttachmentsToModify ().fNoteDynamics.push_back (dynamics);
 }
 void msrNote::appendOtherDynamicsToNote (S_msrOtherDynamics otherDynamics)
 {
-  fNoteOtherDynamics.push_back (otherDynamics);
+  getNoteAttachmentsToModify ().fNoteOtherDynamics.push_back (otherDynamics);
 }
 
 void msrNote::appendWordsToNote (S_msrWords words)
 {
-  fNoteWords.push_back (words);
+  getNoteAttachmentsToModify ().fNoteWords.push_back (words);
 }
 
 void msrNote::appendSlurToNote (S_msrSlur slur)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceSlursFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Adding slur '" << slur <<
       "' to note '" << asString () << "'" <<
@@ -4199,26 +4262,26 @@ void msrNote::appendSlurToNote (S_msrSlur slur)
   }
 #endif
 
-  fNoteSlurs.push_back (slur);
+  getNoteAttachmentsToModify ().fNoteSlurs.push_back (slur);
 }
 
 void msrNote::appendLigatureToNote (S_msrLigature ligature)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLigatures || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceLigaturesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending ligature " << ligature << " to note " << asString () <<
        endl;
   }
 #endif
 
-  if (fNoteLigatures.size ()) {
+  if (getNoteAttachments ().fNoteLigatures.size ()) {
     if (
-      fNoteLigatures.back ()->getLigatureKind () == msrLigature::kLigatureStart
+      getNoteAttachments ().fNoteLigatures.back ()->getLigatureKind () == msrLigature::kLigatureStart
         &&
       ligature->getLigatureKind () == msrLigature::kLigatureStop
         &&
-      fNoteLigatures.back ()->getLigatureNumber () == ligature->getLigatureNumber ()
+      getNoteAttachments ().fNoteLigatures.back ()->getLigatureNumber () == ligature->getLigatureNumber ()
       ) {
       // it may happen that a given note has a 'ligature start'
       // and a 'ligature stop' in sequence, ignore both
@@ -4238,7 +4301,7 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
         
       // remove 'ligature start'
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLigatures) {
+      if (gTraceFlags [kTraceLigaturesFlag]) {
         gLogIOstream <<
           "Removing last ligature (start) for note '" <<
           asShortString () <<
@@ -4247,32 +4310,32 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
       }
 #endif
 
-      fNoteLigatures.pop_back ();
+      getNoteAttachmentsToModify ().fNoteLigatures.pop_back ();
 
       // don't register 'ligature stop'
     }
 
     else
-      fNoteLigatures.push_back (ligature);
+      getNoteAttachmentsToModify ().fNoteLigatures.push_back (ligature);
   }
 
   else
-    fNoteLigatures.push_back (ligature);
+    getNoteAttachmentsToModify ().fNoteLigatures.push_back (ligature);
 }
 
 void msrNote::appendPedalToNote (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePedals || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTracePedalsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending pedal " << pedal << " to note " << asString () <<
        endl;
   }
 #endif
 
-  if (fNotePedals.size ()) {
+  if (getNoteAttachments ().fNotePedals.size ()) {
     if (
-      fNotePedals.back ()->getPedalTypeKind () == msrPedal::kPedalStart
+      getNoteAttachments ().fNotePedals.back ()->getPedalTypeKind () == msrPedal::kPedalStart
         &&
       pedal->getPedalTypeKind () == msrPedal::kPedalStop
       ) {
@@ -4294,7 +4357,7 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
         
       // rmeove 'pedal start'
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePedals) {
+      if (gTraceFlags [kTracePedalsFlag]) {
         gLogIOstream <<
           "Removing last pedal (start) for note '" <<
           asShortString () <<
@@ -4302,23 +4365,23 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
           endl;
       }
 #endif
-      fNotePedals.pop_back ();
+      getNoteAttachmentsToModify ().fNotePedals.pop_back ();
 
       // don't register 'pedal stop'
     }
 
     else
-      fNotePedals.push_back (pedal);
+      getNoteAttachmentsToModify ().fNotePedals.push_back (pedal);
   }
 
   else
-    fNotePedals.push_back (pedal);
+    getNoteAttachmentsToModify ().fNotePedals.push_back (pedal);
 }
 
 void msrNote::appendSlashToNote (S_msrSlash slash)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlashes || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceSlashesFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending slash '" <<
       slash <<
@@ -4329,38 +4392,38 @@ void msrNote::appendSlashToNote (S_msrSlash slash)
   }
 #endif
 
-  fNoteSlashes.push_back (slash);
+  getNoteAttachmentsToModify ().fNoteSlashes.push_back (slash);
 }
 
 void msrNote::appendWedgeToNote (S_msrWedge wedge)
 {
-  fNoteWedges.push_back (wedge);
+  getNoteAttachmentsToModify ().fNoteWedges.push_back (wedge);
 }
 
 void msrNote::appendEyeGlassesToNote (S_msrEyeGlasses eyeGlasses)
 {
-  fNoteEyeGlasses.push_back (eyeGlasses);
+  getNoteAttachmentsToModify ().fNoteEyeGlasses.push_back (eyeGlasses);
 }
 
 void msrNote::appendDampToNote (S_msrDamp damp)
 {
-  fNoteDamps.push_back (damp);
+  getNoteAttachmentsToModify ().fNoteDamps.push_back (damp);
 }
 
 void msrNote::appendDampAllToNote (S_msrDampAll dampAll)
 {
-  fNoteDampAlls.push_back (dampAll);
+  getNoteAttachmentsToModify ().fNoteDampAlls.push_back (dampAll);
 }
 
 void msrNote::appendScordaturaToNote (S_msrScordatura scordatura)
 {
-  fNoteScordaturas.push_back (scordatura);
+  getNoteAttachmentsToModify ().fNoteScordaturas.push_back (scordatura);
 }
 
 S_msrDynamics msrNote::removeFirstDynamics () // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDynamics || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceDynamicsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Removing first dynamics from note '" <<
       asShortString () <<
@@ -4371,11 +4434,11 @@ S_msrDynamics msrNote::removeFirstDynamics () // JMI
 
   // sanity check
   msrAssert (
-    fNoteDynamics.size () > 0,
+    getNoteAttachments ().fNoteDynamics.size () > 0,
     "fNoteDynamics is empty");
 
-  S_msrDynamics dyn = fNoteDynamics.front ();
-  fNoteDynamics.pop_front ();
+  S_msrDynamics dyn = getNoteAttachments ().fNoteDynamics.front ();
+  getNoteAttachmentsToModify ().fNoteDynamics.pop_front ();
   
   return dyn;
 }
@@ -4383,7 +4446,7 @@ S_msrDynamics msrNote::removeFirstDynamics () // JMI
 S_msrWedge msrNote::removeFirstWedge () // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDynamics || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceDynamicsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Removing first wedge from note '" <<
       asShortString () <<
@@ -4393,18 +4456,18 @@ S_msrWedge msrNote::removeFirstWedge () // JMI
 
   // sanity check
   msrAssert (
-    fNoteDynamics.size () > 0,
+    getNoteAttachments ().fNoteDynamics.size () > 0,
     "fNoteDynamics is empty");
 
-  S_msrWedge wedge = fNoteWedges.front ();
-  fNoteWedges.pop_front ();
+  S_msrWedge wedge = getNoteAttachments ().fNoteWedges.front ();
+  getNoteAttachmentsToModify ().fNoteWedges.pop_front ();
   return wedge;
 }
 
 void msrNote::appendSyllableToNote (S_msrSyllable syllable)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceLyricsFlag] || gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending syllable '" <<
       syllable->asString () <<
@@ -4414,13 +4477,13 @@ void msrNote::appendSyllableToNote (S_msrSyllable syllable)
   }
 #endif
   
-  fNoteSyllables.push_back (syllable);
+  getNoteAttachmentsToModify ().fNoteSyllables.push_back (syllable);
 }
 
 void msrNote::setNoteHarmony (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Setting note '" << asShortString ()  << "'" <<
       " harmony to '" << harmony->asString () << "'" <<
@@ -4439,7 +4502,7 @@ void msrNote::setNoteHarmony (S_msrHarmony harmony)
 void msrNote::setNoteFrame (S_msrFrame frame)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Setting note '" << asShortString ()  << "'" <<
       " frame to '" << frame->asString () << "'" <<
@@ -4453,7 +4516,7 @@ void msrNote::setNoteFrame (S_msrFrame frame)
 void msrNote::setNoteFiguredBass (S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Setting note '" << asShortString ()  << "'" <<
       " figured bass to '" << figuredBass->asString () << "'" <<
@@ -4466,50 +4529,62 @@ void msrNote::setNoteFiguredBass (S_msrFiguredBass figuredBass)
 
 void msrNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrNote::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrNote>*
     p =
-      dynamic_cast<visitor<S_msrNote>*> (v)) {
+      v->cast<visitor<S_msrNote> > (msrVisitorKey<S_msrNote> ())) {
         S_msrNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrNote::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrNote::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrNote>*
     p =
-      dynamic_cast<visitor<S_msrNote>*> (v)) {
+      v->cast<visitor<S_msrNote> > (msrVisitorKey<S_msrNote> ())) {
         S_msrNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrNote::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrNote::browseData (basevisitor* v)
 {
+  const msrNoteAttachments&
+    attachments =
+      getNoteAttachments ();
+
   if (fNoteOctaveShift) {
     // browse the octave shift
     msrBrowser<msrOctaveShift> browser (v);
@@ -4523,10 +4598,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the beams if any
-  if (fNoteBeams.size ()) {
+  if (attachments.fNoteBeams.size ()) {
     gIndenter++;
     list<S_msrBeam>::const_iterator i;
-    for (i=fNoteBeams.begin (); i!=fNoteBeams.end (); i++) {
+    for (i=attachments.fNoteBeams.begin (); i!=attachments.fNoteBeams.end (); i++) {
       // browse the beam
       msrBrowser<msrBeam> browser (v);
       browser.browse (*(*i));
@@ -4535,10 +4610,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the articulations if any
-  if (fNoteArticulations.size ()) {
+  if (attachments.fNoteArticulations.size ()) {
     gIndenter++;
     list<S_msrArticulation>::const_iterator i;
-    for (i=fNoteArticulations.begin (); i!=fNoteArticulations.end (); i++) {
+    for (i=attachments.fNoteArticulations.begin (); i!=attachments.fNoteArticulations.end (); i++) {
       // browse the articulation
       msrBrowser<msrArticulation> browser (v);
       browser.browse (*(*i));
@@ -4547,10 +4622,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the spanners if any
-  if (fNoteSpanners.size ()) {
+  if (attachments.fNoteSpanners.size ()) {
     gIndenter++;
     list<S_msrSpanner>::const_iterator i;
-    for (i=fNoteSpanners.begin (); i!=fNoteSpanners.end (); i++) {
+    for (i=attachments.fNoteSpanners.begin (); i!=attachments.fNoteSpanners.end (); i++) {
       // browse the spanner
       msrBrowser<msrSpanner> browser (v);
       browser.browse (*(*i));
@@ -4559,12 +4634,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals if any
-  if (fNoteTechnicals.size ()) {
+  if (attachments.fNoteTechnicals.size ()) {
     gIndenter++;
     list<S_msrTechnical>::const_iterator i;
     for (
-      i=fNoteTechnicals.begin ();
-      i!=fNoteTechnicals.end ();
+      i=attachments.fNoteTechnicals.begin ();
+      i!=attachments.fNoteTechnicals.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnical> browser (v);
@@ -4574,12 +4649,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with integer if any
-  if (fNoteTechnicalWithIntegers.size ()) {
+  if (attachments.fNoteTechnicalWithIntegers.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i=fNoteTechnicalWithIntegers.begin ();
-      i!=fNoteTechnicalWithIntegers.end ();
+      i=attachments.fNoteTechnicalWithIntegers.begin ();
+      i!=attachments.fNoteTechnicalWithIntegers.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithInteger> browser (v);
@@ -4589,12 +4664,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with float if any
-  if (fNoteTechnicalWithFloats.size ()) {
+  if (attachments.fNoteTechnicalWithFloats.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithFloat>::const_iterator i;
     for (
-      i=fNoteTechnicalWithFloats.begin ();
-      i!=fNoteTechnicalWithFloats.end ();
+      i=attachments.fNoteTechnicalWithFloats.begin ();
+      i!=attachments.fNoteTechnicalWithFloats.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithFloat> browser (v);
@@ -4604,12 +4679,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with string if any
-  if (fNoteTechnicalWithStrings.size ()) {
+  if (attachments.fNoteTechnicalWithStrings.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithString>::const_iterator i;
     for (
-      i=fNoteTechnicalWithStrings.begin ();
-      i!=fNoteTechnicalWithStrings.end ();
+      i=attachments.fNoteTechnicalWithStrings.begin ();
+      i!=attachments.fNoteTechnicalWithStrings.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithString> browser (v);
@@ -4619,10 +4694,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the ornaments if any
-  if (fNoteOrnaments.size ()) {
+  if (attachments.fNoteOrnaments.size ()) {
     gIndenter++;
     list<S_msrOrnament>::const_iterator i;
-    for (i=fNoteOrnaments.begin (); i!=fNoteOrnaments.end (); i++) {
+    for (i=attachments.fNoteOrnaments.begin (); i!=attachments.fNoteOrnaments.end (); i++) {
       // browse the ornament
       msrBrowser<msrOrnament> browser (v);
       browser.browse (*(*i));
@@ -4631,10 +4706,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the glissandos if any
-  if (fNoteGlissandos.size ()) {
+  if (attachments.fNoteGlissandos.size ()) {
     gIndenter++;
     list<S_msrGlissando>::const_iterator i;
-    for (i=fNoteGlissandos.begin (); i!=fNoteGlissandos.end (); i++) {
+    for (i=attachments.fNoteGlissandos.begin (); i!=attachments.fNoteGlissandos.end (); i++) {
       // browse the glissando
       msrBrowser<msrGlissando> browser (v);
       browser.browse (*(*i));
@@ -4643,10 +4718,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the slides if any
-  if (fNoteSlides.size ()) {
+  if (attachments.fNoteSlides.size ()) {
     gIndenter++;
     list<S_msrSlide>::const_iterator i;
-    for (i=fNoteSlides.begin (); i!=fNoteSlides.end (); i++) {
+    for (i=attachments.fNoteSlides.begin (); i!=attachments.fNoteSlides.end (); i++) {
       // browse the glissando
       msrBrowser<msrSlide> browser (v);
       browser.browse (*(*i));
@@ -4682,10 +4757,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the dynamics if any
-  if (fNoteDynamics.size ()) {
+  if (attachments.fNoteDynamics.size ()) {
     gIndenter++;
     list<S_msrDynamics>::const_iterator i;
-    for (i=fNoteDynamics.begin (); i!=fNoteDynamics.end (); i++) {
+    for (i=attachments.fNoteDynamics.begin (); i!=attachments.fNoteDynamics.end (); i++) {
       // browse the dynamics
       msrBrowser<msrDynamics> browser (v);
       browser.browse (*(*i));
@@ -4694,10 +4769,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the other dynamics if any
-  if (fNoteOtherDynamics.size ()) {
+  if (attachments.fNoteOtherDynamics.size ()) {
     gIndenter++;
     list<S_msrOtherDynamics>::const_iterator i;
-    for (i=fNoteOtherDynamics.begin (); i!=fNoteOtherDynamics.end (); i++) {
+    for (i=attachments.fNoteOtherDynamics.begin (); i!=attachments.fNoteOtherDynamics.end (); i++) {
       // browse the other dynamics
       msrBrowser<msrOtherDynamics> browser (v);
       browser.browse (*(*i));
@@ -4706,10 +4781,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the words if any
-  if (fNoteWords.size ()) {
+  if (attachments.fNoteWords.size ()) {
     gIndenter++;
     list<S_msrWords>::const_iterator i;
-    for (i=fNoteWords.begin (); i!=fNoteWords.end (); i++) {
+    for (i=attachments.fNoteWords.begin (); i!=attachments.fNoteWords.end (); i++) {
       // browse the words
       msrBrowser<msrWords> browser (v);
       browser.browse (*(*i));
@@ -4718,10 +4793,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the slurs if any
-  if (fNoteSlurs.size ()) {
+  if (attachments.fNoteSlurs.size ()) {
     gIndenter++;
     list<S_msrSlur>::const_iterator i;
-    for (i=fNoteSlurs.begin (); i!=fNoteSlurs.end (); i++) {
+    for (i=attachments.fNoteSlurs.begin (); i!=attachments.fNoteSlurs.end (); i++) {
       // browse the slur
       msrBrowser<msrSlur> browser (v);
       browser.browse (*(*i));
@@ -4730,10 +4805,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the ligatures if any
-  if (fNoteLigatures.size ()) {
+  if (attachments.fNoteLigatures.size ()) {
     gIndenter++;
     list<S_msrLigature>::const_iterator i;
-    for (i=fNoteLigatures.begin (); i!=fNoteLigatures.end (); i++) {
+    for (i=attachments.fNoteLigatures.begin (); i!=attachments.fNoteLigatures.end (); i++) {
       // browse the ligature
       msrBrowser<msrLigature> browser (v);
       browser.browse (*(*i));
@@ -4742,10 +4817,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the pedals if any
-  if (fNotePedals.size ()) {
+  if (attachments.fNotePedals.size ()) {
     gIndenter++;
     list<S_msrPedal>::const_iterator i;
-    for (i=fNotePedals.begin (); i!=fNotePedals.end (); i++) {
+    for (i=attachments.fNotePedals.begin (); i!=attachments.fNotePedals.end (); i++) {
       // browse the pedal
       msrBrowser<msrPedal> browser (v);
       browser.browse (*(*i));
@@ -4754,10 +4829,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the wedges if any
-  if (fNoteSlashes.size ()) {
+  if (attachments.fNoteSlashes.size ()) {
     gIndenter++;
     list<S_msrSlash>::const_iterator i;
-    for (i=fNoteSlashes.begin (); i!=fNoteSlashes.end (); i++) {
+    for (i=attachments.fNoteSlashes.begin (); i!=attachments.fNoteSlashes.end (); i++) {
       // browse the wedge
       msrBrowser<msrSlash> browser (v);
       browser.browse (*(*i));
@@ -4766,10 +4841,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the wedges if any
-  if (fNoteWedges.size ()) {
+  if (attachments.fNoteWedges.size ()) {
     gIndenter++;
     list<S_msrWedge>::const_iterator i;
-    for (i=fNoteWedges.begin (); i!=fNoteWedges.end (); i++) {
+    for (i=attachments.fNoteWedges.begin (); i!=attachments.fNoteWedges.end (); i++) {
       // browse the wedge
       msrBrowser<msrWedge> browser (v);
       browser.browse (*(*i));
@@ -4778,10 +4853,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the eyeglasses if any
-  if (fNoteEyeGlasses.size ()) {
+  if (attachments.fNoteEyeGlasses.size ()) {
     gIndenter++;
     list<S_msrEyeGlasses>::const_iterator i;
-    for (i=fNoteEyeGlasses.begin (); i!=fNoteEyeGlasses.end (); i++) {
+    for (i=attachments.fNoteEyeGlasses.begin (); i!=attachments.fNoteEyeGlasses.end (); i++) {
       // browse the eyeglasses
       msrBrowser<msrEyeGlasses> browser (v);
       browser.browse (*(*i));
@@ -4790,10 +4865,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damps if any
-  if (fNoteDamps.size ()) {
+  if (attachments.fNoteDamps.size ()) {
     gIndenter++;
     list<S_msrDamp>::const_iterator i;
-    for (i=fNoteDamps.begin (); i!=fNoteDamps.end (); i++) {
+    for (i=attachments.fNoteDamps.begin (); i!=attachments.fNoteDamps.end (); i++) {
       // browse the damp
       msrBrowser<msrDamp> browser (v);
       browser.browse (*(*i));
@@ -4802,10 +4877,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damp alls if any
-  if (fNoteDampAlls.size ()) {
+  if (attachments.fNoteDampAlls.size ()) {
     gIndenter++;
     list<S_msrDampAll>::const_iterator i;
-    for (i=fNoteDampAlls.begin (); i!=fNoteDampAlls.end (); i++) {
+    for (i=attachments.fNoteDampAlls.begin (); i!=attachments.fNoteDampAlls.end (); i++) {
       // browse the damp all
       msrBrowser<msrDampAll> browser (v);
       browser.browse (*(*i));
@@ -4814,10 +4889,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the scordaturas if any
-  if (fNoteScordaturas.size ()) {
+  if (attachments.fNoteScordaturas.size ()) {
     gIndenter++;
     list<S_msrScordatura>::const_iterator i;
-    for (i=fNoteScordaturas.begin (); i!=fNoteScordaturas.end (); i++) {
+    for (i=attachments.fNoteScordaturas.begin (); i!=attachments.fNoteScordaturas.end (); i++) {
       // browse the scordatura
       msrBrowser<msrScordatura> browser (v);
       browser.browse (*(*i));
@@ -4826,10 +4901,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the syllables if any
-  if (fNoteSyllables.size ()) {
+  if (attachments.fNoteSyllables.size ()) {
     gIndenter++;
     list<S_msrSyllable>::const_iterator i;
-    for (i=fNoteSyllables.begin (); i!=fNoteSyllables.end (); i++) {
+    for (i=attachments.fNoteSyllables.begin (); i!=attachments.fNoteSyllables.end (); i++) {
       // browse the syllable
       msrBrowser<msrSyllable> browser (v);
       browser.browse (*(*i));
@@ -5468,6 +5543,10 @@ string msrNote::asString () const
 
 void msrNote::print (ostream& os)
 {
+  const msrNoteAttachments&
+    attachments =
+      getNoteAttachments ();
+
   rational
     measureFullLength =
       fNoteMeasureUplink
@@ -6046,7 +6125,7 @@ void msrNote::print (ostream& os)
   }
 
   // print the syllables associated to this note if any
-  int noteSyllablesSize = fNoteSyllables.size ();
+  int noteSyllablesSize = attachments.fNoteSyllables.size ();
 
   if (noteSyllablesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
@@ -6059,8 +6138,8 @@ void msrNote::print (ostream& os)
       gIndenter++;
             
       list<S_msrSyllable>::const_iterator
-        iBegin = fNoteSyllables.begin (),
-        iEnd   = fNoteSyllables.end (),
+        iBegin = attachments.fNoteSyllables.begin (),
+        iEnd   = attachments.fNoteSyllables.end (),
         i      = iBegin;
       for ( ; ; ) {
         S_msrSyllable
@@ -6151,21 +6230,21 @@ void msrNote::print (ostream& os)
   }
     
   // print the beams if any
-  int noteBeamsSize = fNoteBeams.size ();
+  int noteBeamsSize = attachments.fNoteBeams.size ();
 
   if (noteBeamsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteBeams";
-    if (fNoteBeams.size ()) {
+    if (attachments.fNoteBeams.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrBeam>::const_iterator
-        iBegin = fNoteBeams.begin (),
-        iEnd   = fNoteBeams.end (),
+        iBegin = attachments.fNoteBeams.begin (),
+        iEnd   = attachments.fNoteBeams.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6183,21 +6262,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the articulations if any
-  int noteArticulationsSize = fNoteArticulations.size ();
+  int noteArticulationsSize = attachments.fNoteArticulations.size ();
 
   if (noteArticulationsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteArticulations";
-    if (fNoteArticulations.size ()) {
+    if (attachments.fNoteArticulations.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrArticulation>::const_iterator
-        iBegin = fNoteArticulations.begin (),
-        iEnd   = fNoteArticulations.end (),
+        iBegin = attachments.fNoteArticulations.begin (),
+        iEnd   = attachments.fNoteArticulations.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6215,21 +6294,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the spanners if any
-  int noteSpannersSize = fNoteSpanners.size ();
+  int noteSpannersSize = attachments.fNoteSpanners.size ();
 
   if (noteSpannersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSpanners";
-    if (fNoteSpanners.size ()) {
+    if (attachments.fNoteSpanners.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrSpanner>::const_iterator
-        iBegin = fNoteSpanners.begin (),
-        iEnd   = fNoteSpanners.end (),
+        iBegin = attachments.fNoteSpanners.begin (),
+        iEnd   = attachments.fNoteSpanners.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6247,21 +6326,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals if any
-  int noteTechnicalsSize = fNoteTechnicals.size ();
+  int noteTechnicalsSize = attachments.fNoteTechnicals.size ();
 
   if (noteTechnicalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicals";
-    if (fNoteTechnicals.size ()) {
+    if (attachments.fNoteTechnicals.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnical>::const_iterator
-        iBegin = fNoteTechnicals.begin (),
-        iEnd   = fNoteTechnicals.end (),
+        iBegin = attachments.fNoteTechnicals.begin (),
+        iEnd   = attachments.fNoteTechnicals.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6279,21 +6358,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with integer if any
-  int noteTechnicalWithIntegersSize = fNoteTechnicalWithIntegers.size ();
+  int noteTechnicalWithIntegersSize = attachments.fNoteTechnicalWithIntegers.size ();
 
   if (noteTechnicalWithIntegersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithIntegers";
-    if (fNoteTechnicalWithIntegers.size ()) {
+    if (attachments.fNoteTechnicalWithIntegers.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithInteger>::const_iterator
-        iBegin = fNoteTechnicalWithIntegers.begin (),
-        iEnd   = fNoteTechnicalWithIntegers.end (),
+        iBegin = attachments.fNoteTechnicalWithIntegers.begin (),
+        iEnd   = attachments.fNoteTechnicalWithIntegers.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6311,21 +6390,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with float if any
-  int noteTechnicalWithFloatsSize = fNoteTechnicalWithFloats.size ();
+  int noteTechnicalWithFloatsSize = attachments.fNoteTechnicalWithFloats.size ();
 
   if (noteTechnicalWithFloatsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithFloats";
-    if (fNoteTechnicalWithFloats.size ()) {
+    if (attachments.fNoteTechnicalWithFloats.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithFloat>::const_iterator
-        iBegin = fNoteTechnicalWithFloats.begin (),
-        iEnd   = fNoteTechnicalWithFloats.end (),
+        iBegin = attachments.fNoteTechnicalWithFloats.begin (),
+        iEnd   = attachments.fNoteTechnicalWithFloats.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6343,21 +6422,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with string if any
-  int noteTechnicalWithStringsSize = fNoteTechnicalWithStrings.size ();
+  int noteTechnicalWithStringsSize = attachments.fNoteTechnicalWithStrings.size ();
 
   if (noteTechnicalWithStringsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithStrings";
-    if (fNoteTechnicalWithStrings.size ()) {
+    if (attachments.fNoteTechnicalWithStrings.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithString>::const_iterator
-        iBegin = fNoteTechnicalWithStrings.begin (),
-        iEnd   = fNoteTechnicalWithStrings.end (),
+        iBegin = attachments.fNoteTechnicalWithStrings.begin (),
+        iEnd   = attachments.fNoteTechnicalWithStrings.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6375,21 +6454,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the ornaments if any
-  int noteOrnamentsSize = fNoteOrnaments.size ();
+  int noteOrnamentsSize = attachments.fNoteOrnaments.size ();
 
   if (noteOrnamentsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOrnaments";
-    if (fNoteOrnaments.size ()) {
+    if (attachments.fNoteOrnaments.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrOrnament>::const_iterator
-        iBegin = fNoteOrnaments.begin (),
-        iEnd   = fNoteOrnaments.end (),
+        iBegin = attachments.fNoteOrnaments.begin (),
+        iEnd   = attachments.fNoteOrnaments.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6407,21 +6486,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the glissandos if any
-  int noteGlissandosSize = fNoteGlissandos.size ();
+  int noteGlissandosSize = attachments.fNoteGlissandos.size ();
 
   if (noteGlissandosSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGlissandos";
-    if (fNoteGlissandos.size ()) {
+    if (attachments.fNoteGlissandos.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrGlissando>::const_iterator
-        iBegin = fNoteGlissandos.begin (),
-        iEnd   = fNoteGlissandos.end (),
+        iBegin = attachments.fNoteGlissandos.begin (),
+        iEnd   = attachments.fNoteGlissandos.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6439,21 +6518,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the slides if any
-  int noteSlidesSize = fNoteSlides.size ();
+  int noteSlidesSize = attachments.fNoteSlides.size ();
 
   if (noteSlidesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlides";
-    if (fNoteSlides.size ()) {
+    if (attachments.fNoteSlides.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrSlide>::const_iterator
-        iBegin = fNoteSlides.begin (),
-        iEnd   = fNoteSlides.end (),
+        iBegin = attachments.fNoteSlides.begin (),
+        iEnd   = attachments.fNoteSlides.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6560,21 +6639,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the dynamics if any
-  int noteDynamicsSize = fNoteDynamics.size ();
+  int noteDynamicsSize = attachments.fNoteDynamics.size ();
 
   if (noteDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDynamics";
-    if (fNoteDynamics.size ()) {
+    if (attachments.fNoteDynamics.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDynamics>::const_iterator
-        iBegin = fNoteDynamics.begin (),
-        iEnd   = fNoteDynamics.end (),
+        iBegin = attachments.fNoteDynamics.begin (),
+        iEnd   = attachments.fNoteDynamics.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6592,21 +6671,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the other dynamics if any
-  int noteOtherDynamicsSize = fNoteOtherDynamics.size ();
+  int noteOtherDynamicsSize = attachments.fNoteOtherDynamics.size ();
 
   if (noteOtherDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOtherDynamics";
-    if (fNoteOtherDynamics.size ()) {
+    if (attachments.fNoteOtherDynamics.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrOtherDynamics>::const_iterator
-        iBegin = fNoteOtherDynamics.begin (),
-        iEnd   = fNoteOtherDynamics.end (),
+        iBegin = attachments.fNoteOtherDynamics.begin (),
+        iEnd   = attachments.fNoteOtherDynamics.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6624,20 +6703,20 @@ void msrNote::print (ostream& os)
   }
 
   // print the words if any
-  int noteWordsSize = fNoteWords.size ();
+  int noteWordsSize = attachments.fNoteWords.size ();
 
   if (noteWordsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWords";
-    if (fNoteWords.size ()) {
+    if (attachments.fNoteWords.size ()) {
       gIndenter++;
             os <<
         endl;
 
       list<S_msrWords>::const_iterator
-        iBegin = fNoteWords.begin (),
-        iEnd   = fNoteWords.end (),
+        iBegin = attachments.fNoteWords.begin (),
+        iEnd   = attachments.fNoteWords.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6655,21 +6734,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the slurs if any
-  int noteSlursSize = fNoteSlurs.size ();
+  int noteSlursSize = attachments.fNoteSlurs.size ();
 
   if (noteSlursSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlurs";
-    if (fNoteSlurs.size ()) {
+    if (attachments.fNoteSlurs.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrSlur>::const_iterator
-        iBegin = fNoteSlurs.begin (),
-        iEnd   = fNoteSlurs.end (),
+        iBegin = attachments.fNoteSlurs.begin (),
+        iEnd   = attachments.fNoteSlurs.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6687,21 +6766,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the ligatures if any
-  int noteLigaturesSize = fNoteLigatures.size ();
+  int noteLigaturesSize = attachments.fNoteLigatures.size ();
 
   if (noteLigaturesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteLigatures";
-    if (fNoteLigatures.size ()) {
+    if (attachments.fNoteLigatures.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrLigature>::const_iterator
-        iBegin = fNoteLigatures.begin (),
-        iEnd   = fNoteLigatures.end (),
+        iBegin = attachments.fNoteLigatures.begin (),
+        iEnd   = attachments.fNoteLigatures.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6719,21 +6798,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the pedals if any
-  int notePedalsSize = fNotePedals.size ();
+  int notePedalsSize = attachments.fNotePedals.size ();
 
   if (notePedalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "notePedals";
-    if (fNotePedals.size ()) {
+    if (attachments.fNotePedals.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrPedal>::const_iterator
-        iBegin = fNotePedals.begin (),
-        iEnd   = fNotePedals.end (),
+        iBegin = attachments.fNotePedals.begin (),
+        iEnd   = attachments.fNotePedals.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6751,21 +6830,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the slashes if any
-  int noteSlashesSize = fNoteSlashes.size ();
+  int noteSlashesSize = attachments.fNoteSlashes.size ();
 
   if (noteSlashesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlashes";
-    if (fNoteSlashes.size ()) {
+    if (attachments.fNoteSlashes.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrSlash>::const_iterator
-        iBegin = fNoteSlashes.begin (),
-        iEnd   = fNoteSlashes.end (),
+        iBegin = attachments.fNoteSlashes.begin (),
+        iEnd   = attachments.fNoteSlashes.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6783,21 +6862,21 @@ void msrNote::print (ostream& os)
       }
 
   // print the wedges if any
-  int noteWedgesSize = fNoteWedges.size ();
+  int noteWedgesSize = attachments.fNoteWedges.size ();
 
   if (noteWedgesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWedges";
-    if (fNoteWedges.size ()) {
+    if (attachments.fNoteWedges.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrWedge>::const_iterator
-        iBegin = fNoteWedges.begin (),
-        iEnd   = fNoteWedges.end (),
+        iBegin = attachments.fNoteWedges.begin (),
+        iEnd   = attachments.fNoteWedges.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6815,21 +6894,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the eyeglasses if any
-  int noteEyeGlassesSize = fNoteEyeGlasses.size ();
+  int noteEyeGlassesSize = attachments.fNoteEyeGlasses.size ();
 
   if (noteEyeGlassesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteEyeGlasses";
-    if (fNoteEyeGlasses.size ()) {
+    if (attachments.fNoteEyeGlasses.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrEyeGlasses>::const_iterator
-        iBegin = fNoteEyeGlasses.begin (),
-        iEnd   = fNoteEyeGlasses.end (),
+        iBegin = attachments.fNoteEyeGlasses.begin (),
+        iEnd   = attachments.fNoteEyeGlasses.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6847,21 +6926,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the damps if any
-  int noteDampsSize = fNoteDamps.size ();
+  int noteDampsSize = attachments.fNoteDamps.size ();
 
   if (noteDampsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDamps";
-    if (fNoteDamps.size ()) {
+    if (attachments.fNoteDamps.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDamp>::const_iterator
-        iBegin = fNoteDamps.begin (),
-        iEnd   = fNoteDamps.end (),
+        iBegin = attachments.fNoteDamps.begin (),
+        iEnd   = attachments.fNoteDamps.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6879,21 +6958,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the dampAlls if any
-  int noteDampAllsSize = fNoteDampAlls.size ();
+  int noteDampAllsSize = attachments.fNoteDampAlls.size ();
 
   if (noteDampAllsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDampAlls";
-    if (fNoteDampAlls.size ()) {
+    if (attachments.fNoteDampAlls.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDampAll>::const_iterator
-        iBegin = fNoteDampAlls.begin (),
-        iEnd   = fNoteDampAlls.end (),
+        iBegin = attachments.fNoteDampAlls.begin (),
+        iEnd   = attachments.fNoteDampAlls.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6911,21 +6990,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the scordaturas if any
-  int noteScordaturasSize = fNoteScordaturas.size ();
+  int noteScordaturasSize = attachments.fNoteScordaturas.size ();
 
   if (noteScordaturasSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteScordaturas";
-    if (fNoteScordaturas.size ()) {
+    if (attachments.fNoteScordaturas.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrScordatura>::const_iterator
-        iBegin = fNoteScordaturas.begin (),
-        iEnd   = fNoteScordaturas.end (),
+        iBegin = attachments.fNoteScordaturas.begin (),
+        iEnd   = attachments.fNoteScordaturas.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -7031,7 +7110,7 @@ S_msrChord msrChord::create (
   msrDurationKind chordGraphicDurationKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Creating a chord" <<
       ", chordSoundingWholeNotes = " << chordSoundingWholeNotes <<
@@ -7075,7 +7154,7 @@ S_msrChord msrChord::createChordNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of chord '" <<
       asString () <<
@@ -7119,7 +7198,7 @@ void msrChord::setChordSoundingWholeNotes (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Setting chord sounding whole notes to '" <<
       wholeNotes <<
@@ -7137,7 +7216,7 @@ void msrChord::setChordDisplayWholeNotes (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Setting chord displayed whole notes to '" <<
       wholeNotes <<
@@ -7156,7 +7235,7 @@ void msrChord::addFirstNoteToChord (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Adding first note '" <<
       note->asString () <<
@@ -7201,7 +7280,7 @@ void msrChord::addAnotherNoteToChord (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Adding another note '" <<
       note->asShortString () <<
@@ -7280,7 +7359,7 @@ void msrChord::appendArticulationToChord (S_msrArticulation art)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceArticulations || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceArticulationsFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending articulation '" <<
       art->articulationKindAsString () <<
@@ -7309,7 +7388,7 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSpanners || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceSpannersFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending spanner '" <<
       span->spannerKindAsString () <<
@@ -7326,7 +7405,7 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
 void msrChord::setChordSingleTremolo (S_msrSingleTremolo trem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Adding singleTremolo '" <<
       trem->asString () <<
@@ -7356,7 +7435,7 @@ void msrChord::appendTechnicalToChord (S_msrTechnical tech)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending technical '" <<
       tech->asString () <<
@@ -7387,7 +7466,7 @@ void msrChord::appendTechnicalWithIntegerToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending technical with integer '" <<
       tech->asString () <<
@@ -7418,7 +7497,7 @@ void msrChord::appendTechnicalWithFloatToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending technical with integer '" <<
       tech->asString () <<
@@ -7449,7 +7528,7 @@ void msrChord::appendTechnicalWithStringToChord (
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending technical with string '" <<
       tech->asString () <<
@@ -7478,7 +7557,7 @@ void msrChord::appendOrnamentToChord (S_msrOrnament orn)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending ornament '" <<
       orn->ornamentKindAsString () <<
@@ -7507,7 +7586,7 @@ void msrChord::appendGlissandoToChord (S_msrGlissando gliss)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending glissando '" <<
       gliss->asString () <<
@@ -7536,7 +7615,7 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
   } // for
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending slide '" <<
       slide->asString () <<
@@ -7551,7 +7630,7 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
 void msrChord::appendBeamToChord (S_msrBeam beam)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceBeamsFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending beam '" <<
       beam->asString () <<
@@ -7565,44 +7644,52 @@ void msrChord::appendBeamToChord (S_msrBeam beam)
 
 void msrChord::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChord::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrChord>*
     p =
-      dynamic_cast<visitor<S_msrChord>*> (v)) {
+      v->cast<visitor<S_msrChord> > (msrVisitorKey<S_msrChord> ())) {
         S_msrChord elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChord::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrChord::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrChord::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrChord>*
     p =
-      dynamic_cast<visitor<S_msrChord>*> (v)) {
+      v->cast<visitor<S_msrChord> > (msrVisitorKey<S_msrChord> ())) {
         S_msrChord elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrChord::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -7773,7 +7860,7 @@ void msrChord::applyTupletMemberDisplayFactorToChordMembers (
   int actualNotes, int normalNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Applying tuplet member sounding factor '" <<
       actualNotes << "/" << normalNotes <<
@@ -8331,7 +8418,7 @@ msrTuplet::~msrTuplet ()
 S_msrTuplet msrTuplet::createTupletNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of tuplet '" <<
       asString () <<
@@ -8474,7 +8561,7 @@ void msrTuplet::addNoteToTuplet (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Adding note '" <<
       note->asShortString () <<
@@ -8509,7 +8596,7 @@ void msrTuplet::addNoteToTuplet (
 void msrTuplet::addChordToTuplet (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Adding chord '" <<
       chord->asString () <<
@@ -8543,7 +8630,7 @@ void msrTuplet::addChordToTuplet (S_msrChord chord)
 void msrTuplet::addTupletToTuplet (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Adding tuplet '" <<
       tuplet->asString () <<
@@ -8592,7 +8679,7 @@ void msrTuplet::addTupletToTuplet (S_msrTuplet tuplet)
 void msrTuplet::addTupletToTupletClone (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Adding tuplet '" <<
       tuplet->asString () <<
@@ -8660,7 +8747,7 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
   S_msrNote result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Removing first note from tuplet '" <<
       asString () <<
@@ -8769,7 +8856,7 @@ S_msrNote msrTuplet::removeLastNoteFromTuplet (
   S_msrNote result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Removing last note from tuplet '" <<
       asString () <<
@@ -8823,7 +8910,7 @@ S_msrNote msrTuplet::removeLastNoteFromTuplet (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "This last note from grace notes '" <<
       asString () <<
@@ -8908,7 +8995,7 @@ void msrTuplet::unapplySoundingFactorToTupletMembers (
   */
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "unapplySoundingFactorToTupletMembers ()" <<
       endl;
@@ -8953,44 +9040,52 @@ void msrTuplet::unapplySoundingFactorToTupletMembers (
 
 void msrTuplet::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTuplet::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTuplet>*> (v)) {
+      v->cast<visitor<S_msrTuplet> > (msrVisitorKey<S_msrTuplet> ())) {
         S_msrTuplet elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTuplet::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTuplet::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTuplet::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTuplet>*> (v)) {
+      v->cast<visitor<S_msrTuplet> > (msrVisitorKey<S_msrTuplet> ())) {
         S_msrTuplet elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTuplet::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -9300,7 +9395,7 @@ msrGlissando::~msrGlissando ()
 S_msrGlissando msrGlissando::createGlissandoNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGlissandos) {
+  if (gTraceFlags [kTraceGlissandosFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of glissando '" <<
       asString () <<
@@ -9343,44 +9438,52 @@ string msrGlissando::glissandoTypeKindAsString (
 
 void msrGlissando::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrGlissando::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrGlissando>*
     p =
-      dynamic_cast<visitor<S_msrGlissando>*> (v)) {
+      v->cast<visitor<S_msrGlissando> > (msrVisitorKey<S_msrGlissando> ())) {
         S_msrGlissando elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrGlissando::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrGlissando::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrGlissando::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrGlissando>*
     p =
-      dynamic_cast<visitor<S_msrGlissando>*> (v)) {
+      v->cast<visitor<S_msrGlissando> > (msrVisitorKey<S_msrGlissando> ())) {
         S_msrGlissando elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrGlissando::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -9487,7 +9590,7 @@ msrSlide::~msrSlide ()
 S_msrSlide msrSlide::createSlideNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlides) {
+  if (gTraceFlags [kTraceSlidesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of slide '" <<
       asString () <<
@@ -9530,44 +9633,52 @@ string msrSlide::slideTypeKindAsString (
 
 void msrSlide::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlide::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSlide>*
     p =
-      dynamic_cast<visitor<S_msrSlide>*> (v)) {
+      v->cast<visitor<S_msrSlide> > (msrVisitorKey<S_msrSlide> ())) {
         S_msrSlide elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlide::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSlide::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlide::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSlide>*
     p =
-      dynamic_cast<visitor<S_msrSlide>*> (v)) {
+      v->cast<visitor<S_msrSlide> > (msrVisitorKey<S_msrSlide> ())) {
         S_msrSlide elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlide::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -9685,7 +9796,7 @@ msrSyllable::msrSyllable (
   fSyllableTupletFactor = syllableTupletFactor;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Creating a syllable containing:" <<
       endl;
@@ -9706,7 +9817,7 @@ S_msrSyllable msrSyllable::createSyllableNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of syllable '" <<
       asString () <<
@@ -9753,7 +9864,7 @@ S_msrSyllable msrSyllable::createSyllableDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of syllable '" <<
       asString () <<
@@ -9799,7 +9910,7 @@ S_msrSyllable msrSyllable::createSyllableDeepCopy (
 void msrSyllable::appendLyricTextToSyllable (string text)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending text \"" <<
       text <<
@@ -9837,7 +9948,7 @@ void msrSyllable::appendSyllableToNoteAndSetItsNoteUplink (
 
   // set it uplink to note
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Setting syllable note uplink for:" <<
       endl;
@@ -9857,44 +9968,52 @@ void msrSyllable::appendSyllableToNoteAndSetItsNoteUplink (
 
 void msrSyllable::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSyllable::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSyllable>*
     p =
-      dynamic_cast<visitor<S_msrSyllable>*> (v)) {
+      v->cast<visitor<S_msrSyllable> > (msrVisitorKey<S_msrSyllable> ())) {
         S_msrSyllable elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSyllable::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSyllable::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSyllable::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSyllable>*
     p =
-      dynamic_cast<visitor<S_msrSyllable>*> (v)) {
+      v->cast<visitor<S_msrSyllable> > (msrVisitorKey<S_msrSyllable> ())) {
         S_msrSyllable elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSyllable::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -10323,7 +10442,7 @@ void msrStanza::initializeStanza ()
           fStanzaNumber));
  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Initializing stanza " << getStanzaName () <<
       endl;
@@ -10342,7 +10461,7 @@ S_msrStanza msrStanza::createStanzaNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of stanza \"" <<
       getStanzaName () <<
@@ -10388,7 +10507,7 @@ S_msrStanza msrStanza::createStanzaDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Creating a deep copy of stanza \"" <<
       getStanzaName () <<
@@ -10443,7 +10562,7 @@ void msrStanza::appendSyllableToStanza (
   S_msrSyllable syllable)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending syllable '" << syllable->asString () <<
       "' to stanza " << getStanzaName () <<
@@ -10499,7 +10618,7 @@ S_msrSyllable msrStanza::appendRestSyllableToStanza (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending 'Rest' syllable" <<
       " to stanza " << getStanzaName () <<
@@ -10536,7 +10655,7 @@ S_msrSyllable msrStanza::appendSkipSyllableToStanza (
   rational wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending 'Skip' syllable " <<
       " to stanza " << getStanzaName () <<
@@ -10572,7 +10691,7 @@ S_msrSyllable msrStanza::appendMeasureEndSyllableToStanza (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending 'Measure end' syllable " <<
       " to stanza " << getStanzaName () <<
@@ -10613,7 +10732,7 @@ S_msrSyllable msrStanza::appendMelismaSyllableToStanza (
   rational        wholeNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending '" <<
       msrSyllable::syllableKindAsString (syllableKind) <<
@@ -10651,7 +10770,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending 'line break' syllable" <<
       " to stanza " << getStanzaName () <<
@@ -10687,7 +10806,7 @@ S_msrSyllable msrStanza::appendLineBreakSyllableToStanza (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending a 'LineBreak' syllable" <<
       " to stanza " << getStanzaName () <<
@@ -10724,7 +10843,7 @@ S_msrSyllable msrStanza::appendPageBreakSyllableToStanza (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending a 'PageBreak' syllable" <<
       " to stanza " << getStanzaName () <<
@@ -10769,7 +10888,7 @@ void msrStanza::appendPaddingNoteToStanza (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceLyricsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Apending padding note of " << divisions <<
       " divisions in stanza \"" <<
@@ -10790,55 +10909,65 @@ void msrStanza::appendPaddingNoteToStanza (
 
 void msrStanza::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStanza::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrStanza>*
     p =
-      dynamic_cast<visitor<S_msrStanza>*> (v)) {
+      v->cast<visitor<S_msrStanza> > (msrVisitorKey<S_msrStanza> ())) {
         S_msrStanza elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStanza::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStanza::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStanza::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStanza>*
     p =
-      dynamic_cast<visitor<S_msrStanza>*> (v)) {
+      v->cast<visitor<S_msrStanza> > (msrVisitorKey<S_msrStanza> ())) {
         S_msrStanza elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStanza::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrStanza::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStanza::browseData ()" <<
       endl;
   }
+#endif
 
   gIndenter++;
   
@@ -10852,11 +10981,13 @@ void msrStanza::browseData (basevisitor* v)
 
   gIndenter--;
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrStanza::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void msrStanza::print (ostream& os)
@@ -10931,7 +11062,7 @@ msrHarmonyDegree::msrHarmonyDegree (
   fHarmonyDegreeTypeKind       = harmonyDegreeTypeKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating harmony degree '" <<
       asString () <<
@@ -11017,44 +11148,52 @@ int msrHarmonyDegree::harmonyDegreeAsSemitones () const
 
 void msrHarmonyDegree::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarmonyDegree::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrHarmonyDegree>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
+      v->cast<visitor<S_msrHarmonyDegree> > (msrVisitorKey<S_msrHarmonyDegree> ())) {
         S_msrHarmonyDegree elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarmonyDegree::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrHarmonyDegree::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarmonyDegree::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrHarmonyDegree>*
     p =
-      dynamic_cast<visitor<S_msrHarmonyDegree>*> (v)) {
+      v->cast<visitor<S_msrHarmonyDegree> > (msrVisitorKey<S_msrHarmonyDegree> ())) {
         S_msrHarmonyDegree elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarmonyDegree::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -11218,7 +11357,7 @@ msrHarmony::msrHarmony (
     harmonySoundingWholeNotes;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating harmony '" <<
       asString () <<
@@ -11295,7 +11434,7 @@ S_msrHarmony msrHarmony::createHarmonyNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of harmony '" <<
       msrHarmonyKindAsShortString (fHarmonyKind) <<
@@ -11328,7 +11467,7 @@ S_msrHarmony msrHarmony::createHarmonyDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating a deep copy of harmony '" <<
       msrHarmonyKindAsShortString (fHarmonyKind) <<
@@ -11412,44 +11551,52 @@ string msrHarmony::asString () const
 
 void msrHarmony::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarmony::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrHarmony>*
     p =
-      dynamic_cast<visitor<S_msrHarmony>*> (v)) {
+      v->cast<visitor<S_msrHarmony> > (msrVisitorKey<S_msrHarmony> ())) {
         S_msrHarmony elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarmony::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrHarmony::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrHarmony::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrHarmony>*
     p =
-      dynamic_cast<visitor<S_msrHarmony>*> (v)) {
+      v->cast<visitor<S_msrHarmony> > (msrVisitorKey<S_msrHarmony> ())) {
         S_msrHarmony elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrHarmony::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -11592,7 +11739,7 @@ msrFigure::msrFigure (
   fFigureSuffixKind = figureSuffixKind;
  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating figure '" <<
       asString () <<
@@ -11609,7 +11756,7 @@ S_msrFigure msrFigure::createFigureNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of figure '" <<
       asString () <<
@@ -11639,7 +11786,7 @@ S_msrFigure msrFigure::createFigureDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating a deep copy of figure '" <<
       asString () <<
@@ -11767,44 +11914,52 @@ string msrFigure::asString () const
 
 void msrFigure::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFigure::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrFigure>*
     p =
-      dynamic_cast<visitor<S_msrFigure>*> (v)) {
+      v->cast<visitor<S_msrFigure> > (msrVisitorKey<S_msrFigure> ())) {
         S_msrFigure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFigure::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrFigure::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFigure::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrFigure>*
     p =
-      dynamic_cast<visitor<S_msrFigure>*> (v)) {
+      v->cast<visitor<S_msrFigure> > (msrVisitorKey<S_msrFigure> ())) {
         S_msrFigure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFigure::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -11891,7 +12046,7 @@ msrFiguredBass::msrFiguredBass (
     figuredBassParenthesesKind;
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating figuredBass '" <<
       asString () <<
@@ -11908,7 +12063,7 @@ S_msrFiguredBass msrFiguredBass::createFiguredBassNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of figuredBass '" <<
       asString () <<
@@ -11937,7 +12092,7 @@ S_msrFiguredBass msrFiguredBass::createFiguredBassDeepCopy (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Creating a deep copy of figuredBass '" <<
       asString () <<
@@ -11966,7 +12121,7 @@ void msrFiguredBass::appendFiguredFigureToFiguredBass (
   S_msrFigure figure)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass) {
+  if (gTraceFlags [kTraceFiguredBassFlag]) {
     gLogIOstream <<
       "Appending figure'" << figure->asString () <<
       "' to figuredBass '" <<
@@ -12042,44 +12197,52 @@ string msrFiguredBass::asString () const
 
 void msrFiguredBass::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFiguredBass::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrFiguredBass>*
     p =
-      dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
+      v->cast<visitor<S_msrFiguredBass> > (msrVisitorKey<S_msrFiguredBass> ())) {
         S_msrFiguredBass elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFiguredBass::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrFiguredBass::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFiguredBass::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrFiguredBass>*
     p =
-      dynamic_cast<visitor<S_msrFiguredBass>*> (v)) {
+      v->cast<visitor<S_msrFiguredBass> > (msrVisitorKey<S_msrFiguredBass> ())) {
         S_msrFiguredBass elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFiguredBass::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -12178,7 +12341,7 @@ msrMeasure::msrMeasure (
 void msrMeasure::initializeMeasure ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Initializing measure '" << fMeasureNumber <<
       "' in segment '" <<
@@ -12193,7 +12356,7 @@ void msrMeasure::initializeMeasure ()
   }
 #endif
 
-  static int counter = 0;
+  static thread_local int counter = 0;
   
   counter++;
       
@@ -12217,7 +12380,7 @@ void msrMeasure::initializeMeasure ()
       endl <<
       endl;
 
-    abort ();
+    throw msrException (msrException::kAbort);
   }
   
   // measure kind
@@ -12282,7 +12445,7 @@ S_msrMeasure msrMeasure::createMeasureNewbornClone (
   S_msrSegment containingSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of measure '" <<
       fMeasureNumber <<
@@ -12352,7 +12515,7 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
   S_msrSegment containingSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a deep copy of measure '" <<
       fMeasureNumber <<
@@ -12411,7 +12574,7 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
 
   if (numberOfMeasureElements) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
         singularOrPluralWithoutNumber (
           numberOfMeasureElements, "There is", "There are") <<
@@ -12462,7 +12625,7 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
         S_msrTime time = dynamic_cast<msrTime*>(&(*element))
         ) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
             "Sharing time '" <<
             time->asShortString () <<
@@ -12492,7 +12655,7 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
         "There are no elements in measure to be deep copied" <<
         " in segment " <<
@@ -12519,7 +12682,7 @@ void msrMeasure::setMeasureCreatedForARepeatKind (
     measureCreatedForARepeatKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting measureCreatedForARepeatKind in measure '" <<
       fMeasureNumber <<
@@ -12545,7 +12708,7 @@ void msrMeasure::setMeasureCreatedForARepeatKind (
 void msrMeasure::setNextMeasureNumber (string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting next measure number to '" << nextMeasureNumber <<
       "' in measure '" <<
@@ -12582,7 +12745,7 @@ void msrMeasure::setMeasureLength (
   rationalisedMeasureLength.rationalise ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceDivisionsFlag]) {
     gLogIOstream <<
       "Setting measure '" << fMeasureNumber <<
       "' measure length to '"  << rationalisedMeasureLength << "'";
@@ -12621,7 +12784,7 @@ string msrMeasure::measureLengthAsMSRString ()
 void msrMeasure::appendClefToMeasure (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending clef '" << clef->asString () <<
       "' to measure " << fMeasureNumber <<
@@ -12639,7 +12802,7 @@ void msrMeasure::appendClefToMeasure (S_msrClef clef)
 void msrMeasure::appendKeyToMeasure (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending key '" << key->asString () <<
       "' to measure " << fMeasureNumber <<
@@ -12662,7 +12825,7 @@ void msrMeasure::appendTimeToMeasure (S_msrTime time)
     "time is null");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending time '" <<
       endl;
@@ -12705,7 +12868,7 @@ void msrMeasure::appendTimeToMeasureClone (S_msrTime time)
     "time is null");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending time:" <<
       endl;
@@ -12742,11 +12905,11 @@ void msrMeasure::setMeasureFullLengthFromTime (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceDivisions
+    gTraceFlags [kTraceDivisionsFlag]
       ||
-    gTraceOptions->fTraceTimes
+    gTraceFlags [kTraceTimesFlag]
       ||
-    gTraceOptions->fTraceMeasures) {
+    gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting measure full measure length from time:" <<
       endl;
@@ -12787,11 +12950,11 @@ void msrMeasure::setMeasureFullLengthFromTime (
             
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceDivisions
+          gTraceFlags [kTraceDivisionsFlag]
             ||
-          gTraceOptions->fTraceTimes
+          gTraceFlags [kTraceTimesFlag]
             ||
-          gTraceOptions->fTraceMeasures) {
+          gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
             "There are " <<
             wholeNotesPerMeasure <<
@@ -12823,11 +12986,11 @@ void msrMeasure::setMeasureFullLengthFromTime (
     
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceDivisions
+          gTraceFlags [kTraceDivisionsFlag]
             ||
-          gTraceOptions->fTraceTimes
+          gTraceFlags [kTraceTimesFlag]
             ||
-          gTraceOptions->fTraceMeasures) {
+          gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
             "Measure '" << fMeasureNumber <<
             "' in voice \"" <<
@@ -12850,11 +13013,11 @@ void msrMeasure::setMeasureFullLengthFromTime (
       
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceDivisions
+        gTraceFlags [kTraceDivisionsFlag]
           ||
-        gTraceOptions->fTraceTimes
+        gTraceFlags [kTraceTimesFlag]
           ||
-        gTraceOptions->fTraceMeasures) {
+        gTraceFlags [kTraceMeasuresFlag]) {
         gLogIOstream <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" <<
@@ -12970,7 +13133,7 @@ void msrMeasure::appendNoteToMeasure (S_msrNote note)
     note->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending note '" << note->asShortString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13065,7 +13228,7 @@ void msrMeasure::appendNoteToMeasureClone (S_msrNote note)
     note->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending note '" << note->asShortString () <<
       "' to measure clone '" << fMeasureNumber <<
@@ -13150,7 +13313,7 @@ void msrMeasure::appendDoubleTremoloToMeasure (
     doubleTremolo->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending double tremolo '" <<
       doubleTremolo->asShortString () <<
@@ -13220,7 +13383,7 @@ void msrMeasure::appendMeasuresRepeatToMeasure (
   S_msrMeasuresRepeat measuresRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending multiple rest '" <<
       measuresRepeat->asString () <<
@@ -13255,7 +13418,7 @@ void msrMeasure::appendMultipleRestToMeasure (
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
@@ -13325,7 +13488,7 @@ void msrMeasure::appendChordToMeasure (S_msrChord chord) // JMI XXL
   chord->setChordMeasureUplink (this);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending chord '" << chord->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13386,7 +13549,7 @@ void msrMeasure::appendTupletToMeasure (S_msrTuplet tuplet)
     tuplet->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending tuplet '" << tuplet->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13436,7 +13599,7 @@ void msrMeasure::appendHarmonyToMeasure (S_msrHarmony harmony)
     harmony->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending harmony '" << harmony->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13482,7 +13645,7 @@ void msrMeasure::appendHarmonyToMeasureClone (S_msrHarmony harmony)
   // regular insertion in current measure
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending harmony '" << harmony->asString () <<
       "' to measure clone '" << fMeasureNumber <<
@@ -13527,7 +13690,7 @@ void msrMeasure::appendFiguredBassToMeasure (
     figuredBass->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13574,7 +13737,7 @@ void msrMeasure::appendFiguredBassToMeasureClone (
   // regular insertion in current measure
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to measure clone '" << fMeasureNumber <<
@@ -13618,7 +13781,7 @@ S_msrNote msrMeasure::createPaddingNoteForVoice (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating a padding note for voice \"" <<
       voice->getVoiceName () <<
@@ -13675,7 +13838,7 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Padding from measure length '" << fMeasureLength <<
       "' to '" << measureLength <<
@@ -13716,7 +13879,7 @@ void msrMeasure::padUpToMeasureLengthInMeasure (
         fMeasureLength);
            
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceDivisions) {
+    if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceDivisionsFlag]) {
       gLogIOstream <<
        "Appending rest" << paddingNote->asString () <<
        " (missingDuration " << missingDuration <<
@@ -13751,7 +13914,7 @@ void msrMeasure::appendPaddingNoteToMeasure (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending padding note of " << divisions <<
       " divisions to measure " <<
@@ -13852,7 +14015,7 @@ void msrMeasure::appendStaffDetailsToMeasure (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceMeasures) { 
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceMeasuresFlag]) { 
     gLogIOstream <<
       "Appending staff details '" << staffDetails->asShortString () <<
       "' to measure '" << fMeasureNumber <<
@@ -13895,7 +14058,7 @@ void msrMeasure::removeNoteFromMeasure (
   S_msrNote note)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Removing note '" <<
       note->asShortString () <<
@@ -13988,7 +14151,7 @@ void msrMeasure::removeElementFromMeasure (
   S_msrElement element)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Removing element:" <<
       endl;
@@ -14068,7 +14231,7 @@ void msrMeasure::determineMeasureKind (
         getSegmentVoiceUplink ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
     "Determining the measure kind of measure '" <<
     fMeasureNumber <<
@@ -14084,7 +14247,7 @@ void msrMeasure::determineMeasureKind (
   if (fMeasureLength.getNumerator () == 0) { // JMI
     // empty measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
@@ -14101,7 +14264,7 @@ void msrMeasure::determineMeasureKind (
   else if (fMeasureLength == fMeasureFullLength) {
     // full measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
@@ -14120,7 +14283,7 @@ void msrMeasure::determineMeasureKind (
     switch (fMeasureFirstInSegmentKind) {
       case msrMeasure::kMeasureFirstInSegmentUnknown:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
+        if (gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
@@ -14136,7 +14299,7 @@ void msrMeasure::determineMeasureKind (
         
       case msrMeasure::kMeasureFirstInSegmentYes:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
+        if (gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
@@ -14152,7 +14315,7 @@ void msrMeasure::determineMeasureKind (
         
       case msrMeasure::kMeasureFirstInSegmentNo:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures) {
+        if (gTraceFlags [kTraceMeasuresFlag]) {
           gLogIOstream <<
           "Measure '" << fMeasureNumber <<
           "' in voice \"" << voice->getVoiceName () <<
@@ -14171,7 +14334,7 @@ void msrMeasure::determineMeasureKind (
   else if (fMeasureLength > fMeasureFullLength) {
     // overfull measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
@@ -14187,7 +14350,7 @@ void msrMeasure::determineMeasureKind (
   else {
     // strange measure...
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
       "Measure '" << fMeasureNumber <<
       "' in voice \"" << voice->getVoiceName () <<
@@ -14243,7 +14406,7 @@ void msrMeasure::padUpToPartMeasureLengthHighTide (
       setNotePositionInMeasure (fMeasureLength);
            
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
        "Appending '" << paddingNote->asString () <<
        " (" << missingDuration << " whole notes)'" <<
@@ -14278,13 +14441,13 @@ void msrMeasure::finalizeMeasure (
         getSegmentVoiceUplink ();
     
   // fetch the part measure length high tide
+#ifdef TRACE_OPTIONS
   rational
     partMeasureLengthHighTide =
       fetchMeasurePartUplink ()->
         getPartMeasureLengthHighTide ();
     
-#ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Finalizing measure '" <<
       fMeasureNumber <<
@@ -14360,7 +14523,7 @@ void msrMeasure::finalizeMeasure (
       fMeasureFullLength
     ) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceFlags [kTraceMeasuresFlag]) {
         gLogIOstream <<
           "Note '" <<
           fMeasureLongestNote->asShortString () <<
@@ -14410,55 +14573,65 @@ void msrMeasure::finalizeMeasure (
 
 void msrMeasure::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasure::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMeasure>*
     p =
-      dynamic_cast<visitor<S_msrMeasure>*> (v)) {
+      v->cast<visitor<S_msrMeasure> > (msrVisitorKey<S_msrMeasure> ())) {
         S_msrMeasure elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasure::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMeasure::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasure::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMeasure>*
     p =
-      dynamic_cast<visitor<S_msrMeasure>*> (v)) {
+      v->cast<visitor<S_msrMeasure> > (msrVisitorKey<S_msrMeasure> ())) {
         S_msrMeasure elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasure::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMeasure::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasure::browseData ()" <<
       endl;
   }
+#endif
 
   for (
     list<S_msrElement>::const_iterator i = fMeasureElementsList.begin ();
@@ -14469,11 +14642,13 @@ void msrMeasure::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrMeasure::browseData ()" <<
       endl;
   }
+#endif
 }
 
 string msrMeasure::measureKindAsString (
@@ -14742,7 +14917,7 @@ ostream& operator<< (ostream& os, const S_msrMeasure& elt)
 }
 
 //______________________________________________________________________________
-int msrSegment::gSegmentsCounter = 0;
+thread_local int msrSegment::gSegmentsCounter = 0;
 
 S_msrSegment msrSegment::create (
   int        inputLineNumber,
@@ -14783,7 +14958,7 @@ void msrSegment::initializeSegment ()
   fSegmentAbsoluteNumber = ++gSegmentsCounter;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "% ==> Initializing new segment, gets absolute number '" <<
       fSegmentAbsoluteNumber <<
@@ -14823,7 +14998,7 @@ S_msrSegment msrSegment::createSegmentNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of segment " <<
       asString () <<
@@ -14863,7 +15038,7 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Creating a deep copy of segment " <<
       asString () <<
@@ -14898,7 +15073,7 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
 
   if (numberOfSegmentMeasures) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "There are " <<
         numberOfSegmentMeasures <<
@@ -14922,7 +15097,7 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSegments) {
+    if (gTraceFlags [kTraceSegmentsFlag]) {
       gLogIOstream <<
         "There are no measures in segment to be deep copied" <<
         endl;
@@ -14945,7 +15120,7 @@ void msrSegment::createMeasureAndAppendItToSegment (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Creating and appending a measure '" << measureNumber <<
       "', to segment '" << asString () <<
@@ -14978,7 +15153,7 @@ void msrSegment::createMeasureAndAppendItToSegment (
       
   // create a measure
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Creating measure '" << measureNumber <<
       "' in segment " << asString () <<
@@ -15019,7 +15194,7 @@ void msrSegment::setNextMeasureNumberInSegment (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Setting next measure number to '" << nextMeasureNumber <<
       "' in segment '" << asString () <<
@@ -15035,7 +15210,7 @@ void msrSegment::setNextMeasureNumberInSegment (
   
   if (fSegmentMeasuresList.size ()) { // JMI ???
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+    if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
       gLogIOstream <<
         "Setting next measure number to '" << nextMeasureNumber <<
         "' in segment '" << asString () <<
@@ -15065,7 +15240,7 @@ void msrSegment::finalizeCurrentMeasureInSegment (
         getPartCurrentMeasureNumber ();
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Finalizing current measure '" <<
       currentMeasureNumber <<
@@ -15102,11 +15277,11 @@ void msrSegment::finalizeCurrentMeasureInSegment (
           // yes, remove it
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceFlags [kTraceMeasuresFlag]
               ||
-            gTraceOptions->fTraceSegments
+            gTraceFlags [kTraceSegmentsFlag]
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceFlags [kTraceRepeatsFlag]) {
             stringstream s;
         
             gLogIOstream <<
@@ -15134,11 +15309,11 @@ void msrSegment::finalizeCurrentMeasureInSegment (
           // yes, remove it
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceFlags [kTraceMeasuresFlag]
               ||
-            gTraceOptions->fTraceSegments
+            gTraceFlags [kTraceSegmentsFlag]
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceFlags [kTraceRepeatsFlag]) {
             stringstream s;
         
             gLogIOstream <<
@@ -15180,9 +15355,9 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceMeasuresDetails
+      gTraceFlags [kTraceMeasuresDetailsFlag]
         ||
-      gTraceOptions->fTraceSegmentsDetails) {
+      gTraceFlags [kTraceSegmentsDetailsFlag]) {
       gLogIOstream <<
         endl <<
         "*********>> Current voice \"" <<
@@ -15203,9 +15378,9 @@ void msrSegment::finalizeCurrentMeasureInSegment (
     /* JMI
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceMeasuresDetails
+      gTraceFlags [kTraceMeasuresDetailsFlag]
         ||
-      gTraceOptions->fTraceSegmentsDetails) {
+      gTraceFlags [kTraceSegmentsDetailsFlag]) {
       gLogIOstream <<
         endl <<
         "*********>> HOUHOU Current voice \"" <<
@@ -15224,7 +15399,7 @@ void msrSegment::finalizeCurrentMeasureInSegment (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Segment '" <<
       fSegmentAbsoluteNumber <<
@@ -15239,7 +15414,7 @@ void msrSegment::finalizeCurrentMeasureInSegment (
 void msrSegment::appendClefToSegment (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending clef '" << clef->asString () <<
       "' to segment " << asString () <<
@@ -15290,7 +15465,7 @@ void msrSegment::appendClefToSegment (S_msrClef clef)
 void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Prepending clef '" << clef->asString () <<
       "' to segment " << asString () <<
@@ -15341,7 +15516,7 @@ void msrSegment::prependClefToSegment (S_msrClef clef) // JMI
 void msrSegment::appendKeyToSegment (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending key '" << key->asString () <<
       "' to segment " << asString () <<
@@ -15369,7 +15544,7 @@ void msrSegment::appendKeyToSegment (S_msrKey key)
 void msrSegment::appendTimeToSegment (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending time:" <<
       endl;
@@ -15407,7 +15582,7 @@ void msrSegment::appendTimeToSegment (S_msrTime time)
 void msrSegment::appendTimeToSegmentClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending time:" <<
       endl;
@@ -15445,7 +15620,7 @@ void msrSegment::appendTimeToSegmentClone (S_msrTime time)
 void msrSegment::appendHarmonyToSegment (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending harmony " << harmony->asString () <<
       " to segment " << asString () <<
@@ -15473,7 +15648,7 @@ void msrSegment::appendHarmonyToSegment (S_msrHarmony harmony)
 void msrSegment::appendHarmonyToSegmentClone (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending harmony " << harmony->asString () <<
       " to segment clone " << asString () <<
@@ -15502,7 +15677,7 @@ void msrSegment::appendFiguredBassToSegment (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceFiguredBassFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending figured bass " << figuredBass->asString () <<
       " to segment " << asString () <<
@@ -15531,7 +15706,7 @@ void msrSegment::appendFiguredBassToSegmentClone (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceFiguredBassFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending figured bass " << figuredBass->asString () <<
       " to segment clone " << asString () <<
@@ -15559,7 +15734,7 @@ void msrSegment::appendFiguredBassToSegmentClone (
 void msrSegment::appendSegnoToSegment (S_msrSegno segno)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending segno " <<
       " to segment " << asString () <<
@@ -15587,7 +15762,7 @@ void msrSegment::appendSegnoToSegment (S_msrSegno segno)
 void msrSegment::appendCodaToSegment (S_msrCoda coda)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending coda " <<
       " to segment " << asString () <<
@@ -15616,7 +15791,7 @@ void msrSegment::appendEyeGlassesToSegment (
   S_msrEyeGlasses eyeGlasses)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending eyeGlasses " <<
       " to segment " << asString () <<
@@ -15644,7 +15819,7 @@ void msrSegment::appendEyeGlassesToSegment (
 void msrSegment::appendPedalToSegment (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending pedal " <<
       " to segment " << asString () <<
@@ -15672,7 +15847,7 @@ void msrSegment::appendPedalToSegment (S_msrPedal pedal)
 void msrSegment::appendDampToSegment (S_msrDamp damp)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending damp " <<
       " to segment " << asString () <<
@@ -15700,7 +15875,7 @@ void msrSegment::appendDampToSegment (S_msrDamp damp)
 void msrSegment::appendDampAllToSegment (S_msrDampAll dampAll)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending damp all " <<
       " to segment " << asString () <<
@@ -15729,7 +15904,7 @@ void msrSegment::appendTransposeToSegment (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending transpose " <<
       " to segment " << asString () <<
@@ -15758,7 +15933,7 @@ void msrSegment::appendPartNameDisplayToSegment (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending part name display " <<
       " to segment " << asString () <<
@@ -15787,7 +15962,7 @@ void msrSegment::appendPartAbbreviationDisplayToSegment (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending part abbreviation display " <<
       
@@ -15818,7 +15993,7 @@ void msrSegment::appendStaffDetailsToSegment (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending staff details " <<
       " to segment " << asString () <<
@@ -15863,7 +16038,7 @@ void msrSegment::appendStaffDetailsToSegment (
 void msrSegment::appendLineBreakToSegment (S_msrLineBreak lineBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending break " <<
       " to segment " << asString () <<
@@ -15891,7 +16066,7 @@ void msrSegment::appendLineBreakToSegment (S_msrLineBreak lineBreak)
 void msrSegment::appendPageBreakToSegment (S_msrPageBreak pageBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending break " <<
       " to segment " << asString () <<
@@ -15920,7 +16095,7 @@ void msrSegment::appendBarNumberCheckToSegment (
   S_msrBarNumberCheck barNumberCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending bar number check " <<
       " to segment " << asString () <<
@@ -15949,7 +16124,7 @@ void msrSegment::appendTempoToSegment (
   S_msrTempo tempo)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending tempo " <<
       " to segment " << asString () <<
@@ -15978,7 +16153,7 @@ void msrSegment::appendRehearsalToSegment (
   S_msrRehearsal rehearsal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending rehearsal " <<
       " to segment " << asString () <<
@@ -16007,7 +16182,7 @@ void msrSegment::appendOctaveShiftToSegment (
   S_msrOctaveShift octaveShift)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending octave shift '" <<
       octaveShift->octaveShiftKindAsString () <<
@@ -16037,7 +16212,7 @@ void msrSegment::appendScordaturaToSegment (
   S_msrScordatura scordatura)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending scordatura '" <<
   // JMI ???    scordatura->octaveShiftKindAsString () <<
@@ -16068,7 +16243,7 @@ void msrSegment::appendAccordionRegistrationToSegment (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
@@ -16100,7 +16275,7 @@ void msrSegment::appendHarpPedalsTuningToSegment (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending staff pedals tuning '" <<
       harpPedalsTuning->asString () <<
@@ -16132,7 +16307,7 @@ void msrSegment::padUpToMeasureLengthInSegment (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Padding up to measure length '" << measureLength <<
       "' in segment '" <<
@@ -16194,7 +16369,7 @@ void msrSegment::appendPaddingNoteToSegment (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appendding padding tote of " << divisions <<
       " divisions to segment '" <<
@@ -16234,7 +16409,7 @@ void msrSegment::appendMeasureToSegment (S_msrMeasure measure)
       : fSegmentMeasuresList.back ()->getMeasureNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending measure '" << measureNumber <<
       "' to segment " << asString ();
@@ -16289,7 +16464,7 @@ void msrSegment::prependMeasureToSegment (S_msrMeasure measure)
       : fSegmentMeasuresList.back ()->getMeasureNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Prepending measure " << measureNumber <<
       " to segment " << asString ();
@@ -16342,7 +16517,7 @@ void msrSegment::appendMeasureToSegmentIfNotYetDone ( // JMI
   if (! fSegmentMeasuresList.size ()) {
     // create a new measure
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+    if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
       gLogIOstream <<
         "Appending a new measure '" << measureNumber <<
         "' to segment '" << asString () << "'" <<
@@ -16372,7 +16547,7 @@ void msrSegment::appendMeasureToSegmentIfNotYetDone ( // JMI
 void msrSegment::prependBarlineToSegment (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Prepending barline '" << barline->asString () <<
       "' to segment '" << asString () << "'" <<
@@ -16400,7 +16575,7 @@ void msrSegment::prependBarlineToSegment (S_msrBarline barline)
 void msrSegment::appendBarlineToSegment (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending barline '" << barline->asString () <<
       "' to segment '" << asString () << "'" <<
@@ -16414,9 +16589,9 @@ void msrSegment::appendBarlineToSegment (S_msrBarline barline)
   if (! fSegmentMeasuresList.size ()) { // JMI
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceBarlinesDetails
+      gTraceFlags [kTraceBarlinesDetailsFlag]
         ||
-      gTraceOptions->fTraceSegmentsDetails) { // JMI
+      gTraceFlags [kTraceSegmentsDetailsFlag]) { // JMI
       gLogIOstream <<
         endl <<
         "*********>> Current voice \"" <<
@@ -16450,7 +16625,7 @@ void msrSegment::appendBarlineToSegment (S_msrBarline barline)
 void msrSegment::appendBarCheckToSegment (S_msrBarCheck barCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending bar check " << barCheck->asString () <<
       " to segment '" << asString () << "'" <<
@@ -16475,11 +16650,11 @@ void msrSegment::appendVoiceStaffChangeToSegment (
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceStaves
+    gTraceFlags [kTraceStavesFlag]
       ||
-    gTraceOptions->fTraceSegments) {
+    gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending voice staff change '" <<
       voiceStaffChange->asString () <<
@@ -16553,7 +16728,7 @@ void msrSegment::appendDoubleTremoloToSegment ( // JMI
   S_msrDoubleTremolo doubleTremolo)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending double tremolo " <<
       doubleTremolo->asShortString () <<
@@ -16578,7 +16753,7 @@ void msrSegment::appendMeasuresRepeatToSegment (
   S_msrMeasuresRepeat measuresRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending measure repeat '" <<
       measuresRepeat->asString () <<
@@ -16603,7 +16778,7 @@ void msrSegment::appendMultipleRestToSegment (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
@@ -16757,7 +16932,7 @@ void msrSegment::removeNoteFromSegment (
   S_msrNote note)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Removing note '" <<
       note->asString () <<
@@ -16803,7 +16978,7 @@ void msrSegment::removeElementFromSegment (
   S_msrElement element)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Removing element '" <<
       element->asString () <<
@@ -16844,7 +17019,7 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Removing last measure from segment '" <<
       fSegmentAbsoluteNumber <<
@@ -16876,7 +17051,7 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
       fSegmentMeasuresList.back ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       endl <<
       "This measure contains:" <<
@@ -16916,7 +17091,7 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
       ", line " << inputLineNumber <<
       endl;
 
-    abort ();
+    throw msrException (msrException::kAbort);
   }
 
   fSegmentMeasuresList.pop_back ();
@@ -16926,55 +17101,65 @@ S_msrMeasure msrSegment::removeLastMeasureFromSegment (
 
 void msrSegment::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSegment::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSegment>*
     p =
-      dynamic_cast<visitor<S_msrSegment>*> (v)) {
+      v->cast<visitor<S_msrSegment> > (msrVisitorKey<S_msrSegment> ())) {
         S_msrSegment elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSegment::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSegment::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSegment::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSegment>*
     p =
-      dynamic_cast<visitor<S_msrSegment>*> (v)) {
+      v->cast<visitor<S_msrSegment> > (msrVisitorKey<S_msrSegment> ())) {
         S_msrSegment elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSegment::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrSegment::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSegment::browseData ()" <<
       endl;
   }
+#endif
 
 /* JMI
   gLogIOstream <<
@@ -16992,11 +17177,13 @@ void msrSegment::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrSegment::browseData ()" <<
       endl;
   }
+#endif
 }
 
 string msrSegment::asString () const
@@ -17131,7 +17318,7 @@ void msrRepeatCommonPart::appendElementToRepeatCommonPart (
   S_msrElement elem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending element '" << elem <<
       "' to repeat common part '" << asString () << "'" <<
@@ -17230,44 +17417,52 @@ S_msrNote msrRepeatCommonPart::fetchRepeatCommonPartFirstNonGraceNote () const
 
 void msrRepeatCommonPart::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatCommonPart::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrRepeatCommonPart>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
+      v->cast<visitor<S_msrRepeatCommonPart> > (msrVisitorKey<S_msrRepeatCommonPart> ())) {
         S_msrRepeatCommonPart elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatCommonPart::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrRepeatCommonPart::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatCommonPart::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrRepeatCommonPart>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCommonPart>*> (v)) {
+      v->cast<visitor<S_msrRepeatCommonPart> > (msrVisitorKey<S_msrRepeatCommonPart> ())) {
         S_msrRepeatCommonPart elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatCommonPart::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -17416,44 +17611,52 @@ void msrRepeatEnding::appendElementToRepeatEnding (
 
 void msrRepeatEnding::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatEnding::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrRepeatEnding>*
     p =
-      dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
+      v->cast<visitor<S_msrRepeatEnding> > (msrVisitorKey<S_msrRepeatEnding> ())) {
         S_msrRepeatEnding elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatEnding::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrRepeatEnding::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatEnding::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrRepeatEnding>*
     p =
-      dynamic_cast<visitor<S_msrRepeatEnding>*> (v)) {
+      v->cast<visitor<S_msrRepeatEnding> > (msrVisitorKey<S_msrRepeatEnding> ())) {
         S_msrRepeatEnding elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatEnding::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -17596,7 +17799,7 @@ void msrRepeat::setRepeatCommonPart (
     "repeatCommonPart is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting repeat common part containing " <<
       singularOrPlural (
@@ -17615,7 +17818,7 @@ void msrRepeat::setRepeatCommonSegment (
   S_msrSegment repeatCommonSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting repeat common segment containing " <<
       singularOrPlural (
@@ -17645,7 +17848,7 @@ void msrRepeat::addRepeatEnding (
     "repeatEnding is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Adding ending '" <<
       repeatEnding->asString () <<
@@ -17676,44 +17879,52 @@ S_msrNote msrRepeat::fetchRepeatFirstNonGraceNote () const
 
 void msrRepeat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeat::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrRepeat>*
     p =
-      dynamic_cast<visitor<S_msrRepeat>*> (v)) {
+      v->cast<visitor<S_msrRepeat> > (msrVisitorKey<S_msrRepeat> ())) {
         S_msrRepeat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeat::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrRepeat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeat::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrRepeat>*
     p =
-      dynamic_cast<visitor<S_msrRepeat>*> (v)) {
+      v->cast<visitor<S_msrRepeat> > (msrVisitorKey<S_msrRepeat> ())) {
         S_msrRepeat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeat::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -17856,7 +18067,7 @@ void msrMeasuresRepeatPattern::setMeasuresRepeatPatternSegment (
     S_msrSegment measuresRepeatPatternSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting measure repeat pattern segment containing " <<
       singularOrPlural (
@@ -17894,55 +18105,65 @@ int msrMeasuresRepeatPattern::measuresRepeatPatternMeasuresNumber () const
 
 void msrMeasuresRepeatPattern::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatPattern::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMeasuresRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeatPattern>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeatPattern> > (msrVisitorKey<S_msrMeasuresRepeatPattern> ())) {
         S_msrMeasuresRepeatPattern elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeatPattern::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMeasuresRepeatPattern::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatPattern::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMeasuresRepeatPattern>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeatPattern>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeatPattern> > (msrVisitorKey<S_msrMeasuresRepeatPattern> ())) {
         S_msrMeasuresRepeatPattern elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeatPattern::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMeasuresRepeatPattern::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatPattern::browseData ()" <<
       endl;
   }
+#endif
 
   if (fMeasuresRepeatPatternSegment) {
     // browse the pattern segment
@@ -18042,7 +18263,7 @@ void msrMeasuresRepeatReplicas::setMeasuresRepeatReplicasSegment (
     S_msrSegment measuresRepeatReplicasSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting measure repeat replicas segment containing " <<
       singularOrPlural (
@@ -18080,55 +18301,65 @@ int msrMeasuresRepeatReplicas::measuresRepeatReplicasMeasuresNumber () const
 
 void msrMeasuresRepeatReplicas::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatReplicas::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMeasuresRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeatReplicas>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeatReplicas> > (msrVisitorKey<S_msrMeasuresRepeatReplicas> ())) {
         S_msrMeasuresRepeatReplicas elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeatReplicas::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMeasuresRepeatReplicas::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatReplicas::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMeasuresRepeatReplicas>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeatReplicas>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeatReplicas> > (msrVisitorKey<S_msrMeasuresRepeatReplicas> ())) {
         S_msrMeasuresRepeatReplicas elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeatReplicas::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMeasuresRepeatReplicas::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeatReplicas::browseData ()" <<
       endl;
   }
+#endif
 
   if (fMeasuresRepeatReplicasSegment) {
   // browse the replicas segment
@@ -18243,7 +18474,7 @@ void msrMeasuresRepeat::setMeasuresRepeatPattern (
   S_msrMeasuresRepeatPattern measuresRepeatPattern)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting measure repeat pattern containing " <<
       singularOrPlural (
@@ -18267,7 +18498,7 @@ void msrMeasuresRepeat::setMeasuresRepeatReplicas (
   S_msrMeasuresRepeatReplicas measuresRepeatReplicas)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting measure repeat replicas containing " <<
       singularOrPlural (
@@ -18305,55 +18536,65 @@ int msrMeasuresRepeat::measuresRepeatReplicasNumber () const
 
 void msrMeasuresRepeat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeat::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMeasuresRepeat>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeat>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeat> > (msrVisitorKey<S_msrMeasuresRepeat> ())) {
         S_msrMeasuresRepeat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeat::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMeasuresRepeat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeat::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMeasuresRepeat>*
     p =
-      dynamic_cast<visitor<S_msrMeasuresRepeat>*> (v)) {
+      v->cast<visitor<S_msrMeasuresRepeat> > (msrVisitorKey<S_msrMeasuresRepeat> ())) {
         S_msrMeasuresRepeat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMeasuresRepeat::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMeasuresRepeat::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMeasuresRepeat::browseData ()" <<
       endl;
   }
+#endif
 
   if (fMeasuresRepeatPattern) {
   // browse the measdure repeat pattern
@@ -18373,17 +18614,17 @@ void msrMeasuresRepeat::browseData (basevisitor* v)
     score->getInhibitMeasuresRepeatReplicasBrowsing ();
 
   if (inhibitMeasuresRepeatReplicasBrowsing) {
-    if (
-      gMsrOptions->fTraceMsrVisitors
 #ifdef TRACE_OPTIONS
+    if (
+      gTraceFlags [kTraceMsrVisitorsFlag]
         ||
-      gTraceOptions->fTraceRepeats
-#endif
+      gTraceFlags [kTraceRepeatsFlag]
     ) {
       gLogIOstream <<
         "% ==> visiting measure repeat replicas is inhibited" <<
         endl;
     }
+#endif
   }
 
   if (fMeasuresRepeatReplicas) {
@@ -18505,7 +18746,7 @@ S_msrMultipleRestContents msrMultipleRestContents::createMultipleRestContentsNew
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a multiple rest contents" <<
       endl;
@@ -18530,7 +18771,7 @@ void msrMultipleRestContents::setMultipleRestContentsSegment (
     S_msrSegment multipleRestContentsSegment)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting multiple rest contents segment containing " <<
       singularOrPlural (
@@ -18568,55 +18809,65 @@ int msrMultipleRestContents::multipleRestContentsMeasuresNumber () const
 
 void msrMultipleRestContents::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRestContents::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMultipleRestContents>*
     p =
-      dynamic_cast<visitor<S_msrMultipleRestContents>*> (v)) {
+      v->cast<visitor<S_msrMultipleRestContents> > (msrVisitorKey<S_msrMultipleRestContents> ())) {
         S_msrMultipleRestContents elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMultipleRestContents::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMultipleRestContents::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRestContents::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMultipleRestContents>*
     p =
-      dynamic_cast<visitor<S_msrMultipleRestContents>*> (v)) {
+      v->cast<visitor<S_msrMultipleRestContents> > (msrVisitorKey<S_msrMultipleRestContents> ())) {
         S_msrMultipleRestContents elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMultipleRestContents::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMultipleRestContents::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRestContents::browseData ()" <<
       endl;
   }
+#endif
 
   if (fMultipleRestContentsSegment) {
     // browse the pattern segment
@@ -18720,7 +18971,7 @@ S_msrMultipleRest msrMultipleRest::createMultipleRestNewbornClone (
   S_msrVoice containingVoice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of multiple rest " <<
       asString () <<
@@ -18751,7 +19002,7 @@ void msrMultipleRest::setMultipleRestContents (
   S_msrMultipleRestContents multipleRestContents)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting multiple rest segment containing " <<
       singularOrPlural (
@@ -18775,7 +19026,7 @@ void msrMultipleRest::setMultipleRestNextMeasureNumber (
   string measureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Setting multiple rest next measure number to'" <<
       "' " <<
@@ -18790,55 +19041,65 @@ void msrMultipleRest::setMultipleRestNextMeasureNumber (
 
 void msrMultipleRest::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRest::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrMultipleRest>*
     p =
-      dynamic_cast<visitor<S_msrMultipleRest>*> (v)) {
+      v->cast<visitor<S_msrMultipleRest> > (msrVisitorKey<S_msrMultipleRest> ())) {
         S_msrMultipleRest elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMultipleRest::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrMultipleRest::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRest::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrMultipleRest>*
     p =
-      dynamic_cast<visitor<S_msrMultipleRest>*> (v)) {
+      v->cast<visitor<S_msrMultipleRest> > (msrVisitorKey<S_msrMultipleRest> ())) {
         S_msrMultipleRest elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrMultipleRest::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrMultipleRest::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrMultipleRest::browseData ()" <<
       endl;
   }
+#endif
 
 /* JMI
   // get the part uplink
@@ -18864,7 +19125,7 @@ void msrMultipleRest::browseData (basevisitor* v)
       getInhibitMultipleRestMeasuresBrowsing ();
 
   if (inhibitMultipleRestMeasuresBrowsing) {
-    if (gMsrOptions->fTraceMsrVisitors || gTraceOptions->fTraceRepeats) {
+    if (gTraceFlags [kTraceMsrVisitorsFlag] || gTraceFlags [kTraceRepeatsFlag]) {
       gLogIOstream <<
         "% ==> visiting multiple rest measures is inhibited" <<
         endl;
@@ -19002,7 +19263,7 @@ S_msrRepeatCoda msrRepeatCoda::createRepeatCodaNewbornClone (
   S_msrRepeat containingRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a " <<
       asString () <<
@@ -19037,7 +19298,7 @@ S_msrRepeatCoda msrRepeatCoda::createRepeatCodaDeepCopy (
   S_msrRepeat containingRepeat)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a " <<
       asString () <<
@@ -19086,44 +19347,52 @@ void msrRepeatCoda::appendElementToRepeatCoda (
 
 void msrRepeatCoda::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatCoda::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrRepeatCoda>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
+      v->cast<visitor<S_msrRepeatCoda> > (msrVisitorKey<S_msrRepeatCoda> ())) {
         S_msrRepeatCoda elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatCoda::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrRepeatCoda::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRepeatCoda::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrRepeatCoda>*
     p =
-      dynamic_cast<visitor<S_msrRepeatCoda>*> (v)) {
+      v->cast<visitor<S_msrRepeatCoda> > (msrVisitorKey<S_msrRepeatCoda> ())) {
         S_msrRepeatCoda elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRepeatCoda::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19170,7 +19439,7 @@ ostream& operator<< (ostream& os, const S_msrRepeatCoda& elt)
 
 //______________________________________________________________________________ 
 // global variable
-int msrVoice::gVoicesCounter = 0;
+thread_local int msrVoice::gVoicesCounter = 0;
 
 S_msrVoice msrVoice::create (
   int          inputLineNumber,
@@ -19235,7 +19504,7 @@ void msrVoice::setVoiceNameFromNumber (
   int voiceNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Setting the name of '" <<
       voiceKindAsString () <<
@@ -19332,7 +19601,7 @@ void msrVoice::initializeVoice (
   } // switch
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Initializing voice \"" << fVoiceName <<
       "\" in staff \"" <<
@@ -19393,7 +19662,7 @@ void msrVoice::initializeVoice (
   switch (voiceCreateInitialLastSegmentKind) {
     case msrVoice::kCreateInitialLastSegmentYes:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceSegments) {
+      if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
         gLogIOstream <<
           "Creating an initial voice last segment for voice \"" <<
           fVoiceName <<
@@ -19410,7 +19679,7 @@ void msrVoice::initializeVoice (
       
     case msrVoice::kCreateInitialLastSegmentNo:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceSegments) {
+      if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceSegmentsFlag]) {
         gLogIOstream <<
           "NO initial voice last segment is created for voice \"" <<
           fVoiceName <<
@@ -19438,6 +19707,7 @@ void msrVoice::initializeVoice (
   fVoiceActualHarmoniesCounter = 0;
 
   // multiple rests
+  fVoiceContainsMultipleRests = false;
   fVoiceRemainingRestMeasures = 0;
 
   // get the initial staff details from the staff if any
@@ -19453,7 +19723,7 @@ void msrVoice::initializeVoice (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Initial contents of voice \"" << fVoiceName <<
       "\" in staff \"" <<
@@ -19476,7 +19746,7 @@ void msrVoice::changeVoiceIdentity ( // after a deep copy
   int voiceNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Changing identity of voice \"" <<
       getVoiceName () <<
@@ -19504,7 +19774,7 @@ S_msrVoice msrVoice::createVoiceNewbornClone (
   S_msrStaff staffClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of voice \"" <<
       getVoiceName () <<
@@ -19581,7 +19851,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
   S_msrStaff   containingStaff)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating a deep copy of voice \"" <<
       getVoiceName () <<
@@ -19599,7 +19869,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     "containingStaff is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoicesDetails) {
+  if (gTraceFlags [kTraceVoicesDetailsFlag]) {
     gLogIOstream <<
       "****" <<
       " BEFORE voiceDeepCopy = " <<
@@ -19670,7 +19940,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     
   if (numberOfInitialElements) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "There are " <<
         numberOfInitialElements <<
@@ -19737,7 +20007,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
 
   else {    
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "There are no initial elements in voice \"" <<
         getVoiceName () <<
@@ -19761,7 +20031,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
   }
   else {    
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "There is no last segment in voice \"" <<
         getVoiceName () <<
@@ -19793,7 +20063,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     containingStaff;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoicesDetails) {
+  if (gTraceFlags [kTraceVoicesDetailsFlag]) {
     gLogIOstream <<
       "****" <<
       " AFTER voiceDeepCopy = " <<
@@ -19823,7 +20093,7 @@ void msrVoice::createMeasureAndAppendItToVoice (
   fVoiceCurrentMeasureNumber = measureNumber;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating measure '" <<
       measureNumber <<
@@ -19886,7 +20156,7 @@ void msrVoice::setNextMeasureNumberInVoice (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
@@ -19907,7 +20177,7 @@ void msrVoice::setNextMeasureNumberInVoice (
   if (fVoiceMultipleRestWaitingForItsNextMeasureNumber) {      
     // yes
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceFlags [kTraceRepeatsFlag]) {
       gLogIOstream <<
         "There is a multiple rest waiting for its next measure number" <<
         ", fVoiceRemainingRestMeasures = " <<
@@ -19924,7 +20194,7 @@ void msrVoice::setNextMeasureNumberInVoice (
     if (fVoiceRemainingRestMeasures == 0) {
       // yes, set waiting multiple rest's next measure number
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceFlags [kTraceRepeatsFlag]) {
         gLogIOstream <<
           "Setting multiple rest next measure number to '" <<
           nextMeasureNumber <<
@@ -19951,7 +20221,7 @@ void msrVoice::createNewLastSegmentForVoice (
 {
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating a new segment for voice \"" <<
       getVoiceName () << "\"" <<
@@ -19976,7 +20246,7 @@ void msrVoice::createNewLastSegmentFromFirstMeasureForVoice (
 {
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating a new segment with first measure '" <<
       firstMeasure->getMeasureNumber () <<
@@ -20020,13 +20290,13 @@ void msrVoice::createNewLastSegmentAndANewMeasureBeforeARepeat (
   // create the new voice last segment
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceSegments
+    gTraceFlags [kTraceSegmentsFlag]
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceFlags [kTraceMeasuresFlag]
       ||
-    gTraceOptions->fTraceRepeats
+    gTraceFlags [kTraceRepeatsFlag]
   ) {
     gLogIOstream <<
       "Creating a new last segment containing a new measure '" <<
@@ -20049,7 +20319,7 @@ void msrVoice::createNewLastSegmentAndANewMeasureBeforeARepeat (
 
   // create a measure
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceSegments) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceSegmentsFlag]) {
     gLogIOstream <<
       "Creating measure '" << fVoiceCurrentMeasureNumber <<
       "' in segment " << asString () <<
@@ -20106,7 +20376,7 @@ void msrVoice::createNewLastSegmentAndANewMeasureAfterARepeat (
 
   // create the segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Creating a new last segment containing a new measure '" <<
       fVoiceCurrentMeasureNumber <<
@@ -20130,13 +20400,13 @@ void msrVoice::createNewLastSegmentAndANewMeasureAfterARepeat (
   // create the new measure with number newMeasureMeasureNumber
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceSegments
+    gTraceFlags [kTraceSegmentsFlag]
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceFlags [kTraceMeasuresFlag]
       ||
-    gTraceOptions->fTraceRepeats
+    gTraceFlags [kTraceRepeatsFlag]
   ) {
     gLogIOstream <<
       "Creating a new last segment containing a new measure '" <<
@@ -20199,11 +20469,11 @@ S_msrVoice msrVoice::createHarmonyVoiceForRegularVoice (
     
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceHarmonies
+    gTraceFlags [kTraceHarmoniesFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceStaves) {
+    gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Creating harmony voice for regular voice \"" << getVoiceName () << "\"" <<
       " with voice number " << harmonyVoiceForRegularVoiceNumber <<
@@ -20277,7 +20547,7 @@ void msrVoice::addStanzaToVoice (S_msrStanza stanza)
     
   // register stanza in this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Adding stanza " << stanza->getStanzaName () <<
       " (" << stanzaNumber <<
@@ -20298,7 +20568,7 @@ void msrVoice::addStanzaToVoiceWithoutCatchUp (S_msrStanza stanza)
     
   // register stanza in this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Adding stanza " << stanza->getStanzaName () <<
       " (" << stanzaNumber <<
@@ -20328,7 +20598,7 @@ S_msrStanza msrVoice::createStanzaInVoiceIfNotYetDone (
   else {
     // no, create it and add it to the voice
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceLyrics) {
+    if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceLyricsFlag]) {
       gLogIOstream <<
         "Creating stanza" <<
         " number " << stanzaNumber <<
@@ -20400,7 +20670,7 @@ S_msrStanza msrVoice::fetchStanzaInVoice (
 void msrVoice::appendClefToVoice (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending clef '" << clef->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20432,7 +20702,7 @@ void msrVoice::appendClefToVoice (S_msrClef clef)
 void msrVoice::appendKeyToVoice (S_msrKey key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending key '" << key->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20456,7 +20726,7 @@ void msrVoice::appendKeyToVoice (S_msrKey key)
 void msrVoice::appendTimeToVoice (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending time '" << time->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20480,7 +20750,7 @@ void msrVoice::appendTimeToVoice (S_msrTime time)
 void msrVoice::appendTimeToVoiceClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending time '" << time->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
@@ -20652,7 +20922,7 @@ void msrVoice::registerNoteAsVoiceLastAppendedNote (S_msrNote note)
 void msrVoice::appendHarmonyToVoice (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending harmony '" << harmony->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20711,7 +20981,7 @@ void msrVoice::appendHarmonyToVoice (S_msrHarmony harmony)
 void msrVoice::appendHarmonyToVoiceClone (S_msrHarmony harmony)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending harmony '" << harmony->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
@@ -20764,7 +21034,7 @@ void msrVoice::appendFiguredBassToVoice (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceFiguredBassFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -20812,7 +21082,7 @@ void msrVoice::appendFiguredBassToVoiceClone (
   S_msrFiguredBass figuredBass)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceFiguredBassFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending figured bass '" << figuredBass->asString () <<
       "' to voice clone \"" << getVoiceName () << "\"" <<
@@ -20863,7 +21133,7 @@ void msrVoice::padUpToMeasureLengthInVoice (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Padding up to measure length '" << measureLength <<
       "' in voice \"" <<
@@ -20902,7 +21172,7 @@ void msrVoice::appendPaddingNoteToVoice (
   int divisionsPerQuarterNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending padding note of " << divisions <<
       " divisions to voice \"" <<
@@ -20944,7 +21214,7 @@ void msrVoice::appendTransposeToVoice (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending transpose '" <<
       transpose->asString () <<
@@ -20965,7 +21235,7 @@ void msrVoice::appendPartNameDisplayToVoice (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending part name display '" <<
       partNameDisplay->asString () <<
@@ -20986,7 +21256,7 @@ void msrVoice::appendPartAbbreviationDisplayToVoice (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending part abbreviation display '" <<
       partAbbreviationDisplay->asString () <<
@@ -21008,7 +21278,7 @@ void msrVoice::appendStaffDetailsToVoice (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending staff details '" <<
       staffDetails->asShortString () <<
@@ -21036,7 +21306,7 @@ void msrVoice::appendStaffDetailsToVoice (
 void msrVoice::appendWordsToVoice (S_msrWords words)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceWords) {
+  if (gTraceFlags [kTraceWordsFlag]) {
     gLogIOstream <<
       "Appending words '" << words->asString () <<
       "' to voice " << getVoiceName () << endl;
@@ -21051,12 +21321,14 @@ void msrVoice::appendWordsToVoice (S_msrWords words)
 
 void msrVoice::appendTempoToVoice (S_msrTempo tempo)
 {
-  if (gMsrOptions->fTraceMsr) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrFlag]) {
     gLogIOstream <<
       "Appending tempo '" << tempo->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
+#endif
 
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -21069,7 +21341,8 @@ void msrVoice::appendTempoToVoice (S_msrTempo tempo)
 void msrVoice::appendOctaveShiftToVoice (
   S_msrOctaveShift octaveShift)
 {
-  if (gMsrOptions->fTraceMsr) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrFlag]) {
     gLogIOstream <<
       "Appending octave shift '" <<
       octaveShift->octaveShiftKindAsString () <<
@@ -21077,6 +21350,7 @@ void msrVoice::appendOctaveShiftToVoice (
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
+#endif
 
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -21089,13 +21363,15 @@ void msrVoice::appendOctaveShiftToVoice (
 void msrVoice::appendScordaturaToVoice (
   S_msrScordatura scordatura)
 {
-  if (gMsrOptions->fTraceMsr) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrFlag]) {
     gLogIOstream <<
       "Appending scordatura '" <<
       scordatura->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
       endl;
   }
+#endif
 
   // create the voice last segment and first measure if needed
   appendAFirstMeasureToVoiceIfNotYetDone (
@@ -21110,7 +21386,7 @@ void msrVoice::appendAccordionRegistrationToVoice (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
@@ -21133,7 +21409,7 @@ void msrVoice::appendHarpPedalsTuningToVoice (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending harp pedals tuning '" <<
       harpPedalsTuning->asString () <<
@@ -21154,7 +21430,7 @@ void msrVoice::appendHarpPedalsTuningToVoice (
 void msrVoice::appendRehearsalToVoice (S_msrRehearsal rehearsal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending rehearsal '" << rehearsal->getRehearsalText () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21177,7 +21453,7 @@ void msrVoice::appendVoiceStaffChangeToVoice (
     voiceStaffChange->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending voice staff change '" <<
       voiceStaffChange->asString () <<
@@ -21207,7 +21483,7 @@ void msrVoice::appendNoteToVoice (S_msrNote note) {
     note->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending note '" <<
       endl;
@@ -21298,11 +21574,11 @@ void msrVoice::appendNoteToVoice (S_msrNote note) {
 }
 
 void msrVoice::appendNoteToVoiceClone (S_msrNote note) {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     note->getInputLineNumber ();
     
-#ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending note '" <<
       note->asShortString () <<
@@ -21386,7 +21662,7 @@ void msrVoice::appendDoubleTremoloToVoice (
 
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTremolos) {
+  if (gTraceFlags [kTraceTremolosFlag]) {
     gLogIOstream <<
       "Appending double tremolo '" <<
       doubleTremolo->asShortString () <<
@@ -21408,7 +21684,7 @@ void msrVoice::appendDoubleTremoloToVoice (
 void msrVoice::appendChordToVoice (S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Appending chord '" << chord->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21464,7 +21740,7 @@ void msrVoice::appendChordToVoice (S_msrChord chord)
 void msrVoice::appendTupletToVoice (S_msrTuplet tuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     gLogIOstream <<
       "Appending tuplet '" << tuplet->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21493,7 +21769,7 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
     graceNotesGroup->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Adding grace notes '" <<
       graceNotesGroup->asString () <<
@@ -21550,7 +21826,7 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
       
   if (firstNoteChordUplink) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
       gLogIOstream <<
         "Attaching grace notes before '" <<
         graceNotesGroup->asString () <<
@@ -21569,7 +21845,7 @@ void msrVoice::addGraceNotesGroupBeforeAheadOfVoiceIfNeeded (
   
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
       gLogIOstream <<
         "Attaching grace notes before '" <<
         graceNotesGroup->asString () <<
@@ -21594,7 +21870,7 @@ void msrVoice::appendAfterGraceNotesToVoice (
   S_msrAfterGraceNotes afterGraceNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Appending after grace notes " << // JMI AfterGraceNotes <<
       " to voice \"" << getVoiceName () << "\"" <<
@@ -21616,7 +21892,7 @@ void msrVoice::prependAfterGraceNotesToVoice (
   S_msrAfterGraceNotes afterGraceNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Prepending after grace notes " << // JMI AfterGraceNotes <<
       " to voice \"" << getVoiceName () << "\"" <<
@@ -21643,7 +21919,7 @@ void msrVoice::appendSyllableToVoice (
 {
   // append syllable to this voice
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gLogIOstream <<
       "Appending syllable '" <<
       syllable->asString () <<
@@ -21669,7 +21945,7 @@ void msrVoice::appendSyllableToVoice (
 void msrVoice::appendBarCheckToVoice (S_msrBarCheck barCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending bar check '" << barCheck->asString () <<
       "' to voice \"" << getVoiceName () <<  "\"" <<
@@ -21689,7 +21965,7 @@ void msrVoice::appendBarNumberCheckToVoice (
   S_msrBarNumberCheck barNumberCheck)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending barnumber check '" <<
       barNumberCheck->asString () <<
@@ -21709,7 +21985,7 @@ void msrVoice::appendBarNumberCheckToVoice (
 void msrVoice::appendLineBreakToVoice (S_msrLineBreak lineBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending line break '" << lineBreak->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21741,7 +22017,7 @@ void msrVoice::appendLineBreakToVoice (S_msrLineBreak lineBreak)
 void msrVoice::appendPageBreakToVoice (S_msrPageBreak pageBreak)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending page break '" << pageBreak->asString () <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21759,7 +22035,7 @@ void msrVoice::appendPageBreakToVoice (S_msrPageBreak pageBreak)
 
 void msrVoice::prependOtherElementToVoice (S_msrElement elem) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Prepending other element '" << elem <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21777,7 +22053,7 @@ void msrVoice::prependOtherElementToVoice (S_msrElement elem) {
 
 void msrVoice::appendOtherElementToVoice (S_msrElement elem) {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Appending other element '" << elem <<
       "' to voice \"" << getVoiceName () << "\"" <<
@@ -21862,7 +22138,7 @@ void msrVoice::prepareForRepeatInVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Preparing for repeat in voice \"" <<
       getVoiceName () <<
@@ -21917,9 +22193,9 @@ void msrVoice::prepareForRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice ZZZ \"" <<
@@ -21941,11 +22217,11 @@ void msrVoice::prepareForRepeatInVoice (
           // remove last measure in last segment
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceFlags [kTraceMeasuresFlag]
               ||
-            gTraceOptions->fTraceSegments
+            gTraceFlags [kTraceSegmentsFlag]
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceFlags [kTraceRepeatsFlag]) {
             stringstream s;
         
             gLogIOstream <<
@@ -21978,7 +22254,7 @@ void msrVoice::prepareForRepeatInVoice (
 
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
@@ -21993,7 +22269,7 @@ void msrVoice::prepareForRepeatInVoice (
   
           // create a new last segment containing lastMeasureInLastSegment for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+          if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
             gLogIOstream <<
               "Creating a new last segment containing  measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
@@ -22019,9 +22295,9 @@ else {
 
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice TTT \"" <<
@@ -22050,7 +22326,7 @@ void msrVoice::prepareForRepeatInVoiceClone (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Preparing for repeat in voice clone \"" <<
       getVoiceName () <<
@@ -22105,9 +22381,9 @@ void msrVoice::prepareForRepeatInVoiceClone (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice ZZZ \"" <<
@@ -22129,11 +22405,11 @@ void msrVoice::prepareForRepeatInVoiceClone (
           // remove last measure in last segment
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceMeasures
+            gTraceFlags [kTraceMeasuresFlag]
               ||
-            gTraceOptions->fTraceSegments
+            gTraceFlags [kTraceSegmentsFlag]
               ||
-            gTraceOptions->fTraceRepeats) {
+            gTraceFlags [kTraceRepeatsFlag]) {
             stringstream s;
         
             gLogIOstream <<
@@ -22166,7 +22442,7 @@ void msrVoice::prepareForRepeatInVoiceClone (
 
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
@@ -22181,7 +22457,7 @@ void msrVoice::prepareForRepeatInVoiceClone (
   
           // create a new last segment containing lastMeasureInLastSegment for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+          if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
             gLogIOstream <<
               "Creating a new last segment containing  measure '" <<
               lastMeasureInLastSegment->getMeasureNumber () <<
@@ -22207,9 +22483,9 @@ else {
 
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice TTT \"" <<
@@ -22239,7 +22515,7 @@ else {
 
       // create a repeat common part
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceFlags [kTraceRepeatsFlag]) {
         gLogIOstream <<
           "Creating a repeat common part from current last segment in voice \"" <<
           getVoiceName () <<
@@ -22288,9 +22564,9 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice BBB \"" <<
@@ -22311,7 +22587,7 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
           // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Appending voice last segment to the initial elements in voice \"" <<
               getVoiceName () <<
@@ -22326,7 +22602,7 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
           // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+          if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
             gLogIOstream <<
               "Creating a new last segment containing a new measure for voice \"" <<
               fVoiceName << "\"" <<
@@ -22341,9 +22617,9 @@ void msrVoice::nestContentsIntoNewRepeatInVoice (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice QQQ \"" <<
@@ -22383,9 +22659,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
           
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice III \"" <<
@@ -22406,7 +22682,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
@@ -22425,7 +22701,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create a repeat common part from the new segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22447,7 +22723,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
           
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
@@ -22476,7 +22752,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
   
           // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Append the voice last segment to the repeat common part in voice \"" <<
               getVoiceName () <<
@@ -22496,7 +22772,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
@@ -22525,7 +22801,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
   
           // append the voice last segment to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Appending the voice last segment in voice \"" <<
               getVoiceName () <<
@@ -22546,7 +22822,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // set newRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22562,7 +22838,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // append newRepeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending new repeat to the initial elements in voice \"" <<
             getVoiceName () <<
@@ -22581,7 +22857,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
     // JMI        "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
@@ -22624,9 +22900,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice EEE \"" <<
@@ -22674,9 +22950,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice III \"" <<
@@ -22697,7 +22973,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
@@ -22716,7 +22992,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create a repeat common part from the new segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22738,7 +23014,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
           // move the voice initial elements to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Moving the initial elements in voice \"" <<
               getVoiceName () <<
@@ -22767,7 +23043,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
   
           // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Append the voice last segment to the repeat common part in voice \"" <<
               getVoiceName () <<
@@ -22787,7 +23063,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
           
           // append the voice last segment to the new repeat common part
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceRepeats) {
+          if (gTraceFlags [kTraceRepeatsFlag]) {
             gLogIOstream <<
               "Appending the voice last segment in voice \"" <<
               getVoiceName () <<
@@ -22808,7 +23084,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // set newRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22824,7 +23100,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // append newRepeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending new repeat to the initial elements in voice \"" <<
             getVoiceName () <<
@@ -22843,7 +23119,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
     // JMI        "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
@@ -22865,9 +23141,9 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice EEE \"" <<
@@ -22929,7 +23205,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
           
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
@@ -22949,7 +23225,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // create a repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a repeat common part from current last segment in voice \"" <<
             getVoiceName () <<
@@ -22967,7 +23243,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Append the voice last segment to the repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22983,7 +23259,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
         // set fVoiceCurrentRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
@@ -22999,7 +23275,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
           
         // append the repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending repeat to the initial elements in voice \"" <<
             getVoiceName () <<
@@ -23014,7 +23290,7 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
       
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment with the first ending measure for voice \"" <<
             fVoiceName << "\"" <<
@@ -23029,9 +23305,9 @@ void msrVoice::createRegularRepeatUponItsFirstEndingInVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice \"" <<
@@ -23093,7 +23369,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
           
         // create the repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating and appending a repeat in voice \"" <<
             getVoiceName () <<
@@ -23113,7 +23389,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
 
         // create a repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a repeat common part from current last segment in voice \"" <<
             getVoiceName () <<
@@ -23131,7 +23407,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
 
         // move voice initial elements into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Moving the voice initial elements to the repeat common part in voice \"" <<
             getVoiceName () <<
@@ -23165,7 +23441,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Append the voice last segment to the repeat common part in voice \"" <<
             getVoiceName () <<
@@ -23185,7 +23461,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         
         // set fVoiceCurrentRepeat's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
@@ -23205,7 +23481,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
           
         // append the repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending repeat to the initial elements in voice \"" <<
             getVoiceName () <<
@@ -23220,7 +23496,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
       
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment with the first ending measure for voice \"" <<
             fVoiceName << "\"" <<
@@ -23239,9 +23515,9 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeatsDetails
+          gTraceFlags [kTraceRepeatsDetailsFlag]
             ||
-          gTraceOptions->fTraceVoicesDetails) {
+          gTraceFlags [kTraceVoicesDetailsFlag]) {
           gLogIOstream <<
             endl <<
             "*********>> Current voice \"" <<
@@ -23279,11 +23555,11 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // create a measure repeat
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a " <<
@@ -23301,13 +23577,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // print current voice contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             endl <<
@@ -23374,13 +23650,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // and prepend them to the repeated segment
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Removing the last " <<
@@ -23426,13 +23702,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // create the measures repeat pattern
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a measure repeat pattern for voice \"" <<
@@ -23461,13 +23737,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // containing the first, yet incomplete, replica
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a new last segment with the first replica measure for voice \"" <<
@@ -23484,13 +23760,13 @@ void msrVoice::createMeasuresRepeatFromItsFirstMeasuresInVoice (
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "The resulting voice contents of voice \"" <<
@@ -23562,13 +23838,13 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // remove the next measure from the last segment's measure list
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Removing last measure in last segment in voice \"" <<
@@ -23582,13 +23858,13 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // create the measure repeat replicas contents
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a measure repeat replicas FAA contents for voice \"" <<
@@ -23614,13 +23890,13 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Setting pending measure repeat replicas segment in voice \"" <<
@@ -23636,13 +23912,13 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
 
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Setting measures repeat segment to voice last segment CCC for voice \"" <<
@@ -23664,13 +23940,13 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a new last segment with the AAA measures repeat next measure for voice \"" <<
@@ -23720,7 +23996,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create the measures repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating and appending a measures repeat in voice \"" <<
             getVoiceName () <<
@@ -23739,7 +24015,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create a measures repeat pattern from current last segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a measures repeat pattern from current last segment in voice \"" <<
             getVoiceName () <<
@@ -23763,7 +24039,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // set the measures repeat pattern
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat common part in voice \"" <<
             getVoiceName () <<
@@ -23778,7 +24054,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment containing a new measure for voice \"" <<
             fVoiceName << "\"" <<
@@ -23793,7 +24069,7 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
 
         // append the measures repeat to the list of initial elements
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending measures repeat to the list of initial elements in voice \"" <<
             getVoiceName () <<
@@ -23809,13 +24085,13 @@ void msrVoice::createMeasuresRepeatAndAppendItToVoiceClone (
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceSegments
+          gTraceFlags [kTraceSegmentsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
           ) {
           gLogIOstream <<
             "Creating a new last segment for voice \"" <<
@@ -23836,7 +24112,7 @@ void msrVoice::setVoiceContainsMultipleRests (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Voice \"" <<
       getVoiceName () <<
@@ -23861,7 +24137,7 @@ void msrVoice::createMultipleRestInVoice (
       {
         // create a multiple rest
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a multiple rest in voice \"" <<
             getVoiceName () <<
@@ -23923,7 +24199,7 @@ void msrVoice::createMultipleRestInVoice (
 
          // remember fVoicePendingMultipleRest for later next measure number setting
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Registering multiple rest as waiting for its next measure number" <<
             ", multipleRestMeasuresNumber = " <<
@@ -23941,7 +24217,7 @@ void msrVoice::createMultipleRestInVoice (
           multipleRestMeasuresNumber;
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting fVoiceRemainingRestMeasures to '" <<
             fVoiceRemainingRestMeasures <<
@@ -23954,7 +24230,7 @@ void msrVoice::createMultipleRestInVoice (
         // create a new segment to collect the multiple rest measures,
         // containing the first, rest measure
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment containing the first rest measure in voice \"" <<
             fVoiceName << "\"" <<
@@ -23980,7 +24256,7 @@ void msrVoice::createMultipleRestInVoice (
             
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
@@ -24007,7 +24283,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending the pending multiple rest to voice \"" <<
             getVoiceName () <<
@@ -24057,7 +24333,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
           nextMeasureAfterMultipleRest =
             voiceLastSegmentMeasureList.back ();
 
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             endl <<
             "==========> nextMeasureAfterMultipleRest:" <<
@@ -24077,7 +24353,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // create the multiple rest contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a measure pattern for voice \"" <<
             fVoiceName << "\" is:" <<
@@ -24093,7 +24369,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // set voice last segment as the multiple rest segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting current last segment as multiple rest segment in voice \"" <<
             getVoiceName () <<
@@ -24108,7 +24384,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
 
         // set multipleRestContents as the multiple rest contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting multiple rest contents in voice \"" <<
             getVoiceName () <<
@@ -24128,7 +24404,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
         // create a new segment to collect the remainder of the voice,
         // containing the next, yet incomplete, measure
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment with the measure after the multiple rests for voice \"" <<
             fVoiceName << "\"" <<
@@ -24149,7 +24425,7 @@ void msrVoice::appendPendingMultipleRestToVoice (
 */
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
@@ -24193,9 +24469,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
           if (
-            gTraceOptions->fTraceRepeatsDetails
+            gTraceFlags [kTraceRepeatsDetailsFlag]
               ||
-            gTraceOptions->fTraceVoicesDetails) {
+            gTraceFlags [kTraceVoicesDetailsFlag]) {
             gLogIOstream <<
               endl <<
               "*********>> Current voice HHH \"" <<
@@ -24224,7 +24500,7 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
 
             // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+            if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
               gLogIOstream <<
                 "Creating a new last segment containing a new measure for multiple rest in voice \"" <<
                 fVoiceName << "\"" <<
@@ -24238,9 +24514,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceRepeatsDetails
+              gTraceFlags [kTraceRepeatsDetailsFlag]
                 ||
-              gTraceOptions->fTraceVoicesDetails) {
+              gTraceFlags [kTraceVoicesDetailsFlag]) {
               gLogIOstream <<
                 endl <<
                 "*********>> Current voice KKK \"" <<
@@ -24265,7 +24541,7 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
           
             // move current last segment to the list of initial elements
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceRepeats) {
+            if (gTraceFlags [kTraceRepeatsFlag]) {
               gLogIOstream <<
                 "Appending voice last segment to the initial elements in voice \"" <<
                 getVoiceName () <<
@@ -24280,7 +24556,7 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
             // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+            if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
               gLogIOstream <<
                 "Creating a new last segment containing a new measure for voice \"" <<
                 fVoiceName << "\"" <<
@@ -24295,9 +24571,9 @@ void msrVoice::prepareForMultipleRestInVoiceClone (
   
 #ifdef TRACE_OPTIONS
             if (
-              gTraceOptions->fTraceRepeatsDetails
+              gTraceFlags [kTraceRepeatsDetailsFlag]
                 ||
-              gTraceOptions->fTraceVoicesDetails) {
+              gTraceFlags [kTraceVoicesDetailsFlag]) {
               gLogIOstream <<
                 endl <<
                 "*********>> Current voice PPP \"" <<
@@ -24332,7 +24608,7 @@ void msrVoice::appendMultipleRestCloneToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending multiple rest clone '" <<
             multipleRestClone->asString () <<
@@ -24383,7 +24659,7 @@ void msrVoice::appendMultipleRestCloneToVoice (
 
         // print resulting voice contents
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "The resulting voice contents of voice \"" <<
             fVoiceName << "\" is:" <<
@@ -24414,7 +24690,7 @@ void msrVoice::appendRepeatCloneToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending repeat clone to voice clone \"" <<
             getVoiceName () <<  "\"" <<
@@ -24424,7 +24700,7 @@ void msrVoice::appendRepeatCloneToVoice (
       
         // create a repeat common part from current last segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Creating a repeat clone common part from current last segment in voice \"" <<
             getVoiceName () <<
@@ -24441,7 +24717,7 @@ void msrVoice::appendRepeatCloneToVoice (
 
         // move voice last segment into the repeat common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Append the segment to use to the repeat common part in voice \"" <<
             getVoiceName () <<
@@ -24457,7 +24733,7 @@ void msrVoice::appendRepeatCloneToVoice (
 
         // set repeatCLone's common part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting repeat clone common part in voice \"" <<
             getVoiceName () <<
@@ -24473,7 +24749,7 @@ void msrVoice::appendRepeatCloneToVoice (
 /* JMI
         // set current last segment as the repeat common segment
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Segging current last segment as repeat common segment in voice \"" <<
             getVoiceName () <<
@@ -24488,7 +24764,7 @@ void msrVoice::appendRepeatCloneToVoice (
  */         
         // register repeat clone as the (new) current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Registering repeat clone as the new current repeat in voice \"" <<
             getVoiceName () <<
@@ -24506,7 +24782,7 @@ void msrVoice::appendRepeatCloneToVoice (
       
         // create a new segment for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment for voice BOF JMI \"" <<
             fVoiceName << "\"" <<
@@ -24534,7 +24810,7 @@ void msrVoice::appendRepeatEndingToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending a repeat ending to voice \"" <<
             getVoiceName () <<  "\"" <<
@@ -24562,7 +24838,7 @@ void msrVoice::appendRepeatEndingToVoice (
       
         // add the repeat ending it to the voice current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending a " <<
             msrRepeatEnding::repeatEndingKindAsString (
@@ -24580,11 +24856,11 @@ void msrVoice::appendRepeatEndingToVoice (
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceRepeats
+          gTraceFlags [kTraceRepeatsFlag]
             ||
-          gTraceOptions->fTraceVoices
+          gTraceFlags [kTraceVoicesFlag]
             ||
-          gTraceOptions->fTraceSegments) {
+          gTraceFlags [kTraceSegmentsFlag]) {
           gLogIOstream <<
      // JMI       "Creating a new last segment containing a new measure for voice \"" <<
             "Creating a new last segment for voice \"" <<
@@ -24630,7 +24906,7 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
     case msrVoice::kFiguredBassVoice:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending a measures repeat replica to voice \"" <<
             getVoiceName () <<  "\"" <<
@@ -24646,7 +24922,7 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
               getMeasureFullLength ();
 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) { // JMI
+        if (gTraceFlags [kTraceRepeatsFlag]) { // JMI
           gLogIOstream <<
             endl <<
             "***********" <<
@@ -24679,7 +24955,7 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
         
         // set the measures repeat replicas in the voice current measures repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Setting the measures repeat replica to current measures repeat BBB in voice \"" <<
             fVoiceName <<
@@ -24694,7 +24970,7 @@ void msrVoice::appendMeasuresRepeatReplicaToVoice (
 
         // create a new last segment containing a new measure for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment containing a new measure for voice \"" <<
             fVoiceName << "\"" <<
@@ -24723,7 +24999,7 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
       {
         // add the repeat ending it to the voice current repeat
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceRepeats) {
+        if (gTraceFlags [kTraceRepeatsFlag]) {
           gLogIOstream <<
             "Appending repeat ending clone to current repeat in voice \"" <<
             fVoiceName <<
@@ -24742,7 +25018,7 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
       
         // create a new segment for the voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Creating a new last segment for voice \"" <<
             fVoiceName <<
@@ -24764,7 +25040,7 @@ void msrVoice:: appendRepeatEndingCloneToVoice ( // JMI
 void msrVoice::prependBarlineToVoice (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Prepending barline '" <<
       barline->asString () <<
@@ -24789,7 +25065,7 @@ void msrVoice::prependBarlineToVoice (S_msrBarline barline)
 void msrVoice::appendBarlineToVoice (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending barline '" <<
       barline->asString () <<
@@ -24814,7 +25090,7 @@ void msrVoice::appendBarlineToVoice (S_msrBarline barline)
 void msrVoice::appendSegnoToVoice (S_msrSegno segno)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending a segno to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -24832,7 +25108,7 @@ void msrVoice::appendSegnoToVoice (S_msrSegno segno)
 void msrVoice::appendCodaToVoice (S_msrCoda coda)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending a coda to voice \"" << getVoiceName () << "\"" <<
       ":" <<
@@ -24851,7 +25127,7 @@ void msrVoice::appendCodaToVoice (S_msrCoda coda)
 void msrVoice::appendEyeGlassesToVoice (S_msrEyeGlasses eyeGlasses)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending a eyeGlasses to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -24869,7 +25145,7 @@ void msrVoice::appendEyeGlassesToVoice (S_msrEyeGlasses eyeGlasses)
 void msrVoice::appendPedalToVoice (S_msrPedal pedal)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending a pedal to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -24887,7 +25163,7 @@ void msrVoice::appendPedalToVoice (S_msrPedal pedal)
 void msrVoice::appendDampToVoice (S_msrDamp damp)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending a damp to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -24905,7 +25181,7 @@ void msrVoice::appendDampToVoice (S_msrDamp damp)
 void msrVoice::appendDampAllToVoice (S_msrDampAll dampAll)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     gLogIOstream <<
       "Appending a damp all to voice \"" << getVoiceName () << "\"" <<
       endl;
@@ -24925,7 +25201,7 @@ S_msrElement msrVoice::removeLastElementFromVoice (  // JMI
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Removing last note" <<
       " from voice " << getVoiceName () <<
@@ -24944,7 +25220,7 @@ void msrVoice::removeNoteFromVoice (
   S_msrNote note)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     gLogIOstream <<
       "Removing note '" <<
       note->asShortString () <<
@@ -24968,7 +25244,7 @@ void msrVoice::removeElementFromVoice (
   S_msrElement element)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceGraceNotes) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
     gLogIOstream <<
       "Removing element '" <<
       element->asShortString () <<
@@ -24991,7 +25267,7 @@ S_msrMeasure msrVoice::removeLastMeasureFromVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Removing last measure from voice \"" <<
       getVoiceName () <<
@@ -25018,7 +25294,7 @@ void msrVoice::finalizeCurrentMeasureInVoice (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Finalizing current measure in voice \"" <<
       getVoiceName () <<
@@ -25081,7 +25357,7 @@ void msrVoice:: collectVoiceMeasuresIntoFlatList (
   // collect measures from the initial elements if any
   if (fVoiceInitialElementsList.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "Collecting measures from the initial elements into voice \"" <<
         getVoiceName () <<
@@ -25096,7 +25372,7 @@ void msrVoice:: collectVoiceMeasuresIntoFlatList (
   // collect measures from the last segment if any
   if (fVoiceLastSegment) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "Collecting measures from the last segment into voice \"" <<
         getVoiceName () <<
@@ -25131,7 +25407,7 @@ void msrVoice::finalizeVoice ( // JMI ???
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Finalizing voice \"" <<
       getVoiceName () <<
@@ -25167,55 +25443,65 @@ void msrVoice::finalizeVoice ( // JMI ???
 
 void msrVoice::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVoice::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrVoice>*
     p =
-      dynamic_cast<visitor<S_msrVoice>*> (v)) {
+      v->cast<visitor<S_msrVoice> > (msrVisitorKey<S_msrVoice> ())) {
         S_msrVoice elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVoice::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrVoice::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVoice::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrVoice>*
     p =
-      dynamic_cast<visitor<S_msrVoice>*> (v)) {
+      v->cast<visitor<S_msrVoice> > (msrVisitorKey<S_msrVoice> ())) {
         S_msrVoice elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVoice::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrVoice::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVoice::browseData ()" <<
       endl;
   }
+#endif
 
   // browse the voice initial elements
   if (fVoiceInitialElementsList.size ()) {
@@ -25249,11 +25535,13 @@ void msrVoice::browseData (basevisitor* v)
     } // for
   }
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrVoice::browseData ()" <<
       endl;
   }
+#endif
 }
 
 string msrVoice::voiceKindAsString (
@@ -25616,7 +25904,7 @@ ostream& operator<< (ostream& os, const S_msrVoice& elt)
 }
 
 //______________________________________________________________________________
-int msrStaff::gStaffMaxRegularVoices = 4;
+thread_local int msrStaff::gStaffMaxRegularVoices = 4;
 
 S_msrStaff msrStaff::create (
   int          inputLineNumber,
@@ -25704,7 +25992,7 @@ void msrStaff::initializeStaff ()
   } // switch
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Initializing staff \"" << fStaffName <<
       "\" in part " <<
@@ -25781,7 +26069,7 @@ void msrStaff::initializeStaff ()
   
     if (clef) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
+      if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceStavesFlag]) {
         gLogIOstream <<
           "Appending part clef '" << clef->asString () <<
           "' as initial clef to staff \"" <<
@@ -25806,7 +26094,7 @@ void msrStaff::initializeStaff ()
   
     if (key) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceKeys) {
+      if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceKeysFlag]) {
         gLogIOstream <<
           "Appending part key '" << key->asString () <<
           "' as initial key to staff \"" <<
@@ -25830,7 +26118,7 @@ void msrStaff::initializeStaff ()
         
     if (transpose) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves /* JMI ||       gTraceOptions->fTraceTransposes */) {
+      if (gTraceFlags [kTraceStavesFlag] /* JMI ||       gTraceOptions->fTraceTransposes */) {
         gLogIOstream <<
           "Appending part transpose '" << transpose->asString () <<
           "' as initial transpose to staff \"" <<
@@ -25865,7 +26153,7 @@ S_msrStaff msrStaff::createStaffNewbornClone (
   S_msrPart containingPart)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of staff \"" <<
       fStaffName <<
@@ -25969,7 +26257,7 @@ void msrStaff::createMeasureAndAppendItToStaff (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Creating and appending measure '" <<
       measureNumber <<
@@ -25996,7 +26284,7 @@ void msrStaff::createMeasureAndAppendItToStaff (
     switch (voice->getVoiceKind ()) {
       case msrVoice::kRegularVoice:
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
+        if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceStavesFlag]) {
           gLogIOstream <<
             "Propagating the creation and appending of measure '" <<
             measureNumber <<
@@ -26028,7 +26316,7 @@ void msrStaff::setNextMeasureNumberInStaff (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
@@ -26053,7 +26341,7 @@ void msrStaff::setNextMeasureNumberInStaff (
       "voice is null");
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
+    if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceStavesFlag]) {
       gLogIOstream <<
         "Propagating the setting of next measure number '" <<
         nextMeasureNumber <<
@@ -26084,7 +26372,7 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       fStaffRegularVoicesCounter++;
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+      if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
         gLogIOstream <<
           "Creating regular voice number '" <<
           voiceNumber <<
@@ -26104,7 +26392,7 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       
     case msrVoice::kHarmonyVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+      if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
         gLogIOstream <<
           "Creating harmony voice number '" <<
           voiceNumber <<
@@ -26122,7 +26410,7 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
       
     case msrVoice::kFiguredBassVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+      if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
         gLogIOstream <<
           "Creating figured bass voice number '" <<
           voiceNumber <<
@@ -26184,7 +26472,7 @@ S_msrVoice msrStaff::createVoiceInStaffByItsNumber (
     case msrVoice::kRegularVoice:
       // register the voice by its relative number
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceVoices) {
+      if (gTraceFlags [kTraceVoicesFlag]) {
         gLogIOstream <<
           "Voice " << voiceNumber <<
           " in staff " << getStaffName () <<
@@ -26221,7 +26509,7 @@ void msrStaff::registerVoiceByItsNumber (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Registering voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
@@ -26244,7 +26532,7 @@ void msrStaff::registerVoiceByItsNumber (
 
     case msrVoice::kHarmonyVoice:
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+      if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
         gLogIOstream <<
           "Sorting the voices in staff \"" <<
           getStaffName () << "\"" <<
@@ -26319,7 +26607,7 @@ void msrStaff::registerVoiceInRegularVoicesMap (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Registering regular voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
@@ -26330,9 +26618,66 @@ void msrStaff::registerVoiceInRegularVoicesMap (
   }
 #endif
 
+  // a voice previously registered with this sequential number is replaced
+  map<int, S_msrVoice>::iterator
+    previous =
+      fStaffRegularVoicesMap.find (fStaffRegularVoicesCounter);
+
+  if (previous != fStaffRegularVoicesMap.end ()) {
+    S_msrVoice
+      previousVoice =
+        (*previous).second;
+    int
+      previousVoiceNumber =
+        previousVoice->getVoiceNumber ();
+
+    fStaffRegularVoicesMap.erase (previous);
+
+    map<int, S_msrVoice>::iterator
+      byNumber =
+        fStaffRegularVoicesByNumberMap.find (previousVoiceNumber);
+
+    if (
+      byNumber != fStaffRegularVoicesByNumberMap.end ()
+        &&
+      (*byNumber).second == previousVoice
+    ) {
+      // register the next regular voice with this number if any
+      fStaffRegularVoicesByNumberMap.erase (byNumber);
+
+      for (
+        map<int, S_msrVoice>::const_iterator i =
+          fStaffRegularVoicesMap.begin ();
+        i != fStaffRegularVoicesMap.end ();
+        i++) {
+        if ((*i).second->getVoiceNumber () == previousVoiceNumber) {
+          fStaffRegularVoicesByNumberMap [previousVoiceNumber] =
+            (*i).second;
+          break;
+        }
+      } // for
+    }
+  }
+
   fStaffRegularVoicesMap [fStaffRegularVoicesCounter] =
     voice;
 
+  // register it by its number, unless a voice with a lower
+  // sequential number has the same number
+  S_msrVoice&
+    byNumber =
+      fStaffRegularVoicesByNumberMap [voice->getVoiceNumber ()];
+
+  if (
+    ! byNumber
+      ||
+    byNumber->getRegularVoiceStaffSequentialNumber ()
+      >
+    fStaffRegularVoicesCounter
+  ) {
+    byNumber = voice;
+  }
+
   // set voice staff sequential number
   voice->
     setRegularVoiceStaffSequentialNumber (
@@ -26344,7 +26689,7 @@ void msrStaff::registerVoiceInAllVoicesList (
   S_msrVoice voice)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Registering voice number '" << voiceNumber <<
       "', named \"" << voice->getVoiceName () <<
@@ -26364,7 +26709,7 @@ S_msrVoice msrStaff::fetchVoiceFromStaffByItsNumber (
   S_msrVoice result; // JMI avoid repetitive messages!
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Fetching voice number " <<
       voiceNumber <<
@@ -26376,29 +26721,24 @@ S_msrVoice msrStaff::fetchVoiceFromStaffByItsNumber (
   }
 #endif
 
-  for (
-    map<int, S_msrVoice>::const_iterator i =
-      fStaffRegularVoicesMap.begin ();
-    i != fStaffRegularVoicesMap.end ();
-    i++) {
-    if (
-      (*i).second->getVoiceNumber ()
-        ==
-      voiceNumber) {
+  map<int, S_msrVoice>::const_iterator
+    i =
+      fStaffRegularVoicesByNumberMap.find (voiceNumber);
+
+  if (i != fStaffRegularVoicesByNumberMap.end ()) {
+    result = (*i).second;
+
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves) {
-          gLogIOstream <<
-            "Voice " << voiceNumber <<
-            " in staff \"" << getStaffName () << "\"" <<
-            " has staff relative number " << (*i).first <<
-            endl;
-        }
-#endif
-        
-        result = (*i).second;
-        break;
+    if (gTraceFlags [kTraceVoicesFlag] || gTraceFlags [kTraceStavesFlag]) {
+      gLogIOstream <<
+        "Voice " << voiceNumber <<
+        " in staff \"" << getStaffName () << "\"" <<
+        " has staff relative number " <<
+        result->getRegularVoiceStaffSequentialNumber () <<
+        endl;
     }
-  } // for
+#endif
+  }
 
   return result;
 }
@@ -26408,7 +26748,7 @@ void msrStaff::addAVoiceToStaffIfItHasNone (
 {
   if (fStaffAllVoicesMap.size () == 0) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "Staff \"" <<
         getStaffName () <<
@@ -26482,7 +26822,7 @@ void msrStaff::registerVoiceInStaff (
 
   // register voice in this staff
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Registering voice \"" << voice->getVoiceName () <<
       "\" as relative voice " <<
@@ -26508,7 +26848,7 @@ void msrStaff::registerVoiceInStaff (
         
         // register the voice by its number
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceVoices) {
+        if (gTraceFlags [kTraceVoicesFlag]) {
           gLogIOstream <<
             "Registering regular voice '" << voiceNumber <<
             "' " << voice->getVoiceName () <<
@@ -26538,7 +26878,7 @@ void msrStaff::padUpToMeasureLengthInStaff (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Padding up to measure length '" << measureLength <<
       "' in staff \"" <<
@@ -26562,7 +26902,7 @@ void msrStaff::padUpToMeasureLengthInStaff (
 void msrStaff::appendClefToStaff (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending clef '" << clef->asString () <<
       "' to staff \"" <<
@@ -26622,7 +26962,7 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
 
   else {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceClefs || gTraceOptions->fTraceStaves) {
+    if (gTraceFlags [kTraceClefsFlag] || gTraceFlags [kTraceStavesFlag]) {
       gLogIOstream <<
         "Clef '" <<
         clef->asString () <<
@@ -26641,7 +26981,7 @@ void msrStaff::appendClefToStaff (S_msrClef clef)
 void msrStaff::appendKeyToStaff (S_msrKey  key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending key '" << key->asString () <<
       "' to staff \"" <<
@@ -26668,7 +27008,7 @@ void msrStaff::appendKeyToStaff (S_msrKey  key)
     else {
       if (key->isEqualTo (fStaffCurrentKey)) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceStaves) {
+        if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTraceStavesFlag]) {
           gLogIOstream <<
             "Key '" <<
             key->asString () <<
@@ -26705,7 +27045,7 @@ void msrStaff::appendKeyToStaff (S_msrKey  key)
 void msrStaff::appendTimeToStaff (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending time '" << time->asString () <<
       "' to staff \"" <<
@@ -26732,7 +27072,7 @@ void msrStaff::appendTimeToStaff (S_msrTime time)
     else {
       if (time->isEqualTo (fStaffCurrentTime)) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
+        if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceStavesFlag]) {
           gLogIOstream <<
             "Time '" <<
             time->asString () <<
@@ -26769,7 +27109,7 @@ void msrStaff::appendTimeToStaff (S_msrTime time)
 void msrStaff::appendTimeToStaffClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending time '" << time->asString () <<
       "' to staff clone \"" <<
@@ -26801,7 +27141,7 @@ void msrStaff::prepareForRepeatInStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Preparing for repeat in staff \"" <<
       getStaffName () <<
@@ -26830,7 +27170,7 @@ void msrStaff::nestContentsIntoNewRepeatInStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Nesting contents into new repeat in staff \"" <<
       getStaffName () <<
@@ -26856,7 +27196,7 @@ void msrStaff::createRepeatUponItsEndAndAppendItToStaff (
   int    repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
@@ -26888,7 +27228,7 @@ void msrStaff::createRegularRepeatUponItsFirstEndingInStaff (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
@@ -26919,7 +27259,7 @@ void msrStaff::createEnclosingRepeatUponItsFirstEndingInStaff (
   int repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating and appending a repeat to staff \"" <<
       getStaffName () <<
@@ -26952,7 +27292,7 @@ void msrStaff::appendRepeatEndingToStaff (
             repeatEndingKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending a repeat ending to staff \"" <<
       getStaffName () <<
@@ -26985,7 +27325,7 @@ void msrStaff::createMeasuresRepeatFromItsFirstMeasuresInStaff (
   int measuresRepeatSlashes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a measure repeat from it's first measure in staff \"" <<
       getStaffName () <<
@@ -27011,7 +27351,7 @@ void msrStaff::appendPendingMeasuresRepeatToStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending the pending measure repeat to staff \"" <<
       getStaffName () <<
@@ -27036,7 +27376,7 @@ void msrStaff::createMultipleRestInStaff (
   int multipleRestMeasuresNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating a multiple rest in staff \"" <<
       getStaffName () <<
@@ -27064,7 +27404,7 @@ void msrStaff::appendPendingMultipleRestToStaff (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending the pending multiple rest to staff \"" <<
       getStaffName () <<
@@ -27089,7 +27429,7 @@ void msrStaff::appendMultipleRestCloneToStaff (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
@@ -27116,7 +27456,7 @@ void msrStaff::appendRepeatCloneToStaff (
   S_msrRepeat repeatCLone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending repeat clone to staff \"" <<
       getStaffName () <<
@@ -27140,7 +27480,7 @@ void msrStaff::appendRepeatEndingCloneToStaff (
   S_msrRepeatEnding repeatEndingClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending a repeat ending clone to staff \"" <<
       getStaffName () <<
@@ -27168,7 +27508,7 @@ void msrStaff::appendRepeatEndingCloneToStaff (
 void msrStaff::appendBarlineToStaff (S_msrBarline barline)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Appending barline '" << barline->asString () <<
       "' to staff " <<
@@ -27196,7 +27536,7 @@ void msrStaff::appendTransposeToStaff (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Setting transpose '" <<
       transpose->asString () <<
@@ -27218,7 +27558,7 @@ void msrStaff::appendTransposeToStaff (
   else {
     if (transpose->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+      if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
         gLogIOstream <<
           "Transpose '" <<
           transpose->asString () <<
@@ -27247,7 +27587,7 @@ void msrStaff::appendPartNameDisplayToStaff (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Setting part name display '" <<
       partNameDisplay->asString () <<
@@ -27270,7 +27610,7 @@ void msrStaff::appendPartNameDisplayToStaff (
   else {
     if (partNameDisplay->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+      if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
         gLogIOstream <<
           "Transpose '" <<
           partNameDisplay->asString () <<
@@ -27300,7 +27640,7 @@ void msrStaff::appendPartAbbreviationDisplayToStaff (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Setting part abbreviation display '" <<
       partAbbreviationDisplay->asString () <<
@@ -27323,7 +27663,7 @@ void msrStaff::appendPartAbbreviationDisplayToStaff (
   else {
     if (partAbbreviationDisplay->isEqualTo (fStaffCurrentTranspose)) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceStaves) {
+      if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTraceStavesFlag]) {
         gLogIOstream <<
           "Transpose '" <<
           transpose->asString () <<
@@ -27353,7 +27693,7 @@ void msrStaff::appendStaffDetailsToStaff (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Appending staff details '" <<
       staffDetails->asShortString () <<
@@ -27383,7 +27723,7 @@ void msrStaff::appendStaffDetailsToStaff (
   } // switch
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Setting staff kind to '" <<
       staffKindAsString (fStaffKind) <<
@@ -27484,13 +27824,13 @@ void msrStaff::appendHarpPedalsTuningToStaff (
 void msrStaff::finalizeCurrentMeasureInStaff (
   int inputLineNumber)
 {
+#ifdef TRACE_OPTIONS
   rational
     partMeasureLengthHighTide =
       fStaffPartUplink->
         getPartMeasureLengthHighTide ();
       
-#ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Finalizing current measure in staff \"" <<
       getStaffName () <<
@@ -27606,7 +27946,7 @@ bool msrStaff::compareVoicesToHaveHarmoniesAboveCorrespondingVoice (
 void msrStaff::finalizeStaff (int inputLineNumber)
 {  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     gLogIOstream <<
       "Finalizing staff \"" <<
       getStaffName () << "\"" <<
@@ -27619,7 +27959,7 @@ void msrStaff::finalizeStaff (int inputLineNumber)
   
   // finalize the voices
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     gLogIOstream <<
       "Finalizing the voices in staff \"" <<
       getStaffName () << "\"" <<
@@ -27645,55 +27985,65 @@ void msrStaff::finalizeStaff (int inputLineNumber)
 
 void msrStaff::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaff::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrStaff>*
     p =
-      dynamic_cast<visitor<S_msrStaff>*> (v)) {
+      v->cast<visitor<S_msrStaff> > (msrVisitorKey<S_msrStaff> ())) {
         S_msrStaff elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaff::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStaff::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaff::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStaff>*
     p =
-      dynamic_cast<visitor<S_msrStaff>*> (v)) {
+      v->cast<visitor<S_msrStaff> > (msrVisitorKey<S_msrStaff> ())) {
         S_msrStaff elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaff::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrStaff::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaff::browseData ()" <<
       endl;
   }
+#endif
 
   /*
     fPartCurrentClef, fPartCurrentKey and fPartCurrentTime are used
@@ -27743,11 +28093,13 @@ void msrStaff::browseData (basevisitor* v)
     } // for
   }
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrStaff::browseData ()" <<
       endl;
   }
+#endif
 }
 
 string msrStaff::staffKindAsString (
@@ -28107,7 +28459,7 @@ msrVoiceStaffChange::~msrVoiceStaffChange ()
 S_msrVoiceStaffChange msrVoiceStaffChange::createStaffChangeNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceFlags [kTraceStaffTuningFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of staff change '" <<
       asString () <<
@@ -28127,44 +28479,52 @@ S_msrVoiceStaffChange msrVoiceStaffChange::createStaffChangeNewbornClone ()
 
 void msrVoiceStaffChange::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVoiceStaffChange::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrVoiceStaffChange>*
     p =
-      dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
+      v->cast<visitor<S_msrVoiceStaffChange> > (msrVisitorKey<S_msrVoiceStaffChange> ())) {
         S_msrVoiceStaffChange elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVoiceStaffChange::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrVoiceStaffChange::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVoiceStaffChange::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrVoiceStaffChange>*
     p =
-      dynamic_cast<visitor<S_msrVoiceStaffChange>*> (v)) {
+      v->cast<visitor<S_msrVoiceStaffChange> > (msrVisitorKey<S_msrVoiceStaffChange> ())) {
         S_msrVoiceStaffChange elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVoiceStaffChange::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -28199,7 +28559,7 @@ ostream& operator<< (ostream& os, const S_msrVoiceStaffChange& elt)
 }
 
 //______________________________________________________________________________ 
-int msrPart::gPartsCounter = 0;
+thread_local int msrPart::gPartsCounter = 0;
 
 S_msrPart msrPart::create (
   int            inputLineNumber,
@@ -28247,7 +28607,7 @@ msrPart::msrPart (
 void msrPart::initializePart ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Creating part \"" << getPartCombinedName () << "\"" <<
       endl;
@@ -28284,7 +28644,7 @@ msrPart::~msrPart ()
 S_msrPart msrPart::createPartNewbornClone (S_msrPartGroup partGroupClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of part " <<
       getPartCombinedName () <<
@@ -28341,13 +28701,13 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
     // create the part figured bass staff
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceParts
+      gTraceFlags [kTracePartsFlag]
         ||
-      gTraceOptions->fTraceFiguredBass
+      gTraceFlags [kTraceFiguredBassFlag]
         ||
-      gTraceOptions->fTraceStaves
+      gTraceFlags [kTraceStavesFlag]
         ||
-      gTraceOptions->fTraceVoices) {
+      gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "Creating the figured bass staff" <<
         " with number " << K_PART_FIGURED_BASS_STAFF_NUMBER <<
@@ -28368,7 +28728,7 @@ void msrPart::createPartFiguredBassStaffAndVoiceIfNotYetDone (
       
     // create the part figured bass voice  
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceVoicesFlag]) {
       gLogIOstream <<
         "Creating figured bass voice " <<
         " number " << K_PART_FIGURED_BASS_VOICE_NUMBER <<
@@ -28436,7 +28796,7 @@ void msrPart::setPartMeasureLengthHighTide (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceDivisionsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting measure length high tide for part \"" <<
       getPartCombinedName () <<
@@ -28455,7 +28815,7 @@ void msrPart::updatePartMeasureLengthHighTide (
 {
   if (measureLength > fPartMeasureLengthHighTide) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDivisions || gTraceOptions->fTraceMeasures) {
+    if (gTraceFlags [kTraceDivisionsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
       gLogIOstream <<
         "Updating measure length high tide for part \"" <<
         getPartCombinedName () <<
@@ -28474,7 +28834,7 @@ void msrPart::padUpToMeasureLengthInPart (
   rational measureLength)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTracePartsFlag] || gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Padding up to measure length '" << measureLength <<
       "' in part \"" <<
@@ -28512,7 +28872,7 @@ void msrPart::setPartMsrName (string partMsrName)
     fPartMsrName = (*it).second;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceParts) {
+    if (gTraceFlags [kTracePartsFlag]) {
       gLogIOstream <<
         "Setting part name of " << getPartCombinedName () <<
         " to \"" << fPartMsrName << "\"" <<
@@ -28525,7 +28885,7 @@ void msrPart::setPartMsrName (string partMsrName)
     fPartMsrName = partMsrName;
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceParts) {
+    if (gTraceFlags [kTracePartsFlag]) {
       gLogIOstream <<
         "Keeping partID \"" << partMsrName <<
         "\" as part name  for " << getPartCombinedName () <<
@@ -28570,7 +28930,7 @@ void msrPart::createMeasureAndAppendItToPart (
          measureImplicitKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Creating and appending measure '" <<
       measureNumber <<
@@ -28610,7 +28970,7 @@ void msrPart::setNextMeasureNumberInPart (
   string nextMeasureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Setting next measure number to '" <<
       nextMeasureNumber <<
@@ -28646,7 +29006,7 @@ void msrPart::complementPartVoicesUpToMeasure (
   string measureNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures) {
+  if (gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Complement part voices up to measure number " << measureNumber <<
       ", line " << inputLineNumber <<
@@ -28677,7 +29037,7 @@ void msrPart::appendStaffDetailsToPart (
   S_msrStaffDetails staffDetails)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending staff details\"" <<
       staffDetails->asShortString () <<
@@ -28706,7 +29066,7 @@ void msrPart::appendStaffDetailsToPart (
 void msrPart::appendClefToPart (S_msrClef clef)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTraceClefs) {
+  if (gTraceFlags [kTracePartsFlag] || gTraceFlags [kTraceClefsFlag]) {
     gLogIOstream <<
       "Appending clef '" <<
       clef->asString () <<
@@ -28733,7 +29093,7 @@ void msrPart::appendClefToPart (S_msrClef clef)
 void msrPart::appendKeyToPart  (S_msrKey  key)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceKeys || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceKeysFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending key '" <<
       key->asString () <<
@@ -28766,7 +29126,7 @@ void msrPart::appendKeyToPart  (S_msrKey  key)
 void msrPart::appendTimeToPart (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending time '" <<
       time->asString () <<
@@ -28799,7 +29159,7 @@ void msrPart::appendTimeToPart (S_msrTime time)
 void msrPart::appendTimeToPartClone (S_msrTime time)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceTimesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending time '" <<
       time->asString () <<
@@ -28832,7 +29192,7 @@ void msrPart::appendTransposeToPart (
   S_msrTranspose transpose)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending transpose \"" <<
       transpose->asString () <<
@@ -28861,7 +29221,7 @@ void msrPart::appendPartNameDisplayToPart (
   S_msrPartNameDisplay partNameDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending part name display \"" <<
       partNameDisplay->asString () <<
@@ -28890,7 +29250,7 @@ void msrPart::appendPartAbbreviationDisplayToPart (
   S_msrPartAbbreviationDisplay partAbbreviationDisplay)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceTranspositionsFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending part abbreviation display \"" <<
       partAbbreviationDisplay->asString () <<
@@ -28919,7 +29279,7 @@ void msrPart::prepareForRepeatInPart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Preparing for repeat in part " <<
       getPartCombinedName () <<
@@ -28961,7 +29321,7 @@ void msrPart::createRepeatUponItsEndAndAppendItToPart (
   int    repeatTimes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Creating and appending a repeat to part \"" <<
       getPartCombinedName () <<
@@ -29027,7 +29387,7 @@ void msrPart::appendRepeatEndingToPart (
             repeatEndingKind)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     gLogIOstream <<
       "Appending a repeat ending to part \"" <<
       getPartCombinedName () <<
@@ -29143,7 +29503,7 @@ void msrPart::createMultipleRestInPart (
   int multipleRestMeasuresNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Creating a multiple rest in part " <<
       getPartCombinedName () <<
@@ -29170,7 +29530,7 @@ void msrPart::appendPendingMultipleRestToPart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceRepeatsFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending the pending multiple rest to part " <<
       getPartCombinedName () <<
@@ -29194,7 +29554,7 @@ void msrPart::appendMultipleRestCloneToPart (
   S_msrMultipleRest multipleRest)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending multiple rest '" <<
       multipleRest->asString () <<
@@ -29250,7 +29610,7 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Adding " <<
       msrStaff::staffKindAsString (staffKind) <<
@@ -29302,7 +29662,7 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
 void msrPart::addStaffToPartCloneByItsNumber (S_msrStaff staff)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceStavesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Adding staff \"" << staff->getStaffName () <<
       "\" to part clone " << getPartCombinedName () <<
@@ -29319,8 +29679,12 @@ S_msrStaff msrPart::fetchStaffFromPart (
 {
   S_msrStaff result;
   
-  if (fPartStavesMap.count (staffNumber)) {
-    result = fPartStavesMap [staffNumber];
+  map<int, S_msrStaff>::const_iterator
+    i =
+      fPartStavesMap.find (staffNumber);
+
+  if (i != fPartStavesMap.end ()) {
+    result = (*i).second;
   }
 
   return result;
@@ -29348,7 +29712,7 @@ void msrPart::appendFiguredBassToPart (
     
       // append the figured bass to the part figured bass voice
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceParts) {
+      if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTracePartsFlag]) {
         gLogIOstream <<
           "Appending figured bass '" <<
           figuredBass->asString () <<
@@ -29408,7 +29772,7 @@ void msrPart::appendFiguredBassToPartClone (
     
       // append the figured bass to the part figured bass voice
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceFiguredBass || gTraceOptions->fTraceParts) {
+      if (gTraceFlags [kTraceFiguredBassFlag] || gTraceFlags [kTracePartsFlag]) {
         gLogIOstream <<
           "Appending figured bass '" <<
           figuredBass->asString () <<
@@ -29450,7 +29814,7 @@ void msrPart::appendScordaturaToPart (
   S_msrScordatura scordatura)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending scordatura '" <<
       scordatura->asString () <<
@@ -29475,7 +29839,7 @@ void msrPart::appendAccordionRegistrationToPart (
     accordionRegistration)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending accordion registration '" <<
       accordionRegistration->asString () <<
@@ -29500,7 +29864,7 @@ void msrPart::appendHarpPedalsTuningToPart (
     harpPedalsTuning)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePasses || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePassesFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Appending harp pedals tuning '" <<
       harpPedalsTuning->asString () <<
@@ -29527,11 +29891,11 @@ void msrPart:: handleBackup (
 {
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceParts
+    gTraceFlags [kTracePartsFlag]
       ||
-    gTraceOptions->fTraceDivisions
+    gTraceFlags [kTraceDivisionsFlag]
       ||
-    gTraceOptions->fTraceMeasures) {
+    gTraceFlags [kTraceMeasuresFlag]) {
     gLogIOstream <<
       "Handling backup, divisions = '" <<
       divisions <<
@@ -29569,6 +29933,7 @@ void msrPart::addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded (
   int inputLineNumber =
     skipGraceNotesGroup->getInputLineNumber ();
 
+#ifdef TRACE_OPTIONS
   rational
     graceNotesGroupOriginVoiceMeasureLength =
       graceNotesGroupOriginVoice->
@@ -29576,13 +29941,12 @@ void msrPart::addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded (
           getSegmentMeasuresList ().back ()->
             getMeasureLength ();
         
-#ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceMeasures
+    gTraceFlags [kTraceMeasuresFlag]
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceFlags [kTraceGraceNotesFlag]
       ||
-    gTraceOptions->fTraceParts
+    gTraceFlags [kTracePartsFlag]
     ) {
     gLogIOstream <<
       "addSkipGraceNotesGroupBeforeAheadOfVoicesClonesIfNeeded () in " <<
@@ -29638,7 +30002,7 @@ void msrPart::finalizeCurrentMeasureInPart (
   int    inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Finalizing current measure in part " <<
       getPartCombinedName () <<
@@ -29715,7 +30079,7 @@ void msrPart::finalizePart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Finalizing part " <<
       getPartCombinedName () <<
@@ -29762,7 +30126,7 @@ void msrPart::finalizePartClone (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     gLogIOstream <<
       "Finalizing part clone " <<
       getPartCombinedName () <<
@@ -29777,55 +30141,65 @@ void msrPart::finalizePartClone (
 
 void msrPart::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPart::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPart>*
     p =
-      dynamic_cast<visitor<S_msrPart>*> (v)) {
+      v->cast<visitor<S_msrPart> > (msrVisitorKey<S_msrPart> ())) {
         S_msrPart elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPart::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPart::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPart::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPart>*
     p =
-      dynamic_cast<visitor<S_msrPart>*> (v)) {
+      v->cast<visitor<S_msrPart> > (msrVisitorKey<S_msrPart> ())) {
         S_msrPart elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPart::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrPart::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPart::browseData ()" <<
       endl;
   }
+#endif
 
   // browse all non figured bass staves
   for (
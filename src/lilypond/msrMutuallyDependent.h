@@ -13,6 +13,8 @@
 #ifndef ___msrMutuallyDependent___
 #define ___msrMutuallyDependent___
 
+#include <memory>
+
 #include "typedefs.h"
 #include "tree_browser.h"
 #include "exports.h"
@@ -1498,7 +1500,8 @@ class msrSegment : public msrElement
     S_msrVoice            fSegmentVoiceUplink;
 
     // counter
-    static int            gSegmentsCounter;
+    static thread_local int
+                          gSegmentsCounter;
 
     // absolute number
     int                   fSegmentAbsoluteNumber;
@@ -3187,7 +3190,7 @@ class msrNote : public msrElement
     // -------------------------------
 
     list<S_msrSyllable>   getNoteSyllables () const
-                              { return fNoteSyllables; }              
+                              { return getNoteAttachments ().fNoteSyllables; }              
 
     // elements attached to the note
     // -------------------------------
@@ -3201,57 +3204,57 @@ class msrNote : public msrElement
     // beams
     const list<S_msrBeam>&
                           getNoteBeams () const
-                              { return fNoteBeams; }
+                              { return getNoteAttachments ().fNoteBeams; }
 
     // articulations
     const list<S_msrArticulation>&
                           getNoteArticulations () const
-                              { return fNoteArticulations; }
+                              { return getNoteAttachments ().fNoteArticulations; }
                       
     list<S_msrArticulation>&
                           getNoteArticulationsToModify ()
-                              { return fNoteArticulations; }
+                              { return getNoteAttachmentsToModify ().fNoteArticulations; }
 
     // spanners
     const list<S_msrSpanner>&
                           getNoteSpanners () const
-                              { return fNoteSpanners; }
+                              { return getNoteAttachments ().fNoteSpanners; }
                       
     list<S_msrSpanner>&
                           getNoteSpannersToModify ()
-                              { return fNoteSpanners; }
+                              { return getNoteAttachmentsToModify ().fNoteSpanners; }
 
     // technicals
     const list<S_msrTechnical>&
                           getNoteTechnicals () const
-                              { return fNoteTechnicals; }
+                              { return getNoteAttachments ().fNoteTechnicals; }
                               
     const list<S_msrTechnicalWithInteger>&
                           getNoteTechnicalWithIntegers () const
-                              { return fNoteTechnicalWithIntegers; }
+                              { return getNoteAttachments ().fNoteTechnicalWithIntegers; }
                               
     const list<S_msrTechnicalWithFloat>&
                           getNoteTechnicalWithFloats () const
-                              { return fNoteTechnicalWithFloats; }
+                              { return getNoteAttachments ().fNoteTechnicalWithFloats; }
                               
     const list<S_msrTechnicalWithString>&
                           getNoteTechnicalWithStrings () const
-                              { return fNoteTechnicalWithStrings; }
+                              { return getNoteAttachments ().fNoteTechnicalWithStrings; }
                               
     // ornaments
     const list<S_msrOrnament>&
                           getNoteOrnaments () const
-                              { return fNoteOrnaments; }
+                              { return getNoteAttachments ().fNoteOrnaments; }
         
     // glissandos
     const list<S_msrGlissando>&
                           getNoteGlissandos () const
-                              { return fNoteGlissandos; }
+                              { return getNoteAttachments ().fNoteGlissandos; }
         
     // slides
     const list<S_msrSlide>&
                           getNoteSlides () const
-                              { return fNoteSlides; }
+                              { return getNoteAttachments ().fNoteSlides; }
         
     // grace notes
     void                  setNoteGraceNotesGroupBefore (
@@ -3292,67 +3295,67 @@ class msrNote : public msrElement
     // dynamics
     const list<S_msrDynamics>&
                           getNoteDynamics () const
-                              { return fNoteDynamics; }
+                              { return getNoteAttachments ().fNoteDynamics; }
     const list<S_msrOtherDynamics>&
                           getNoteOtherDynamics () const
-                              { return fNoteOtherDynamics; }
+                              { return getNoteAttachments ().fNoteOtherDynamics; }
         
     // words
     const list<S_msrWords>&
                           getNoteWords () const
-                              { return fNoteWords; }
+                              { return getNoteAttachments ().fNoteWords; }
                       
     list<S_msrWords>&     getNoteWordsToModify ()
-                              { return fNoteWords; }
+                              { return getNoteAttachmentsToModify ().fNoteWords; }
                       
     // slashes
     const list<S_msrSlash>&
                           getNoteSlashes () const
-                              { return fNoteSlashes; }
+                              { return getNoteAttachments ().fNoteSlashes; }
 
     // wedges
     const list<S_msrWedge>&
                           getNoteWedges () const
-                              { return fNoteWedges; }
+                              { return getNoteAttachments ().fNoteWedges; }
 
     list<S_msrWedge>&
                           getNoteWedgesToModify ()
-                              { return fNoteWedges; }
+                              { return getNoteAttachmentsToModify ().fNoteWedges; }
 
     // eyeglasses
     const list<S_msrEyeGlasses>&
                           getNoteEyeGlasses () const
-                              { return fNoteEyeGlasses; }
+                              { return getNoteAttachments ().fNoteEyeGlasses; }
     
     // damps
     const list<S_msrDamp>&
                           getNoteDamps () const
-                              { return fNoteDamps; };
+                              { return getNoteAttachments ().fNoteDamps; };
     
     // damp alls
     const list<S_msrDampAll>&
                           getNoteDampAlls () const
-                              { return fNoteDampAlls; }
+                              { return getNoteAttachments ().fNoteDampAlls; }
     
     // scordaturas
     const list<S_msrScordatura>&
                           getNoteScordaturas () const
-                              { return fNoteScordaturas; }
+                              { return getNoteAttachments ().fNoteScordaturas; }
 
     // slurs
     const list<S_msrSlur>&
                           getNoteSlurs () const
-                              { return fNoteSlurs; }
+                              { return getNoteAttachments ().fNoteSlurs; }
 
     // ligatures
     const list<S_msrLigature>&
                           getNoteLigatures () const
-                              { return fNoteLigatures; }
+                              { return getNoteAttachments ().fNoteLigatures; }
 
     // pedals
     const list<S_msrPedal>&
                           getNotePedals () const
-                              { return fNotePedals; }
+                              { return getNoteAttachments ().fNotePedals; }
 
     // note measure information
     // -------------------------------
@@ -3569,6 +3572,138 @@ class msrNote : public msrElement
       
     virtual void          print (ostream& os);
 
+  private:
+
+    // attachments
+    // ------------------------------------------------------
+
+    // the lists of elements attached to the note,
+    // allocated on demand since most notes have none
+    struct msrNoteAttachments {
+      // note lyrics
+      // ------------------------------------------------------
+
+      list<S_msrSyllable>   fNoteSyllables;
+
+      // beams
+      // ------------------------------------------------------
+
+      list<S_msrBeam>       fNoteBeams;
+
+      // articulations
+      // ------------------------------------------------------
+
+      list<S_msrArticulation>
+                            fNoteArticulations;
+
+      // spanners
+      // ------------------------------------------------------
+
+      list<S_msrSpanner>    fNoteSpanners;
+
+      // technicals
+      // ------------------------------------------------------
+
+      list<S_msrTechnical>  fNoteTechnicals;
+
+      list<S_msrTechnicalWithInteger>
+                            fNoteTechnicalWithIntegers;
+
+      list<S_msrTechnicalWithFloat>
+                            fNoteTechnicalWithFloats;
+
+      list<S_msrTechnicalWithString>
+                            fNoteTechnicalWithStrings;
+
+      // ornaments
+      // ------------------------------------------------------
+
+      list<S_msrOrnament>   fNoteOrnaments;
+
+      // glissandos
+      // ------------------------------------------------------
+
+      list<S_msrGlissando>  fNoteGlissandos;
+
+      // slides
+      // ------------------------------------------------------
+
+      list<S_msrSlide>      fNoteSlides;
+
+      // dynamics
+      // ------------------------------------------------------
+
+      list<S_msrDynamics>   fNoteDynamics;
+      list<S_msrOtherDynamics>
+                            fNoteOtherDynamics;
+
+      // slashes
+      // ------------------------------------------------------
+
+      list<S_msrSlash>      fNoteSlashes;
+
+      // wedges
+      // ------------------------------------------------------
+
+      list<S_msrWedge>      fNoteWedges;
+
+      // eyeglasses
+      // ------------------------------------------------------
+
+      list<S_msrEyeGlasses> fNoteEyeGlasses;
+
+      // damps
+      // ------------------------------------------------------
+
+      list<S_msrDamp>       fNoteDamps;
+
+      // damp alls
+      // ------------------------------------------------------
+
+      list<S_msrDampAll>    fNoteDampAlls;
+
+      // scordaturas
+      // ------------------------------------------------------
+
+      list<S_msrScordatura> fNoteScordaturas;
+
+      // words
+      // ------------------------------------------------------
+
+      list<S_msrWords>      fNoteWords;
+
+      // slurs
+      // ------------------------------------------------------
+
+      list<S_msrSlur>       fNoteSlurs;
+
+      // ligatures
+      // ------------------------------------------------------
+
+      list<S_msrLigature>   fNoteLigatures;
+
+      // pedals
+      // ------------------------------------------------------
+
+      list<S_msrPedal>      fNotePedals;
+    };
+
+    // the attachments, or an empty block if there are none
+    const msrNoteAttachments&
+                          getNoteAttachments () const
+                              {
+                                return
+                                  fNoteAttachments
+                                    ? *fNoteAttachments
+                                    : gNoNoteAttachments;
+                              }
+
+    // the attachments, created if need be
+    msrNoteAttachments&   getNoteAttachmentsToModify ();
+
+    static const msrNoteAttachments
+                          gNoNoteAttachments;
+
   private:
 
     // fields
@@ -3663,61 +3798,18 @@ class msrNote : public msrElement
     bool                  fNoteBelongsToAMultipleRest; // JMI
     int                   fNoteMultipleRestSequenceNumber; // JMI
 
-    // note lyrics
+    // attachments
     // ------------------------------------------------------
 
-    list<S_msrSyllable>   fNoteSyllables;
-    
+    // owned by the note, which is not copyable
+    std::unique_ptr<msrNoteAttachments>
+                          fNoteAttachments;
+
     // stem
     // ------------------------------------------------------
 
     S_msrStem             fNoteStem;
 
-    // beams
-    // ------------------------------------------------------
-
-    list<S_msrBeam>       fNoteBeams;
-                                      
-    // articulations
-    // ------------------------------------------------------
-
-    list<S_msrArticulation>
-                          fNoteArticulations;
-
-    // spanners
-    // ------------------------------------------------------
-
-    list<S_msrSpanner>    fNoteSpanners;
-
-    // technicals
-    // ------------------------------------------------------
-
-    list<S_msrTechnical>  fNoteTechnicals;
-    
-    list<S_msrTechnicalWithInteger>
-                          fNoteTechnicalWithIntegers;
-                          
-    list<S_msrTechnicalWithFloat>
-                          fNoteTechnicalWithFloats;
-                          
-    list<S_msrTechnicalWithString>
-                          fNoteTechnicalWithStrings;
-
-    // ornaments
-    // ------------------------------------------------------
-
-    list<S_msrOrnament>   fNoteOrnaments;
-    
-    // glissandos
-    // ------------------------------------------------------
-
-    list<S_msrGlissando>  fNoteGlissandos;
-    
-    // slides
-    // ------------------------------------------------------
-
-    list<S_msrSlide>      fNoteSlides;
-    
     // grace notes
     // ------------------------------------------------------
 
@@ -3736,63 +3828,6 @@ class msrNote : public msrElement
 
     S_msrTie              fNoteTie;
     
-    // dynamics
-    // ------------------------------------------------------
-
-    list<S_msrDynamics>   fNoteDynamics;
-    list<S_msrOtherDynamics>
-                          fNoteOtherDynamics;
-                          
-    // slashes
-    // ------------------------------------------------------
-
-    list<S_msrSlash>      fNoteSlashes;
-
-    // wedges
-    // ------------------------------------------------------
-
-    list<S_msrWedge>      fNoteWedges;
-
-    // eyeglasses
-    // ------------------------------------------------------
-
-    list<S_msrEyeGlasses> fNoteEyeGlasses;
-    
-    // damps
-    // ------------------------------------------------------
-
-    list<S_msrDamp>       fNoteDamps;
-    
-    // damp alls
-    // ------------------------------------------------------
-
-    list<S_msrDampAll>    fNoteDampAlls;
-    
-    // scordaturas
-    // ------------------------------------------------------
-
-    list<S_msrScordatura> fNoteScordaturas;
-
-    // words
-    // ------------------------------------------------------
-
-    list<S_msrWords>      fNoteWords;
-
-    // slurs
-    // ------------------------------------------------------
-
-    list<S_msrSlur>       fNoteSlurs;
-
-    // ligatures
-    // ------------------------------------------------------
-
-    list<S_msrLigature>   fNoteLigatures;
-
-    // pedals
-    // ------------------------------------------------------
-
-    list<S_msrPedal>      fNotePedals;
-
     // harmony
     // ------------------------------------------------------
 
@@ -6364,7 +6399,8 @@ class msrVoice : public msrElement
 
     // counters
     
-    static int            gVoicesCounter;
+    static thread_local int
+                          gVoicesCounter;
 
     int                   fVoiceActualNotesCounter;
     int                   fVoiceRestsCounter;
@@ -6824,7 +6860,8 @@ class msrStaff : public msrElement
 
     // staff voices
     
-    static int            gStaffMaxRegularVoices;
+    static thread_local int
+                          gStaffMaxRegularVoices;
 
     // the dictionary of all the voices in the staff
     map<int, S_msrVoice>  fStaffAllVoicesMap;
@@ -6835,6 +6872,13 @@ class msrStaff : public msrElement
     int                   fStaffRegularVoicesCounter;
     map<int, S_msrVoice>  fStaffRegularVoicesMap;
 
+    // the regular voices by voice number, kept in sync with
+    // fStaffRegularVoicesMap by registerVoiceInRegularVoicesMap (),
+    // for fetchVoiceFromStaffByItsNumber () to be a single lookup:
+    // when several regular voices have the same number,
+    // the one with the lowest sequential number is registered
+    map<int, S_msrVoice>  fStaffRegularVoicesByNumberMap;
+
     // we need to sort the voices by increasing voice numbers,
     // but with harmony voices right before the corresponding regular voices
     list<S_msrVoice>      fStaffAllVoicesList;
@@ -7446,7 +7490,8 @@ class msrPart : public msrElement
 
     // counter
     
-    static int            gPartsCounter;
+    static thread_local int
+                          gPartsCounter;
 };
 typedef SMARTP<msrPart> S_msrPart;
 EXP ostream& operator<< (ostream& os, const S_msrPart& elt);
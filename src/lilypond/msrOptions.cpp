@@ -17,6 +17,7 @@
 #include <regex>
 
 #include "utilities.h"
+#include "messagesHandling.h"
 
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
@@ -254,9 +255,9 @@ ostream& operator<< (ostream& os, const S_optionsMsrPitchesLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_msrOptions gMsrOptions;
-S_msrOptions gMsrOptionsUserChoices;
-S_msrOptions gMsrOptionsWithDetailedTrace;
+thread_local S_msrOptions gMsrOptions;
+thread_local S_msrOptions gMsrOptionsUserChoices;
+thread_local S_msrOptions gMsrOptionsWithDetailedTrace;
 
 S_msrOptions msrOptions::create (
   S_optionsHandler optionsHandler)
@@ -1220,7 +1221,7 @@ void msrOptions::handleOptionsItemValue (
         partRenameItem->
           getOptionsSubGroupUplink ());
           
-      exit (4);
+      throw msrException (4);
     }
 
     string
@@ -1255,7 +1256,7 @@ void msrOptions::handleOptionsItemValue (
         "in the '--partName' option";
         
       optionError (s.str ());
-      exit (4);
+      throw msrException (4);
     }
     
     else {
@@ -1313,7 +1314,7 @@ void msrOptions::handleOptionsItemValue (
       optionError (s.str ());
       
  //     exit (4); // JMI
-      abort ();
+      throw msrException (msrException::kAbort);
     }
   
     pitchesLanguageKindItem->
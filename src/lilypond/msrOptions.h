@@ -319,9 +319,9 @@ class msrOptions : public optionsGroup
 typedef SMARTP<msrOptions> S_msrOptions;
 EXP ostream& operator<< (ostream& os, const S_msrOptions& elt);
 
-EXP extern S_msrOptions gMsrOptions;
-EXP extern S_msrOptions gMsrOptionsUserChoices;
-EXP extern S_msrOptions gMsrOptionsWithDetailedTrace;
+extern thread_local S_msrOptions gMsrOptions;
+extern thread_local S_msrOptions gMsrOptionsUserChoices;
+extern thread_local S_msrOptions gMsrOptionsWithDetailedTrace;
 
 //______________________________________________________________________________
 void initializeMsrOptionsHandling (
@@ -19,6 +19,11 @@
 
 #include "msrOtherElements.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -47,44 +52,52 @@ msrSegno::~msrSegno ()
 
 void msrSegno::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSegno::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSegno>*
     p =
-      dynamic_cast<visitor<S_msrSegno>*> (v)) {
+      v->cast<visitor<S_msrSegno> > (msrVisitorKey<S_msrSegno> ())) {
         S_msrSegno elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSegno::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSegno::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSegno::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSegno>*
     p =
-      dynamic_cast<visitor<S_msrSegno>*> (v)) {
+      v->cast<visitor<S_msrSegno> > (msrVisitorKey<S_msrSegno> ())) {
         S_msrSegno elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSegno::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -127,44 +140,52 @@ msrCoda::~msrCoda ()
 
 void msrCoda::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCoda::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrCoda>*
     p =
-      dynamic_cast<visitor<S_msrCoda>*> (v)) {
+      v->cast<visitor<S_msrCoda> > (msrVisitorKey<S_msrCoda> ())) {
         S_msrCoda elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCoda::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrCoda::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrCoda::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrCoda>*
     p =
-      dynamic_cast<visitor<S_msrCoda>*> (v)) {
+      v->cast<visitor<S_msrCoda> > (msrVisitorKey<S_msrCoda> ())) {
         S_msrCoda elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrCoda::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -207,44 +228,52 @@ msrEyeGlasses::~msrEyeGlasses ()
 
 void msrEyeGlasses::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrEyeGlasses::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrEyeGlasses>*
     p =
-      dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
+      v->cast<visitor<S_msrEyeGlasses> > (msrVisitorKey<S_msrEyeGlasses> ())) {
         S_msrEyeGlasses elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrEyeGlasses::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrEyeGlasses::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrEyeGlasses::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrEyeGlasses>*
     p =
-      dynamic_cast<visitor<S_msrEyeGlasses>*> (v)) {
+      v->cast<visitor<S_msrEyeGlasses> > (msrVisitorKey<S_msrEyeGlasses> ())) {
         S_msrEyeGlasses elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrEyeGlasses::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -132,7 +132,7 @@ float msrPageGeometry::globalStaffSize () const
   float staffSize = lilyPondDefaultStaffSize * ratio;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceFlags [kTraceGeometryFlag]) {
     gLogIOstream <<
       "globalStaffSize ():" <<
       endl;
@@ -162,7 +162,7 @@ float msrPageGeometry::globalStaffSize () const
   
   if (staffSize < 1.0 || staffSize > 100.0) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGeometry) {
+    if (gTraceFlags [kTraceGeometryFlag]) {
       stringstream s;
 
       s <<
@@ -185,44 +185,52 @@ float msrPageGeometry::globalStaffSize () const
 
 void msrPageGeometry::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPageGeometry::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPageGeometry>*
     p =
-      dynamic_cast<visitor<S_msrPageGeometry>*> (v)) {
+      v->cast<visitor<S_msrPageGeometry> > (msrVisitorKey<S_msrPageGeometry> ())) {
         S_msrPageGeometry elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPageGeometry::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPageGeometry::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPageGeometry::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPageGeometry>*
     p =
-      dynamic_cast<visitor<S_msrPageGeometry>*> (v)) {
+      v->cast<visitor<S_msrPageGeometry> > (msrVisitorKey<S_msrPageGeometry> ())) {
         S_msrPageGeometry elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPageGeometry::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -158,7 +158,7 @@ msrPartGroup::msrPartGroup (
   fPartGroupBarlineKind     = partGroupBarlineKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "--------------------------------------------" <<
       endl <<
@@ -178,7 +178,7 @@ S_msrPartGroup msrPartGroup::createPartGroupNewbornClone (
   S_msrScore     scoreClone)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "--------------------------------------------" <<
       endl <<
@@ -295,7 +295,7 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
 
   // register it in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Adding part " <<
       part->getPartCombinedName () <<
@@ -309,8 +309,14 @@ S_msrPart msrPartGroup::appendPartToPartGroupByItsPartID (
   fPartGroupPartsMap [partID] = part;
   fPartGroupElements.push_back (part);
 
+  // the score's parts map has to be rebuilt
+  if (fPartGroupScoreUplink) {
+    fPartGroupScoreUplink->
+      invalidateScorePartsMap ();
+  }
+
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     gLogIOstream <<
       endl <<
       "After appendPartToPartGroupByItsID, fPartGroupPartsMap contains:" <<
@@ -364,7 +370,7 @@ void msrPartGroup::appendPartToPartGroup (S_msrPart part)
 {
   // register part in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Adding part " <<
       part->getPartCombinedName () <<
@@ -377,6 +383,12 @@ void msrPartGroup::appendPartToPartGroup (S_msrPart part)
   fPartGroupPartsMap [part->getPartID ()] = part;
   fPartGroupElements.push_back (part);
 
+  // the score's parts map has to be rebuilt
+  if (fPartGroupScoreUplink) {
+    fPartGroupScoreUplink->
+      invalidateScorePartsMap ();
+  }
+
   // set part's partgroup uplink
   part->setPartPartGroupUplink (this);
 }
@@ -387,7 +399,7 @@ void msrPartGroup::removePartFromPartGroup (
 {
   // register part in this part group
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Removing part " <<
       partToBeRemoved->getPartCombinedName () <<
@@ -421,6 +433,13 @@ void msrPartGroup::removePartFromPartGroup (
       // this is a part
       if (part == partToBeRemoved) {
         fPartGroupElements.erase (i);
+        fPartGroupPartsMap.erase (part->getPartID ());
+
+        // the score's parts map has to be rebuilt
+        if (fPartGroupScoreUplink) {
+          fPartGroupScoreUplink->
+            invalidateScorePartsMap ();
+        }
         break;
       }
     }
@@ -448,7 +467,7 @@ void msrPartGroup::prependSubPartGroupToPartGroup (
   S_msrPartGroup partGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Prepending (sub-)part group " << partGroup->getPartGroupNumber () <<
       " to part group " << getPartGroupNumber ()  << endl;
@@ -457,13 +476,19 @@ void msrPartGroup::prependSubPartGroupToPartGroup (
 
   // register it in this part group
   fPartGroupElements.push_front (partGroup);
+
+  // the score's parts map has to be rebuilt
+  if (fPartGroupScoreUplink) {
+    fPartGroupScoreUplink->
+      invalidateScorePartsMap ();
+  }
 }
 
 void msrPartGroup::appendSubPartGroupToPartGroup (
   S_msrPartGroup partGroup)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     gLogIOstream <<
       "Appending (sub-)part group " << partGroup->getPartGroupNumber () <<
       " to part group " << getPartGroupNumber ()  << endl;
@@ -472,6 +497,12 @@ void msrPartGroup::appendSubPartGroupToPartGroup (
 
   // register it in this part group
   fPartGroupElements.push_back (partGroup);
+
+  // the score's parts map has to be rebuilt
+  if (fPartGroupScoreUplink) {
+    fPartGroupScoreUplink->
+      invalidateScorePartsMap ();
+  }
 }
 
 
@@ -543,7 +574,7 @@ S_msrPart msrPartGroup::fetchPartFromPartGroupByItsPartID (
   S_msrPart result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {    
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {    
     gLogIOstream <<
       "fetchPartFromPartGroupByItsPartID(" << partID << "), fPartGroupElements contains:" <<
       endl;
@@ -570,6 +601,16 @@ S_msrPart msrPartGroup::fetchPartFromPartGroupByItsPartID (
     i      = iBegin;
   */
     
+  // the parts of this part group are registered by their ID
+  map<string, S_msrPart>::const_iterator
+    it =
+      fPartGroupPartsMap.find (partID);
+
+  if (it != fPartGroupPartsMap.end ()) {
+    return (*it).second;
+  }
+
+  // look for it in the nested part groups
   for (
     list<S_msrElement>::const_iterator i = fPartGroupElements.begin ();
     i != fPartGroupElements.end ();
@@ -601,11 +642,7 @@ S_msrPart msrPartGroup::fetchPartFromPartGroupByItsPartID (
         part =
           dynamic_cast<msrPart*>(&(*element))
       ) {
-      // this is a part
-      if (part->getPartID () == partID) {
-        result = part;
-        break;
-      }
+      // this is a part, it has been looked for above
     }
 
     else {
@@ -676,57 +713,93 @@ void msrPartGroup::collectPartGroupPartsList (
   } // for
 }
 
+void msrPartGroup::registerPartGroupPartsInMap (
+  map<string, S_msrPart>& partsMap)
+{
+  // in the order fetchPartFromPartGroupByItsPartID () looks for them:
+  // a part already registered with the same ID is kept
+  partsMap.insert (
+    fPartGroupPartsMap.begin (),
+    fPartGroupPartsMap.end ());
+
+  for (
+    list<S_msrElement>::const_iterator i = fPartGroupElements.begin ();
+    i != fPartGroupElements.end ();
+    i++) {
+    if (
+      S_msrPartGroup
+        partGroup =
+          dynamic_cast<msrPartGroup*>(&(*(*i)))
+      ) {
+      // this is a part group
+      partGroup->
+        registerPartGroupPartsInMap (
+          partsMap);
+    }
+  } // for
+}
+
 void msrPartGroup::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartGroup::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPartGroup>*
     p =
-      dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
+      v->cast<visitor<S_msrPartGroup> > (msrVisitorKey<S_msrPartGroup> ())) {
         S_msrPartGroup elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartGroup::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPartGroup::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartGroup::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPartGroup>*
     p =
-      dynamic_cast<visitor<S_msrPartGroup>*> (v)) {
+      v->cast<visitor<S_msrPartGroup> > (msrVisitorKey<S_msrPartGroup> ())) {
         S_msrPartGroup elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartGroup::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrPartGroup::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartGroup::browseData ()" <<
       endl;
   }
+#endif
   
   for (
     list<S_msrElement>::const_iterator i = fPartGroupElements.begin ();
@@ -737,11 +810,13 @@ void msrPartGroup::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrPartGroup::browseData ()" <<
       endl;
   }
+#endif
 }
 
 string msrPartGroup::partGroupImplicitKindAsString (
@@ -227,6 +227,9 @@ class msrPartGroup : public msrElement
                             int    inputLineNumber,
                             list<S_msrPart>& partsList);
 
+    void                  registerPartGroupPartsInMap (
+                            map<string, S_msrPart>& partsMap);
+
   public:
 
     // visitors
@@ -19,6 +19,11 @@
 
 #include "msrPartNamesDisplays.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -51,44 +56,52 @@ msrPartNameDisplay::~msrPartNameDisplay ()
 
 void msrPartNameDisplay::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartNameDisplay::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPartNameDisplay>*
     p =
-      dynamic_cast<visitor<S_msrPartNameDisplay>*> (v)) {
+      v->cast<visitor<S_msrPartNameDisplay> > (msrVisitorKey<S_msrPartNameDisplay> ())) {
         S_msrPartNameDisplay elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartNameDisplay::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPartNameDisplay::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartNameDisplay::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPartNameDisplay>*
     p =
-      dynamic_cast<visitor<S_msrPartNameDisplay>*> (v)) {
+      v->cast<visitor<S_msrPartNameDisplay> > (msrVisitorKey<S_msrPartNameDisplay> ())) {
         S_msrPartNameDisplay elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartNameDisplay::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -146,44 +159,52 @@ msrPartAbbreviationDisplay::~msrPartAbbreviationDisplay ()
 
 void msrPartAbbreviationDisplay::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartAbbreviationDisplay::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrPartAbbreviationDisplay>*
     p =
-      dynamic_cast<visitor<S_msrPartAbbreviationDisplay>*> (v)) {
+      v->cast<visitor<S_msrPartAbbreviationDisplay> > (msrVisitorKey<S_msrPartAbbreviationDisplay> ())) {
         S_msrPartAbbreviationDisplay elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartAbbreviationDisplay::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrPartAbbreviationDisplay::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrPartAbbreviationDisplay::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrPartAbbreviationDisplay>*
     p =
-      dynamic_cast<visitor<S_msrPartAbbreviationDisplay>*> (v)) {
+      v->cast<visitor<S_msrPartAbbreviationDisplay> > (msrVisitorKey<S_msrPartAbbreviationDisplay> ())) {
         S_msrPartAbbreviationDisplay elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrPartAbbreviationDisplay::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrRehearsals.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -62,44 +67,52 @@ msrRehearsal::~msrRehearsal ()
 
 void msrRehearsal::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRehearsal::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrRehearsal>*
     p =
-      dynamic_cast<visitor<S_msrRehearsal>*> (v)) {
+      v->cast<visitor<S_msrRehearsal> > (msrVisitorKey<S_msrRehearsal> ())) {
         S_msrRehearsal elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRehearsal::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrRehearsal::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrRehearsal::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrRehearsal>*
     p =
-      dynamic_cast<visitor<S_msrRehearsal>*> (v)) {
+      v->cast<visitor<S_msrRehearsal> > (msrVisitorKey<S_msrRehearsal> ())) {
         S_msrRehearsal elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrRehearsal::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -53,6 +53,9 @@ msrScore::msrScore (
     msrPageGeometry::create (
       inputLineNumber);
 
+  // the parts map is built on the first access
+  fScorePartsMapIsUpToDate = false;
+
   // number of measures
   fScoreNumberOfMeasures = -1;
 
@@ -79,7 +82,7 @@ msrScore::~msrScore ()
 S_msrScore msrScore::createScoreNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceScore) {
+  if (gTraceFlags [kTraceScoreFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of a score" <<
       endl;
@@ -144,12 +147,15 @@ void msrScore::addPartGroupToScore (S_msrPartGroup partGroup)
   // register it in this score
   fScorePartGroupsSet.insert (partGroup);
   fPartGroupsList.push_back (partGroup);
+
+  // the parts map has to be rebuilt
+  fScorePartsMapIsUpToDate = false;
 }
 
 void msrScore::appendCreditToScore (S_msrCredit credit)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceCredits) {
+  if (gTraceFlags [kTraceCreditsFlag]) {
     gLogIOstream <<
       "Appending credit '" <<
       credit->asString () <<
@@ -168,7 +174,7 @@ S_msrPart msrScore::fetchPartFromScoreByItsPartID (
   S_msrPart result;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     gLogIOstream <<
       "fetchPartFromScoreByItsPartID(" << partID << "), fPartGroupsList contains:" <<
       endl;
@@ -195,22 +201,29 @@ S_msrPart msrScore::fetchPartFromScoreByItsPartID (
   }
 #endif
 
-  for (
-    list<S_msrPartGroup>::const_iterator i = fPartGroupsList.begin ();
-    i != fPartGroupsList.end ();
-    i++) {
-    S_msrPart
-      part =
-        (*i)->
-          fetchPartFromPartGroupByItsPartID (
-            inputLineNumber,
-            partID);
-
-    if (part) {
-      result = part;
-      break;
-    }
-  } // for
+  if (! fScorePartsMapIsUpToDate) {
+    // register the parts in the order the part groups are looked in
+    fScorePartsMap.clear ();
+    
+    for (
+      list<S_msrPartGroup>::const_iterator i = fPartGroupsList.begin ();
+      i != fPartGroupsList.end ();
+      i++) {
+      (*i)->
+        registerPartGroupPartsInMap (
+          fScorePartsMap);
+    } // for
+
+    fScorePartsMapIsUpToDate = true;
+  }
+
+  map<string, S_msrPart>::const_iterator
+    it =
+      fScorePartsMap.find (partID);
+
+  if (it != fScorePartsMap.end ()) {
+    result = (*it).second;
+  }
 
   return result;
 }
@@ -250,55 +263,65 @@ S_msrPartGroup msrScore::fetchScorePartGroup (
 
 void msrScore::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrScore::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrScore>*
     p =
-      dynamic_cast<visitor<S_msrScore>*> (v)) {
+      v->cast<visitor<S_msrScore> > (msrVisitorKey<S_msrScore> ())) {
         S_msrScore elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrScore::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrScore::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrScore::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrScore>*
     p =
-      dynamic_cast<visitor<S_msrScore>*> (v)) {
+      v->cast<visitor<S_msrScore> > (msrVisitorKey<S_msrScore> ())) {
         S_msrScore elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrScore::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
 
 void msrScore::browseData (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrScore::browseData ()" <<
       endl;
   }
+#endif
     
   if (fIdentification) {
     // browse identification
@@ -330,11 +353,13 @@ void msrScore::browseData (basevisitor* v)
     browser.browse (*(*i));
   } // for
 
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% <== msrScore::browseData ()" <<
       endl;
   }
+#endif
 }
 
 void msrScore::print (ostream& os)
@@ -157,6 +157,9 @@ class msrScore : public msrElement
     void                  appendCreditToScore (
                             S_msrCredit credit);
                               
+    void                  invalidateScorePartsMap ()
+                              { fScorePartsMapIsUpToDate = false; }
+
     S_msrPart             fetchPartFromScoreByItsPartID (
                             int    inputLineNumber,
                             string partID);
@@ -199,6 +202,12 @@ class msrScore : public msrElement
     
     list<S_msrPartGroup>  fPartGroupsList;
 
+    // accessing parts by ID whatever the part groups nesting,
+    // rebuilt on the first access after the part groups change
+    map<string, S_msrPart>
+                          fScorePartsMap;
+    bool                  fScorePartsMapIsUpToDate;
+
     // number of measures
     
     int                   fScoreNumberOfMeasures;
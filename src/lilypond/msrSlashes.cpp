@@ -20,6 +20,11 @@
 
 #include "msrSlashes.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -61,44 +66,52 @@ msrSlash::~msrSlash ()
 
 void msrSlash::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlash::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSlash>*
     p =
-      dynamic_cast<visitor<S_msrSlash>*> (v)) {
+      v->cast<visitor<S_msrSlash> > (msrVisitorKey<S_msrSlash> ())) {
         S_msrSlash elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlash::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSlash::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlash::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSlash>*
     p =
-      dynamic_cast<visitor<S_msrSlash>*> (v)) {
+      v->cast<visitor<S_msrSlash> > (msrVisitorKey<S_msrSlash> ())) {
         S_msrSlash elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlash::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
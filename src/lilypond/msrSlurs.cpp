@@ -19,6 +19,11 @@
 
 #include "msrSlurs.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -57,44 +62,52 @@ msrSlur::~msrSlur ()
 
 void msrSlur::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlur::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSlur>*
     p =
-      dynamic_cast<visitor<S_msrSlur>*> (v)) {
+      v->cast<visitor<S_msrSlur> > (msrVisitorKey<S_msrSlur> ())) {
         S_msrSlur elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlur::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSlur::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSlur::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSlur>*
     p =
-      dynamic_cast<visitor<S_msrSlur>*> (v)) {
+      v->cast<visitor<S_msrSlur> > (msrVisitorKey<S_msrSlur> ())) {
         S_msrSlur elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSlur::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -67,7 +67,7 @@ msrStaffTuning::~ msrStaffTuning ()
 S_msrStaffTuning msrStaffTuning::createStaffTuningNewbornClone ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceFlags [kTraceStaffTuningFlag]) {
     gLogIOstream <<
       "Creating a newborn clone of staff tuning '" <<
       asString () <<
@@ -89,44 +89,52 @@ S_msrStaffTuning msrStaffTuning::createStaffTuningNewbornClone ()
 
 void msrStaffTuning::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaffTuning::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrStaffTuning>*
     p =
-      dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
+      v->cast<visitor<S_msrStaffTuning> > (msrVisitorKey<S_msrStaffTuning> ())) {
         S_msrStaffTuning elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaffTuning::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStaffTuning::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaffTuning::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStaffTuning>*
     p =
-      dynamic_cast<visitor<S_msrStaffTuning>*> (v)) {
+      v->cast<visitor<S_msrStaffTuning> > (msrVisitorKey<S_msrStaffTuning> ())) {
         S_msrStaffTuning elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaffTuning::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -228,44 +236,52 @@ msrStaffDetails::~msrStaffDetails ()
 
 void msrStaffDetails::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaffDetails::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrStaffDetails>*
     p =
-      dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
+      v->cast<visitor<S_msrStaffDetails> > (msrVisitorKey<S_msrStaffDetails> ())) {
         S_msrStaffDetails elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaffDetails::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStaffDetails::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStaffDetails::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStaffDetails>*
     p =
-      dynamic_cast<visitor<S_msrStaffDetails>*> (v)) {
+      v->cast<visitor<S_msrStaffDetails> > (msrVisitorKey<S_msrStaffDetails> ())) {
         S_msrStaffDetails elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStaffDetails::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrStems.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -51,44 +56,52 @@ msrStem::~msrStem ()
 
 void msrStem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStem::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrStem>*
     p =
-      dynamic_cast<visitor<S_msrStem>*> (v)) {
+      v->cast<visitor<S_msrStem> > (msrVisitorKey<S_msrStem> ())) {
         S_msrStem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStem::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrStem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrStem::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrStem>*
     p =
-      dynamic_cast<visitor<S_msrStem>*> (v)) {
+      v->cast<visitor<S_msrStem> > (msrVisitorKey<S_msrStem> ())) {
         S_msrStem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrStem::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -71,7 +71,7 @@ msrFrameNote::msrFrameNote (
   fFrameNoteBarreTypeKind = frameNoteBarreTypeKind;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating frame note '" <<
       asString () <<
@@ -123,44 +123,52 @@ string msrFrameNote::asString () const
 
 void msrFrameNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFrameNote::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrFrameNote>*
     p =
-      dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
+      v->cast<visitor<S_msrFrameNote> > (msrVisitorKey<S_msrFrameNote> ())) {
         S_msrFrameNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFrameNote::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrFrameNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFrameNote::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrFrameNote>*
     p =
-      dynamic_cast<visitor<S_msrFrameNote>*> (v)) {
+      v->cast<visitor<S_msrFrameNote> > (msrVisitorKey<S_msrFrameNote> ())) {
         S_msrFrameNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFrameNote::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -236,7 +244,7 @@ msrFrame::msrFrame (
   fFrameContainsFingerings = false;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     gLogIOstream <<
       "Creating frame '" <<
       asString () <<
@@ -355,44 +363,52 @@ string msrFrame::asString () const
 
 void msrFrame::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFrame::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrFrame>*
     p =
-      dynamic_cast<visitor<S_msrFrame>*> (v)) {
+      v->cast<visitor<S_msrFrame> > (msrVisitorKey<S_msrFrame> ())) {
         S_msrFrame elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFrame::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrFrame::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrFrame::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrFrame>*
     p =
-      dynamic_cast<visitor<S_msrFrame>*> (v)) {
+      v->cast<visitor<S_msrFrame> > (msrVisitorKey<S_msrFrame> ())) {
         S_msrFrame elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrFrame::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
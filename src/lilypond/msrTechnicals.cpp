@@ -20,6 +20,11 @@
 
 #include "msrTechnicals.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -141,44 +146,52 @@ string msrTechnical::technicalAccidentalMarkKindAsString () const
 
 void msrTechnical::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnical::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTechnical>*
     p =
-      dynamic_cast<visitor<S_msrTechnical>*> (v)) {
+      v->cast<visitor<S_msrTechnical> > (msrVisitorKey<S_msrTechnical> ())) {
         S_msrTechnical elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnical::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTechnical::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnical::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTechnical>*
     p =
-      dynamic_cast<visitor<S_msrTechnical>*> (v)) {
+      v->cast<visitor<S_msrTechnical> > (msrVisitorKey<S_msrTechnical> ())) {
         S_msrTechnical elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnical::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -271,44 +284,52 @@ string msrTechnicalWithInteger::technicalWithIntegerPlacementKindAsString () con
 
 void msrTechnicalWithInteger::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithInteger::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTechnicalWithInteger>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithInteger> > (msrVisitorKey<S_msrTechnicalWithInteger> ())) {
         S_msrTechnicalWithInteger elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithInteger::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTechnicalWithInteger::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithInteger::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTechnicalWithInteger>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithInteger>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithInteger> > (msrVisitorKey<S_msrTechnicalWithInteger> ())) {
         S_msrTechnicalWithInteger elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithInteger::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -421,44 +442,52 @@ string msrTechnicalWithFloat::technicalWithFloatPlacementKindAsString () const
 
 void msrTechnicalWithFloat::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithFloat::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTechnicalWithFloat>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithFloat> > (msrVisitorKey<S_msrTechnicalWithFloat> ())) {
         S_msrTechnicalWithFloat elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithFloat::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTechnicalWithFloat::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithFloat::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTechnicalWithFloat>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithFloat>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithFloat> > (msrVisitorKey<S_msrTechnicalWithFloat> ())) {
         S_msrTechnicalWithFloat elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithFloat::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -598,44 +627,52 @@ string msrTechnicalWithString::technicalWithStringPlacementKindAsString () const
 
 void msrTechnicalWithString::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithString::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTechnicalWithString>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithString> > (msrVisitorKey<S_msrTechnicalWithString> ())) {
         S_msrTechnicalWithString elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithString::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTechnicalWithString::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTechnicalWithString::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTechnicalWithString>*
     p =
-      dynamic_cast<visitor<S_msrTechnicalWithString>*> (v)) {
+      v->cast<visitor<S_msrTechnicalWithString> > (msrVisitorKey<S_msrTechnicalWithString> ())) {
         S_msrTechnicalWithString elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTechnicalWithString::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -72,44 +72,52 @@ void msrTempoNote::appendBeamToTempoNote (S_msrBeam beam)
 
 void msrTempoNote::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoNote::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTempoNote>*
     p =
-      dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
+      v->cast<visitor<S_msrTempoNote> > (msrVisitorKey<S_msrTempoNote> ())) {
         S_msrTempoNote elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoNote::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTempoNote::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoNote::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTempoNote>*
     p =
-      dynamic_cast<visitor<S_msrTempoNote>*> (v)) {
+      v->cast<visitor<S_msrTempoNote> > (msrVisitorKey<S_msrTempoNote> ())) {
         S_msrTempoNote elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoNote::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -241,7 +249,7 @@ msrTempoTuplet::msrTempoTuplet (
   fTempoTupletDisplayWholeNotes  = rational (0, 1);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos){
+  if (gTraceFlags [kTraceTemposFlag]){
     gLogIOstream <<
       "Creating tempo tuplet '" <<
       this->asString () <<
@@ -314,7 +322,7 @@ string msrTempoTuplet::tempoTupletShowNumberKindAsString (
 void msrTempoTuplet::addTempoNoteToTempoTuplet (S_msrTempoNote tempoNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
+  if (gTraceFlags [kTraceTemposFlag]) {
     gLogIOstream <<
       "Adding tempoNote '" <<
       tempoNote->asShortString () <<
@@ -344,7 +352,7 @@ void msrTempoTuplet::addTempoNoteToTempoTuplet (S_msrTempoNote tempoNote)
 void msrTempoTuplet::addTempoTupletToTempoTuplet (S_msrTempoTuplet tempoTuplet)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
+  if (gTraceFlags [kTraceTemposFlag]) {
     gLogIOstream <<
       "Adding tempoTuplet '" <<
       tempoTuplet->asString () <<
@@ -385,7 +393,7 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
   S_msrTempoNote tempoNote)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
+  if (gTraceFlags [kTraceTemposFlag]) {
     gLogIOstream <<
       "Removing first tempoNote '" <<
       tempoNote->asShortString () <<
@@ -459,7 +467,7 @@ void msrTempoTuplet::removeFirstNoteFromTempoTuplet (
 void msrTempoTuplet::applyDisplayFactorToTempoTupletMembers ()
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
+  if (gTraceFlags [kTraceTemposFlag]) {
     gLogIOstream <<
       "% ==> applyDisplayFactorToTempoTupletMembers ()" <<
       endl;
@@ -484,7 +492,7 @@ void msrTempoTuplet::unapplySoundingFactorToTempoTupletMembers (
   int containingTempoTupletNormalNotes)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos) {
+  if (gTraceFlags [kTraceTemposFlag]) {
     gLogIOstream <<
       "unapplySoundingFactorToTempoTupletMembers ()" <<
       endl;
@@ -517,44 +525,52 @@ void msrTempoTuplet::unapplySoundingFactorToTempoTupletMembers (
 
 void msrTempoTuplet::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoTuplet::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTempoTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
+      v->cast<visitor<S_msrTempoTuplet> > (msrVisitorKey<S_msrTempoTuplet> ())) {
         S_msrTempoTuplet elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoTuplet::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTempoTuplet::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoTuplet::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTempoTuplet>*
     p =
-      dynamic_cast<visitor<S_msrTempoTuplet>*> (v)) {
+      v->cast<visitor<S_msrTempoTuplet> > (msrVisitorKey<S_msrTempoTuplet> ())) {
         S_msrTempoTuplet elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoTuplet::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -804,7 +820,7 @@ void msrTempoRelationshipElements::addElementToTempoRelationshipElements (
   S_msrElement element)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTempos){
+  if (gTraceFlags [kTraceTemposFlag]){
     gLogIOstream <<
       "Adding element '" <<
       element->asString () <<
@@ -818,44 +834,52 @@ void msrTempoRelationshipElements::addElementToTempoRelationshipElements (
 
 void msrTempoRelationshipElements::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoRelationshipElements::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTempoRelationshipElements>*
     p =
-      dynamic_cast<visitor<S_msrTempoRelationshipElements>*> (v)) {
+      v->cast<visitor<S_msrTempoRelationshipElements> > (msrVisitorKey<S_msrTempoRelationshipElements> ())) {
         S_msrTempoRelationshipElements elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoRelationshipElements::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTempoRelationshipElements::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempoRelationshipElements::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTempoRelationshipElements>*
     p =
-      dynamic_cast<visitor<S_msrTempoRelationshipElements>*> (v)) {
+      v->cast<visitor<S_msrTempoRelationshipElements> > (msrVisitorKey<S_msrTempoRelationshipElements> ())) {
         S_msrTempoRelationshipElements elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempoRelationshipElements::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -1089,44 +1113,52 @@ msrTempo::~msrTempo ()
 
 void msrTempo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempo::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTempo>*
     p =
-      dynamic_cast<visitor<S_msrTempo>*> (v)) {
+      v->cast<visitor<S_msrTempo> > (msrVisitorKey<S_msrTempo> ())) {
         S_msrTempo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempo::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTempo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTempo::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTempo>*
     p =
-      dynamic_cast<visitor<S_msrTempo>*> (v)) {
+      v->cast<visitor<S_msrTempo> > (msrVisitorKey<S_msrTempo> ())) {
         S_msrTempo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTempo::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrTies.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -51,44 +56,52 @@ msrTie::~msrTie ()
 
 void msrTie::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTie::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTie>*
     p =
-      dynamic_cast<visitor<S_msrTie>*> (v)) {
+      v->cast<visitor<S_msrTie> > (msrVisitorKey<S_msrTie> ())) {
         S_msrTie elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTie::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTie::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTie::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTie>*
     p =
-      dynamic_cast<visitor<S_msrTie>*> (v)) {
+      v->cast<visitor<S_msrTie> > (msrVisitorKey<S_msrTie> ())) {
         S_msrTie elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTie::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -53,7 +53,7 @@ msrTimeItem::msrTimeItem (
   fTimeBeatValue = -1;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
+  if (gTraceFlags [kTraceTimesFlag]) {
     gLogIOstream <<
       "Creating time item" <<
       ", line = " << inputLineNumber <<
@@ -101,7 +101,7 @@ bool msrTimeItem::isEqualTo (S_msrTimeItem otherTimeItem) const
 void msrTimeItem::appendBeatsNumber (int beatsNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
+  if (gTraceFlags [kTraceTimesFlag]) {
     gLogIOstream <<
       "Append beat number '" <<
       beatsNumber <<
@@ -130,44 +130,52 @@ int msrTimeItem::getTimeBeatsNumber () const
 
 void msrTimeItem::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTimeItem::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTimeItem>*
     p =
-      dynamic_cast<visitor<S_msrTimeItem>*> (v)) {
+      v->cast<visitor<S_msrTimeItem> > (msrVisitorKey<S_msrTimeItem> ())) {
         S_msrTimeItem elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTimeItem::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTimeItem::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTimeItem::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTimeItem>*
     p =
-      dynamic_cast<visitor<S_msrTimeItem>*> (v)) {
+      v->cast<visitor<S_msrTimeItem> > (msrVisitorKey<S_msrTimeItem> ())) {
         S_msrTimeItem elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTimeItem::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -326,7 +334,7 @@ void msrTime::appendTimeItem (
   S_msrTimeItem timeItem)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTimes) {
+  if (gTraceFlags [kTraceTimesFlag]) {
     gLogIOstream <<
       "Append item '" <<
       timeItem->asString () <<
@@ -425,44 +433,52 @@ rational msrTime::wholeNotesPerMeasure () const
 
 void msrTime::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTime::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTime>*
     p =
-      dynamic_cast<visitor<S_msrTime>*> (v)) {
+      v->cast<visitor<S_msrTime> > (msrVisitorKey<S_msrTime> ())) {
         S_msrTime elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTime::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTime::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTime::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTime>*
     p =
-      dynamic_cast<visitor<S_msrTime>*> (v)) {
+      v->cast<visitor<S_msrTime> > (msrVisitorKey<S_msrTime> ())) {
         S_msrTime elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTime::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
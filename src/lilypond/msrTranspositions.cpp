@@ -61,44 +61,52 @@ msrOctaveShift::~msrOctaveShift ()
 
 void msrOctaveShift::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOctaveShift::acceptIn ()" <<
       endl;
   }
+#endif
   
   if (visitor<S_msrOctaveShift>*
     p =
-      dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
+      v->cast<visitor<S_msrOctaveShift> > (msrVisitorKey<S_msrOctaveShift> ())) {
         S_msrOctaveShift elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOctaveShift::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrOctaveShift::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrOctaveShift::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrOctaveShift>*
     p =
-      dynamic_cast<visitor<S_msrOctaveShift>*> (v)) {
+      v->cast<visitor<S_msrOctaveShift> > (msrVisitorKey<S_msrOctaveShift> ())) {
         S_msrOctaveShift elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrOctaveShift::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -183,7 +191,7 @@ msrTranspose::msrTranspose (
   fTransposeDouble       = transposeDouble;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTranspositions) {
+  if (gTraceFlags [kTraceTranspositionsFlag]) {
     gLogIOstream <<
       "Creating transpose '" <<
       asString () <<
@@ -218,44 +226,52 @@ bool msrTranspose::isEqualTo (S_msrTranspose otherTranspose) const
 
 void msrTranspose::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTranspose::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrTranspose>*
     p =
-      dynamic_cast<visitor<S_msrTranspose>*> (v)) {
+      v->cast<visitor<S_msrTranspose> > (msrVisitorKey<S_msrTranspose> ())) {
         S_msrTranspose elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTranspose::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrTranspose::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrTranspose::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrTranspose>*
     p =
-      dynamic_cast<visitor<S_msrTranspose>*> (v)) {
+      v->cast<visitor<S_msrTranspose> > (msrVisitorKey<S_msrTranspose> ())) {
         S_msrTranspose elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrTranspose::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -19,6 +19,11 @@
 
 #include "msrTremolos.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -62,44 +67,52 @@ string msrSingleTremolo::singleTremoloPlacementKindAsString () const
 
 void msrSingleTremolo::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSingleTremolo::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrSingleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
+      v->cast<visitor<S_msrSingleTremolo> > (msrVisitorKey<S_msrSingleTremolo> ())) {
         S_msrSingleTremolo elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSingleTremolo::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrSingleTremolo::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrSingleTremolo::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrSingleTremolo>*
     p =
-      dynamic_cast<visitor<S_msrSingleTremolo>*> (v)) {
+      v->cast<visitor<S_msrSingleTremolo> > (msrVisitorKey<S_msrSingleTremolo> ())) {
         S_msrSingleTremolo elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrSingleTremolo::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
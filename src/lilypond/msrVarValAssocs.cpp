@@ -62,7 +62,7 @@ msrVarValAssoc::~msrVarValAssoc ()
 void msrVarValAssoc::setVariableValue (string value)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVarValAssocs) {
+  if (gTraceFlags [kTraceVarValAssocsFlag]) {
     gLogIOstream <<
       "Setting the value of marVarValAssoc \"" <<
       varValAssocKindAsString (fVarValAssocKind) <<
@@ -78,44 +78,52 @@ void msrVarValAssoc::setVariableValue (string value)
 
 void msrVarValAssoc::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVarValAssoc::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrVarValAssoc>*
     p =
-      dynamic_cast<visitor<S_msrVarValAssoc>*> (v)) {
+      v->cast<visitor<S_msrVarValAssoc> > (msrVisitorKey<S_msrVarValAssoc> ())) {
         S_msrVarValAssoc elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVarValAssoc::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrVarValAssoc::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVarValAssoc::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrVarValAssoc>*
     p =
-      dynamic_cast<visitor<S_msrVarValAssoc>*> (v)) {
+      v->cast<visitor<S_msrVarValAssoc> > (msrVisitorKey<S_msrVarValAssoc> ())) {
         S_msrVarValAssoc elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVarValAssoc::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
@@ -217,44 +225,52 @@ msrVarValsListAssoc::~msrVarValsListAssoc ()
 
 void msrVarValsListAssoc::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVarValsListAssoc::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrVarValsListAssoc>*
     p =
-      dynamic_cast<visitor<S_msrVarValsListAssoc>*> (v)) {
+      v->cast<visitor<S_msrVarValsListAssoc> > (msrVisitorKey<S_msrVarValsListAssoc> ())) {
         S_msrVarValsListAssoc elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVarValsListAssoc::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrVarValsListAssoc::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrVarValsListAssoc::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrVarValsListAssoc>*
     p =
-      dynamic_cast<visitor<S_msrVarValsListAssoc>*> (v)) {
+      v->cast<visitor<S_msrVarValsListAssoc> > (msrVisitorKey<S_msrVarValsListAssoc> ())) {
         S_msrVarValsListAssoc elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrVarValsListAssoc::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
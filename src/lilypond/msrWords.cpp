@@ -20,6 +20,11 @@
 
 #include "msrWords.h"
 
+#include "setTraceOptionsIfDesired.h"
+#ifdef TRACE_OPTIONS
+  #include "traceOptions.h"
+#endif
+
 #include "msrOptions.h"
 
 
@@ -85,44 +90,52 @@ msrWords::~msrWords ()
 
 void msrWords::acceptIn (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrWords::acceptIn ()" <<
       endl;
   }
+#endif
       
   if (visitor<S_msrWords>*
     p =
-      dynamic_cast<visitor<S_msrWords>*> (v)) {
+      v->cast<visitor<S_msrWords> > (msrVisitorKey<S_msrWords> ())) {
         S_msrWords elem = this;
         
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrWords::visitStart ()" <<
             endl;
         }
+#endif
         p->visitStart (elem);
   }
 }
 
 void msrWords::acceptOut (basevisitor* v)
 {
-  if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMsrVisitorsFlag]) {
     gLogIOstream <<
       "% ==> msrWords::acceptOut ()" <<
       endl;
   }
+#endif
 
   if (visitor<S_msrWords>*
     p =
-      dynamic_cast<visitor<S_msrWords>*> (v)) {
+      v->cast<visitor<S_msrWords> > (msrVisitorKey<S_msrWords> ())) {
         S_msrWords elem = this;
       
-        if (gMsrOptions->fTraceMsrVisitors) {
+#ifdef TRACE_OPTIONS
+        if (gTraceFlags [kTraceMsrVisitorsFlag]) {
           gLogIOstream <<
             "% ==> Launching msrWords::visitEnd ()" <<
             endl;
         }
+#endif
         p->visitEnd (elem);
   }
 }
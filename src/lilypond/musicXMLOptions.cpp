@@ -25,9 +25,9 @@ namespace MusicXML2
 
 //_______________________________________________________________________________
 
-S_musicXMLOptions gMusicXMLOptions;
-S_musicXMLOptions gMusicXMLOptionsUserChoices;
-S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
+thread_local S_musicXMLOptions gMusicXMLOptions;
+thread_local S_musicXMLOptions gMusicXMLOptionsUserChoices;
+thread_local S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
 
 S_musicXMLOptions musicXMLOptions::create (
   S_optionsHandler optionsHandler)
@@ -118,9 +118,9 @@ class musicXMLOptions : public optionsGroup
 typedef SMARTP<musicXMLOptions> S_musicXMLOptions;
 EXP ostream& operator<< (ostream& os, const S_musicXMLOptions& elt);
 
-EXP extern S_musicXMLOptions gMusicXMLOptions;
-EXP extern S_musicXMLOptions gMusicXMLOptionsUserChoices;
-EXP extern S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
+extern thread_local S_musicXMLOptions gMusicXMLOptions;
+extern thread_local S_musicXMLOptions gMusicXMLOptionsUserChoices;
+extern thread_local S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
 
 //______________________________________________________________________________
 void initializeMusicXMLOptionsHandling (
@@ -86,7 +86,7 @@ string mxmlPartGroupDescr::partGroupDescrAsString () const
     fPartGroup->getPartGroupCombinedName ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     s <<
       ", positions " <<
       fStartPosition << ".." << fStopPosition;
@@ -672,7 +672,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
   S_mxmlPartGroupDescr partGroupDescr)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Registering part group descr '" <<
       partGroupDescr->getPartGroupCombinedName () <<
@@ -681,7 +681,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
       endl;
   }
 
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "BEFORE registering part group " +
@@ -718,7 +718,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStarted (
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER registering part group " +
@@ -763,7 +763,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStartingAtCurrentPosit
       if (i == iEnd) {
         // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTracePartGroups) {
+        if (gTraceFlags [kTracePartGroupsFlag]) {
           fLogOutputStream <<
             "Appending part group descr " <<
             partGroupDescr->
@@ -804,7 +804,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStartingAtCurrentPosit
 
         // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTracePartGroups) {
+        if (gTraceFlags [kTracePartGroupsFlag]) {
           fLogOutputStream <<
             "Inserting part group descr " <<
             currentPartGroupDescr->
@@ -846,7 +846,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStartingList (
     if (i == iEnd) {
       // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceFlags [kTracePartGroupsFlag]) {
         fLogOutputStream <<
           "Appending part group descr " <<
           partGroupDescr->
@@ -886,7 +886,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStartingList (
       currentPartGroupDescr->getStopPosition ()) {
       // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceFlags [kTracePartGroupsFlag]) {
         fLogOutputStream <<
           "Inserting part group descr " <<
           currentPartGroupDescr->
@@ -926,7 +926,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStoppingList (
     if (i == iEnd) {
       // append partGroupDescr to the list 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceFlags [kTracePartGroupsFlag]) {
         fLogOutputStream <<
           "Appending part group descr " <<
           partGroupDescr->
@@ -966,7 +966,7 @@ void mxmlTree2MsrSkeletonBuilder::insertPartGroupDescInStoppingList (
       currentPartGroupDescr->getStartPosition ()) {
       // insert partGroupDescr before currentPartGroupDescr
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTracePartGroups) {
+      if (gTraceFlags [kTracePartGroupsFlag]) {
         fLogOutputStream <<
           "Inserting part group descr " <<
           currentPartGroupDescr->
@@ -1043,7 +1043,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStopped (
   S_mxmlPartGroupDescr partGroupDescr)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Registering part group descr '" <<
       partGroupDescr->getPartGroupCombinedName () <<
@@ -1066,7 +1066,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPartGroupDescrAsStopped (
         getPartGroupNumber ());
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER forgetting part group descr " +
@@ -1082,7 +1082,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Creating part group with number '" <<
       fCurrentPartGroupNumber <<
@@ -1125,7 +1125,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
              
   // register it in the part groups data
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Adding part group descr for '" << fCurrentPartGroupNumber <<
       "' to visitor's part groups data" <<
@@ -1140,7 +1140,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStart (
     partGroupDescr);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handlePartGroupStart()");
@@ -1185,7 +1185,7 @@ void mxmlTree2MsrSkeletonBuilder::handlePartGroupStop (
     partGroupDescrToBeStopped);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handlePartGroupStop()");
@@ -1210,7 +1210,7 @@ void mxmlTree2MsrSkeletonBuilder::doNestPartGroupDescrInItsContainer (
         
   // set currentPartGroup's uplink to containingPartGroupDescr
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Setting the uplink of part group " <<
       partGroupToBeStopped->
@@ -1229,7 +1229,7 @@ void mxmlTree2MsrSkeletonBuilder::doNestPartGroupDescrInItsContainer (
 
   // appending currentPartGroup to containingPartGroupDescr
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Appending sub part group " <<
       partGroupToBeStopped->
@@ -1265,7 +1265,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
   fCurrentPartGroupNumber = 0;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Creating an implicit part group with number '" <<
       fCurrentPartGroupNumber <<
@@ -1289,7 +1289,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
 
   // append it to the MSR score
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Appending implicit part group '" <<
       fImplicitPartGroup->getPartGroupNumber () <<
@@ -1314,7 +1314,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
       
   // register it in the part groups data
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Adding implicit part group descr for '" <<
       fCurrentPartGroupNumber <<
@@ -1330,7 +1330,7 @@ void mxmlTree2MsrSkeletonBuilder::createImplicitPartGroup ()
     fImplicitPartGroupDescr);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER creating fImplicitPartGroup");
@@ -1343,7 +1343,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "doPartGroupsNestingAndPartsAllocation:" <<
       endl;
@@ -1355,7 +1355,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
   // stored in the data we've built, a second time
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "BEFORE doPartGroupsNestingAndPartsAllocation");
@@ -1458,7 +1458,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
                 fPartGroupsDescrStack.front ();
 
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTracePartGroups) {
+            if (gTraceFlags [kTracePartGroupsFlag]) {
               fLogOutputStream <<
                 "Popping part group " <<
                 partGroupDescr->
@@ -1505,7 +1505,7 @@ void mxmlTree2MsrSkeletonBuilder::doPartGroupsNestingAndPartsAllocation (
 
           else {
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTracePartGroupsDetails) {
+            if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
               showPartGroupsData (
                 stopInputLineNumber,
                 "UPON overlapping part groups");
@@ -1578,8 +1578,8 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
                 __FILE__, __LINE__,
                 s.str ());
             }
-          }
 #endif
+          }
     
           if (++i == iEnd) break;
           // no endl here
@@ -1613,7 +1613,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
       
           // make it the new current part group
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTracePartGroups) {
+          if (gTraceFlags [kTracePartGroupsFlag]) {
             fLogOutputStream <<
               "Pushing part group descr '" <<
               partGroupDescr->partGroupDescrAsString () <<
@@ -1635,7 +1635,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
     }
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePartGroupsDetails) {
+    if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
       stringstream s;
 
       s <<
@@ -1650,7 +1650,7 @@ R"(Please contact the maintainers of xml2ly (see '-c, -contact'):
   } // for
       
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER doPartGroupsNestingAndPartsAllocation");
@@ -1746,15 +1746,17 @@ S_msrVoice mxmlTree2MsrSkeletonBuilder::createHarmonyVoiceForVoiceIfNotYetDone (
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_encoding& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_encoding" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "*** Analysing S_encoding ***" <<
       ", " << elt->getValue () <<
@@ -1768,15 +1770,17 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_encoding& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_partwise& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_score_partwise" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Analysing the score partwise" <<
       endl;
@@ -1788,12 +1792,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_partwise& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_partwise& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_score_partwise" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   S_msrIdentification
     identification =
@@ -1826,12 +1832,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_work_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_work_number" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fMsrScore->getIdentification () ->
     setWorkNumber (
@@ -1844,12 +1852,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_work_title& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_work_title" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fMsrScore->getIdentification () ->
     setWorkTitle (
@@ -1862,12 +1872,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_movement_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_movement_number" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fMsrScore->getIdentification () ->
     setMovementNumber (
@@ -1880,12 +1892,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_movement_title& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_movement_title" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string movementTitle = elt->getValue ();
 
@@ -1904,12 +1918,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_creator& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_creator" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string creatorType = elt->getAttributeValue ("type");
   string creatorValue = elt->getValue ();
@@ -1970,12 +1986,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_rights& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_rights" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string rightsValue = elt->getValue ();
 
@@ -1992,12 +2010,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_software" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string softwareValue = elt->getValue ();
 
@@ -2035,7 +2055,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_software& elt )
         ) {
         // handle it at once
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceOptions) {
+        if (gTraceFlags [kTraceOptionsFlag]) {
           fLogOutputStream <<
             "Setting '-cubase' option" <<
             endl;
@@ -2061,12 +2081,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_encoding_date& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_encoding_date" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fMsrScore->getIdentification () ->
     setEncodingDate (
@@ -2079,12 +2101,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_miscellaneous_field& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_miscellaneous_field" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string miscellaneousFielValue = elt->getValue ();
   
@@ -2100,12 +2124,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_miscellaneous_field& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_millimeters& elt )
 { 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_millimeters" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentMillimeters = (float)(*elt);
   
@@ -2115,12 +2141,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_millimeters& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_tenths& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tenths" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTenths = (int)(*elt);
 
@@ -2130,15 +2158,17 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_tenths& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_scaling& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_scaling" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceGeometry) {
+  if (gTraceFlags [kTraceGeometryFlag]) {
     fLogOutputStream <<
       "There are " << fCurrentTenths <<
       " tenths for " <<  fCurrentMillimeters <<
@@ -2152,12 +2182,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_scaling& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_margins& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_system_margins" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int systemDistance = (int)(*elt);
   
@@ -2168,12 +2200,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_margins& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_distance& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_system_distance" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int systemDistanceTenths = (int)(*elt);
   
@@ -2184,12 +2218,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_distance& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_system_distance& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_top_system_distance" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int topSystemDistanceTenths = (int)(*elt);
   
@@ -2200,12 +2236,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_system_distance& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_dividers& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_system_dividers" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   int topSystemDistance = (int)(*elt);
   
@@ -2217,35 +2255,41 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_system_dividers& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_layout& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_page_layout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPageLayout = true;
 }
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_page_layout& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_page_layout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPageLayout = false;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_height& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_page_height" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int pageHeight = (int)(*elt);
@@ -2258,12 +2302,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_height& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_width& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_page_width" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int pageWidth = (int)(*elt);
@@ -2276,12 +2322,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_page_width& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_left_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_left_margin" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int leftMargin = (int)(*elt);
@@ -2294,12 +2342,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_left_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_right_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_right_margin" <<
        ", line " << elt->getInputLineNumber () <<
      endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int rightMargin = (int)(*elt);
@@ -2312,12 +2362,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_right_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_top_margin" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int topMargin = (int)(*elt);
@@ -2330,12 +2382,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_top_margin& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_bottom_margin& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bottom_margin" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   if (fOnGoingPageLayout) {
     int bottomMargin = (int)(*elt);
@@ -2352,12 +2406,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_credit" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int creditPageNumber =
     elt->getAttributeIntValue ("page", 0);
@@ -2373,12 +2429,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit_words& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_credit_words" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string creditWordsContents =
     elt->getValue ();
@@ -2426,12 +2484,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_credit_words& elt )
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_credit& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_credit" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fMsrScore->
     appendCreditToScore (fCurrentCredit);
@@ -2442,15 +2502,17 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_credit& elt )
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_list& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_list" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Analysing part list" <<
       endl;
@@ -2465,12 +2527,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_list& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part_list" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   gIndenter--;
 
@@ -2490,7 +2554,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_list& elt)
     inputLineNumber);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "Part groups data gathered for score skeleton");
@@ -2520,12 +2584,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_group" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // part group number
   
@@ -2589,36 +2655,42 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_group& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_group_name" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartGroupName = elt->getValue();
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_group_name_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartGroupNameDisplay = true;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_group_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_group_name_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartGroupNameDisplay = false;
 }
@@ -2628,12 +2700,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_display_text& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_display_text" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingPartGroupNameDisplay) {
     fCurrentPartGroupNameDisplayText =
@@ -2658,24 +2732,28 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_display_text& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_accidental_text& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accidental_text" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
     fCurrentPartGroupAccidentalText = elt->getValue();
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_group_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartGroupAbbreviation = elt->getValue ();
 }
@@ -2685,12 +2763,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_group_symbol& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_group_symbol" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string groupSymbol = elt->getValue ();
 
@@ -2737,12 +2817,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_group_barline& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_group_barline" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string groupBarline = elt->getValue ();
   
@@ -2771,15 +2853,17 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_group& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part_group" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Handling part group '" <<
       fCurrentPartGroupNumber <<
@@ -2823,17 +2907,19 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_score_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentPartID = elt->getAttributeValue ("id");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Found part name \"" << fCurrentPartID << "\"" <<
       " in part list" <<
@@ -2882,12 +2968,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_score_part& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_name" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartName = elt->getValue ();
   
@@ -2902,84 +2990,98 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_name_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartNameDisplay = true;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_name_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part_name_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartNameDisplay = false;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartAbbreviation = elt->getValue ();
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_part_abbreviation_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part_abbreviation_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartAbbreviationDisplay = true;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part_abbreviation_display& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part_abbreviation_display" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingPartAbbreviationDisplay = false;
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_instrument_name& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_name" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartInstrumentName = elt->getValue();
 }
 
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_instrument_abbreviation& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_abbreviation" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentPartInstrumentAbbreviation = elt->getValue();
 }
@@ -2989,19 +3091,21 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_score_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentPartsPosition++;
 
   string partID = elt->getAttributeValue ("id");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
    fLogOutputStream <<
     "--------------------------------------------" <<
     endl <<
@@ -3016,7 +3120,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
 
   // create the part
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
    fLogOutputStream <<
     "--------------------------------------------" <<
     endl <<
@@ -3062,7 +3166,7 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_score_part& elt)
     part);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroupsDetails) {
+  if (gTraceFlags [kTracePartGroupsDetailsFlag]) {
     showPartGroupsData (
       inputLineNumber,
       "AFTER handling score part \"" + partID + "\"");
@@ -3079,7 +3183,7 @@ void mxmlTree2MsrSkeletonBuilder::registerPart (
   S_msrPart part)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTracePartGroups) {
+  if (gTraceFlags [kTracePartGroupsFlag]) {
     fLogOutputStream <<
       "Resitering part " <<
       part->getPartCombinedName () <<
@@ -3111,18 +3215,20 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // fCurrentPartID is used throughout
   fCurrentPartID = elt->getAttributeValue ("id");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePartsFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << fCurrentPartID << "\"" <<
@@ -3191,7 +3297,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_part& elt)
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       endl <<
       endl <<
@@ -3217,17 +3323,19 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   gIndenter--;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Analyzing part \"" << fCurrentPartID << "\" -- end" <<
       endl <<
@@ -3277,17 +3385,19 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staves& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int stavesNumber = int(*elt);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     switch (stavesNumber) {
       case 0:
         fLogOutputStream <<
@@ -3331,12 +3441,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentStaffMusicXMLNumber = int(*elt);
 
@@ -3363,12 +3475,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_staff& elt)
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_voice& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentVoiceMusicXMLNumber = int(*elt);
   
@@ -3387,15 +3501,17 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_voice& elt )
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
 {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_measure" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
   Measures have a required number attribute (going from partwise to timewise,
@@ -3406,7 +3522,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
     elt->getAttributeValue ("number");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure " << fCurrentMeasureNumber <<
@@ -3421,23 +3537,27 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_measure& elt)
 
 void mxmlTree2MsrSkeletonBuilder::visitEnd (S_measure& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_measure" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_note& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_note" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
   
   // assuming staff number 1, unless S_staff states otherwise afterwards
   fCurrentStaffMusicXMLNumber = 1;
@@ -3457,12 +3577,14 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_note" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
   
   // should the staff be created?
   S_msrStaff
@@ -3481,11 +3603,11 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_note& elt )
   
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceStaves
+    gTraceFlags [kTraceStavesFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
     ) {
     fLogOutputStream <<
       "--> S_note, fCurrentStaffMusicXMLNumber = " <<
@@ -3524,12 +3646,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_lyric" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -3548,7 +3672,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     else {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceFlags [kTraceLyricsFlag]) {
         fLogOutputStream <<
           "--> setting fCurrentStanzaNumber to " <<
           fCurrentStanzaNumber <<
@@ -3572,7 +3696,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     if (fCurrentStanzaName.size () == 0) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceFlags [kTraceLyricsFlag]) {
         // lyrics names are not so frequent after all...
         stringstream s;
 
@@ -3593,7 +3717,7 @@ void mxmlTree2MsrSkeletonBuilder::visitStart (S_lyric& elt )
     
     else {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceFlags [kTraceLyricsFlag]) {
         fLogOutputStream <<
           "--> setting fCurrentStanzaName to " <<
           fCurrentStanzaName <<
@@ -3615,15 +3739,17 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_lyric" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     fLogOutputStream <<
       endl <<
       "visitEnd ( S_lyric& )" <<
@@ -3675,13 +3801,15 @@ void mxmlTree2MsrSkeletonBuilder::visitEnd ( S_lyric& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::visitStart ( S_harmony& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_harmony" <<
       ", fHarmonyVoicesCounter = " << fHarmonyVoicesCounter <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   /*
     several harmonies can be attached to a given note,
@@ -3700,12 +3828,14 @@ void mxmlTree2MsrSkeletonBuilder::visitStart ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
     
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // append a figured bass staff and voice to the current part
   fCurrentPart->
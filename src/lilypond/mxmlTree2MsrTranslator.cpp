@@ -560,7 +560,7 @@ S_msrStaff mxmlTree2MsrTranslator::fetchStaffFromCurrentPart (
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     fLogOutputStream <<
       "--> fetchStaffFromCurrentPart returns " <<
       staff->getStaffName () <<
@@ -619,7 +619,7 @@ S_msrVoice mxmlTree2MsrTranslator::fetchVoiceFromPart (
     */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceVoicesFlag]) {
     fLogOutputStream <<
       "--> fetchVoiceFromPart() returns " <<
       voice->getVoiceName () <<
@@ -636,17 +636,19 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string partID = elt->getAttributeValue ("id");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTracePartsFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== part \"" << partID << "\"" <<
@@ -711,7 +713,7 @@ void mxmlTree2MsrTranslator::visitStart (S_part& elt)
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "--------------------------------------------" <<
       endl <<
@@ -762,17 +764,19 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_part" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   gIndenter--;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceParts) {
+  if (gTraceFlags [kTracePartsFlag]) {
     fLogOutputStream <<
       "Analyzing part " <<
       fCurrentPart->
@@ -818,7 +822,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
           2); // JMI
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBarlines) {
+    if (gTraceFlags [kTraceBarlinesFlag]) {
       fLogOutputStream <<
         "Creating an extra barline in part " <<
         fCurrentPart->getPartCombinedName () << ":" <<
@@ -848,12 +852,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_part& elt)
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_attributes& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_attributes" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitEnd (S_attributes& elt)
@@ -861,12 +867,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_attributes& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_attributes" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // have the divisions been defined alright?
   if (! fCurrentDivisions) {
@@ -900,12 +908,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_divisions" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
     
   fCurrentDivisionsPerQuarterNote = (int)(*elt);
   
@@ -923,7 +933,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
 
   // set current part's divisions per quarter note
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceDivisions) {
+  if (gTraceFlags [kTraceDivisionsFlag]) {
     if (fCurrentDivisionsPerQuarterNote == 1) {
       fLogOutputStream <<
         "There is 1 division";
@@ -953,12 +963,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_divisions& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_clef& elt )
 { 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_clef" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // https://usermanuals.musicxml.com/MusicXML/Content/EL-MusicXML-clef.htm
 
@@ -975,24 +987,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_sign& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sign" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentClefSign = elt->getValue();
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_line& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_line" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentClefLine = (int)(*elt);
 }
@@ -1002,12 +1018,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_clef_octave_change& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_clef_octave_change" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentClefOctaveChange = (int)(*elt);
 
@@ -1031,12 +1049,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_clef" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // convert clef to upper case for analysis
   transform (
@@ -1280,12 +1300,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_clef& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_key& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_key" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // The optional number attribute refers to staff numbers.
   // If absent (0), apply to all part staves.
@@ -1307,24 +1329,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_key& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_cancel& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_cancel" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentKeyCancelFifths = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_fifths& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fifths" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentKeyKind = msrKey::kTraditionalKind;
 
@@ -1336,12 +1362,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_mode& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_mode" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string mode = elt->getValue();
 
@@ -1391,12 +1419,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_key_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fCurrentHumdrumScotKeyItem) {
     msrMusicXMLError (
@@ -1441,12 +1471,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_key_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (! fCurrentHumdrumScotKeyItem) {
     msrMusicXMLError (
@@ -1492,12 +1524,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_key_octave& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_key_octave" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int keyOctave = (int)(*elt);
 
@@ -1571,12 +1605,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_key& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_key" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // handle key
   S_msrKey key;
@@ -1767,12 +1803,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_time" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
   
   fCurrentTimeStaffNumber =
     elt->getAttributeIntValue ("number", 0);
@@ -1822,12 +1860,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_time& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_beats& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beats" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTimeBeats = elt->getValue (); // can be a string such as 3+2
 }
@@ -1837,12 +1877,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beat_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int beatType = (int)(*elt);
 
@@ -1891,12 +1933,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_type& elt )
  
 void mxmlTree2MsrTranslator::visitStart ( S_senza_misura& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_senza_misura" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTimeSymbolKind = msrTime::kTimeSymbolSenzaMisura;
 }
@@ -1906,12 +1950,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_interchangeable& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_interchangeable" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string interchangeableSymbol =
     elt->getAttributeValue ("symbol");
@@ -1995,12 +2041,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_time_relation& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_time_relation" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string timeRelation = elt->getValue ();
   
@@ -2047,12 +2095,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_time& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_time" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the time
   fCurrentTime =
@@ -2104,12 +2154,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_time& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_instruments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_time" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
         <instruments>2</instruments>
@@ -2121,12 +2173,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_instruments& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_transpose& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_transpose" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTransposeNumber = elt->getAttributeIntValue ("number", 0);
   
@@ -2138,48 +2192,56 @@ void mxmlTree2MsrTranslator::visitStart ( S_transpose& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_diatonic& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_diatonic" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTransposeDiatonic = (int)(*elt);
 }
   
 void mxmlTree2MsrTranslator::visitStart ( S_chromatic& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_chromatic" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTransposeChromatic = (int)(*elt);
 }
  
 void mxmlTree2MsrTranslator::visitStart ( S_octave_change& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting octave_change" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTransposeOctaveChange = (int)(*elt);
 }
  
 void mxmlTree2MsrTranslator::visitStart ( S_double& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting double" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentTransposeDouble = true;
 }
@@ -2189,12 +2251,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_transpose& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_transpose" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // bring the transpose chromatic value in the -11..+11 interval
   if (fCurrentTransposeChromatic < -11) {
@@ -2284,12 +2348,14 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -2324,12 +2390,14 @@ void mxmlTree2MsrTranslator::visitStart (S_direction& elt)
 
 void mxmlTree2MsrTranslator::visitEnd (S_direction& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_direction" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* JMI
   if (fCurrentMetronomeTempo) {
@@ -2369,12 +2437,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_direction& elt)
 
 void mxmlTree2MsrTranslator::visitStart (S_direction_type& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_direction_type" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingDirectionType = true; // JMI
 }
@@ -2385,12 +2455,14 @@ void mxmlTree2MsrTranslator::visitStart (S_offset& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_offset" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // sound
   
@@ -2434,12 +2506,14 @@ void mxmlTree2MsrTranslator::visitStart (S_octave_shift& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_octave_shift" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // size
   
@@ -2537,12 +2611,14 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_words" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
   <words default-y="-73" font-style="italic" relative-x="5">cresc.</words>
@@ -2748,7 +2824,7 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
   // create the words
   if (wordsValue.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWords) {
+    if (gTraceFlags [kTraceWordsFlag]) {
       fLogOutputStream <<
         "Creating words \"" << wordsValue << "\"" <<
         ", placement = \"" <<
@@ -2777,12 +2853,14 @@ void mxmlTree2MsrTranslator::visitStart (S_words& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_registration& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_registration" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
       <direction>
@@ -2805,12 +2883,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_registration& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_high& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_high" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentAccordionHigh = 1;
 
@@ -2822,12 +2902,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_middle& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_middle" <<
        ", line " << inputLineNumber <<
      endl;
   }
+#endif
 
   fCurrentAccordionMiddle = (int)(*elt);
 
@@ -2852,12 +2934,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accordion_middle& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_accordion_low& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accordion_low" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentAccordionLow = 1;
 
@@ -2869,12 +2953,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_accordion_registration& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_accordion_registration" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // An accordion-registration element needs to have 
   // at least one of the child elements present
@@ -2905,12 +2991,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_accordion_registration& elt )
 
 void mxmlTree2MsrTranslator::visitEnd (S_direction_type& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_direction_type" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingDirectionType = false;
 }
@@ -2921,12 +3009,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string parentheses = elt->getAttributeValue ("parentheses");
   
@@ -2973,12 +3063,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beat_unit" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string beatUnitString = elt->getValue();
    
@@ -3002,12 +3094,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit_dot& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beat_unit_dot" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fCurrentMetronomeBeatUnitsVector.size ()) {
     fCurrentMetronomeBeatUnitsVector.back ().fDotsNumber++;
@@ -3028,24 +3122,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_beat_unit_dot& elt )
   
 void mxmlTree2MsrTranslator::visitStart ( S_per_minute& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_per_minute" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentMetrenomePerMinute = elt->getValue ();
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_metronome_note& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_note" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingMetronomeNote = true;
 }
@@ -3055,12 +3153,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string noteType = elt->getValue();
 
@@ -3073,12 +3173,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_metronome_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_dot" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentMetrenomeDotsNumber++;
 }
@@ -3088,12 +3190,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_beam& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_beam" <<
       ", line " << inputLineNumber <<
      endl;
   }
+#endif
 
   // value
   
@@ -3154,7 +3258,7 @@ void mxmlTree2MsrTranslator::attachCurrentMetronomeBeamsToMetronomeNote (
   if (fPendingMetronomeBeams.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceBeams) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceBeamsFlag]) {
       fLogOutputStream <<
         "Attaching current beams to tempoNote " <<
         tempoNote->asString () <<
@@ -3168,7 +3272,7 @@ void mxmlTree2MsrTranslator::attachCurrentMetronomeBeamsToMetronomeNote (
           fPendingMetronomeBeams.front();
         
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceBeams) {
+      if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceBeamsFlag]) {
         fLogOutputStream <<
           "Attaching beam '" <<
           beam->asString () <<
@@ -3191,12 +3295,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_metronome_note" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // convert metronome note duration into whole notes
   fCurrentMetronomeNoteWholeNotesFromMetronomeType =
@@ -3281,12 +3387,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_relation& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_relation" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string metrenomeRelation = elt->getValue ();
 
@@ -3314,12 +3422,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_metronome_tuplet" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -3352,7 +3462,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceTupletsFlag]) {
           stringstream s;
           
           s <<
@@ -3425,9 +3535,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
   
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "fCurrentTempoTupletTypeKind: " <<
       msrTempoTuplet::tempoTupletTypeKindAsString (
@@ -3447,12 +3557,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_metronome_tuplet& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_normal_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_normal_dot" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentMetrenomeNormalDotsNumber++;
 }
@@ -3462,12 +3574,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_metronome_tuplet" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   switch (fCurrentTempoTupletTypeKind) {
     case msrTempoTuplet::kTempoTupletTypeNone:
@@ -3532,12 +3646,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_metronome" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // fCurrentMetronomeParenthesedKind ??? JMI
 
@@ -3665,12 +3781,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_metronome& elt )
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_staves& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_direction" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //________________________________________________________________________
@@ -3679,12 +3797,14 @@ void mxmlTree2MsrTranslator::visitStart (S_staff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentMusicXMLStaffNumber = int(*elt);
 
@@ -3706,7 +3826,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff& elt)
         inputLineNumber, fCurrentMusicXMLStaffNumber);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     fLogOutputStream <<
       "--> S_staff, fCurrentMusicXMLStaffNumber = " <<
       fCurrentMusicXMLStaffNumber <<
@@ -3753,12 +3873,14 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -3865,7 +3987,7 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_details& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     fLogOutputStream <<
       "Handling staff details:" <<
       endl <<
@@ -3904,12 +4026,14 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string staffType = elt->getValue ();
   
@@ -3958,24 +4082,28 @@ void mxmlTree2MsrTranslator::visitStart (S_staff_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_lines& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_lines" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentStaffLinesNumber = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_tuning& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_tuning" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentStaffTuningLine =
     elt->getAttributeIntValue ("line", 0);
@@ -3991,12 +4119,14 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string tuningStep = elt->getValue();
 
@@ -4033,12 +4163,14 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_octave& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_octave" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int tuningOctave = (int)(*elt);
   
@@ -4066,12 +4198,14 @@ void mxmlTree2MsrTranslator::visitStart (S_tuning_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuning_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float tuningAlter = (float)(*elt);
 
@@ -4118,12 +4252,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_staff_tuning" <<
        ", line " << inputLineNumber <<
      endl;
   }
+#endif
 
   // fetch relevant staff
   S_msrStaff
@@ -4141,7 +4277,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_tuning& elt )
 
   // create the staff tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceFlags [kTraceStaffTuningFlag]) {
     fLogOutputStream <<
       "Creating staff tuning:" <<
       endl;
@@ -4204,12 +4340,14 @@ void mxmlTree2MsrTranslator::visitStart (S_voice& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_details" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentMusicXMLVoiceNumber = int(*elt);
   
@@ -4227,7 +4365,7 @@ void mxmlTree2MsrTranslator::visitStart (S_voice& elt )
           fCurrentForwardVoiceNumber);
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
       fLogOutputStream <<
         "--> S_voice, fCurrentForwardVoiceNumber = " <<
         fCurrentForwardVoiceNumber << endl <<
@@ -4262,12 +4400,14 @@ void mxmlTree2MsrTranslator::visitStart (S_backup& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_backup" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // handle the pending tuplets if any
   handleTupletsPendingOnTupletsStack (
@@ -4281,26 +4421,28 @@ void mxmlTree2MsrTranslator::visitEnd (S_backup& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_backup" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceFlags [kTraceMeasuresFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceStaves
+    gTraceFlags [kTraceStavesFlag]
       ||
-    gTraceOptions->fTraceLyrics
+    gTraceFlags [kTraceLyricsFlag]
     ) {
     fLogOutputStream <<
       "Handling 'backup <<< " << fCurrentBackupDurationDivisions <<
@@ -4333,12 +4475,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_backup& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_forward& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_forward" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   /*
       <forward>
@@ -4366,26 +4510,28 @@ void mxmlTree2MsrTranslator::visitEnd ( S_forward& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_forward" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
       ||
-    gTraceOptions->fTraceMeasures
+    gTraceFlags [kTraceMeasuresFlag]
       ||
-    gTraceOptions->fTraceVoices
+    gTraceFlags [kTraceVoicesFlag]
       ||
-    gTraceOptions->fTraceStaves
+    gTraceFlags [kTraceStavesFlag]
       ||
-    gTraceOptions->fTraceLyrics
+    gTraceFlags [kTraceLyricsFlag]
     ) {
     fLogOutputStream <<
       "Handling 'forward <<< " << fCurrentBackupDurationDivisions <<
@@ -4450,12 +4596,14 @@ void mxmlTree2MsrTranslator::visitStart (S_tied& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tied" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 // <tied orientation="over" type="start"/>
 
@@ -4606,15 +4754,17 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_slur" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs) {
+  if (gTraceFlags [kTraceSlursFlag]) {
     displaySlurStartsStack ("BEFORE handling slur");
   }
 #endif
@@ -4671,7 +4821,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
     
             // the stack top is in fact a phrasing slur start
 #ifdef TRACE_OPTIONS
-            if (gTraceOptions->fTraceSlurs) {
+            if (gTraceFlags [kTraceSlursFlag]) {
               fLogOutputStream <<
                 "The slur start '" <<
                 containingSlur->asString () <<
@@ -4746,7 +4896,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
             case msrSlur::kPhrasingSlurStart:
               // the stack top is in fact a phrasing slur start
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlurs) {
+              if (gTraceFlags [kTraceSlursFlag]) {
                 fLogOutputStream <<
                   "A slur stop matches a phrasing slur start, it is thus a phrasing slur stop" <<
                   ", line " << inputLineNumber <<
@@ -4824,9 +4974,9 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceFlags [kTraceNotesDetailsFlag]
         ||
-      gTraceOptions->fTraceSlurs) {
+      gTraceFlags [kTraceSlursFlag]) {
       fLogOutputStream <<
         "slurNumber: " <<
         slurNumber <<
@@ -4862,7 +5012,7 @@ void mxmlTree2MsrTranslator::visitStart (S_slur& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlurs) {
+  if (gTraceFlags [kTraceSlursFlag]) {
     displaySlurStartsStack ("AFTER handling slur");
   }
 #endif
@@ -4874,12 +5024,14 @@ void mxmlTree2MsrTranslator::visitStart (S_bracket& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bracket" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
   
@@ -5105,12 +5257,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_wedge& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_wedge" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // type
   
@@ -5221,12 +5375,14 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_lyric" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -5244,7 +5400,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     }
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceLyrics) {
+    if (gTraceFlags [kTraceLyricsFlag]) {
       fLogOutputStream <<
         "Setting fCurrentStanzaNumber to " <<
         fCurrentStanzaNumber <<
@@ -5268,7 +5424,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     if (fCurrentStanzaName.size () == 0) {
       // lyrics names are not so frequent after all...
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceLyrics) {
+      if (gTraceFlags [kTraceLyricsFlag]) {
         fLogOutputStream <<
           "Lyric name is empty, using \"" <<
           K_NO_STANZA_NAME <<
@@ -5281,7 +5437,7 @@ void mxmlTree2MsrTranslator::visitStart (S_lyric& elt )
     }
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceLyrics) {
+    if (gTraceFlags [kTraceLyricsFlag]) {
       fLogOutputStream <<
         "Setting fCurrentStanzaName to \"" <<
         fCurrentStanzaName <<
@@ -5311,12 +5467,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_syllabic& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_syllabic" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentSyllabic = elt->getValue();
   
@@ -5352,15 +5510,17 @@ void mxmlTree2MsrTranslator::visitStart ( S_syllabic& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_text& elt ) 
 {
+#ifdef TRACE_OPTIONS
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_text" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string textValue = elt->getValue();
 
@@ -5368,7 +5528,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
   fCurrentLyricTextsList.push_back (textValue);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     fLogOutputStream <<
       "textValue = \""<< textValue << "\"" <<
       ", line " << inputLineNumber <<
@@ -5380,7 +5540,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
   fCurrentStanzaHasText = true;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     gIndenter++;
     
     const int fieldWidth = 20;
@@ -5418,12 +5578,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_text& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_elision& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_elision" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   string elisionValue = elt->getValue ();
 
@@ -5442,12 +5604,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_extend& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_extend" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string extendType =
     elt->getAttributeValue ("type");
@@ -5497,12 +5661,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_lyric" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fCurrentSyllableKind == msrSyllable::kSyllableNone) {
     // syllabic is not mandatory...
@@ -5542,7 +5708,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyricsDetails) {
+  if (gTraceFlags [kTraceLyricsDetailsFlag]) {
     fLogOutputStream <<
       "==> visitEnd ( S_lyric&), fCurrentSyllableKind = " <<
       msrSyllable::syllableKindAsString (fCurrentSyllableKind) <<
@@ -5685,7 +5851,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_lyric& elt )
           fCurrentStanzaName);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {      
+  if (gTraceFlags [kTraceLyricsFlag]) {      
     fLogOutputStream <<
       "Creating a syllable '" <<
       msrSyllable::syllableKindAsString (
@@ -5762,18 +5928,20 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_measure" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // take this measure into account
   fCurrentMeasureOrdinalNumber++;
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasuresDetails) {
+  if (gTraceFlags [kTraceMeasuresDetailsFlag]) {
     gLogIOstream <<
       "==> visitStart (S_measure" <<
       ", fCurrentMeasureOrdinalNumber = '" <<
@@ -5793,7 +5961,7 @@ void mxmlTree2MsrTranslator::visitStart (S_measure& elt)
     elt->getAttributeValue ("number");
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceMeasures || gTraceOptions->fTracePasses) {
+  if (gTraceFlags [kTraceMeasuresFlag] || gTraceFlags [kTracePassesFlag]) {
     fLogOutputStream <<
       endl <<
       "<!--=== measure '" << fCurrentMeasureNumber <<
@@ -5894,20 +6062,22 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_measure" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // is there a pending grace notes group?
   if (fPendingGraceNotesGroup) {
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceGraceNotes
+      gTraceFlags [kTraceGraceNotesFlag]
         ||
-      gTraceOptions->fTraceNotes
+      gTraceFlags [kTraceNotesFlag]
     ) {
       fLogOutputStream <<
         endl <<
@@ -6012,7 +6182,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
   // so that the necessary staves/voices have been created
   if (fOnGoingMultipleRest) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMultipleRests) {
+    if (gTraceFlags [kTraceMultipleRestsFlag]) {
       fLogOutputStream <<
         "--> onGoingMultipleRest" <<
         endl <<
@@ -6071,7 +6241,7 @@ void mxmlTree2MsrTranslator::visitEnd (S_measure& elt)
     }
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceMultipleRests) {
+    if (gTraceFlags [kTraceMultipleRestsFlag]) {
       fLogOutputStream <<
         "<-- onGoingMultipleRest" <<
         endl <<
@@ -6106,12 +6276,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_print" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /* JMI
   const int staffSpacing =
@@ -6128,7 +6300,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
       
       // create a barNumberCheck
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceFlags [kTraceMeasuresFlag]) {
         fLogOutputStream << 
           "Creating a barnumber check, " <<
           "line = " << inputLineNumber <<
@@ -6158,7 +6330,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   
       // create a line break
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceFlags [kTraceMeasuresFlag]) {
         fLogOutputStream << 
           "Creating a line break, " <<
           "line = " << inputLineNumber << endl;
@@ -6213,7 +6385,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
   
       // create a page break
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceMeasures) {
+      if (gTraceFlags [kTraceMeasuresFlag]) {
         fLogOutputStream << 
           "Creating a page break, " <<
           "line = " << inputLineNumber << endl;
@@ -6262,12 +6434,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_print& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_system_layout& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_system_layout" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /* JMI
   int inputLineNumber =
@@ -6304,12 +6478,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_system_layout& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_measure_numbering& elt ) 
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_measure_numbering" <<
        ", line " << elt->getInputLineNumber () <<
      endl;
   }
+#endif
 
   // JMI
 }
@@ -6320,12 +6496,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_barline& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_barline" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
       <barline location="right">
@@ -6399,12 +6577,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_bar_style& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bar_style" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string barStyle = elt->getValue();
 
@@ -6470,12 +6650,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_segno& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_segno" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingDirectionType) {
     // fetch current voice
@@ -6508,12 +6690,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_coda& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_coda" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingDirectionType) {
     // fetch current voice
@@ -6545,12 +6729,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_eyeglasses& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_eyeglasses" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingDirectionType) {
     // fetch current voice
@@ -6577,12 +6763,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_pedal& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pedal" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // type
   
@@ -6701,12 +6889,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_ending& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ending" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -6767,12 +6957,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_repeat& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_repeat" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // direction
 
@@ -6864,12 +7056,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_barline" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // is there a pending tuplet?
   if (fTupletsStack.size ()) { // JMI
@@ -6896,7 +7090,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
         fCurrentBarlineTimes);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines) {
+  if (gTraceFlags [kTraceBarlinesFlag]) {
     fLogOutputStream <<
       "Creating barline in part " <<
       fCurrentPart->getPartCombinedName () << ":" <<
@@ -7011,7 +7205,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
         inputLineNumber);
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceFlags [kTraceRepeatsFlag]) {
         fLogOutputStream <<
           "Appending an implicit repeat to part " <<
           fCurrentPart->getPartCombinedName () <<
@@ -7064,7 +7258,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_barline& elt )
               
         // append the bar line to the current part
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceBarlines) {
+        if (gTraceFlags [kTraceBarlinesFlag]) {
           fLogOutputStream <<
             "Appending a barline to part " <<
             fCurrentPart->getPartCombinedName () << ":" <<
@@ -7158,12 +7352,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_note" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // save previous note staff number
   fPreviousNoteMusicXMLStaffNumber = fCurrentMusicXMLStaffNumber;
@@ -7284,12 +7480,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string step = elt->getValue();
   
@@ -7306,12 +7504,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_alter& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float alter = (float)(*elt);
 
@@ -7336,12 +7536,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_alter& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_octave& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_octave" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNoteOctave = (int)(*elt);
 
@@ -7366,17 +7568,19 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_duration" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int duration = (int)(*elt); // divisions
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     fLogOutputStream <<
       "Note duration: " << duration <<
       endl;
@@ -7398,7 +7602,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   else if (fOnGoingNote) {
   
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceFlags [kTraceNotesDetailsFlag]) {
       fLogOutputStream <<
         "fCurrentDivisionsPerQuarterNote: " <<
         fCurrentDivisionsPerQuarterNote <<
@@ -7415,7 +7619,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
     fCurrentNoteSoundingWholeNotesFromDuration.rationalise ();
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceFlags [kTraceNotesDetailsFlag]) {
       fLogOutputStream <<
         "fCurrentNoteSoundingWholeNotesFromDuration: " <<
         fCurrentNoteSoundingWholeNotesFromDuration <<
@@ -7434,7 +7638,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
   else if (fOnGoingFiguredBass) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceFlags [kTraceFiguredBassFlag]) {
       fLogOutputStream <<
         "fCurrentDivisionsPerQuarterNote: " <<
         fCurrentDivisionsPerQuarterNote <<
@@ -7451,7 +7655,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
     fCurrentFiguredBassSoundingWholeNotes.rationalise ();
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceFlags [kTraceFiguredBassFlag]) {
       fLogOutputStream <<
         "fCurrentFiguredBassSoundingWholeNotes: " <<
         fCurrentFiguredBassSoundingWholeNotes <<
@@ -7478,12 +7682,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_duration& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_instrument" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
   <instrument id="P2-I4"/>
@@ -7493,12 +7699,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_instrument& elt )
        
 void mxmlTree2MsrTranslator::visitStart ( S_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_dot" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNoteDotsNumber++;
 }
@@ -7508,12 +7716,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
  Type indicates the graphic note type, Valid values (from shortest to longest) are 1024th, 512th, 256th, 128th, 64th, 32nd, 16th, eighth, quarter, half, whole, breve, long, and maxima. The size attribute indicates full, cue, or large size, with full the default for regular notes and cue the default for cue and grace notes.
@@ -7552,7 +7762,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_type& elt )
   }
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     /* JMI
     fLogOutputStream <<
       "noteType: \"" <<
@@ -7573,12 +7783,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_notehead& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_notehead" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   {
     string noteHead = elt->getValue();
@@ -7708,12 +7920,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental& elt ) // JMI
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accidental" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // value
 
@@ -7876,12 +8090,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_stem& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_stem" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string        stem = elt->getValue();
 
@@ -7924,12 +8140,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beam" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // value
   
@@ -7984,22 +8202,26 @@ void mxmlTree2MsrTranslator::visitStart ( S_beam& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_measure_style& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_measure_style" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
        
 void mxmlTree2MsrTranslator::visitStart ( S_beat_repeat& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_beat_repeat" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentBeatRepeatSlashes = elt->getAttributeIntValue ("slashes", 0);
 
@@ -8029,12 +8251,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_measure_repeat& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_measure_repeat" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
   The multiple-rest and measure-repeat symbols indicate the
@@ -8098,12 +8322,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_multiple_rest& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_multiple_rest" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
   
   fCurrentMultipleRestMeasuresNumber = (int)(*elt);
 
@@ -8147,12 +8373,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_slash" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // type
   
@@ -8232,12 +8460,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_slash_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string slashType = elt->getValue();
 
@@ -8265,7 +8495,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSlashes) {
+  if (gTraceFlags [kTraceSlashesFlag]) {
     fLogOutputStream <<
       "slashType: \"" <<
       slashType <<
@@ -8281,12 +8511,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_slash_type& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_slash_dot& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_slash_dot" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentSlashDotsNumber++;
 }
@@ -8296,12 +8528,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_slash& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_slash" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   S_msrSlash
     slash =
@@ -8317,12 +8551,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_slash& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_articulations& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_articulations" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_accent& elt )
@@ -8330,12 +8566,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accent" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8379,12 +8617,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_breath_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_breath_mark" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8428,12 +8668,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_caesura& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_caesura" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8477,12 +8719,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_spiccato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_spiccato" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8526,12 +8770,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staccato" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8575,12 +8821,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_staccatissimo& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staccatissimo" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8624,12 +8872,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_stress& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_stress" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8673,12 +8923,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_unstress& elt )
    int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+ if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_unstress" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8722,12 +8974,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_detached_legato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+ if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_detached_legato" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
     
   // placement
   
@@ -8771,12 +9025,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_strong_accent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_strong_accent" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8821,12 +9077,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tenuto& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tenuto" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8871,12 +9129,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_doit& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_doit" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8920,12 +9180,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_falloff& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_falloff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -8969,12 +9231,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_plop& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_plop" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -9018,12 +9282,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_scoop" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -9064,12 +9330,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_scoop& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_articulations& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_articulations" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // JMI
 }
@@ -9080,12 +9348,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_arpeggiate& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_arpeggiate" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -9160,12 +9430,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_non_arpeggiate" << // JMI
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -9243,24 +9515,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_non_arpeggiate& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_technical& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_technical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTechnical = true;
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_technical& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_technical" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTechnical = false;
 }
@@ -9270,12 +9546,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_arrow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_arrow" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement = elt->getAttributeValue ("placement");
 
@@ -9313,24 +9591,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_arrow& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_bend_alter& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bend_alter" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fBendAlterValue = (float)(*elt);
 }
   
 void mxmlTree2MsrTranslator::visitStart ( S_bend& elt ) // JMI
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bend" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_bend& elt )
@@ -9338,12 +9620,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_bend& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bend" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement = elt->getAttributeValue ("placement");
 
@@ -9385,12 +9669,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_double_tongue& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_double_tongue" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9432,12 +9718,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_down_bow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_down_bow" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9479,12 +9767,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingering& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fingering" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int fingeringValue = (int)(*elt);
 
@@ -9548,12 +9838,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_fingernails& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fingernails" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9595,12 +9887,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_fret& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fret" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int fretValue = (int)(*elt);
 
@@ -9664,12 +9958,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_hammer_on& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_hammer_on" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // type
   
@@ -9741,12 +10037,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_handbell& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_handbell" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string handBellValue = elt->getValue ();
 
@@ -9794,12 +10092,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmonic& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_harmonic" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9841,12 +10141,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_heel& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_heel" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9888,12 +10190,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_hole& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_hole" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
     
   string
     placement =
@@ -9935,12 +10239,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_open_string& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_open_string" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -9982,12 +10288,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_other_technical& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_other_technical" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string otherTechnicalValue = elt->getValue ();
     
@@ -10033,12 +10341,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_pluck& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pluck" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string pluckValue = elt->getValue ();
     
@@ -10084,12 +10394,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_pull_off& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pull_off" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string pullOffValue = elt->getValue ();
     
@@ -10163,12 +10475,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_snap_pizzicato& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_snap_pizzicato" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10210,12 +10524,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_stopped& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_stopped" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10257,12 +10573,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_string& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_string" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
         <notations>
@@ -10356,12 +10674,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tap& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tap" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10403,12 +10723,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_thumb_position& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_thumb_position" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10450,12 +10772,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_toe& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_toe" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10497,12 +10821,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_triple_tongue& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_triple_tongue" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10544,12 +10870,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_up_bow& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_up_bow" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string
     placement =
@@ -10592,12 +10920,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fermata" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string fermataTextValue = elt->getValue ();
 
@@ -10676,12 +11006,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_fermata& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_ornaments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ornaments" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
@@ -10689,12 +11021,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting tremolo" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // value (tremolo marks number)
   
@@ -10831,7 +11165,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
       // create a single tremolo, it will be attached to current note
       // in attachCurrentSingleTremoloToNote()
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTremolos) {
+      if (gTraceFlags [kTraceTremolosFlag]) {
         fLogOutputStream <<
           "Creating a single tremolo" <<
           ", line " << inputLineNumber <<
@@ -10865,7 +11199,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
 
         // create a double tremolo start
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTremolos) {
+        if (gTraceFlags [kTraceTremolosFlag]) {
           fLogOutputStream <<
             "Creating a double tremolo" <<
             ", line " << inputLineNumber <<
@@ -10907,7 +11241,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tremolo& elt )
     case kTremoloTypeStop:
       if (fCurrentDoubleTremolo) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTremolos) {
+        if (gTraceFlags [kTraceTremolosFlag]) {
           fLogOutputStream <<
             "Meeting a double tremolo stop" <<
             ", line " << inputLineNumber <<
@@ -10940,12 +11274,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_trill_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_trill_mark" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
  // type : upright inverted  (Binchois20.xml) JMI
 
@@ -10991,12 +11327,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_dashes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_dashes" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
  // type : upright inverted  (Binchois20.xml) JMI
 
@@ -11077,12 +11415,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_wavy_line& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_wavy_line" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
 <!ELEMENT wavy-line EMPTY>
@@ -11209,12 +11549,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_turn" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11258,12 +11600,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_inverted_turn" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11307,12 +11651,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_delayed_turn" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11356,12 +11702,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_delayed_inverted_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_delayed_inverted_turn" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11405,12 +11753,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_vertical_turn& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_vertical_turn" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11454,12 +11804,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_mordent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_mordent" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11503,12 +11855,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_inverted_mordent& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_inverted_mordent" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11552,12 +11906,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_schleifer& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_schleifer" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11601,12 +11957,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_shake& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_shake" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11650,12 +12008,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accidental_mark" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string accidentalMark = elt->getValue ();
 
@@ -11746,12 +12106,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_accidental_mark& elt )
 
 void mxmlTree2MsrTranslator::visitEnd ( S_ornaments& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_ornaments" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //______________________________________________________________________________
@@ -11760,12 +12122,14 @@ void mxmlTree2MsrTranslator::visitStart( S_f& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_f" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // placement
   
@@ -11808,12 +12172,14 @@ void mxmlTree2MsrTranslator::visitStart( S_ff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -11854,12 +12220,14 @@ void mxmlTree2MsrTranslator::visitStart( S_fff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -11900,12 +12268,14 @@ void mxmlTree2MsrTranslator::visitStart( S_ffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ffff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -11946,12 +12316,14 @@ void mxmlTree2MsrTranslator::visitStart( S_fffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fffff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -11992,12 +12364,14 @@ void mxmlTree2MsrTranslator::visitStart( S_ffffff& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ffffff" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12039,12 +12413,14 @@ void mxmlTree2MsrTranslator::visitStart( S_p& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_p" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12085,12 +12461,14 @@ void mxmlTree2MsrTranslator::visitStart( S_pp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12131,12 +12509,14 @@ void mxmlTree2MsrTranslator::visitStart( S_ppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ppp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12177,12 +12557,14 @@ void mxmlTree2MsrTranslator::visitStart( S_pppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pppp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12223,12 +12605,14 @@ void mxmlTree2MsrTranslator::visitStart( S_ppppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_ppppp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12269,12 +12653,14 @@ void mxmlTree2MsrTranslator::visitStart( S_pppppp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pppppp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12317,12 +12703,14 @@ void mxmlTree2MsrTranslator::visitStart( S_mf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_mf" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12363,12 +12751,14 @@ void mxmlTree2MsrTranslator::visitStart( S_mp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_mp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12410,12 +12800,14 @@ void mxmlTree2MsrTranslator::visitStart( S_fp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12456,12 +12848,14 @@ void mxmlTree2MsrTranslator::visitStart( S_fz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_fz" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12503,12 +12897,14 @@ void mxmlTree2MsrTranslator::visitStart( S_rf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_rf" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12550,12 +12946,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sf& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sf" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12597,12 +12995,14 @@ void mxmlTree2MsrTranslator::visitStart( S_rfz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_rfz" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12643,12 +13043,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sfz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sfz" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12689,12 +13091,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sfp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sfp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12735,12 +13139,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sfpp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sfpp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12781,12 +13187,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sffz& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
- if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+ if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sffz" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string placement =
     elt->getAttributeValue ("placement");
@@ -12828,12 +13236,14 @@ void mxmlTree2MsrTranslator::visitStart( S_other_dynamics& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_other_dynamics" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string otherDynamicsValue = elt->getValue ();
 
@@ -12894,7 +13304,7 @@ void mxmlTree2MsrTranslator::visitStart( S_damper_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_damper_pedal" <<
       ", line " << inputLineNumber <<
@@ -12960,7 +13370,7 @@ void mxmlTree2MsrTranslator::visitStart( S_soft_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_soft_pedal" <<
        ", line " << inputLineNumber <<
@@ -12983,7 +13393,7 @@ void mxmlTree2MsrTranslator::visitStart( S_sostenuto_pedal& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sostenuto_pedal" <<
       ", line " << inputLineNumber <<
@@ -13005,12 +13415,14 @@ void mxmlTree2MsrTranslator::visitStart( S_sostenuto_pedal& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_cue& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_cue" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
  
   fCurrentNoteIsACueNote = true;
 }
@@ -13021,12 +13433,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_grace& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_grace" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
  
   fCurrentNoteIsAGraceNote = true;
 
@@ -13079,12 +13493,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_grace& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_chord& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_chord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // the current note belongs to a chord,
   // placed in the corresponding staff AND voice
@@ -13098,12 +13514,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_chord& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_time_modification& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_time_modification" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // there may be no '<tuplet number="n" type="start" />'
   // in the tuplet notes after the first one,
@@ -13116,12 +13534,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_actual_notes" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int actualNotes = (int)(*elt);
 
@@ -13130,9 +13550,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceFlags [kTraceNotesDetailsFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "fCurrentNoteActualNotes: " <<
         fCurrentNoteActualNotes <<
@@ -13156,9 +13576,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_actual_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceFlags [kTraceTemposFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteActualNotes: " <<
         fCurrentMetronomeNoteActualNotes <<
@@ -13187,12 +13607,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_normal_notes" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   int normalNotes = (int)(*elt);
 
@@ -13201,9 +13623,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceFlags [kTraceNotesDetailsFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "fCurrentNoteNormalNotes: " <<
         fCurrentNoteNormalNotes <<
@@ -13227,9 +13649,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_notes& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceFlags [kTraceTemposFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteNormalNotes: " <<
         fCurrentMetronomeNoteNormalNotes <<
@@ -13258,21 +13680,23 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_normal_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string normalTypeString = elt->getValue();
 
   if (fOnGoingNote) {        
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceFlags [kTraceNotesDetailsFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "normalTypeString: " <<
         normalTypeString <<
@@ -13301,9 +13725,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_normal_type& elt )
     
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTempos
+      gTraceFlags [kTraceTemposFlag]
         ||
-      gTraceOptions->fTraceTuplets) {
+      gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "fCurrentMetronomeNoteNormalType: " <<
         fCurrentMetronomeNoteNormalType <<
@@ -13334,12 +13758,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // number
 
@@ -13374,7 +13800,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
       }
       else {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceTupletsFlag]) {
           stringstream s;
           
           s <<
@@ -13432,7 +13858,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     
     if      (tupletType == "start") {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets) {
+      if (gTraceFlags [kTraceTupletsFlag]) {
         fLogOutputStream <<
           "--> There is a tuplet start (kTupletTypeStart)" <<
           ", line " << inputLineNumber <<
@@ -13444,7 +13870,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
     }
     else if (tupletType == "continue") {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets) {
+      if (gTraceFlags [kTraceTupletsFlag]) {
         fLogOutputStream <<
           "--> There is a tuplet continue (kTupletTypeContinue)" <<
           ", line " << inputLineNumber <<
@@ -13468,7 +13894,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
         // for one and the same tuplet number:
         // possible if the note is a tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceTupletsFlag]) {
           fLogOutputStream <<
             "--> There is a tuplet stop right after a tuplet start for tuplet nummber " << fCurrentTupletNumber <<
             " (kTupletTypeStartAndStopInARow)" <<
@@ -13482,7 +13908,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
       else {
         // this is a 'regular' tuplet stop
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceTupletsFlag]) {
           fLogOutputStream <<
             "--> There is a tuplet stop (kTupletTypeStop)" <<
             ", line " << inputLineNumber <<
@@ -13565,9 +13991,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "fCurrentTupletNumber: " <<
       fCurrentTupletNumber <<
@@ -13592,48 +14018,56 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_tuplet_actual& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_actual" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTupletActual = true;
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_tuplet_actual& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_tuplet_actual" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTupletActual = false;
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_tuplet_normal& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_normal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTupletNormal = true;
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_tuplet_normal& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_tuplet_normal" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fOnGoingTupletNormal = false;
 }
@@ -13643,12 +14077,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_number" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // not handled JMI
   int tupletNumberValue = (int)(*elt);
@@ -13669,9 +14105,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_number& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "tuplet number (not handled): " <<
       tupletNumberValue <<
@@ -13685,12 +14121,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // not handled JMI
   string tupletTypeValue = elt->getValue();
@@ -13711,9 +14149,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_type& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTuplets) {
+    gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "tuplet type (not handled): " <<
       tupletTypeValue <<
@@ -13727,12 +14165,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_tuplet_dot& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_tuplet_dot" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingTupletActual) {
     fCurrentTupletActualDotsNumber++;
@@ -13755,12 +14195,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_glissando" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // glissando text, i.e. the text along it
   string glissandoTextValue = elt->getValue ();
@@ -13826,9 +14268,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceGlissandos) {
+    gTraceFlags [kTraceGlissandosFlag]) {
     fLogOutputStream <<
       "glissandoNumber: " <<
       glissandoNumber <<
@@ -13857,9 +14299,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_glissando& elt )
   // register glissando in this visitor
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceGlissandos) {
+    gTraceFlags [kTraceGlissandosFlag]) {
     fLogOutputStream <<
       "Appending glissando '" <<
       glissando->asString () <<
@@ -13877,12 +14319,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_slide" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // slide text, i.e. the text along it
   string slideTextValue = elt->getValue ();
@@ -13948,9 +14392,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceSlides) {
+    gTraceFlags [kTraceSlidesFlag]) {
     fLogOutputStream <<
       "slideNumber: " <<
       slideNumber <<
@@ -13977,9 +14421,9 @@ void mxmlTree2MsrTranslator::visitStart ( S_slide& elt )
   // register glissando in this visitor
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceSlides) {
+    gTraceFlags [kTraceSlidesFlag]) {
     fLogOutputStream <<
       "Appending slide '" <<
       slide->asString () <<
@@ -13997,12 +14441,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_rest& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_rest" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   /*
       <note>
@@ -14050,12 +14496,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_display_step& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_display_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string displayStep = elt->getValue();
   
@@ -14074,24 +14522,28 @@ void mxmlTree2MsrTranslator::visitStart ( S_display_step& elt)
 
 void mxmlTree2MsrTranslator::visitStart ( S_display_octave& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_display_octave" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentDisplayOctave = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_unpitched& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_unpitched" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentNoteIsUnpitched = true;
   
@@ -14110,7 +14562,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
     chordFirstNote->getInputLineNumber ();
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceNotesFlag]) {
     fLogOutputStream <<
       "--> creating a chord from its first note '" <<
       chordFirstNote->asShortString () <<
@@ -14140,7 +14592,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
   
   // register note as first member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceNotesFlag]) {
     fLogOutputStream <<
       "Adding first note " <<
       chordFirstNote->
@@ -14164,7 +14616,7 @@ S_msrChord mxmlTree2MsrTranslator::createChordFromItsFirstNote (
     chordFirstNote, chord);
 
 #ifdef TRACE_OPTIONS
-  if (false && (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes)) {
+  if (false && (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceNotesFlag])) {
     fLogOutputStream << // JMI
       endl <<
       endl <<
@@ -14207,7 +14659,7 @@ void mxmlTree2MsrTranslator::registerVoiceCurrentChordInMap (
   S_msrChord chord)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "Registering chord '" <<
       chord->asString () <<
@@ -14227,7 +14679,7 @@ void mxmlTree2MsrTranslator::registerVoiceCurrentChordInMap (
       chord;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceFlags [kTraceChordsDetailsFlag]) {
     printCurrentChord ();
   }
 #endif
@@ -14344,7 +14796,7 @@ void mxmlTree2MsrTranslator::copyNoteArticulationsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceNotes) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceNotesFlag]) {
       fLogOutputStream <<
         "Copying articulation '" <<
         (*i)->articulationKindAsString () <<
@@ -14377,9 +14829,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalsToChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTechnicals
+    gTraceFlags [kTraceTechnicalsFlag]
     ) {
     fLogOutputStream <<
       "Copying technical '" <<
@@ -14413,9 +14865,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithIntegersToChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceTechnicals
+    gTraceFlags [kTraceTechnicalsFlag]
     ) {
     fLogOutputStream <<
       "Copying technical '" <<
@@ -14449,9 +14901,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithFloatsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotesDetails
+      gTraceFlags [kTraceNotesDetailsFlag]
         ||
-      gTraceOptions->fTraceTechnicals
+      gTraceFlags [kTraceTechnicalsFlag]
       ) {
       fLogOutputStream <<
         "Copying technical '" <<
@@ -14485,9 +14937,9 @@ void mxmlTree2MsrTranslator::copyNoteTechnicalWithStringsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceTechnicals
+      gTraceFlags [kTraceTechnicalsFlag]
         ||
-      gTraceOptions->fTraceChords
+      gTraceFlags [kTraceChordsFlag]
       ) {
       fLogOutputStream <<
         "Copying technical '" <<
@@ -14521,9 +14973,9 @@ void mxmlTree2MsrTranslator::copyNoteOrnamentsToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceOrnaments
+      gTraceFlags [kTraceOrnamentsFlag]
         ||
-      gTraceOptions->fTraceChords) {
+      gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying ornament '" <<
         (*i)->ornamentKindAsString () <<
@@ -14557,9 +15009,9 @@ void mxmlTree2MsrTranslator::copyNoteSpannersToChord (
 
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceSpanners
+      gTraceFlags [kTraceSpannersFlag]
         ||
-      gTraceOptions->fTraceChords) {
+      gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying spanner '" <<
         (*i)->spannerKindAsString () <<
@@ -14587,7 +15039,7 @@ void mxmlTree2MsrTranslator::copyNoteSingleTremoloToChord (
 
   if (noteSingleTremolo) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTremolos || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceTremolosFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying singleTremolo '" <<
         noteSingleTremolo->asString () <<
@@ -14620,7 +15072,7 @@ void mxmlTree2MsrTranslator::copyNoteDynamicsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceDynamics) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceDynamicsFlag]) {
       fLogOutputStream <<
         "Copying dynamics '" <<
         (*i)->dynamicsKindAsString () <<
@@ -14653,7 +15105,7 @@ void mxmlTree2MsrTranslator::copyNoteOtherDynamicsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceDynamics) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceDynamicsFlag]) {
       fLogOutputStream <<
         "Copying other dynamics '" <<
         (*i)->asString () <<
@@ -14686,7 +15138,7 @@ void mxmlTree2MsrTranslator::copyNoteWordsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceWords) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceWordsFlag]) {
       fLogOutputStream <<
         "Copying words '" <<
         (*i)->asString () <<
@@ -14714,7 +15166,7 @@ void mxmlTree2MsrTranslator::copyNoteStemToChord (
 
   if (noteStem) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceStems || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceStemsFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying stem '" <<
         noteStem->asString () <<
@@ -14747,7 +15199,7 @@ void mxmlTree2MsrTranslator::copyNoteBeamsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceBeamsFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying beam '" <<
         (*i)->asString () <<
@@ -14762,7 +15214,7 @@ void mxmlTree2MsrTranslator::copyNoteBeamsToChord (
   } // for      
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBeams || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceBeamsFlag] || gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "==> AFTER copying beams to chord:" <<
       endl;
@@ -14791,7 +15243,7 @@ void mxmlTree2MsrTranslator::copyNoteTieToChord (
 
   if (noteTie) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceTies) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceTiesFlag]) {
       fLogOutputStream <<
         "Copying tie '" <<
         noteTie->asString () <<
@@ -14824,7 +15276,7 @@ void mxmlTree2MsrTranslator::copyNoteSlursToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceSlurs) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceSlursFlag]) {
       fLogOutputStream <<
         "Copying slur '" <<
         (*i)->asString () <<
@@ -14857,7 +15309,7 @@ void mxmlTree2MsrTranslator::copyNoteLigaturesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceLigatures) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceLigaturesFlag]) {
       fLogOutputStream <<
         "Copying ligature '" <<
         (*i)->ligatureKindAsString () <<
@@ -14890,7 +15342,7 @@ void mxmlTree2MsrTranslator::copyNotePedalsToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTracePedals) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTracePedalsFlag]) {
       fLogOutputStream <<
         "Copying pedal '" <<
         (*i)->pedalTypeAsString () <<
@@ -14923,7 +15375,7 @@ void mxmlTree2MsrTranslator::copyNoteSlashesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceSlashes) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceSlashesFlag]) {
       fLogOutputStream <<
         "Copying slash '" <<
         (*i)->asString () <<
@@ -14956,7 +15408,7 @@ void mxmlTree2MsrTranslator::copyNoteWedgesToChord (
     i++) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords || gTraceOptions->fTraceWedges) {
+    if (gTraceFlags [kTraceChordsFlag] || gTraceFlags [kTraceWedgesFlag]) {
       fLogOutputStream <<
         "Copying wedges '" <<
         (*i)->wedgeKindAsString () <<
@@ -14982,7 +15434,7 @@ void mxmlTree2MsrTranslator::copyNoteGraceNotesGroupsToChord (
                           
   if (graceNotesGroupBefore) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying grace notes group before '" <<
         graceNotesGroupBefore->asShortString () <<
@@ -15004,7 +15456,7 @@ void mxmlTree2MsrTranslator::copyNoteGraceNotesGroupsToChord (
                           
   if (graceNotesGroupAfter) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGraceNotes || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceGraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying grace notes group after '" <<
         graceNotesGroupAfter->asShortString () <<
@@ -15033,7 +15485,7 @@ void mxmlTree2MsrTranslator::copyNoteHarmonyToChord (
                           
   if (harmony) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceHarmonies || gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceHarmoniesFlag] || gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Copying harmony '" <<
         harmony->asString () <<
@@ -15120,7 +15572,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
 
   // create a tuplet
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "Creating a '" <<
       fCurrentNoteActualNotes <<
@@ -15168,7 +15620,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
       nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     // only after addNoteToTuplet() has set the note's tuplet uplink
     fLogOutputStream <<
       "Adding first note " <<
@@ -15183,7 +15635,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
       
   // register tuplet in this visitor
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceNotesFlag]) {
     fLogOutputStream <<
       "++> pushing tuplet '" <<
       tuplet->asString () <<
@@ -15195,7 +15647,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
   fTupletsStack.push_front (tuplet);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceFlags [kTraceTupletsDetailsFlag]) {
     displayTupletsStack (
       "############## After  createTupletWithItsFirstNoteAndPushItToTupletsStack()");
   }
@@ -15225,7 +15677,7 @@ void mxmlTree2MsrTranslator::createTupletWithItsFirstNoteAndPushItToTupletsStack
     tuplet;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceFlags [kTraceTupletsDetailsFlag]) {
     displayLastHandledTupletInVoiceMap (
       "############## Before fLastHandledTupletInVoiceMap");
   }
@@ -15237,7 +15689,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack(), " <<
       "line " << inputLineNumber <<
@@ -15246,7 +15698,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 #endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     displayTupletsStack (
       "############## Before  finalizeTupletAndPopItFromTupletsStack()");
   }
@@ -15275,7 +15727,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 /* JMI
   // add lastNote to the tuplet
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "==> adding last note " << lastNote->asString () <<
       " to tuplets stack top " <<
@@ -15289,7 +15741,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
 
   // pop from the tuplets stack
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "Popping tuplet '" <<
       tuplet->asString () <<
@@ -15304,7 +15756,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   if (fTupletsStack.size ()) {
     // tuplet is a nested tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "=== adding nested tuplet '" <<
       tuplet->asString () <<
@@ -15323,7 +15775,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   else {
     // tuplet is a top level tuplet
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "=== adding top level tuplet '" <<
       tuplet->asString () <<
@@ -15343,7 +15795,7 @@ void mxmlTree2MsrTranslator::finalizeTupletAndPopItFromTupletsStack (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     displayTupletsStack (
       "############## After  finalizeTupletAndPopItFromTupletsStack()");
   }
@@ -15358,7 +15810,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToNote (
   if (fCurrentArticulations.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceArticulations) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceArticulationsFlag]) {
       fLogOutputStream <<
         "Attaching current articulations to note " <<
         note->asString () <<
@@ -15372,7 +15824,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToNote (
           fCurrentArticulations.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Attaching articulation '" <<
           art->articulationKindAsString () <<
@@ -15398,7 +15850,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalsToNote (
   if (fCurrentTechnicalsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
       fLogOutputStream <<
         "Attaching current technicals to note " <<
         note->asString () <<
@@ -15412,7 +15864,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalsToNote (
           fCurrentTechnicalsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+      if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
         fLogOutputStream <<
           "Attaching technical '" <<
           tech->asString () <<
@@ -15438,7 +15890,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithIntegersToNote (
   if (fCurrentTechnicalWithIntegersList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
       fLogOutputStream <<
         "Attaching current technical with integers to note " <<
         note->asString () <<
@@ -15452,7 +15904,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithIntegersToNote (
           fCurrentTechnicalWithIntegersList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+      if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
         fLogOutputStream <<
           "Attaching technical with integer '" <<
           tech->asString () <<
@@ -15478,7 +15930,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithFloatsToNote (
   if (fCurrentTechnicalWithFloatsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
       fLogOutputStream <<
         "Attaching current technical with floats to note " <<
         note->asString () <<
@@ -15492,7 +15944,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithFloatsToNote (
           fCurrentTechnicalWithFloatsList.front();
           
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
         fLogOutputStream <<
           "Attaching technical with integer '" <<
           tech->asString () <<
@@ -15518,7 +15970,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithStringsToNote (
   if (fCurrentTechnicalWithStringsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTechnicals) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTechnicalsFlag]) {
       fLogOutputStream <<
         "Attaching current technical with strings to note " <<
         note->asString () <<
@@ -15532,7 +15984,7 @@ void mxmlTree2MsrTranslator::attachCurrentTechnicalWithStringsToNote (
           fCurrentTechnicalWithStringsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTechnicals) {
+      if (gTraceFlags [kTraceTechnicalsFlag]) {
         fLogOutputStream <<
           "Attaching technical with string '" <<
           tech->asString () <<
@@ -15558,7 +16010,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToNote (
   if (fCurrentOrnamentsList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOrnaments) {
+    if (gTraceFlags [kTraceOrnamentsFlag]) {
       fLogOutputStream <<
         "Attaching current ornaments to note " <<
         note->asString () <<
@@ -15572,7 +16024,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToNote (
           fCurrentOrnamentsList.front();
           
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotes) {
+      if (gTraceFlags [kTraceNotesFlag]) {
         fLogOutputStream <<
           "Attaching ornament '" <<
           orn->ornamentKindAsString () <<
@@ -15598,7 +16050,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
   if (fCurrentSpannersList.size ()) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSpanners) {
+    if (gTraceFlags [kTraceSpannersFlag]) {
       fLogOutputStream <<
         "Attaching current spanners to note " <<
         note->asString () <<
@@ -15654,7 +16106,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
 
       if (doHandleSpanner) {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSpanners) {
+        if (gTraceFlags [kTraceSpannersFlag]) {
           fLogOutputStream <<
             "Attaching spanner '" <<
             spanner->spannerKindAsString () <<
@@ -15676,7 +16128,7 @@ void mxmlTree2MsrTranslator::attachCurrentSpannersToNote (
 
       else { // check it is the same spanner kind JMI
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceSpanners) {
+        if (gTraceFlags [kTraceSpannersFlag]) {
           fLogOutputStream <<
             "Spanner start amd stop on one and the same note' to note " <<
             note->asString () <<
@@ -15709,7 +16161,7 @@ void mxmlTree2MsrTranslator::attachCurrentSingleTremoloToNote (
   if (fCurrentSingleTremolo) {
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes) {
+    if (gTraceFlags [kTraceNotesFlag]) {
       fLogOutputStream <<
         "Attaching current singleTremolo to note " <<
         note->asString () <<
@@ -15739,7 +16191,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToChord ( // JMI
   if (fCurrentArticulations.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Attaching current articulations to chord " <<
         chord->asString () <<
@@ -15753,7 +16205,7 @@ void mxmlTree2MsrTranslator::attachCurrentArticulationsToChord ( // JMI
       i!=fCurrentArticulations.end ();
       i++) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceChords) {
+      if (gTraceFlags [kTraceChordsFlag]) {
         fLogOutputStream <<
           "Attaching articulation " <<  (*i) <<
           " to chord " << chord <<
@@ -15776,7 +16228,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToChord ( // JMI
   if (fCurrentOrnamentsList.size ()) {
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Attaching current ornaments to chord " <<
         chord->asString () <<
@@ -15790,7 +16242,7 @@ void mxmlTree2MsrTranslator::attachCurrentOrnamentsToChord ( // JMI
       i!=fCurrentOrnamentsList.end ();
       i++) {
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceChords) {
+      if (gTraceFlags [kTraceChordsFlag]) {
         fLogOutputStream <<
           "Attaching ornament " <<  (*i) << " to chord " <<
           chord <<
@@ -15812,7 +16264,7 @@ void mxmlTree2MsrTranslator::attachPendingTemposToTheVoiceOfNote (
  // attach the pending tempos if any to the note
   if (fPendingTempos.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // tempos ??? JMI
+    if (gTraceFlags [kTracePassesFlag]) { // tempos ??? JMI
       fLogOutputStream <<
         "Attaching pending tempos to note " <<
         note->asString () <<
@@ -15849,7 +16301,7 @@ void mxmlTree2MsrTranslator::attachPendingRehearsalsToTheVoiceOfNote (
  // attach the pending rehearsals if any to the note
   if (fPendingRehearsals.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // Rehearsals ??? JMI
+    if (gTraceFlags [kTracePassesFlag]) { // Rehearsals ??? JMI
       fLogOutputStream <<
         "Attaching pending rehearsals to note " <<
         note->asString () <<
@@ -15886,7 +16338,7 @@ void mxmlTree2MsrTranslator::attachPendingEyeGlassesToNote (
  // attach the pending eyeglasses if any to the note
   if (fPendingEyeGlasses.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // EyeGlasses ??? JMI
+    if (gTraceFlags [kTracePassesFlag]) { // EyeGlasses ??? JMI
       fLogOutputStream <<
         "Attaching pending eyeglasses to note " <<
         note->asString () <<
@@ -15914,7 +16366,7 @@ void mxmlTree2MsrTranslator::attachPendingDampsToNote (
  // attach the pending damps if any to the note
   if (fPendingDamps.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceFlags [kTracePassesFlag]) {
       fLogOutputStream <<
         "Attaching pending damps to note " <<
         note->asString () <<
@@ -15942,7 +16394,7 @@ void mxmlTree2MsrTranslator::attachPendingDampAllsToNote (
  // attach the pending damp alls if any to the note
   if (fPendingDampAlls.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceFlags [kTracePassesFlag]) {
       fLogOutputStream <<
         "Attaching pending damp alls to note " <<
         note->asString () <<
@@ -15970,7 +16422,7 @@ void mxmlTree2MsrTranslator::attachPendingOctaveShiftsToNote (
  // attach the pending octave shifts if any to the note
   if (fPendingOctaveShifts.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceOctaveShifts) {
+    if (gTraceFlags [kTraceOctaveShiftsFlag]) {
       fLogOutputStream <<
         "Attaching pending octave shifts to note " <<
         note->asString () <<
@@ -16008,7 +16460,7 @@ void mxmlTree2MsrTranslator::attachPendingScordaturasToNote (
  // attach the pending scordatura if any to the note
   if (fPendingScordaturas.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) {
+    if (gTraceFlags [kTracePassesFlag]) {
       fLogOutputStream <<
         "Attaching pending scordaturas to note " <<
         note->asString () <<
@@ -16038,7 +16490,7 @@ void mxmlTree2MsrTranslator::attachPendingDynamicsToNote (
     bool delayAttachment = false;
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDynamics) {
+    if (gTraceFlags [kTraceDynamicsFlag]) {
       fLogOutputStream <<
         "Attaching pending dynamics to note " <<
         note->asString () <<
@@ -16100,7 +16552,7 @@ void mxmlTree2MsrTranslator::attachPendingOtherDynamicsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceDynamics) {
+    if (gTraceFlags [kTraceDynamicsFlag]) {
       fLogOutputStream <<
         "Attaching pending other dynamics to note " <<
         note->asString () <<
@@ -16162,7 +16614,7 @@ void mxmlTree2MsrTranslator::attachPendingWordsToNote (
     bool delayAttachment = false;
     
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWords) {
+    if (gTraceFlags [kTraceWordsFlag]) {
       fLogOutputStream <<
         "Attaching pending words to note " <<
         note->asString () <<
@@ -16225,7 +16677,7 @@ void mxmlTree2MsrTranslator::attachPendingBeamsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceBeams) {
+    if (gTraceFlags [kTraceBeamsFlag]) {
       fLogOutputStream <<
         "Attaching pending beams to note " <<
         note->asString () <<
@@ -16287,7 +16739,7 @@ void mxmlTree2MsrTranslator::attachPendingSlursToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSlurs) {
+    if (gTraceFlags [kTraceSlursFlag]) {
       fLogOutputStream <<
         "Attaching pending slurs to note " <<
         note->asString () <<
@@ -16438,7 +16890,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
               case 1:
               case 3:
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceLigatures) {
+                if (gTraceFlags [kTraceLigaturesFlag]) {
                   fLogOutputStream <<
                     "Attaching pending ligature above to note '" <<
                     note->asString () <<
@@ -16463,7 +16915,7 @@ void mxmlTree2MsrTranslator::attachPendingLigaturesToNote (
               case 2:
               case 4:
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceLigatures) {
+                if (gTraceFlags [kTraceLigaturesFlag]) {
                   fLogOutputStream <<
                     "Attaching pending ligature below to note '" <<
                     note->asString () <<
@@ -16510,7 +16962,7 @@ void mxmlTree2MsrTranslator::attachPendingPedalsToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePedals) {
+    if (gTraceFlags [kTracePedalsFlag]) {
       fLogOutputStream <<
         "Attaching pending pedals to note " <<
         note->asString () <<
@@ -16572,7 +17024,7 @@ void mxmlTree2MsrTranslator::attachPendingSlashesToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceSlashes) {
+    if (gTraceFlags [kTraceSlashesFlag]) {
       fLogOutputStream <<
         "Attaching pending slashes to note " <<
         note->asString () <<
@@ -16634,7 +17086,7 @@ void mxmlTree2MsrTranslator::attachPendingWedgesToNote (
     bool delayAttachment = false;
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceWedges) {
+    if (gTraceFlags [kTraceWedgesFlag]) {
       fLogOutputStream <<
         "Attaching pending wedges to note " <<
         note->asString () <<
@@ -16694,7 +17146,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
  // attach the pending glissandos if any to the note
   if (fPendingGlissandos.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceGlissandos) {
+    if (gTraceFlags [kTraceGlissandosFlag]) {
       fLogOutputStream <<
         "Attaching pending glissandos to note " <<
         note->asString () <<
@@ -16736,7 +17188,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
                 getVoiceStanzasMap ();
                     
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceGlissandos) {
+              if (gTraceFlags [kTraceGlissandosFlag]) {
                 fLogOutputStream <<
                   "--> attachPendingGlissandosToNote()"
                   ", voiceStanzasMap.size () = " <<
@@ -16754,7 +17206,7 @@ void mxmlTree2MsrTranslator::attachPendingGlissandosToNote (
             if (! fCurrentNoteHasLyrics) {
               // append a skip to lyrics the same duration as the note
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceGlissandos) {
+              if (gTraceFlags [kTraceGlissandosFlag]) {
                 fLogOutputStream <<
                   "Attaching a skip syllable to note '" <<
                   note->asString () <<
@@ -16807,7 +17259,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
  // attach the pending slides if any to the note
   if (fPendingSlides.size ()) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTracePasses) { // slides ??? JMI
+    if (gTraceFlags [kTracePassesFlag]) { // slides ??? JMI
       fLogOutputStream <<
         "Attaching pending slides to note " <<
         note->asString () <<
@@ -16849,7 +17301,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
                 getVoiceStanzasMap ();
                     
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlides) {
+              if (gTraceFlags [kTraceSlidesFlag]) {
                 fLogOutputStream <<
                   "--> attachPendingSlidesToNote()"
                   ", voiceStanzasMap.size () = " <<
@@ -16867,7 +17319,7 @@ void mxmlTree2MsrTranslator::attachPendingSlidesToNote (
             if (! fCurrentNoteHasLyrics) {
               // append a skip to lyrics the same duration as the note
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceSlides) {
+              if (gTraceFlags [kTraceSlidesFlag]) {
                 fLogOutputStream <<
                   "Attaching a skip syllable to note '" <<
                   note->asString () <<
@@ -16977,12 +17429,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_note" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   /*
   This is a complex method, due to the fact that
@@ -17031,7 +17485,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
           fCurrentNoteGraphicDurationKind);
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotesDetails) {
+      if (gTraceFlags [kTraceNotesDetailsFlag]) {
         fLogOutputStream <<
           endl <<
           "(1):" <<
@@ -17068,7 +17522,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
           dots--;
 
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotesDetails) {
+          if (gTraceFlags [kTraceNotesDetailsFlag]) {
             fLogOutputStream <<
               endl <<
               "(2):" <<
@@ -17091,7 +17545,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       }
       
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceNotesDetails) {
+      if (gTraceFlags [kTraceNotesDetailsFlag]) {
         fLogOutputStream <<
           endl <<
           "(3):" <<
@@ -17121,7 +17575,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         );
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceVoicesFlag]) {
     fLogOutputStream <<
       "--> fCurrentMusicXMLVoiceNumber        = " <<
       fCurrentMusicXMLVoiceNumber <<
@@ -17145,7 +17599,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 */
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {
+  if (gTraceFlags [kTraceNotesFlag]) {
     fLogOutputStream <<
       "--> Gathered note information:" <<
       endl;
@@ -17224,7 +17678,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) { // JMI
+  if (gTraceFlags [kTraceNotesFlag]) { // JMI
     fLogOutputStream <<
       endl <<
       "==> BEFORE visitEnd (S_note&)" <<
@@ -17384,7 +17838,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
         fCurrentNoteHeadParenthesesKind);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotesDetails) {
+  if (gTraceFlags [kTraceNotesDetailsFlag]) {
     fLogOutputStream <<
       "Creating note:" <<
       endl;
@@ -17435,7 +17889,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   // set current staff number to insert into if needed JMI ???
   if (fCurrentStaffNumberToInsertInto == K_NO_STAFF_NUMBER) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+    if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceStavesFlag]) {
       fLogOutputStream <<
         "==> setting fCurrentStaffNumberToInsertInto to " <<
         fCurrentMusicXMLStaffNumber <<
@@ -17451,7 +17905,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   }
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceStavesFlag]) {
     fLogOutputStream <<
       "==> fetching voice to insert into" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -17481,7 +17935,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
     "voiceToInsertInto is null");
         
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceStavesFlag]) {
     fLogOutputStream <<
       "==> is there a staff change?" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -17531,9 +17985,9 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceStaves
+        gTraceFlags [kTraceStavesFlag]
           ||
-        gTraceOptions->fTraceVoices
+        gTraceFlags [kTraceVoicesFlag]
       ) {
         fLogOutputStream <<
           "*** There is staff change for chord member note '" <<
@@ -17564,9 +18018,9 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 #ifdef TRACE_OPTIONS
       if (
-        gTraceOptions->fTraceStaves
+        gTraceFlags [kTraceStavesFlag]
           ||
-        gTraceOptions->fTraceVoices
+        gTraceFlags [kTraceVoicesFlag]
       ) {
         fLogOutputStream <<
           "*** There is staff change for note '" <<
@@ -17763,7 +18217,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
 /* JMI
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) { // JMI
+  if (gTraceFlags [kTraceNotesFlag]) { // JMI
      const int fieldWidth = 27;
 
     fLogOutputStream << left <<
@@ -17853,7 +18307,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
   // so that it gets attached to the note right now
   if (fPendingFiguredBass) {
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceFiguredBass) {
+    if (gTraceFlags [kTraceFiguredBassFlag]) {
       fLogOutputStream <<
         "--> figured bass" <<
         ", line " << inputLineNumber << ":" <<
@@ -17957,7 +18411,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
 
   // register newNote as the last found note for the current voice  
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "--> STORING " <<
       newNote->asShortString () <<
@@ -17989,7 +18443,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_note& elt )
       newNote;
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "--> AFTER STORING " <<
       endl;
@@ -18058,7 +18512,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) { // JMI
+  if (gTraceFlags [kTraceChordsFlag]) { // JMI
     fLogOutputStream <<
       "handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRest(), newNote = " <<
       endl;
@@ -18079,7 +18533,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
         fCurrentMusicXMLVoiceNumber);
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes) {    
+  if (gTraceFlags [kTraceNotesFlag]) {    
     fLogOutputStream <<
       "Handling a standalone, double tremolo or grace note or rest" <<
       ", currentVoice = \"" <<
@@ -18107,7 +18561,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       booleanAsString (fCurrentNoteIsAGraceNote) <<
       endl;
 
-    if (gTraceOptions->fTraceNotesDetails) {
+    if (gTraceFlags [kTraceNotesDetailsFlag]) {
       fLogOutputStream <<
         setw (fieldWidth) << "fPendingGraceNotesGroup" << " : " <<
         endl <<
@@ -18150,7 +18604,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       // this is the first grace note in grace notes
 
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceGraceNotes) {
+      if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
         fLogOutputStream <<
           "Creating grace notes for note '" <<
           newNote->asString () <<
@@ -18202,7 +18656,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
 
     // append newNote to the current grace notes
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets || gTraceOptions->fTraceGraceNotes) {
+    if (gTraceFlags [kTraceTupletsFlag] || gTraceFlags [kTraceGraceNotesFlag]) {
       fLogOutputStream <<
         "Appending note " <<
         newNote->asString () <<
@@ -18229,7 +18683,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeSingle:
         // append newNote to the current voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Appending standalone " <<
             newNote->asString () <<
@@ -18251,7 +18705,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeStart:
         // register newNote as first element of the current double tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Setting standalone note '" <<
             newNote->asString () <<
@@ -18272,7 +18726,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
       case kTremoloTypeStop:
         // register newNote as second element of the current double tremolo
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes) {
+        if (gTraceFlags [kTraceNotesFlag]) {
           fLogOutputStream <<
             "Setting standalone note '" <<
             newNote->asString () <<
@@ -18311,7 +18765,7 @@ void mxmlTree2MsrTranslator::handleStandaloneOrDoubleTremoloNoteOrGraceNoteOrRes
     
     // append newNote to the current voice
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotes) {
+    if (gTraceFlags [kTraceNotesFlag]) {
       fLogOutputStream <<
         "Appending standalone " <<
         newNote->asString () <<
@@ -18378,7 +18832,7 @@ void mxmlTree2MsrTranslator::handleLyricsForNote (
     newNote->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceLyrics) {
+  if (gTraceFlags [kTraceLyricsFlag]) {
     fLogOutputStream <<
       "Handling lyrics for note '" <<
       newNote->asShortString () <<
@@ -18446,7 +18900,7 @@ void mxmlTree2MsrTranslator::handleLyricsForNote (
   if (fCurrentNoteHasLyrics) {
     // newNote has lyrics attached to it
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceNotesDetails || gTraceOptions->fTraceLyricsDetails) {
+    if (gTraceFlags [kTraceNotesDetailsFlag] || gTraceFlags [kTraceLyricsDetailsFlag]) {
       fLogOutputStream <<
         "Note '" <<
         newNote->asShortString () <<
@@ -18582,7 +19036,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       msrNote::kChordMemberNote);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "Handling a note belonging to a chord" <<
       ", newChordNote:" <<
@@ -18635,9 +19089,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
           
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
     ) {
     fLogOutputStream << // JMI
       endl <<
@@ -18669,7 +19123,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       "currentVoice is null");
     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "Handling a chord member note" <<
       ", currentVoice = \"" <<
@@ -18683,9 +19137,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotesDetails
+    gTraceFlags [kTraceNotesDetailsFlag]
       ||
-    gTraceOptions->fTraceChordsDetails
+    gTraceFlags [kTraceChordsDetailsFlag]
   ) {
     fLogOutputStream <<
       endl <<
@@ -18722,7 +19176,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     // i.e the last handled note for this voice
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       printVoicesLastMetNoteMap (
         inputLineNumber);
     }
@@ -18762,7 +19216,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     }
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "mxmlTree2MsrTranslator::handleNoteBelongingToAChord()" <<
         ", chordFirstNote:" <<
@@ -18785,7 +19239,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
         chordFirstNote->getNoteKind ();
         
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Handling a note belonging to a chord" <<
         ", savedChordFirstNoteKind = " <<
@@ -18822,7 +19276,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
       case msrNote::kStandaloneNote:
         // remove last handled (previous current) note from the current voice
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+        if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
           fLogOutputStream <<
             "Removing chord first note " <<
             chordFirstNote->asShortString () <<
@@ -18835,9 +19289,9 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceNotesDetails
+          gTraceFlags [kTraceNotesDetailsFlag]
             ||
-          gTraceOptions->fTraceChordsDetails
+          gTraceFlags [kTraceChordsDetailsFlag]
         ) {
           fLogOutputStream <<
             endl << endl <<
@@ -18851,15 +19305,15 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
         
 #ifdef TRACE_OPTIONS
         if (
-          gTraceOptions->fTraceNotes
+          gTraceFlags [kTraceNotesFlag]
             ||
-          gTraceOptions->fTraceChords
+          gTraceFlags [kTraceChordsFlag]
             ||
-          gTraceOptions->fTraceStaves
+          gTraceFlags [kTraceStavesFlag]
             ||
-          gTraceOptions->fTraceMeasures
+          gTraceFlags [kTraceMeasuresFlag]
             ||
-          gTraceOptions->fTraceLyrics
+          gTraceFlags [kTraceLyricsFlag]
         ) {
           fLogOutputStream << // JMI
             endl <<
@@ -18881,7 +19335,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     
         // add chord to the voice instead
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceChords) {
+        if (gTraceFlags [kTraceChordsFlag]) {
           fLogOutputStream <<
             "Appending chord " << fCurrentChord->asString () <<
             " to voice \"" <<
@@ -18908,7 +19362,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
           /* JMI
           // updating chord's divisions // JMI
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+          if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
             fLogOutputStream <<
               "Updating sounding divisions for double tremolo chord '" <<
               "' " << chord->asString () <<
@@ -18983,7 +19437,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
 
 /* JMI
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "is newChordNote in the same chord but in another voice?" <<
         ", currentVoice = " <<
@@ -18997,7 +19451,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
   
   // register newChordNote as another member of chord
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceChords) {
+    if (gTraceFlags [kTraceChordsFlag]) {
       fLogOutputStream <<
         "Adding another note " <<
         newChordNote->asString() <<
@@ -19019,7 +19473,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChord (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceFlags [kTraceChordsDetailsFlag]) {
     printCurrentChord ();
   }
 #endif
@@ -19034,7 +19488,7 @@ void mxmlTree2MsrTranslator::handlePendingTupletStopIfAny (
     // finalize the tuplet, only now
     // in case the last element is a chord
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTuplets) {
+    if (gTraceFlags [kTraceTupletsFlag]) {
       fLogOutputStream <<
         "--> kTupletTypeStart: handling pending tuplet stop, note '" <<
         note->
@@ -19078,7 +19532,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
   }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "Handling a note belonging to a tuplet" <<
       ", note: " <<
@@ -19099,7 +19553,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
     case msrTuplet::kTupletTypeStart:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
           fLogOutputStream <<
             "--> kTupletTypeStart: note = '" <<
             note->
@@ -19117,7 +19571,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
           // finalize the tuplet, only now
           // in case the last element is a chord
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceTuplets) {
+          if (gTraceFlags [kTraceTupletsFlag]) {
             fLogOutputStream <<
               "--> kTupletTypeStart: handling pending tuplet stop, note '" <<
               note->
@@ -19155,7 +19609,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               
           // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+          if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
             fLogOutputStream <<
               "--> kTupletTypeContinue: adding tuplet member note '" <<
               note->
@@ -19173,7 +19627,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-          if (gTraceOptions->fTraceTupletsDetails) {
+          if (gTraceFlags [kTraceTupletsDetailsFlag]) {
             displayTupletsStack (
               "############## kTupletTypeContinue");
           }
@@ -19241,7 +19695,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
               // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+              if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
                 fLogOutputStream <<
                   "--> kTupletTypeStop: adding outer-most tuplet member note '" <<
                   note->
@@ -19259,7 +19713,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                   nullptr /* JMI */);
 
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceTupletsDetails) {
+              if (gTraceFlags [kTraceTupletsDetailsFlag]) {
                 displayTupletsStack (
                   "############## kTupletTypeStop, outer-most");
               }
@@ -19269,7 +19723,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               if (fCurrentATupletStopIsPending) {
                 // end of a tuplet forces handling of the pending one 
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceFlags [kTraceTupletsFlag]) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing pending tuplet" <<
                     ", line " << inputLineNumber <<
@@ -19285,7 +19739,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               }
               else {
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceFlags [kTraceTupletsFlag]) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing non-pending tuplet" << // JMI ???
                     ", line " << inputLineNumber <<
@@ -19315,7 +19769,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
               if (fCurrentATupletStopIsPending) {
                 // end of a tuplet forces handling of the pending one 
 #ifdef TRACE_OPTIONS
-                if (gTraceOptions->fTraceTuplets) {
+                if (gTraceFlags [kTraceTupletsFlag]) {
                   fLogOutputStream <<
                     "--> kTupletTypeStop: finalizing tuplet" <<
                     ", line " << inputLineNumber <<
@@ -19337,7 +19791,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
               // populate the tuplet at the top of the stack
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+              if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
                 fLogOutputStream <<
                   "--> kTupletTypeStop: adding nested tuplet member note '" <<
                   note->
@@ -19356,7 +19810,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
                 
 
 #ifdef TRACE_OPTIONS
-              if (gTraceOptions->fTraceTupletsDetails) {
+              if (gTraceFlags [kTraceTupletsDetailsFlag]) {
                 displayTupletsStack (
                   "############## kTupletTypeStop, nested");
               }
@@ -19384,7 +19838,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToATuplet (
     case msrTuplet::kTupletTypeStartAndStopInARow:
       {
 #ifdef TRACE_OPTIONS
-        if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceTuplets) {
+        if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceTupletsFlag]) {
           fLogOutputStream <<
             "--> kTupletTypeStartAndStopInARow: note = '" <<
             note->
@@ -19466,11 +19920,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
       ||
-      gTraceOptions->fTraceTuplets
+      gTraceFlags [kTraceTupletsFlag]
     ) {
     fLogOutputStream <<
       "Handling a note belonging to a chord in a tuplet" <<
@@ -19556,7 +20010,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 */
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceTupletsDetails) {
+    if (gTraceFlags [kTraceTupletsDetailsFlag]) {
       displayTupletsStack (
         "############## After  removeLastNoteFromTuplet()");
     }
@@ -19584,11 +20038,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
     // add chord to the current tuplet instead of tupletLastNote
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotes
+      gTraceFlags [kTraceNotesFlag]
         ||
-      gTraceOptions->fTraceChords
+      gTraceFlags [kTraceChordsFlag]
         ||
-      gTraceOptions->fTraceTuplets
+      gTraceFlags [kTraceTupletsFlag]
       ) {
       fLogOutputStream <<
         "Adding chord '" <<
@@ -19618,7 +20072,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
 
   // register note as another member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "Adding another note " <<
       newChordNote->
@@ -19639,7 +20093,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInATuplet (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceFlags [kTraceChordsDetailsFlag]) {
     printCurrentChord ();
   }
 #endif
@@ -19667,11 +20121,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
 
 #ifdef TRACE_OPTIONS
   if (
-    gTraceOptions->fTraceNotes
+    gTraceFlags [kTraceNotesFlag]
       ||
-    gTraceOptions->fTraceChords
+    gTraceFlags [kTraceChordsFlag]
       ||
-    gTraceOptions->fTraceGraceNotes
+    gTraceFlags [kTraceGraceNotesFlag]
     ) {
     fLogOutputStream <<
       "Handling a note belonging to a chord in grace notes" <<
@@ -19741,11 +20195,11 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
        
 #ifdef TRACE_OPTIONS
     if (
-      gTraceOptions->fTraceNotes
+      gTraceFlags [kTraceNotesFlag]
         ||
-      gTraceOptions->fTraceChords
+      gTraceFlags [kTraceChordsFlag]
         ||
-      gTraceOptions->fTraceGraceNotes
+      gTraceFlags [kTraceGraceNotesFlag]
     ) {
       fLogOutputStream <<
         "The grace notes chord's first note is '" <<
@@ -19819,7 +20273,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
 
   // register note as another member of chord
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceNotes || gTraceOptions->fTraceChords) {
+  if (gTraceFlags [kTraceNotesFlag] || gTraceFlags [kTraceChordsFlag]) {
     fLogOutputStream <<
       "Adding another note " <<
       newChordNote->
@@ -19840,7 +20294,7 @@ void mxmlTree2MsrTranslator::handleNoteBelongingToAChordInAGraceNotesGroup (
     newChordNote, fCurrentChord);
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceChordsDetails) {
+  if (gTraceFlags [kTraceChordsDetailsFlag]) {
     printCurrentChord ();
   }
 #endif
@@ -19851,7 +20305,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
   int inputLineNumber)
 {
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTuplets) {
+  if (gTraceFlags [kTraceTupletsFlag]) {
     fLogOutputStream <<
       "Handling tuplets pending on tuplet stack" <<
       ", fCurrentStaffNumberToInsertInto = " <<
@@ -19862,7 +20316,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
       endl;
   }
 
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceFlags [kTraceTupletsDetailsFlag]) {
     displayTupletsStack (
       "############## Before  handleTupletsPendingOnTupletsStack()");
   }
@@ -19890,7 +20344,7 @@ void mxmlTree2MsrTranslator::handleTupletsPendingOnTupletsStack (
   } // while
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceTupletsDetails) {
+  if (gTraceFlags [kTraceTupletsDetailsFlag]) {
     displayTupletsStack (
       "############## Before  handleTupletsPendingOnTupletsStack()");
   }
@@ -19947,7 +20401,7 @@ void mxmlTree2MsrTranslator::createAndPrependImplicitBarLine (
   int inputLineNumber)
 {     
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceBarlines || gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceBarlinesFlag] || gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Prepending an implicit repeat start barline at the beginning of part" <<
       fCurrentPart->getPartCombinedName () <<
@@ -19997,7 +20451,7 @@ void mxmlTree2MsrTranslator::handleRepeatStart (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Handling repeat start" <<
     /* JMI
@@ -20037,7 +20491,7 @@ void mxmlTree2MsrTranslator::handleRepeatEnd (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Handling repeat end" <<
     /* JMI
@@ -20071,7 +20525,7 @@ void mxmlTree2MsrTranslator::handleRepeatEnd (
    }
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a repeat to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20099,7 +20553,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Handling repeat ending start" <<
     /* JMI
@@ -20125,7 +20579,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
     // yes
 
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceFlags [kTraceRepeatsFlag]) {
       fLogOutputStream <<
         endl <<
         endl <<
@@ -20156,7 +20610,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 
       // create the enclosing repeat and append it to the part
 #ifdef TRACE_OPTIONS
-      if (gTraceOptions->fTraceRepeats) {
+      if (gTraceFlags [kTraceRepeatsFlag]) {
         fLogOutputStream <<
           "Creating a regular repeat in part " <<
           fCurrentPart->getPartCombinedName () <<
@@ -20180,7 +20634,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 
     // append an implicit repeat to the current part
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceFlags [kTraceRepeatsFlag]) {
       fLogOutputStream <<
         "Prepending an implicit barline ahead of part " <<
         fCurrentPart->getPartCombinedName () <<
@@ -20194,7 +20648,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
  
     // create the enclosing repeat and append it to the part
 #ifdef TRACE_OPTIONS
-    if (gTraceOptions->fTraceRepeats) {
+    if (gTraceFlags [kTraceRepeatsFlag]) {
       fLogOutputStream <<
         "Creating a repeat enclosing everything from the beginning of part " <<
         fCurrentPart->getPartCombinedName () <<
@@ -20216,7 +20670,7 @@ void mxmlTree2MsrTranslator::handleEndingStart (
 /* JMI
   // create a new last segment to collect the repeat ending contents
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceSegments || gTraceOptions->fTraceVoices) {
+  if (gTraceFlags [kTraceSegmentsFlag] || gTraceFlags [kTraceVoicesFlag]) {
     fLogOutputStream <<
       "Creating a new last segment for a repeat ending contents for voice \"" <<
       currentVoice->getVoiceName () << "\"" <<
@@ -20249,7 +20703,7 @@ void mxmlTree2MsrTranslator::handleHookedEndingEnd (
     barline->getInputLineNumber ();
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Handling repeat hooked ending end" <<
     /* JMI
@@ -20297,7 +20751,7 @@ void mxmlTree2MsrTranslator::handleHookedEndingEnd (
 
   // create a hooked repeat ending from the current segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a new hooked repeat ending to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20330,7 +20784,7 @@ void mxmlTree2MsrTranslator::handleHooklessEndingEnd (
     barline->getInputLineNumber ();
   
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Handling repeat hookless ending end" <<
     /* JMI
@@ -20378,7 +20832,7 @@ void mxmlTree2MsrTranslator::handleHooklessEndingEnd (
 
   // create a hookless repeat ending from the current segment
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRepeats) {
+  if (gTraceFlags [kTraceRepeatsFlag]) {
     fLogOutputStream <<
       "Appending a new hookless repeat ending to part " <<
       fCurrentPart->getPartCombinedName () <<
@@ -20406,12 +20860,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_rehearsal& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_rehearsal" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
 <!ATTLIST sound
@@ -20494,7 +20950,7 @@ void mxmlTree2MsrTranslator::visitStart ( S_rehearsal& elt )
 
   // create a rehearsal
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceRehearsals) {
+  if (gTraceFlags [kTraceRehearsalsFlag]) {
     fLogOutputStream <<
       "Creating rehearsal \"" << rehearsalValue << "\"" <<
       " in part " <<
@@ -20521,12 +20977,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_harmony& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_harmony" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fHarmonyVoicesCounter++;
   
@@ -20547,12 +21005,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_root_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_root_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string step = elt->getValue ();
 
@@ -20570,12 +21030,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_root_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_root_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float rootAlter = (float)(*elt);
 
@@ -20603,12 +21065,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_kind" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // harmony kind
   // ----------------------------------
@@ -20825,12 +21289,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_kind& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_inversion& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bass_step" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
   Inversion is a number indicating which inversion is used:
@@ -20845,12 +21311,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bass_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string step = elt->getValue();
   
@@ -20868,12 +21336,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_bass_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float bassAlter = (float)(*elt);
 
@@ -20898,22 +21368,26 @@ void mxmlTree2MsrTranslator::visitStart ( S_bass_alter& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_degree& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_degree" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_degree_value& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_degree_value" <<
        ", line " << elt->getInputLineNumber () <<
      endl;
   }
+#endif
 
   fCurrentHarmonyDegreeValue = (int)(*elt);
 }
@@ -20923,12 +21397,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_degree_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float degreeAlter = (float)(*elt);
 
@@ -20956,12 +21432,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_degree_type& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_degree_type" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string degreeType = elt->getValue ();
 
@@ -20992,12 +21470,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_degree& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_degree" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create harmony degree
   S_msrHarmonyDegree
@@ -21018,12 +21498,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_harmony" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // convert root diatonic pitch to a quarter tone pitch
   fCurrentHarmonyRootQuarterTonesPitchKind =
@@ -21076,7 +21558,7 @@ void mxmlTree2MsrTranslator::visitEnd ( S_harmony& elt )
 
   // create the harmony
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarmonies) {
+  if (gTraceFlags [kTraceHarmoniesFlag]) {
     fLogOutputStream <<
       "Creating a harmony" <<
       ", line " << inputLineNumber << ":" <<
@@ -21184,12 +21666,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_frame" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
       <harmony>
@@ -21253,36 +21737,42 @@ void mxmlTree2MsrTranslator::visitStart ( S_frame& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_strings& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_frame_strings" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFrameStrings = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_frets& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_frame_frets" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFrameFrets = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_first_fret& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_first_fret" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
           <first-fret location="right" text="12fr.">12</first-fret>
@@ -21297,12 +21787,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_first_fret& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_frame_note& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_frame_note" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentFrameNoteStringNumber = -1;
   fCurrentFrameNoteFretNumber = -1;
@@ -21317,12 +21809,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_barre& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_barre" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
  
   string barreType = elt->getAttributeValue ("type");
     
@@ -21352,12 +21846,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_frame_note& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_frame_note" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the frame note
   S_msrFrameNote
@@ -21380,12 +21876,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_frame& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_frame" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the frame
   S_msrFrame
@@ -21425,12 +21923,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string parentheses = elt->getAttributeValue("parentheses");
   
@@ -21476,12 +21976,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_figured_bass& elt )
 
 void mxmlTree2MsrTranslator::visitStart ( S_figure& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_figure" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitStart ( S_prefix& elt )
@@ -21489,12 +21991,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_prefix& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_prefix" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string prefix =
     elt->getValue ();
@@ -21543,12 +22047,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_figure_number& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_figure_number" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   fCurrentFigureNumber = (int)(*elt);
 
@@ -21571,12 +22077,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_suffix& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_suffix" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string suffix =
     elt->getValue ();
@@ -21627,12 +22135,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_figure& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_figure" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create the figure
   S_msrFigure
@@ -21654,12 +22164,14 @@ void mxmlTree2MsrTranslator::visitEnd ( S_figured_bass& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_figured_bass" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (! fPendingFiguredBassFigures.size ()) {
     msrMusicXMLWarning (
@@ -21677,12 +22189,14 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_harp_pedals" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
 <!-- 
@@ -21748,7 +22262,7 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
 
   // create the harp pedals tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceHarpPedalsTuning) {
+  if (gTraceFlags [kTraceHarpPedalsTuningFlag]) {
     fLogOutputStream <<
       "Creating harp pedals tuning:" <<
       endl;
@@ -21768,12 +22282,14 @@ void mxmlTree2MsrTranslator::visitStart (S_harp_pedals& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_pedal_tuning& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_tuning" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
     
 void mxmlTree2MsrTranslator::visitStart (S_pedal_step& elt )
@@ -21781,12 +22297,14 @@ void mxmlTree2MsrTranslator::visitStart (S_pedal_step& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_step" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   string tuningStep = elt->getValue();
 
@@ -21804,12 +22322,14 @@ void mxmlTree2MsrTranslator::visitStart (S_pedal_alter& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_pedal_alter" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   float pedalAlter = (float)(*elt);
 
@@ -21837,16 +22357,18 @@ void mxmlTree2MsrTranslator::visitEnd (S_pedal_tuning& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_pedal_tuning" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   // create a harp pedals tuning
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaffTuning) {
+  if (gTraceFlags [kTraceStaffTuningFlag]) {
     fLogOutputStream <<
       "Creating harp pedal tuning:" <<
       endl;
@@ -21884,12 +22406,14 @@ void mxmlTree2MsrTranslator::visitStart( S_damp& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_damp" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingDirectionType) {      
     // fetch current voice
@@ -21916,12 +22440,14 @@ void mxmlTree2MsrTranslator::visitStart( S_damp_all& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_damp_all" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   if (fOnGoingDirectionType) {      
     // fetch current voice
@@ -21946,24 +22472,28 @@ void mxmlTree2MsrTranslator::visitStart( S_damp_all& elt)
 //________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart (S_capo& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_capo" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentStaffDetailsCapo = (int)(*elt);
 }
 
 void mxmlTree2MsrTranslator::visitStart (S_staff_size& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_staff_size" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   fCurrentStaffDetailsStaffSize = (int)(*elt);
   // JMI not used
@@ -21974,15 +22504,17 @@ void mxmlTree2MsrTranslator::visitEnd (S_staff_details& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_staff_details" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 #ifdef TRACE_OPTIONS
-  if (gTraceOptions->fTraceStaves) {
+  if (gTraceFlags [kTraceStavesFlag]) {
     const int fieldWidth = 29;
 
     fLogOutputStream << left <<
@@ -22040,12 +22572,14 @@ void mxmlTree2MsrTranslator::visitStart (S_scordatura& elt )
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_scordatura" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
 /*
   <direction>
@@ -22075,12 +22609,14 @@ void mxmlTree2MsrTranslator::visitStart (S_scordatura& elt )
 
 void mxmlTree2MsrTranslator::visitStart (S_accord& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_accord" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
         <accord string="3">
@@ -22103,12 +22639,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_accord& elt)
   int inputLineNumber =
     elt->getInputLineNumber ();
 
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_accord" <<
       ", line " << inputLineNumber <<
       endl;
   }
+#endif
 
   S_msrStringTuning
     stringTuning =
@@ -22126,12 +22664,14 @@ void mxmlTree2MsrTranslator::visitEnd (S_accord& elt)
 
 void mxmlTree2MsrTranslator::visitEnd (S_scordatura& elt)
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_scordatura" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
   // append the current scordatura to the pending scordatura list
   fPendingScordaturas.push_back (fCurrentScordatura);
@@ -22143,55 +22683,65 @@ void mxmlTree2MsrTranslator::visitEnd (S_scordatura& elt)
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_sound" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 void mxmlTree2MsrTranslator::visitEnd ( S_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> End visiting S_sound" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_instrument_sound& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_instrument_sound" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_virtual_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_virtual_instrument" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 }
 
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_midi_device& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_midi_device" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
       <midi-device>SmartMusic SoftSynth</midi-device>
@@ -22201,12 +22751,14 @@ void mxmlTree2MsrTranslator::visitStart ( S_midi_device& elt )
 //______________________________________________________________________________
 void mxmlTree2MsrTranslator::visitStart ( S_midi_instrument& elt )
 {
-  if (gMusicXMLOptions->fTraceMusicXMLTreeVisitors) {
+#ifdef TRACE_OPTIONS
+  if (gTraceFlags [kTraceMusicXMLTreeVisitorsFlag]) {
     fLogOutputStream <<
       "--> Start visiting S_midi_instrument" <<
       ", line " << elt->getInputLineNumber () <<
       endl;
   }
+#endif
 
 /*
       <midi-instrument id="P2-I2">
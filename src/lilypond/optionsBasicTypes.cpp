@@ -606,7 +606,7 @@ void optionsCombinedItemsItem::appendOptionsItemToCombinedItemsList (
         
       optionError (s.str ());
   
-      exit (2);
+      throw msrException (2);
     }
   }
 }
@@ -2937,7 +2937,7 @@ void optionsHandler::registerOptionsNamesInHandler (
       "option long name and short name are both empty";
       
     optionError (s.str ());
-    exit (33);
+    throw msrException (33);
   }
   
   if (optionShortName == optionLongName) {
@@ -2948,7 +2948,7 @@ void optionsHandler::registerOptionsNamesInHandler (
       " is the same as the short name for the same";
       
     optionError (s.str ());
-    exit (33);
+    throw msrException (33);
   }
   
   for (
@@ -2967,7 +2967,7 @@ void optionsHandler::registerOptionsNamesInHandler (
         " is specified more that once";
         
       optionError (s.str ());
-      exit (33);
+      throw msrException (33);
     }
 
     // is optionShortName already in the options names map?
@@ -2981,7 +2981,7 @@ void optionsHandler::registerOptionsNamesInHandler (
           " is specified more that once";
           
         optionError (s.str ());
-        exit (33);
+        throw msrException (33);
       }
     }
   } // for
@@ -3247,7 +3247,7 @@ void optionsHandler::printSpecificItemHelp (
       "' is not well handled in optionsHandler::printSpecificItemHelp ()";
       
     optionError (s.str ());
-    exit (33);
+    throw msrException (33);
   }
 
   else {
@@ -3392,7 +3392,7 @@ void optionsHandler::printSpecificItemHelp (
         "\"";
         
       optionError (s.str ());
-      exit (33);
+      throw msrException (33);
     }
   }
 }
@@ -3713,7 +3713,7 @@ void optionsHandler::handleOptionsItemName (
       "' is unknown, see help summary above";      
 
     optionError (s.str ());
-    exit (6);
+    throw msrException (6);
   }
   
   else {
@@ -3890,7 +3890,7 @@ void optionsHandler::handleOptionsItemName (
             fOptionsHandlerLogIOstream);
 
         // exit
-        exit (0);
+        throw msrException (0);
       }
       
       else if (
@@ -3912,7 +3912,7 @@ void optionsHandler::handleOptionsItemName (
           fOptionsHandlerLogIOstream);
 
         // exit
-        exit (0);
+        throw msrException (0);
       }
       
       else if (
@@ -4134,7 +4134,7 @@ void optionsHandler::handleOptionsItemName (
         "' cannot be handled";      
   
       optionError (s.str ());
-      exit (7);
+      throw msrException (7);
     }
   }
 }
@@ -4199,7 +4199,7 @@ void optionsHandler::handleOptionsItemValueOrArgument (
       fPendingOptionsItem = nullptr;
 
       // exit
-      exit (23);
+      throw msrException (23);
       }
     
     else if (
@@ -4313,7 +4313,7 @@ void optionsHandler::handleOptionsItemValueOrArgument (
           rationalItem->
             getOptionsSubGroupUplink ());
             
-        exit (4);
+        throw msrException (4);
       }
 
       int
@@ -14,8 +14,9 @@
 #define ___setTraceOptionsIfDesired___
 
 
-// comment the following definition if no trace options are wanted
-#ifndef TRACE_OPTIONS
+// comment the following definition if no trace options are wanted,
+// or define NO_TRACE_OPTIONS when building (cmake -DTRACE=no)
+#if !defined(TRACE_OPTIONS) && !defined(NO_TRACE_OPTIONS)
 #define TRACE_OPTIONS
 #endif
 
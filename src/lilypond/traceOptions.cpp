@@ -15,6 +15,9 @@
 #include "msr.h"
 
 #include "traceOptions.h"
+#include "musicXMLOptions.h"
+#include "msrOptions.h"
+#include "lpsrOptions.h"
 
 
 using namespace std;
@@ -23,9 +26,11 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_traceOptions gTraceOptions;
-S_traceOptions gTraceOptionsUserChoices;
-S_traceOptions gTraceOptionsWithDetailedTrace;
+thread_local S_traceOptions gTraceOptions;
+thread_local S_traceOptions gTraceOptionsUserChoices;
+thread_local S_traceOptions gTraceOptionsWithDetailedTrace;
+
+thread_local traceFlags gTraceFlags;
 
 S_traceOptions traceOptions::create (
   S_optionsHandler optionsHandler)
@@ -1795,6 +1800,100 @@ ostream& operator<< (ostream& os, const S_traceOptions& elt)
   return os;
 }
 
+//______________________________________________________________________________
+void refreshTraceFlags ()
+{
+  // the trace options are created first,
+  // the other groups may not exist yet
+  gTraceFlags.reset ();
+  
+  if (! gTraceOptions)
+    return;
+    
+  gTraceFlags [kTracePassesFlag] = gTraceOptions->fTracePasses;
+  gTraceFlags [kTraceOptionsFlag] = gTraceOptions->fTraceOptions;
+  gTraceFlags [kTraceEncodingFlag] = gTraceOptions->fTraceEncoding;
+  gTraceFlags [kTraceDivisionsFlag] = gTraceOptions->fTraceDivisions;
+  gTraceFlags [kTraceGeometryFlag] = gTraceOptions->fTraceGeometry;
+  gTraceFlags [kTraceScoreFlag] = gTraceOptions->fTraceScore;
+  gTraceFlags [kTraceVarValAssocsFlag] = gTraceOptions->fTraceVarValAssocs;
+  gTraceFlags [kTracePartGroupsFlag] = gTraceOptions->fTracePartGroups;
+  gTraceFlags [kTracePartGroupsDetailsFlag] = gTraceOptions->fTracePartGroupsDetails;
+  gTraceFlags [kTracePartsFlag] = gTraceOptions->fTraceParts;
+  gTraceFlags [kTraceStavesFlag] = gTraceOptions->fTraceStaves;
+  gTraceFlags [kTraceVoicesFlag] = gTraceOptions->fTraceVoices;
+  gTraceFlags [kTraceVoicesDetailsFlag] = gTraceOptions->fTraceVoicesDetails;
+  gTraceFlags [kTraceClefsFlag] = gTraceOptions->fTraceClefs;
+  gTraceFlags [kTraceKeysFlag] = gTraceOptions->fTraceKeys;
+  gTraceFlags [kTraceTimesFlag] = gTraceOptions->fTraceTimes;
+  gTraceFlags [kTraceTemposFlag] = gTraceOptions->fTraceTempos;
+  gTraceFlags [kTraceRehearsalsFlag] = gTraceOptions->fTraceRehearsals;
+  gTraceFlags [kTraceTranspositionsFlag] = gTraceOptions->fTraceTranspositions;
+  gTraceFlags [kTraceOctaveShiftsFlag] = gTraceOptions->fTraceOctaveShifts;
+  gTraceFlags [kTraceSegmentsFlag] = gTraceOptions->fTraceSegments;
+  gTraceFlags [kTraceSegmentsDetailsFlag] = gTraceOptions->fTraceSegmentsDetails;
+  gTraceFlags [kTraceBarlinesFlag] = gTraceOptions->fTraceBarlines;
+  gTraceFlags [kTraceBarlinesDetailsFlag] = gTraceOptions->fTraceBarlinesDetails;
+  gTraceFlags [kTraceMultipleRestsFlag] = gTraceOptions->fTraceMultipleRests;
+  gTraceFlags [kTraceRepeatsFlag] = gTraceOptions->fTraceRepeats;
+  gTraceFlags [kTraceRepeatsDetailsFlag] = gTraceOptions->fTraceRepeatsDetails;
+  gTraceFlags [kTraceMeasureRepeatsFlag] = gTraceOptions->fTraceMeasureRepeats;
+  gTraceFlags [kTraceSlashesFlag] = gTraceOptions->fTraceSlashes;
+  gTraceFlags [kTraceMeasuresFlag] = gTraceOptions->fTraceMeasures;
+  gTraceFlags [kTraceMeasuresDetailsFlag] = gTraceOptions->fTraceMeasuresDetails;
+  gTraceFlags [kTraceNotesFlag] = gTraceOptions->fTraceNotes;
+  gTraceFlags [kTraceNotesDetailsFlag] = gTraceOptions->fTraceNotesDetails;
+  gTraceFlags [kTraceStemsFlag] = gTraceOptions->fTraceStems;
+  gTraceFlags [kTraceBeamsFlag] = gTraceOptions->fTraceBeams;
+  gTraceFlags [kTraceArticulationsFlag] = gTraceOptions->fTraceArticulations;
+  gTraceFlags [kTraceTechnicalsFlag] = gTraceOptions->fTraceTechnicals;
+  gTraceFlags [kTraceOrnamentsFlag] = gTraceOptions->fTraceOrnaments;
+  gTraceFlags [kTraceGraceDynamicsFlag] = gTraceOptions->fTraceGraceDynamics;
+  gTraceFlags [kTraceSpannersFlag] = gTraceOptions->fTraceSpanners;
+  gTraceFlags [kTraceWordsFlag] = gTraceOptions->fTraceWords;
+  gTraceFlags [kTraceTremolosFlag] = gTraceOptions->fTraceTremolos;
+  gTraceFlags [kTraceChordsFlag] = gTraceOptions->fTraceChords;
+  gTraceFlags [kTraceChordsDetailsFlag] = gTraceOptions->fTraceChordsDetails;
+  gTraceFlags [kTraceTupletsFlag] = gTraceOptions->fTraceTuplets;
+  gTraceFlags [kTraceTupletsDetailsFlag] = gTraceOptions->fTraceTupletsDetails;
+  gTraceFlags [kTraceGlissandosFlag] = gTraceOptions->fTraceGlissandos;
+  gTraceFlags [kTraceSlidesFlag] = gTraceOptions->fTraceSlides;
+  gTraceFlags [kTraceGraceNotesFlag] = gTraceOptions->fTraceGraceNotes;
+  gTraceFlags [kTraceLyricsFlag] = gTraceOptions->fTraceLyrics;
+  gTraceFlags [kTraceLyricsDetailsFlag] = gTraceOptions->fTraceLyricsDetails;
+  gTraceFlags [kTraceHarmoniesFlag] = gTraceOptions->fTraceHarmonies;
+  gTraceFlags [kTraceFramesFlag] = gTraceOptions->fTraceFrames;
+  gTraceFlags [kTraceFiguredBassFlag] = gTraceOptions->fTraceFiguredBass;
+  gTraceFlags [kTraceCreditsFlag] = gTraceOptions->fTraceCredits;
+  gTraceFlags [kTraceDynamicsFlag] = gTraceOptions->fTraceDynamics;
+  gTraceFlags [kTraceTiesFlag] = gTraceOptions->fTraceTies;
+  gTraceFlags [kTraceSlursFlag] = gTraceOptions->fTraceSlurs;
+  gTraceFlags [kTraceLigaturesFlag] = gTraceOptions->fTraceLigatures;
+  gTraceFlags [kTracePedalsFlag] = gTraceOptions->fTracePedals;
+  gTraceFlags [kTraceWedgesFlag] = gTraceOptions->fTraceWedges;
+  gTraceFlags [kTraceStaffTuningFlag] = gTraceOptions->fTraceStaffTuning;
+  gTraceFlags [kTraceScordaturasFlag] = gTraceOptions->fTraceScordaturas;
+  gTraceFlags [kTraceHarpPedalsTuningFlag] = gTraceOptions->fTraceHarpPedalsTuning;
+  gTraceFlags [kTraceExtraChordsFlag] = gTraceOptions->fTraceExtraChords;
+  gTraceFlags [kTraceMsrStreamsFlag] = gTraceOptions->fTraceMsrStreams;
+  gTraceFlags [kTraceMidiFlag] = gTraceOptions->fTraceMidi;
+
+  if (gMusicXMLOptions) {
+    gTraceFlags [kTraceMusicXMLTreeVisitorsFlag] = gMusicXMLOptions->fTraceMusicXMLTreeVisitors;
+  }
+
+  if (gMsrOptions) {
+    gTraceFlags [kTraceMsrFlag] = gMsrOptions->fTraceMsr;
+    gTraceFlags [kTraceMsrVisitorsFlag] = gMsrOptions->fTraceMsrVisitors;
+  }
+
+  if (gLpsrOptions) {
+    gTraceFlags [kTraceLpsrFlag] = gLpsrOptions->fTraceLpsr;
+    gTraceFlags [kTraceLpsrVisitorsFlag] = gLpsrOptions->fTraceLpsrVisitors;
+    gTraceFlags [kTraceSchemeFunctionsFlag] = gLpsrOptions->fTraceSchemeFunctions;
+  }
+}
+
 //______________________________________________________________________________
 void initializeTraceOptionsHandling (
   S_optionsHandler optionsHandler)
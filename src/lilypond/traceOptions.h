@@ -14,6 +14,7 @@
 #define ___traceOptions___
 
 #include <set>
+#include <bitset>
 
 #include "exports.h"
 
@@ -276,9 +277,97 @@ class traceOptions : public optionsGroup
 typedef SMARTP<traceOptions> S_traceOptions;
 EXP ostream& operator<< (ostream& os, const S_traceOptions& elt);
 
-EXP extern S_traceOptions gTraceOptions;
-EXP extern S_traceOptions gTraceOptionsUserChoices;
-EXP extern S_traceOptions gTraceOptionsWithDetailedTrace;
+extern thread_local S_traceOptions gTraceOptions;
+extern thread_local S_traceOptions gTraceOptionsUserChoices;
+extern thread_local S_traceOptions gTraceOptionsWithDetailedTrace;
+
+//______________________________________________________________________________
+// the trace flags of all the options groups, cached in a bit set:
+// testing one of them in the passes doesn't dereference the options
+
+enum traceFlagKind {
+  kTracePassesFlag,
+  kTraceOptionsFlag,
+  kTraceEncodingFlag,
+  kTraceDivisionsFlag,
+  kTraceGeometryFlag,
+  kTraceScoreFlag,
+  kTraceVarValAssocsFlag,
+  kTracePartGroupsFlag,
+  kTracePartGroupsDetailsFlag,
+  kTracePartsFlag,
+  kTraceStavesFlag,
+  kTraceVoicesFlag,
+  kTraceVoicesDetailsFlag,
+  kTraceClefsFlag,
+  kTraceKeysFlag,
+  kTraceTimesFlag,
+  kTraceTemposFlag,
+  kTraceRehearsalsFlag,
+  kTraceTranspositionsFlag,
+  kTraceOctaveShiftsFlag,
+  kTraceSegmentsFlag,
+  kTraceSegmentsDetailsFlag,
+  kTraceBarlinesFlag,
+  kTraceBarlinesDetailsFlag,
+  kTraceMultipleRestsFlag,
+  kTraceRepeatsFlag,
+  kTraceRepeatsDetailsFlag,
+  kTraceMeasureRepeatsFlag,
+  kTraceSlashesFlag,
+  kTraceMeasuresFlag,
+  kTraceMeasuresDetailsFlag,
+  kTraceNotesFlag,
+  kTraceNotesDetailsFlag,
+  kTraceStemsFlag,
+  kTraceBeamsFlag,
+  kTraceArticulationsFlag,
+  kTraceTechnicalsFlag,
+  kTraceOrnamentsFlag,
+  kTraceGraceDynamicsFlag,
+  kTraceSpannersFlag,
+  kTraceWordsFlag,
+  kTraceTremolosFlag,
+  kTraceChordsFlag,
+  kTraceChordsDetailsFlag,
+  kTraceTupletsFlag,
+  kTraceTupletsDetailsFlag,
+  kTraceGlissandosFlag,
+  kTraceSlidesFlag,
+  kTraceGraceNotesFlag,
+  kTraceLyricsFlag,
+  kTraceLyricsDetailsFlag,
+  kTraceHarmoniesFlag,
+  kTraceFramesFlag,
+  kTraceFiguredBassFlag,
+  kTraceCreditsFlag,
+  kTraceDynamicsFlag,
+  kTraceTiesFlag,
+  kTraceSlursFlag,
+  kTraceLigaturesFlag,
+  kTracePedalsFlag,
+  kTraceWedgesFlag,
+  kTraceStaffTuningFlag,
+  kTraceScordaturasFlag,
+  kTraceHarpPedalsTuningFlag,
+  kTraceExtraChordsFlag,
+  kTraceMsrStreamsFlag,
+  kTraceMidiFlag,
+  kTraceMusicXMLTreeVisitorsFlag,
+  kTraceMsrFlag,
+  kTraceMsrVisitorsFlag,
+  kTraceLpsrFlag,
+  kTraceLpsrVisitorsFlag,
+  kTraceSchemeFunctionsFlag,
+  
+  kTraceFlagsNumber };
+
+typedef bitset<kTraceFlagsNumber> traceFlags;
+
+extern thread_local traceFlags gTraceFlags;
+
+// to be called each time the current options or their values change
+void refreshTraceFlags ();
 
 //______________________________________________________________________________
 void initializeTraceOptionsHandling (
@@ -186,7 +186,7 @@ void timing::print (ostream& os) const
     endl;
 }
 
-timing timing::gTiming;
+thread_local timing gTiming;
 
 //______________________________________________________________________________
 //#define DEBUG_INDENTER
@@ -323,14 +323,122 @@ void indenter::print (ostream& os) const
   while (i-- > 0) os << fSpacer;
 }
 
-indenter indenter::gIndenter;
+thread_local indenter gIndenter;
 
 //______________________________________________________________________________
-indentedOstream indentedOstream::gOutputIndentedOstream (
-  cout, indenter::gIndenter);
+indentedOstream::indentedStreamBuf::indentedStreamBuf (
+  ostream&  str,
+  indenter& idtr,
+  size_t    bufferSize)
+  : fOutput (str),
+    fIndenter (idtr),
+    fLineIsIndented (false),
+    fLinesSize (bufferSize)
+{
+  fLines.reserve (fLinesSize);
+}
+
+indentedOstream::indentedStreamBuf::~indentedStreamBuf ()
+{
+  // don't lose the pending lines, nor the last one if it has no endl
+  flushOutput ();
+}
+
+void indentedOstream::indentedStreamBuf::appendLine ()
+{
+  if (! fLineIsIndented) {
+    int indent = fIndenter.getIndent ();
+
+    if (indent > 0) {
+      const string& spacer = fIndenter.getSpacer ();
+
+      while (indent-- > 0)
+        fLines.append (spacer);
+    }
+    
+    fLineIsIndented = true;
+  }
+
+  fLines.append (fLine);
+  fLine.clear ();
+}
+
+indentedOstream::indentedStreamBuf::int_type
+  indentedOstream::indentedStreamBuf::overflow (int_type c)
+{
+  if (traits_type::eq_int_type (c, traits_type::eof ()))
+    return traits_type::not_eof (c);
+
+  char ch = traits_type::to_char_type (c);
+  
+  xsputn (&ch, 1);
+
+  return c;
+}
+
+streamsize indentedOstream::indentedStreamBuf::xsputn (
+  const char* s,
+  streamsize  n)
+{
+  if ((n == 1) && (*s == '\n')) {
+    // the line ends, indent it with the current indentation
+    fLine.push_back ('\n');
+    appendLine ();
+    fLineIsIndented = false;
+
+    if (fLines.size () >= fLinesSize)
+      writeLines ();
+  }
+  else {
+    // the line goes on, even if s contains '\n's:
+    // multi-line strings such as the Scheme functions are indented as a whole
+    fLine.append (s, n);
+  }
+
+  return n;
+}
+
+int indentedOstream::indentedStreamBuf::sync ()
+{
+  // the buffered lines are written when bufferSize bytes are pending:
+  // the code generator ends each line with endl
+  if (fLinesSize) {
+    if (fLine.size ())
+      appendLine ();
+
+    return 0;
+  }
+
+  return flushOutput ();
+}
+
+int indentedOstream::indentedStreamBuf::flushOutput ()
+{
+  // an empty pending line is not indented yet,
+  // since more characters may follow
+  if (fLine.size ())
+    appendLine ();
+
+  writeLines ();
+  fOutput.flush ();
+
+  return fOutput ? 0 : -1;
+}
+
+void indentedOstream::indentedStreamBuf::writeLines ()
+{
+  if (fLines.size ()) {
+    fOutput.write (fLines.data (), fLines.size ());
+    fLines.clear ();
+  }
+}
+
+//______________________________________________________________________________
+thread_local indentedOstream gOutputIOstream (
+  cout, gIndenter);
 
-indentedOstream indentedOstream::gLogIndentedOstream (
-  cerr, indenter::gIndenter);
+thread_local indentedOstream gLogIOstream (
+  cerr, gIndenter);
 
 // code taken from:
 // http://comp.lang.cpp.moderated.narkive.com/fylLGJgp/redirect-output-to-dev-null
@@ -351,14 +459,14 @@ typedef basic_nullbuf <char>    nullbuf;
 //typedef basic_nullbuf <wchar_t> wnullbuf;
 
 // buffers and streams
-nullbuf cnull_obj;
+thread_local nullbuf cnull_obj;
 //wnullbuf wcnull_obj;
 
-std::ostream cnull  (& cnull_obj);
+thread_local std::ostream cnull  (& cnull_obj);
 //std::wostream wcnull (& wcnull_obj);
 
-indentedOstream indentedOstream::gNullIndentedOstream (
-  cnull, indenter::gIndenter);
+thread_local indentedOstream gNullIOstream (
+  cnull, gIndenter);
 
 //______________________________________________________________________________
 string replicateString (
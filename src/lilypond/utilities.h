@@ -23,6 +23,7 @@
 
 #include <set>
 #include <list>
+#include <vector>
 
 #include <functional> 
 #include <algorithm>
@@ -78,9 +79,6 @@ class EXP timing {
        timing ();
     virtual ~timing ();
 
-    // global variable for general use
-    static timing gTiming; 
-
     // add an item
     void                  appendTimingItem (
                             std::string    activity,
@@ -89,6 +87,10 @@ class EXP timing {
                                            kind,
                             clock_t        startClock,
                             clock_t        endClock);
+
+    // forget the items
+    void                  clear ()
+                              { fTimingItemsList.clear (); }
       
     // print
     void                  print (std::ostream& os) const;
@@ -100,6 +102,10 @@ class EXP timing {
 };
 std::ostream& operator<< (std::ostream& os, const timing& tim);
 
+// the timing of the conversion running on the current thread,
+// bound to its context by the conversion API
+extern thread_local timing gTiming;
+
 //______________________________________________________________________________
 class EXP indenter
 {
@@ -138,9 +144,6 @@ class EXP indenter
 
     // indent a multiline 'R"(...)"' std::string
     std::string                indentMultiLineString (std::string value);
-    
-    // global variable for general use
-    static indenter       gIndenter; 
 
   private:
     int                   fIndent;
@@ -149,9 +152,12 @@ class EXP indenter
 
 EXP std::ostream& operator<< (std::ostream& os, const indenter& idtr);
 
-// useful shortcut macros
-#define gIndenter indenter::gIndenter
-#define gTab      indenter::gIndenter.getSpacer ()
+// the indenter of the conversion running on the current thread,
+// bound to its context by the conversion API
+extern thread_local indenter gIndenter;
+
+// useful shortcut macro
+#define gTab      gIndenter.getSpacer ()
 
 //______________________________________________________________________________
 class EXP indentedOstream: public std::ostream
@@ -171,40 +177,56 @@ Usage:
  
   // a stream buffer that prefixes each line
   // with the current indentation
-  class indentedStreamBuf: public std::stringbuf
+  class indentedStreamBuf: public std::streambuf
   {
     private:
     
-      std::ostream& fOutput;
-      indenter&     fIndenter;
+      std::ostream&       fOutput;
+      indenter&           fIndenter;
+
+      // the current line, without its indentation
+      std::string         fLine;
+      bool                fLineIsIndented; // part of it is in fLines already
+
+      // the indented lines not yet written to fOutput
+      std::string         fLines;
+      size_t              fLinesSize; // 0 to write each line at once
+
+      // append the indentation then the current line to fLines
+      void                appendLine ();
+
+      // write fLines to fOutput
+      void                writeLines ();
+
+    protected:
+
+      // there is no put area: each character or sequence of characters
+      // goes through overflow() or xsputn(), which detect the end of lines,
+      // i.e. a '\n' written on its own as std::endl does:
+      // the indentation is the one current at the end of the line
+      virtual int_type    overflow (int_type c);
+      virtual std::streamsize
+                          xsputn (const char* s, std::streamsize n);
+
+      // When we sync the stream (std::endl, std::flush):
+      // 1) append the pending part of the current line to fLines,
+      //    indented if it is its first part
+      // 2) when unbuffered, write fLines to fOutput and flush it
+      virtual int         sync ();
 
     public:
+
+      // append the pending part of the current line to fLines,
+      // then write fLines to fOutput and flush it
+      int                 flushOutput ();
     
       // constructor
       indentedStreamBuf (
         std::ostream& str,
-        indenter&     idtr)
-        : fOutput (str),
-          fIndenter (idtr)
-          {}
-
-      // flush
-      void flush ()
-          {
-            fOutput.flush ();
-          }
-    
-      // When we sync the stream with fOutput:
-      // 1) output the indentation then the buffer
-      // 2) reset the buffer
-      // 3) flush the actual output stream we are using.
-      virtual int sync ()
-          {
-            fOutput << fIndenter << str ();
-            str ("");
-            fOutput.flush ();
-            return 0;
-          }
+        indenter&     idtr,
+        size_t        bufferSize);
+
+      virtual ~indentedStreamBuf ();
   };
 
   private:
@@ -212,39 +234,44 @@ Usage:
     indentedStreamBuf     fIndentedStreamBuf;
   
   public:
+
+    // the buffer size for the LilyPond code output
+    enum { K_BUFFER_SIZE = 65536 };
   
     // constructor
+    // the lines are written to str one at a time when bufferSize is 0,
+    // and flushing the stream then flushes str too.
+    // otherwise they are written by chunks of bufferSize bytes,
+    // by flushOutput () and by the destructor, which is also
+    // run when a conversion stops on an exception:
+    // the failures must throw (msrAssert) rather than abort
+    // for the output up to them to be written
     indentedOstream (
       std::ostream&  str,
-      indenter&      idtr)
+      indenter&      idtr,
+      size_t         bufferSize = 0)
       : std::ostream (&fIndentedStreamBuf),
         fIndentedStreamBuf (
-          str, idtr)
+          str, idtr, bufferSize)
       {}
 
     // destructor
     virtual ~indentedOstream ()
         {};
 
-    // flush
-    void flush ()
-        {
-          fIndentedStreamBuf.flush ();
-        }
-    
-    // global variables for general use
-    static indentedOstream
-                          gOutputIndentedOstream; 
-    static indentedOstream
-                          gLogIndentedOstream; 
-    static indentedOstream
-                          gNullIndentedOstream; 
+    // write the pending lines to str and flush it
+    void                  flushOutput ()
+                              {
+                                if (fIndentedStreamBuf.flushOutput () != 0)
+                                  setstate (std::ios_base::badbit);
+                              }
 };
 
-// useful shortcut macros
-#define gOutputIOstream indentedOstream::gOutputIndentedOstream
-#define gLogIOstream    indentedOstream::gLogIndentedOstream
-#define gNullIOstream   indentedOstream::gNullIndentedOstream
+// the output, log and null streams of the current thread,
+// indented by gIndenter
+extern thread_local indentedOstream gOutputIOstream;
+extern thread_local indentedOstream gLogIOstream;
+extern thread_local indentedOstream gNullIOstream;
 
 //______________________________________________________________________________
 struct stringQuoteEscaper
@@ -24,7 +24,7 @@ namespace MusicXML2
 {
 
 //______________________________________________________________________________
-list<versionInfo> gVersionInfoList;
+thread_local list<versionInfo> gVersionInfoList;
 
 versionInfo::versionInfo (
   string versionNumber,
@@ -42,18 +42,18 @@ versionInfo::~versionInfo ()
 void versionInfo::print (ostream& os) const
 {
   os << left <<
-    indenter::gIndenter <<
+    gIndenter <<
       setw (5) << fVersionNumber << " " <<
       "(" << fVersionDate << "):" <<
       endl <<
     
-  indenter::gIndenter++;
+  gIndenter++;
 
   os <<
-    indenter::gIndenter <<
+    gIndenter <<
       fVersionDescription;
 
-  indenter::gIndenter--;  
+  gIndenter--;  
 }
 
 void enlistVersion (
@@ -61,6 +61,16 @@ void enlistVersion (
   string versionDate,
   string versionDescription)
 {
+  // the options handling may be initialized several times per thread
+  for (
+    list<versionInfo>::const_iterator i = gVersionInfoList.begin ();
+    i != gVersionInfoList.end ();
+    i++
+  ) {
+    if ((*i).fVersionNumber == versionNumber)
+      return;
+  } // for
+
   gVersionInfoList.push_front (
     versionInfo (
       versionNumber,
@@ -74,7 +84,7 @@ void printVersionsHistory (ostream& os)
     "Versions history:" <<
     endl << endl;
 
-  indenter::gIndenter++;
+  gIndenter++;
 
   list<versionInfo>::const_iterator
     iBegin = gVersionInfoList.begin (),
@@ -89,7 +99,7 @@ void printVersionsHistory (ostream& os)
   os <<
     endl << endl;
 
-  indenter::gIndenter--;
+  gIndenter--;
 }
 
 string currentVersionNumber ()
@@ -42,7 +42,7 @@ class EXP versionInfo
     std::string           fVersionDescription;
 };
 
-extern std::list<versionInfo> gVersionInfoList;
+extern thread_local std::list<versionInfo> gVersionInfoList;
 
 void enlistVersion (
   std::string versionNumber,
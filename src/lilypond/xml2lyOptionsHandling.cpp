@@ -17,6 +17,7 @@
 
 #include "version.h"
 #include "utilities.h"
+#include "messagesHandling.h"
 
 #include "xml2lyOptionsHandling.h"
 
@@ -389,6 +390,86 @@ void xml2lyOptionsHandler::initializeOptionsHandler ()
 #endif
 }
 
+//______________________________________________________________________________
+static string buildPotentialOutputFileName (
+  string inputSourceName)
+{
+  string potentialOutputFileName;
+    
+  if (inputSourceName != "-") {
+    // determine potential output file name,
+    // may be set differently by '--ofn, --outputFileName' option
+    potentialOutputFileName =
+      baseName (
+        inputSourceName);
+
+    // set '.ly' suffix
+    size_t
+      posInString =
+        potentialOutputFileName.rfind ('.');
+      
+    if (posInString != string::npos) {
+      potentialOutputFileName.replace (
+        posInString,
+        potentialOutputFileName.size () - posInString,
+        ".ly");
+    }
+  }
+
+  return potentialOutputFileName;
+}
+
+static string commandLineEnd (
+  string inputSourceName)
+{
+  // decipherOptionsAndArguments () writes the '-' stdin indicator
+  // both as a command line element and as the argument
+  return
+    inputSourceName == "-"
+      ? " - -"
+      : " " + inputSourceName;
+}
+
+static void replaceInputSourceName (
+  string& commandLine,
+  string  previousInputSourceName,
+  string  inputSourceName)
+{
+  string
+    previousEnd =
+      commandLineEnd (previousInputSourceName);
+  size_t
+    previousEndSize = previousEnd.size ();
+
+  if (
+    commandLine.size () >= previousEndSize
+      &&
+    commandLine.compare (
+      commandLine.size () - previousEndSize,
+      previousEndSize,
+      previousEnd) == 0
+  ) {
+    commandLine.replace (
+      commandLine.size () - previousEndSize,
+      previousEndSize,
+      commandLineEnd (inputSourceName));
+  }
+}
+
+static void autoOutputFileNameFromStdinError ()
+{
+  stringstream s;
+
+  s <<
+    "option '--aofn, --autoOutputFileName'"  <<
+    endl <<
+    "cannot be used when reading from standard input";
+    
+  optionError (s.str ());
+
+  throw msrException (4);
+}
+
 void xml2lyOptionsHandler::checkOptionsAndArguments ()
 {
   unsigned int argumentsNumber =
@@ -446,35 +527,18 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
         endl <<
         endl;
 
-      exit (1);
+      throw msrException (1);
       break;
   } //  switch
 
   // build potential output file name
   // ------------------------------------------------------
 
-  string potentialOutputFileName;
-    
-  if (gXml2lyOptions->fInputSourceName != "-") {
-    // determine potential output file name,
-    // may be set differently by '--ofn, --outputFileName' option
+  string
     potentialOutputFileName =
-      baseName (
+      buildPotentialOutputFileName (
         gXml2lyOptions->fInputSourceName);
 
-    // set '.ly' suffix
-    size_t
-      posInString =
-        potentialOutputFileName.rfind ('.');
-      
-    if (posInString != string::npos) {
-      potentialOutputFileName.replace (
-        posInString,
-        potentialOutputFileName.size () - posInString,
-        ".ly");
-    }
-  }
-
   // check auto output file option usage
   // ------------------------------------------------------
 
@@ -489,20 +553,11 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
         
       optionError (s.str ());
 
-      exit (3);
+      throw msrException (3);
     }
   
     else if (gXml2lyOptions->fInputSourceName == "-") {
-      stringstream s;
-  
-      s <<
-        "option '--aofn, --autoOutputFileName'"  <<
-        endl <<
-        "cannot be used when reading from standard input";
-        
-      optionError (s.str ());
-
-      exit (4);
+      autoOutputFileNameFromStdinError ();
     }
 
     else {
@@ -523,6 +578,49 @@ void xml2lyOptionsHandler::checkOptionsAndArguments ()
     fCommandLineWithLongOptions;
 }
 
+//______________________________________________________________________________
+void xml2lyOptionsHandler::setInputSourceName (
+  string inputSourceName)
+{
+  string
+    previousInputSourceName =
+      gXml2lyOptions->fInputSourceName;
+
+  if (inputSourceName == previousInputSourceName)
+    return;
+
+  // the input source name is the only argument
+  gXml2lyOptions->fInputSourceName =
+    inputSourceName;
+  fArgumentsVector.assign (1, inputSourceName);
+
+  // replace it at the end of the command lines
+  replaceInputSourceName (
+    fCommandLineWithShortOptions,
+    previousInputSourceName,
+    inputSourceName);
+  replaceInputSourceName (
+    fCommandLineWithLongOptions,
+    previousInputSourceName,
+    inputSourceName);
+
+  gGeneralOptions->fCommandLineWithShortOptions =
+    fCommandLineWithShortOptions;
+  gGeneralOptions->fCommandLineWithLongOptions =
+    fCommandLineWithLongOptions;
+
+  // the automatic output file name derives from it
+  if (gXml2lyOptions->fAutoOutputFile) {
+    if (inputSourceName == "-") {
+      autoOutputFileNameFromStdinError ();
+    }
+    
+    gXml2lyOptions->fOutputFileName =
+      buildPotentialOutputFileName (
+        inputSourceName);
+  }
+}
+
 //______________________________________________________________________________
 void xml2lyOptionsHandler::enforceOptionsHandlerQuietness ()
 {
@@ -651,7 +749,7 @@ ostream& operator<< (ostream& os, const S_xml2lyOptionsHandler& elt)
 }
 
 //_______________________________________________________________________________
-S_xml2lyOptions gXml2lyOptions;
+thread_local S_xml2lyOptions gXml2lyOptions;
 
 S_xml2lyOptions xml2lyOptions::create (
   S_optionsHandler optionsHandler)
@@ -686,22 +784,29 @@ are grouped here.)",
 xml2lyOptions::~xml2lyOptions ()
 {}
 
+void xml2lyOptions::registerTranslationDate ()
+{
+  time_t      translationRawtime;
+  struct tm   translationTimeinfo;
+  char buffer [80];
+
+  time (&translationRawtime);
+#ifdef WIN32
+  localtime_s (&translationTimeinfo, &translationRawtime);
+#else
+  localtime_r (&translationRawtime, &translationTimeinfo); // reentrant
+#endif
+
+  strftime (buffer, 80, "%A %F @ %T %Z", &translationTimeinfo);
+  fTranslationDate = buffer;
+}
+
 void xml2lyOptions::initializeXml2lyOptions ()
 {
   // register translation date
   // ------------------------------------------------------
 
-  {
-    time_t      translationRawtime;
-    struct tm*  translationTimeinfo;
-    char buffer [80];
-  
-    time (&translationRawtime);
-    translationTimeinfo = localtime (&translationRawtime);
-  
-    strftime (buffer, 80, "%A %F @ %T %Z", translationTimeinfo);
-    fTranslationDate = buffer;
-  }
+  registerTranslationDate ();
 
 
   // version
@@ -912,7 +1017,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
       printVersion (os);
 
     // exit
-    exit (0);
+    throw msrException (0);
   }
   
   else if (
@@ -934,7 +1039,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
       printAbout (os);
 
     // exit
-    exit (0);
+    throw msrException (0);
   }
   
   else if (
@@ -956,7 +1061,7 @@ S_optionsItem xml2lyOptions::handleOptionsItem (
       printContact (os);
 
     // exit
-    exit (0);
+    throw msrException (0);
   }
 
   return result;
@@ -217,6 +217,11 @@ class EXP xml2lyOptionsHandler : public optionsHandler
     // ------------------------------------------------------
 
     void                  checkOptionsAndArguments ();
+
+    // reuse the deciphered options for another input source:
+    // update the input source name, the automatic output file name
+    // and the command lines, that end with the input source name
+    void                  setInputSourceName (string inputSourceName);
     
     // print
     // ------------------------------------------------------
@@ -245,6 +250,8 @@ class xml2lyOptions : public optionsGroup
     // ------------------------------------------------------
 
     void                  initializeXml2lyOptions ();
+
+    void                  registerTranslationDate ();
         
     void                  printXml2lyOptionsHelp ();
 
@@ -304,7 +311,7 @@ class xml2lyOptions : public optionsGroup
 typedef SMARTP<xml2lyOptions> S_xml2lyOptions;
 EXP ostream& operator<< (ostream& os, const S_xml2lyOptions& elt);
 
-EXP extern S_xml2lyOptions gXml2lyOptions;
+extern thread_local S_xml2lyOptions gXml2lyOptions;
 
 //______________________________________________________________________________
 void initializeXml2lyOptionsHandling (
@@ -34,6 +34,15 @@ namespace MusicXML2
         beatCum = 0.0;
     }
     
+    void musicxmlQuery::init(const scoreindex& index) {
+        init();
+        partlistvisitor::init(index);
+        stavesInPart.clear();
+        for (auto&& p : index.parts()) {
+            stavesInPart[p.fID] = p.fStaves;
+        }
+    }
+    
     
     int musicxmlQuery::getStavesForFirstPart() {
         
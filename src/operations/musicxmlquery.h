@@ -19,6 +19,7 @@
 #include "transposevisitor.h"
 #include "partlistvisitor.h"
 #include "partsummary.h"
+#include "scoreindex.h"
 
 namespace MusicXML2
 {
@@ -48,6 +49,8 @@ namespace MusicXML2
         virtual ~musicxmlQuery();
         
         void init();
+        /// initializes the staves count of the parts and the part groups from a score index, without browsing the score
+        void init(const scoreindex& index);
         
         /// Query methods
         
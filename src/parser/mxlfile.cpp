@@ -0,0 +1,451 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <string.h>
+#include "mxlfile.h"
+
+using namespace std;
+
+//______________________________________________________________________________
+// little endian fields of the zip headers
+static inline unsigned get16 (const unsigned char* p)	{ return p[0] | (p[1] << 8); }
+static inline unsigned get32 (const unsigned char* p)	{ return get16(p) | (unsigned(get16(p+2)) << 16); }
+
+static const unsigned kLocalHeader	= 0x04034b50;
+static const unsigned kCentralHeader	= 0x02014b50;
+static const unsigned kEndOfCentralDir	= 0x06054b50;
+
+//______________________________________________________________________________
+// crc32 of the inflated data, as stored in the zip headers
+// computed 4 bytes at a time using 4 tables (slicing by 4)
+namespace {
+	struct crctable {
+		unsigned fValues[4][256];
+		crctable () {
+			for (unsigned i = 0; i < 256; i++) {
+				unsigned c = i;
+				for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320 ^ (c >> 1) : c >> 1;
+				fValues[0][i] = c;
+			}
+			for (unsigned i = 0; i < 256; i++)
+				for (int t = 1; t < 4; t++)
+					fValues[t][i] = fValues[0][fValues[t-1][i] & 0xff] ^ (fValues[t-1][i] >> 8);
+		}
+	};
+}
+
+static unsigned crc32 (const char* data, size_t size)
+{
+	static const crctable crc32table;
+	const unsigned (*t)[256] = crc32table.fValues;
+	const unsigned char* p = (const unsigned char*)data;
+	unsigned crc = 0xffffffff;
+	for (; size >= 4; size -= 4, p += 4) {
+		crc ^= get32 (p);
+		crc = t[3][crc & 0xff] ^ t[2][(crc >> 8) & 0xff] ^ t[1][(crc >> 16) & 0xff] ^ t[0][crc >> 24];
+	}
+	while (size--) crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+	return crc ^ 0xffffffff;
+}
+
+//______________________________________________________________________________
+/*
+	A raw deflate decoder (RFC 1951).
+	Huffman codes are decoded with a lookup table indexed by the next kFastBits
+	bits of the input, longer codes are decoded using the canonical code limits.
+	The output size is known from the zip headers: data are inflated in place.
+*/
+//______________________________________________________________________________
+class inflater
+{
+	enum { kFastBits = 9, kMaxSymbols = 288 };
+
+	struct huffman {
+		unsigned short	fFast[1 << kFastBits];	// (length << 9) | symbol, 0 when the code is longer
+		unsigned short	fFirstCode[16];
+		unsigned short	fFirstSymbol[16];
+		int				fMaxCode[17];			// left aligned on 16 bits
+		unsigned char	fSize[kMaxSymbols];
+		unsigned short	fValue[kMaxSymbols];
+		bool	build (const unsigned char* lengths, int n);
+	};
+
+	const unsigned char*	fIn;
+	size_t					fInSize;
+	size_t					fInPos;			// may go beyond fInSize: zeros are read past the end
+	unsigned				fBits;
+	int						fBitCount;
+	char*					fOut;
+	size_t					fOutSize;
+	size_t					fOutPos;
+	huffman					fLengths, fDistances;
+
+	void		fill ();
+	unsigned	bits (int n);
+	int			decode (const huffman& h);
+	bool		stored ();
+	bool		fixed ();
+	bool		dynamic ();
+	bool		codes ();
+	bool		overrun () const	{ return fInPos > fInSize + 4; }
+
+	static int	reverse (int code, int n);
+
+	public:
+				 inflater (const char* in, size_t inSize, char* out, size_t outSize)
+					: fIn((const unsigned char*)in), fInSize(inSize), fInPos(0), fBits(0), fBitCount(0),
+					  fOut(out), fOutSize(outSize), fOutPos(0) {}
+		virtual ~inflater() {}
+
+		bool	run ();
+};
+
+//______________________________________________________________________________
+int inflater::reverse (int code, int n)
+{
+	int r = 0;
+	for (int i = 0; i < n; i++) {
+		r = (r << 1) | (code & 1);
+		code >>= 1;
+	}
+	return r;
+}
+
+//______________________________________________________________________________
+bool inflater::huffman::build (const unsigned char* lengths, int n)
+{
+	int sizes[17], next[16];
+	memset (sizes, 0, sizeof(sizes));
+	memset (fFast, 0, sizeof(fFast));
+	memset (fSize, 0, sizeof(fSize));
+	for (int i = 0; i < n; i++) sizes[lengths[i]]++;
+	sizes[0] = 0;
+
+	int code = 0, k = 0;
+	for (int i = 1; i < 16; i++) {
+		next[i] = code;
+		fFirstCode[i] = code;
+		fFirstSymbol[i] = k;
+		code += sizes[i];
+		if (sizes[i] && (code - 1 >= (1 << i))) return false;		// over subscribed
+		fMaxCode[i] = code << (16 - i);
+		code <<= 1;
+		k += sizes[i];
+	}
+	fMaxCode[16] = 0x10000;
+
+	for (int i = 0; i < n; i++) {
+		int s = lengths[i];
+		if (!s) continue;
+		int c = next[s] - fFirstCode[s] + fFirstSymbol[s];
+		fSize[c] = s;
+		fValue[c] = i;
+		if (s <= kFastBits) {
+			for (int j = reverse (next[s], s); j < (1 << kFastBits); j += (1 << s))
+				fFast[j] = (s << 9) | i;
+		}
+		next[s]++;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+void inflater::fill ()
+{
+	while (fBitCount <= 24) {
+		unsigned c = (fInPos < fInSize) ? fIn[fInPos] : 0;
+		fInPos++;
+		fBits |= c << fBitCount;
+		fBitCount += 8;
+	}
+}
+
+unsigned inflater::bits (int n)
+{
+	if (fBitCount < n) fill();
+	unsigned v = fBits & ((1 << n) - 1);
+	fBits >>= n;
+	fBitCount -= n;
+	return v;
+}
+
+//______________________________________________________________________________
+int inflater::decode (const huffman& h)
+{
+	if (fBitCount < 16) fill();
+	int b = h.fFast[fBits & ((1 << kFastBits) - 1)];
+	if (b) {
+		int s = b >> 9;
+		fBits >>= s;
+		fBitCount -= s;
+		return b & 511;
+	}
+	// slow path: codes longer than kFastBits
+	int k = reverse (fBits, 16);
+	int s = kFastBits + 1;
+	while (k >= h.fMaxCode[s]) s++;
+	if (s >= 16) return -1;
+	b = (k >> (16 - s)) - h.fFirstCode[s] + h.fFirstSymbol[s];
+	if ((b >= kMaxSymbols) || (h.fSize[b] != s)) return -1;
+	fBits >>= s;
+	fBitCount -= s;
+	return h.fValue[b];
+}
+
+//______________________________________________________________________________
+bool inflater::stored ()
+{
+	// skip to a byte boundary, bytes already in the bit buffer are given back
+	bits (fBitCount & 7);
+	fInPos -= fBitCount / 8;
+	fBits = 0;
+	fBitCount = 0;
+	if (fInPos + 4 > fInSize) return false;
+	unsigned len  = get16 (fIn + fInPos);
+	unsigned nlen = get16 (fIn + fInPos + 2);
+	fInPos += 4;
+	if ((len != (~nlen & 0xffff)) || (fInPos + len > fInSize) || (fOutPos + len > fOutSize)) return false;
+	memcpy (fOut + fOutPos, fIn + fInPos, len);
+	fInPos += len;
+	fOutPos += len;
+	return true;
+}
+
+//______________________________________________________________________________
+bool inflater::codes ()
+{
+	static const unsigned short lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const unsigned char lextra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const unsigned short dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const unsigned char dextra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	while (!overrun()) {
+		int symbol = decode (fLengths);
+		if (symbol < 256) {
+			if ((symbol < 0) || (fOutPos >= fOutSize)) return false;
+			fOut[fOutPos++] = char(symbol);
+		}
+		else if (symbol == 256) return true;		// end of block
+		else {
+			symbol -= 257;
+			if (symbol >= 29) return false;
+			size_t len = lbase[symbol] + bits (lextra[symbol]);
+			symbol = decode (fDistances);
+			if ((symbol < 0) || (symbol >= 30)) return false;
+			size_t dist = dbase[symbol] + bits (dextra[symbol]);
+			if ((dist > fOutPos) || (fOutPos + len > fOutSize)) return false;
+			// the source and destination may overlap: copy byte per byte
+			const char* src = fOut + fOutPos - dist;
+			char* dst = fOut + fOutPos;
+			for (size_t i = 0; i < len; i++) dst[i] = src[i];
+			fOutPos += len;
+		}
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+bool inflater::fixed ()
+{
+	unsigned char lengths[288];
+	int i = 0;
+	for (; i < 144; i++) lengths[i] = 8;
+	for (; i < 256; i++) lengths[i] = 9;
+	for (; i < 280; i++) lengths[i] = 7;
+	for (; i < 288; i++) lengths[i] = 8;
+	if (!fLengths.build (lengths, 288)) return false;
+	for (i = 0; i < 30; i++) lengths[i] = 5;
+	return fDistances.build (lengths, 30) && codes();
+}
+
+//______________________________________________________________________________
+bool inflater::dynamic ()
+{
+	static const unsigned char order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	int nlen  = bits (5) + 257;
+	int ndist = bits (5) + 1;
+	int ncode = bits (4) + 4;
+	if ((nlen > 286) || (ndist > 30)) return false;
+
+	unsigned char lengths[286 + 30];
+	memset (lengths, 0, 19);
+	for (int i = 0; i < ncode; i++) lengths[order[i]] = bits (3);
+	huffman codelengths;
+	if (!codelengths.build (lengths, 19)) return false;
+
+	int n = 0;
+	while (n < nlen + ndist) {
+		int symbol = decode (codelengths);
+		if ((symbol < 0) || overrun()) return false;
+		if (symbol < 16) lengths[n++] = symbol;
+		else {
+			int repeat; unsigned char len = 0;
+			if (symbol == 16) {
+				if (n == 0) return false;
+				len = lengths[n - 1];
+				repeat = 3 + bits (2);
+			}
+			else if (symbol == 17) repeat = 3 + bits (3);
+			else repeat = 11 + bits (7);
+			if (n + repeat > nlen + ndist) return false;
+			while (repeat--) lengths[n++] = len;
+		}
+	}
+	if (lengths[256] == 0) return false;		// no end of block code
+	return fLengths.build (lengths, nlen) && fDistances.build (lengths + nlen, ndist) && codes();
+}
+
+//______________________________________________________________________________
+bool inflater::run ()
+{
+	bool last;
+	do {
+		last = bits (1);
+		bool ret;
+		switch (bits (2)) {
+			case 0:	ret = stored();		break;
+			case 1:	ret = fixed();		break;
+			case 2:	ret = dynamic();	break;
+			default: return false;
+		}
+		if (!ret || overrun()) return false;
+	} while (!last);
+	return fOutPos == fOutSize;
+}
+
+//______________________________________________________________________________
+// mxlfile
+//______________________________________________________________________________
+mxlfile::mxlfile (const char* data, size_t size) : fData((const unsigned char*)data), fSize(size)
+{
+	if (!directory())
+		fEntries.clear();
+}
+
+//______________________________________________________________________________
+bool mxlfile::isArchive (const char* data, size_t size)
+{
+	return (size >= 4) && (get32 ((const unsigned char*)data) == kLocalHeader);
+}
+
+//______________________________________________________________________________
+// reads the central directory, located by the end of central directory record
+// which is followed by an optional comment (up to 64k)
+bool mxlfile::directory ()
+{
+	if (fSize < 22) return false;
+	size_t end = fSize - 22;
+	size_t limit = (end > 0xffff) ? end - 0xffff : 0;
+	while (get32 (fData + end) != kEndOfCentralDir) {
+		if (end == limit) return false;
+		end--;
+	}
+	unsigned count = get16 (fData + end + 10);
+	size_t pos = get32 (fData + end + 16);
+
+	for (unsigned i = 0; i < count; i++) {
+		if ((pos + 46 > fSize) || (get32 (fData + pos) != kCentralHeader)) return false;
+		const unsigned char* p = fData + pos;
+		size_t nameLen = get16 (p + 28);
+		if (pos + 46 + nameLen > fSize) return false;
+
+		entry e;
+		e.fName.assign ((const char*)p + 46, nameLen);
+		e.fMethod = (get16 (p + 8) & 1) ? -1 : get16 (p + 10);		// encrypted entries are not supported
+		e.fCrc = get32 (p + 16);
+		e.fCompressedSize = get32 (p + 20);
+		e.fSize = get32 (p + 24);
+		e.fOffset = get32 (p + 42);
+		if ((e.fSize == 0xffffffff) || (e.fCompressedSize == 0xffffffff))
+			e.fMethod = -1;			// zip64 entries are not supported
+		fEntries.push_back (e);
+		pos += 46 + nameLen + get16 (p + 30) + get16 (p + 32);
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+const mxlfile::entry* mxlfile::find (const string& name) const
+{
+	for (size_t i = 0; i < fEntries.size(); i++)
+		if (fEntries[i].fName == name) return &fEntries[i];
+	return 0;
+}
+
+//______________________________________________________________________________
+bool mxlfile::read (const string& name, string& content, size_t maxSize) const
+{
+	const entry* e = find (name);
+	if (!e || (e->fSize > maxSize)) return false;
+
+	size_t pos = e->fOffset;
+	if ((pos + 30 > fSize) || (get32 (fData + pos) != kLocalHeader)) return false;
+	pos += 30 + get16 (fData + pos + 26) + get16 (fData + pos + 28);
+	if ((pos > fSize) || (e->fCompressedSize > fSize - pos)) return false;
+	const char* data = (const char*)fData + pos;
+	// deflate can't compress more than 1032:1, reject inconsistent sizes before allocating
+	if ((e->fMethod == 8) && (e->fSize / 1032 > e->fCompressedSize)) return false;
+
+	content.resize (e->fSize);
+	char* out = e->fSize ? &content[0] : 0;
+	bool ret;
+	switch (e->fMethod) {
+		case 0:
+			ret = (e->fCompressedSize == e->fSize);
+			if (ret && e->fSize) memcpy (out, data, e->fSize);
+			break;
+		case 8:
+			ret = inflater(data, e->fCompressedSize, out, e->fSize).run();
+			break;
+		default:
+			ret = false;
+	}
+	return ret && (crc32 (content.data(), content.size()) == e->fCrc);
+}
+
+//______________________________________________________________________________
+// the score is given by the full-path attribute of the first rootfile element
+// of META-INF/container.xml. Without container, the first .xml or .musicxml
+// file outside of META-INF is taken.
+string mxlfile::rootfile () const
+{
+	string container;
+	if (read ("META-INF/container.xml", container)) {
+		size_t pos = container.find ("<rootfile");
+		if (pos != string::npos) pos = container.find ("full-path", pos);
+		if (pos != string::npos) pos = container.find_first_of ("\"'", pos);
+		if (pos != string::npos) {
+			size_t end = container.find (container[pos], pos + 1);
+			if (end != string::npos) return container.substr (pos + 1, end - pos - 1);
+		}
+	}
+	for (size_t i = 0; i < fEntries.size(); i++) {
+		const string& name = fEntries[i].fName;
+		if (name.compare (0, 9, "META-INF/") == 0) continue;
+		size_t dot = name.rfind ('.');
+		if ((dot != string::npos) && ((name.substr (dot) == ".xml") || (name.substr (dot) == ".musicxml")))
+			return name;
+	}
+	return "";
+}
+
+//______________________________________________________________________________
+bool mxlfile::readRootfile (string& content, size_t maxSize) const
+{
+	string name = rootfile();
+	return name.size() && read (name, content, maxSize);
+}
@@ -0,0 +1,69 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __mxlfile__
+#define __mxlfile__
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+/*!
+\brief A compressed MusicXML file (.mxl) reader.
+
+	A .mxl file is a zip archive. The MusicXML score is the rootfile
+	listed by META-INF/container.xml. mxlfile reads the archive from memory:
+	the entries are inflated in process (stored and deflated entries are
+	supported), there is no external tool nor temporary file involved.
+	The data must remain valid during the lifetime of the mxlfile.
+	Entries larger than kMaxSize once inflated are rejected.
+*/
+//______________________________________________________________________________
+class mxlfile
+{
+	struct entry {
+		std::string	fName;
+		int			fMethod;		// 0 for stored, 8 for deflated
+		unsigned	fCrc;
+		size_t		fCompressedSize;
+		size_t		fSize;
+		size_t		fOffset;		// the offset of the local header
+	};
+
+	const unsigned char*	fData;
+	size_t					fSize;
+	std::vector<entry>		fEntries;
+
+	bool	directory ();
+	const entry* find (const std::string& name) const;
+
+	public:
+		enum { kMaxSize = 1 << 28 };		// 256 MB
+
+				 mxlfile (const char* data, size_t size);
+		virtual ~mxlfile() {}
+
+		//! checks for the zip local header signature
+		static bool	isArchive (const char* data, size_t size);
+
+		//! false when the zip central directory can't be read
+		bool		valid () const	{ return fEntries.size() > 0; }
+		//! the name of the MusicXML score, as given by META-INF/container.xml
+		std::string	rootfile () const;
+		//! inflates an entry of the archive, fails when its size exceeds maxSize
+		bool		read (const std::string& name, std::string& content, size_t maxSize = kMaxSize) const;
+		//! inflates the MusicXML score, fails when its size exceeds maxSize
+		bool		readRootfile (std::string& content, size_t maxSize = kMaxSize) const;
+};
+
+
+#endif
@@ -13,6 +13,8 @@
 #ifndef __reader__
 #define __reader__
 
+#include <string>
+
 class reader
 { 
 	public:
@@ -29,6 +31,21 @@ class reader
 		virtual void	setValue (const char* value) = 0;
 		virtual bool	endElement (const char* eltName) = 0;
 		virtual void	error (const char* s, int lineno) = 0;
+
+		// zero-copy interface used by xmlparser: the strings are given by a pointer
+		// into the input buffer and a length, they are NOT null terminated.
+		// The default implementation makes null terminated copies and calls the methods above.
+		virtual void	newComment (const char* comment, size_t len)			{ newComment (std::string(comment, len).c_str()); }
+		virtual void	newProcessingInstruction (const char* pi, size_t len)	{ newProcessingInstruction (std::string(pi, len).c_str()); }
+		virtual bool	newElement (const char* eltName, size_t len)			{ return newElement (std::string(eltName, len).c_str()); }
+		virtual bool	newAttribute (const char* eltName, size_t len, const char *val, size_t vlen)
+								{ return newAttribute (std::string(eltName, len).c_str(), std::string(val, vlen).c_str()); }
+		virtual void	setValue (const char* value, size_t len)				{ setValue (std::string(value, len).c_str()); }
+		virtual bool	endElement (const char* eltName, size_t len)			{ return endElement (std::string(eltName, len).c_str()); }
+
+		// called at the end of each start tag, after the element attributes: when true,
+		// the element content is scanned but not reported, endElement is called next
+		virtual bool	skipElement ()		{ return false; }
 };
 
 
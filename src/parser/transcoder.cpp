@@ -0,0 +1,184 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <string.h>
+#include "transcoder.h"
+
+using namespace std;
+
+//______________________________________________________________________________
+// appends a unicode code point to an utf8 string
+static inline void put (unsigned c, string& out)
+{
+	if (c < 0x80) out += char(c);
+	else if (c < 0x800) {
+		out += char(0xc0 | (c >> 6));
+		out += char(0x80 | (c & 0x3f));
+	}
+	else if (c < 0x10000) {
+		out += char(0xe0 | (c >> 12));
+		out += char(0x80 | ((c >> 6) & 0x3f));
+		out += char(0x80 | (c & 0x3f));
+	}
+	else {
+		out += char(0xf0 | (c >> 18));
+		out += char(0x80 | ((c >> 12) & 0x3f));
+		out += char(0x80 | ((c >> 6) & 0x3f));
+		out += char(0x80 | (c & 0x3f));
+	}
+}
+
+static const unsigned kReplacement = 0xfffd;
+
+// windows-1252 differs from ISO-8859-1 in the 0x80 - 0x9f range
+static const unsigned short kWindows1252Table[32] = {
+	0x20ac, 0xfffd, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021, 0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0xfffd, 0x017d, 0xfffd,
+	0xfffd, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014, 0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0xfffd, 0x017e, 0x0178
+};
+
+//______________________________________________________________________________
+// case insensitive comparison of an encoding name
+static bool same (const string& name, const char* ref)
+{
+	size_t n = strlen (ref);
+	if (name.size() != n) return false;
+	for (size_t i = 0; i < n; i++) {
+		char c = name[i];
+		if ((c >= 'a') && (c <= 'z')) c -= 'a' - 'A';
+		if (c != ref[i]) return false;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+// the encoding attribute of the xml declaration, empty when there is none
+static string declaredEncoding (const char* data, size_t size)
+{
+	if ((size < 6) || strncmp (data, "<?xml", 5)) return "";
+	string decl (data, size < 256 ? size : 256);
+	size_t end = decl.find ("?>");
+	if (end == string::npos) return "";
+	decl.resize (end);
+	size_t pos = decl.find ("encoding");
+	if (pos != string::npos) pos = decl.find_first_of ("\"'", pos);
+	if (pos == string::npos) return "";
+	size_t close = decl.find (decl[pos], pos + 1);
+	return (close == string::npos) ? "" : decl.substr (pos + 1, close - pos - 1);
+}
+
+//______________________________________________________________________________
+void transcoder::detect (const char* data, size_t size)
+{
+	const unsigned char* p = (const unsigned char*)data;
+	fEncoding = kUTF8;
+	fSkip = 0;
+	if (size < 2) return;
+
+	// byte order marks
+	if ((size >= 3) && (p[0] == 0xef) && (p[1] == 0xbb) && (p[2] == 0xbf))	fSkip = 3;
+	else if ((p[0] == 0xff) && (p[1] == 0xfe))	{ fEncoding = kUTF16LE; fSkip = 2; }
+	else if ((p[0] == 0xfe) && (p[1] == 0xff))	{ fEncoding = kUTF16BE; fSkip = 2; }
+	// utf16 xml declaration without byte order mark
+	else if ((size >= 4) && !memcmp (p, "<\0?\0", 4))	fEncoding = kUTF16LE;
+	else if ((size >= 4) && !memcmp (p, "\0<\0?", 4))	fEncoding = kUTF16BE;
+	else {
+		string name = declaredEncoding (data, size);
+		if (same (name, "ISO-8859-1") || same (name, "ISO8859-1") || same (name, "ISO_8859-1") || same (name, "LATIN1"))
+			fEncoding = kLatin1;
+		else if (same (name, "WINDOWS-1252") || same (name, "CP1252"))
+			fEncoding = kWindows1252;
+	}
+}
+
+//______________________________________________________________________________
+void transcoder::convert (const char* data, size_t size, string& out)
+{
+	switch (fEncoding) {
+		case kUTF16LE:
+		case kUTF16BE:
+			utf16 ((const unsigned char*)data, size, out);
+			break;
+		case kLatin1:
+		case kWindows1252:
+			latin1 ((const unsigned char*)data, size, out);
+			break;
+		default:
+			out.append (data, size);
+	}
+}
+
+//______________________________________________________________________________
+void transcoder::end (string& out)
+{
+	if ((fPending >= 0) || fSurrogate) put (kReplacement, out);
+	fPending = -1;
+	fSurrogate = 0;
+}
+
+//______________________________________________________________________________
+// ascii runs are copied as is
+void transcoder::latin1 (const unsigned char* data, size_t size, string& out) const
+{
+	out.reserve (out.size() + size + size / 16);
+	const unsigned char* end = data + size;
+	while (data < end) {
+		const unsigned char* start = data;
+		while ((data < end) && (*data < 0x80)) data++;
+		out.append ((const char*)start, data - start);
+		if (data == end) break;
+		unsigned c = *data++;
+		if ((fEncoding == kWindows1252) && (c < 0xa0)) c = kWindows1252Table[c - 0x80];
+		put (c, out);
+	}
+}
+
+//______________________________________________________________________________
+void transcoder::utf16 (const unsigned char* data, size_t size, string& out)
+{
+	out.reserve (out.size() + size / 2 + size / 16);
+	const unsigned char* end = data + size;
+	// skip the byte order mark, which is necessarily in the first part of the input
+	if (fSkip) {
+		size_t n = (size < fSkip) ? size : fSkip;
+		data += n;
+		fSkip -= n;
+	}
+	bool little = (fEncoding == kUTF16LE);
+	while (data < end) {
+		unsigned b0, b1;
+		if (fPending >= 0) {
+			b0 = fPending;
+			fPending = -1;
+		}
+		else b0 = *data++;
+		if (data == end) {
+			fPending = b0;
+			break;
+		}
+		b1 = *data++;
+		unsigned c = little ? (b0 | (b1 << 8)) : ((b0 << 8) | b1);
+
+		if (fSurrogate) {
+			if ((c >= 0xdc00) && (c < 0xe000)) {
+				put (0x10000 + ((fSurrogate - 0xd800) << 10) + (c - 0xdc00), out);
+				fSurrogate = 0;
+				continue;
+			}
+			put (kReplacement, out);
+			fSurrogate = 0;
+		}
+		if ((c >= 0xd800) && (c < 0xdc00))	fSurrogate = c;
+		else if ((c >= 0xdc00) && (c < 0xe000))	put (kReplacement, out);
+		else if (c < 0x80)	out += char(c);
+		else put (c, out);
+	}
+}
@@ -0,0 +1,63 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __transcoder__
+#define __transcoder__
+
+#include <stddef.h>
+#include <string>
+
+/*!
+\brief Converts the xml input to UTF-8.
+
+	The encoding is detected from the beginning of the data: byte order mark,
+	UTF-16 xml declaration without byte order mark, or encoding declared by
+	the xml declaration. UTF-16 (both endians), ISO-8859-1 and windows-1252
+	data are converted, other data are left as is.
+	Conversion is incremental: the input can be given in successive parts
+	of any size, the output is appended to a string.
+*/
+//______________________________________________________________________________
+class transcoder
+{
+	public:
+		enum encoding { kUTF8, kUTF16LE, kUTF16BE, kLatin1, kWindows1252 };
+
+	private:
+		encoding	fEncoding;
+		size_t		fSkip;			// the size of the byte order mark
+		int			fPending;		// a pending utf16 byte, -1 when none
+		unsigned	fSurrogate;		// a pending utf16 high surrogate, 0 when none
+
+		void	utf16 (const unsigned char* data, size_t size, std::string& out);
+		void	latin1 (const unsigned char* data, size_t size, std::string& out) const;
+
+	public:
+				 transcoder () : fEncoding(kUTF8), fSkip(0), fPending(-1), fSurrogate(0) {}
+		virtual ~transcoder() {}
+
+		//! detects the encoding from the first bytes of the input (at least the xml declaration)
+		void		detect (const char* data, size_t size);
+		encoding	getEncoding () const	{ return fEncoding; }
+		//! the size of the byte order mark, to be skipped when there is no conversion
+		size_t		skip () const			{ return fSkip; }
+		//! true when the input has to be converted
+		bool		active () const			{ return fEncoding != kUTF8; }
+
+		//! converts the next part of the input, the first part must start with the data given to detect
+		void	convert (const char* data, size_t size, std::string& out);
+		//! flushes the pending bytes at the end of the input
+		void	end (std::string& out);
+};
+
+
+#endif
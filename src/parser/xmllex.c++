@@ -1,2485 +0,0 @@
-#line 1 "xmllex.c++"
-
-#line 3 "xmllex.c++"
-
-#define  YY_INT_ALIGNED short int
-
-/* A lexical scanner generated by flex */
-
-#define yy_create_buffer libmxml_create_buffer
-#define yy_delete_buffer libmxml_delete_buffer
-#define yy_scan_buffer libmxml_scan_buffer
-#define yy_scan_string libmxml_scan_string
-#define yy_scan_bytes libmxml_scan_bytes
-#define yy_init_buffer libmxml_init_buffer
-#define yy_flush_buffer libmxml_flush_buffer
-#define yy_load_buffer_state libmxml_load_buffer_state
-#define yy_switch_to_buffer libmxml_switch_to_buffer
-#define yypush_buffer_state libmxmlpush_buffer_state
-#define yypop_buffer_state libmxmlpop_buffer_state
-#define yyensure_buffer_stack libmxmlensure_buffer_stack
-#define yy_flex_debug libmxml_flex_debug
-#define yyin libmxmlin
-#define yyleng libmxmlleng
-#define yylex libmxmllex
-#define yylineno libmxmllineno
-#define yyout libmxmlout
-#define yyrestart libmxmlrestart
-#define yytext libmxmltext
-#define yywrap libmxmlwrap
-#define yyalloc libmxmlalloc
-#define yyrealloc libmxmlrealloc
-#define yyfree libmxmlfree
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 6
-#define YY_FLEX_SUBMINOR_VERSION 4
-#if YY_FLEX_SUBMINOR_VERSION > 0
-#define FLEX_BETA
-#endif
-
-#ifdef yy_create_buffer
-#define libmxml_create_buffer_ALREADY_DEFINED
-#else
-#define yy_create_buffer libmxml_create_buffer
-#endif
-
-#ifdef yy_delete_buffer
-#define libmxml_delete_buffer_ALREADY_DEFINED
-#else
-#define yy_delete_buffer libmxml_delete_buffer
-#endif
-
-#ifdef yy_scan_buffer
-#define libmxml_scan_buffer_ALREADY_DEFINED
-#else
-#define yy_scan_buffer libmxml_scan_buffer
-#endif
-
-#ifdef yy_scan_string
-#define libmxml_scan_string_ALREADY_DEFINED
-#else
-#define yy_scan_string libmxml_scan_string
-#endif
-
-#ifdef yy_scan_bytes
-#define libmxml_scan_bytes_ALREADY_DEFINED
-#else
-#define yy_scan_bytes libmxml_scan_bytes
-#endif
-
-#ifdef yy_init_buffer
-#define libmxml_init_buffer_ALREADY_DEFINED
-#else
-#define yy_init_buffer libmxml_init_buffer
-#endif
-
-#ifdef yy_flush_buffer
-#define libmxml_flush_buffer_ALREADY_DEFINED
-#else
-#define yy_flush_buffer libmxml_flush_buffer
-#endif
-
-#ifdef yy_load_buffer_state
-#define libmxml_load_buffer_state_ALREADY_DEFINED
-#else
-#define yy_load_buffer_state libmxml_load_buffer_state
-#endif
-
-#ifdef yy_switch_to_buffer
-#define libmxml_switch_to_buffer_ALREADY_DEFINED
-#else
-#define yy_switch_to_buffer libmxml_switch_to_buffer
-#endif
-
-#ifdef yypush_buffer_state
-#define libmxmlpush_buffer_state_ALREADY_DEFINED
-#else
-#define yypush_buffer_state libmxmlpush_buffer_state
-#endif
-
-#ifdef yypop_buffer_state
-#define libmxmlpop_buffer_state_ALREADY_DEFINED
-#else
-#define yypop_buffer_state libmxmlpop_buffer_state
-#endif
-
-#ifdef yyensure_buffer_stack
-#define libmxmlensure_buffer_stack_ALREADY_DEFINED
-#else
-#define yyensure_buffer_stack libmxmlensure_buffer_stack
-#endif
-
-#ifdef yylex
-#define libmxmllex_ALREADY_DEFINED
-#else
-#define yylex libmxmllex
-#endif
-
-#ifdef yyrestart
-#define libmxmlrestart_ALREADY_DEFINED
-#else
-#define yyrestart libmxmlrestart
-#endif
-
-#ifdef yylex_init
-#define libmxmllex_init_ALREADY_DEFINED
-#else
-#define yylex_init libmxmllex_init
-#endif
-
-#ifdef yylex_init_extra
-#define libmxmllex_init_extra_ALREADY_DEFINED
-#else
-#define yylex_init_extra libmxmllex_init_extra
-#endif
-
-#ifdef yylex_destroy
-#define libmxmllex_destroy_ALREADY_DEFINED
-#else
-#define yylex_destroy libmxmllex_destroy
-#endif
-
-#ifdef yyget_debug
-#define libmxmlget_debug_ALREADY_DEFINED
-#else
-#define yyget_debug libmxmlget_debug
-#endif
-
-#ifdef yyset_debug
-#define libmxmlset_debug_ALREADY_DEFINED
-#else
-#define yyset_debug libmxmlset_debug
-#endif
-
-#ifdef yyget_extra
-#define libmxmlget_extra_ALREADY_DEFINED
-#else
-#define yyget_extra libmxmlget_extra
-#endif
-
-#ifdef yyset_extra
-#define libmxmlset_extra_ALREADY_DEFINED
-#else
-#define yyset_extra libmxmlset_extra
-#endif
-
-#ifdef yyget_in
-#define libmxmlget_in_ALREADY_DEFINED
-#else
-#define yyget_in libmxmlget_in
-#endif
-
-#ifdef yyset_in
-#define libmxmlset_in_ALREADY_DEFINED
-#else
-#define yyset_in libmxmlset_in
-#endif
-
-#ifdef yyget_out
-#define libmxmlget_out_ALREADY_DEFINED
-#else
-#define yyget_out libmxmlget_out
-#endif
-
-#ifdef yyset_out
-#define libmxmlset_out_ALREADY_DEFINED
-#else
-#define yyset_out libmxmlset_out
-#endif
-
-#ifdef yyget_leng
-#define libmxmlget_leng_ALREADY_DEFINED
-#else
-#define yyget_leng libmxmlget_leng
-#endif
-
-#ifdef yyget_text
-#define libmxmlget_text_ALREADY_DEFINED
-#else
-#define yyget_text libmxmlget_text
-#endif
-
-#ifdef yyget_lineno
-#define libmxmlget_lineno_ALREADY_DEFINED
-#else
-#define yyget_lineno libmxmlget_lineno
-#endif
-
-#ifdef yyset_lineno
-#define libmxmlset_lineno_ALREADY_DEFINED
-#else
-#define yyset_lineno libmxmlset_lineno
-#endif
-
-#ifdef yywrap
-#define libmxmlwrap_ALREADY_DEFINED
-#else
-#define yywrap libmxmlwrap
-#endif
-
-#ifdef yyalloc
-#define libmxmlalloc_ALREADY_DEFINED
-#else
-#define yyalloc libmxmlalloc
-#endif
-
-#ifdef yyrealloc
-#define libmxmlrealloc_ALREADY_DEFINED
-#else
-#define yyrealloc libmxmlrealloc
-#endif
-
-#ifdef yyfree
-#define libmxmlfree_ALREADY_DEFINED
-#else
-#define yyfree libmxmlfree
-#endif
-
-#ifdef yytext
-#define libmxmltext_ALREADY_DEFINED
-#else
-#define yytext libmxmltext
-#endif
-
-#ifdef yyleng
-#define libmxmlleng_ALREADY_DEFINED
-#else
-#define yyleng libmxmlleng
-#endif
-
-#ifdef yyin
-#define libmxmlin_ALREADY_DEFINED
-#else
-#define yyin libmxmlin
-#endif
-
-#ifdef yyout
-#define libmxmlout_ALREADY_DEFINED
-#else
-#define yyout libmxmlout
-#endif
-
-#ifdef yy_flex_debug
-#define libmxml_flex_debug_ALREADY_DEFINED
-#else
-#define yy_flex_debug libmxml_flex_debug
-#endif
-
-#ifdef yylineno
-#define libmxmllineno_ALREADY_DEFINED
-#else
-#define yylineno libmxmllineno
-#endif
-
-/* First, we deal with  platform-specific or compiler-specific issues. */
-
-/* begin standard C headers. */
-#include <stdio.h>
-#include <string.h>
-#include <errno.h>
-#include <stdlib.h>
-
-/* end standard C headers. */
-
-/* flex integer type definitions */
-
-#ifndef FLEXINT_H
-#define FLEXINT_H
-
-/* C99 systems have <inttypes.h>. Non-C99 systems may or may not. */
-
-#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
-
-/* C99 says to define __STDC_LIMIT_MACROS before including stdint.h,
- * if you want the limit (max/min) macros for int types. 
- */
-#ifndef __STDC_LIMIT_MACROS
-#define __STDC_LIMIT_MACROS 1
-#endif
-
-#include <inttypes.h>
-typedef int8_t flex_int8_t;
-typedef uint8_t flex_uint8_t;
-typedef int16_t flex_int16_t;
-typedef uint16_t flex_uint16_t;
-typedef int32_t flex_int32_t;
-typedef uint32_t flex_uint32_t;
-#else
-typedef signed char flex_int8_t;
-typedef short int flex_int16_t;
-typedef int flex_int32_t;
-typedef unsigned char flex_uint8_t; 
-typedef unsigned short int flex_uint16_t;
-typedef unsigned int flex_uint32_t;
-
-/* Limits of integral types. */
-#ifndef INT8_MIN
-#define INT8_MIN               (-128)
-#endif
-#ifndef INT16_MIN
-#define INT16_MIN              (-32767-1)
-#endif
-#ifndef INT32_MIN
-#define INT32_MIN              (-2147483647-1)
-#endif
-#ifndef INT8_MAX
-#define INT8_MAX               (127)
-#endif
-#ifndef INT16_MAX
-#define INT16_MAX              (32767)
-#endif
-#ifndef INT32_MAX
-#define INT32_MAX              (2147483647)
-#endif
-#ifndef UINT8_MAX
-#define UINT8_MAX              (255U)
-#endif
-#ifndef UINT16_MAX
-#define UINT16_MAX             (65535U)
-#endif
-#ifndef UINT32_MAX
-#define UINT32_MAX             (4294967295U)
-#endif
-
-#ifndef SIZE_MAX
-#define SIZE_MAX               (~(size_t)0)
-#endif
-
-#endif /* ! C99 */
-
-#endif /* ! FLEXINT_H */
-
-/* begin standard C++ headers. */
-
-/* TODO: this is always defined, so inline it */
-#define yyconst const
-
-#if defined(__GNUC__) && __GNUC__ >= 3
-#define yynoreturn __attribute__((__noreturn__))
-#else
-#define yynoreturn
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an
- *   integer in range [0..255] for use as an array index.
- */
-#define YY_SC_TO_UI(c) ((YY_CHAR) (c))
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN (yy_start) = 1 + 2 *
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START (((yy_start) - 1) / 2)
-#define YYSTATE YY_START
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin  )
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#ifndef YY_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k.
- * Moreover, YY_BUF_SIZE is 2*YY_READ_BUF_SIZE in the general case.
- * Ditto for the __ia64__ case accordingly.
- */
-#define YY_BUF_SIZE 32768
-#else
-#define YY_BUF_SIZE 16384
-#endif /* __ia64__ */
-#endif
-
-/* The state buf must be large enough to hold one state per character in the main buffer.
- */
-#define YY_STATE_BUF_SIZE   ((YY_BUF_SIZE + 2) * sizeof(yy_state_type))
-
-#ifndef YY_TYPEDEF_YY_BUFFER_STATE
-#define YY_TYPEDEF_YY_BUFFER_STATE
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-#endif
-
-#ifndef YY_TYPEDEF_YY_SIZE_T
-#define YY_TYPEDEF_YY_SIZE_T
-typedef size_t yy_size_t;
-#endif
-
-extern int yyleng;
-
-extern FILE *yyin, *yyout;
-
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-    
-    /* Note: We specifically omit the test for yy_rule_can_match_eol because it requires
-     *       access to the local variable yy_act. Since yyless() is a macro, it would break
-     *       existing scanners that call yyless() from OUTSIDE yylex.
-     *       One obvious solution it to make yy_act a global. I tried that, and saw
-     *       a 5% performance hit in a non-yylineno scanner, because yy_act is
-     *       normally declared as a register variable-- so it is not worth it.
-     */
-    #define  YY_LESS_LINENO(n) \
-            do { \
-                int yyl;\
-                for ( yyl = n; yyl < yyleng; ++yyl )\
-                    if ( yytext[yyl] == '\n' )\
-                        --yylineno;\
-            }while(0)
-    #define YY_LINENO_REWIND_TO(dst) \
-            do {\
-                const char *p;\
-                for ( p = yy_cp-1; p >= (dst); --p)\
-                    if ( *p == '\n' )\
-                        --yylineno;\
-            }while(0)
-    
-/* Return all but the first "n" matched characters back to the input stream. */
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		*yy_cp = (yy_hold_char); \
-		YY_RESTORE_YY_MORE_OFFSET \
-		(yy_c_buf_p) = yy_cp = yy_bp + yyless_macro_arg - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-		} \
-	while ( 0 )
-#define unput(c) yyunput( c, (yytext_ptr)  )
-
-#ifndef YY_STRUCT_YY_BUFFER_STATE
-#define YY_STRUCT_YY_BUFFER_STATE
-struct yy_buffer_state
-	{
-	FILE *yy_input_file;
-
-	char *yy_ch_buf;		/* input buffer */
-	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
-	int yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	int yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
-	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
-	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
-	int yy_at_bol;
-
-    int yy_bs_lineno; /**< The line count. */
-    int yy_bs_column; /**< The column count. */
-
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
-	int yy_fill_buffer;
-
-	int yy_buffer_status;
-
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
-#define YY_BUFFER_EOF_PENDING 2
-
-	};
-#endif /* !YY_STRUCT_YY_BUFFER_STATE */
-
-/* Stack of input buffers. */
-static size_t yy_buffer_stack_top = 0; /**< index of top of stack. */
-static size_t yy_buffer_stack_max = 0; /**< capacity of stack. */
-static YY_BUFFER_STATE * yy_buffer_stack = NULL; /**< Stack as an array. */
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- *
- * Returns the top of the stack, or NULL.
- */
-#define YY_CURRENT_BUFFER ( (yy_buffer_stack) \
-                          ? (yy_buffer_stack)[(yy_buffer_stack_top)] \
-                          : NULL)
-/* Same as previous macro, but useful when we know that the buffer stack is not
- * NULL or when we need an lvalue. For internal use only.
- */
-#define YY_CURRENT_BUFFER_LVALUE (yy_buffer_stack)[(yy_buffer_stack_top)]
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-int yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = NULL;
-static int yy_init = 0;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart ( FILE *input_file  );
-void yy_switch_to_buffer ( YY_BUFFER_STATE new_buffer  );
-YY_BUFFER_STATE yy_create_buffer ( FILE *file, int size  );
-void yy_delete_buffer ( YY_BUFFER_STATE b  );
-void yy_flush_buffer ( YY_BUFFER_STATE b  );
-void yypush_buffer_state ( YY_BUFFER_STATE new_buffer  );
-void yypop_buffer_state ( void );
-
-static void yyensure_buffer_stack ( void );
-static void yy_load_buffer_state ( void );
-static void yy_init_buffer ( YY_BUFFER_STATE b, FILE *file  );
-#define YY_FLUSH_BUFFER yy_flush_buffer( YY_CURRENT_BUFFER )
-
-YY_BUFFER_STATE yy_scan_buffer ( char *base, yy_size_t size  );
-YY_BUFFER_STATE yy_scan_string ( const char *yy_str  );
-YY_BUFFER_STATE yy_scan_bytes ( const char *bytes, int len  );
-
-void *yyalloc ( yy_size_t  );
-void *yyrealloc ( void *, yy_size_t  );
-void yyfree ( void *  );
-
-#define yy_new_buffer yy_create_buffer
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){ \
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_is_interactive = is_interactive; \
-	}
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! YY_CURRENT_BUFFER ){\
-        yyensure_buffer_stack (); \
-		YY_CURRENT_BUFFER_LVALUE =    \
-            yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	} \
-	YY_CURRENT_BUFFER_LVALUE->yy_at_bol = at_bol; \
-	}
-#define YY_AT_BOL() (YY_CURRENT_BUFFER_LVALUE->yy_at_bol)
-
-typedef flex_uint8_t YY_CHAR;
-
-FILE *yyin = NULL, *yyout = NULL;
-
-typedef int yy_state_type;
-
-extern int yylineno;
-int yylineno = 1;
-
-extern char *yytext;
-#ifdef yytext_ptr
-#undef yytext_ptr
-#endif
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state ( void );
-static yy_state_type yy_try_NUL_trans ( yy_state_type current_state  );
-static int yy_get_next_buffer ( void );
-static void yynoreturn yy_fatal_error ( const char* msg  );
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-	(yytext_ptr) = yy_bp; \
-	yyleng = (int) (yy_cp - yy_bp); \
-	(yy_hold_char) = *yy_cp; \
-	*yy_cp = '\0'; \
-	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 27
-#define YY_END_OF_BUFFER 28
-/* This struct is not used in this scanner,
-   but its presence is necessary. */
-struct yy_trans_info
-	{
-	flex_int32_t yy_verify;
-	flex_int32_t yy_nxt;
-	};
-static const flex_int16_t yy_accept[236] =
-    {   0,
-       26,   26,    3,    3,   26,   26,   26,   26,   26,   26,
-       26,   26,   28,   27,   21,   21,   27,   27,   17,   25,
-       18,   23,   23,    3,    3,    3,    3,   27,    3,    3,
-        3,    3,    3,    3,   22,   21,   21,   22,   22,   22,
-       18,   22,   22,   21,   27,   27,   23,   23,   23,   27,
-       13,   13,   13,   27,   27,   17,   25,   18,   27,   23,
-       23,   23,   23,   21,   21,    0,   17,   25,   18,    0,
-       24,   20,   17,    0,   19,   11,   25,   23,   23,    3,
-        0,    3,    3,    3,    3,    3,    3,    3,    3,    0,
-        0,    3,    3,    3,    3,    3,    3,   23,    3,    3,
-
-       22,   21,   21,   22,   22,   18,   22,   22,   20,   22,
-       22,   22,   21,    0,    0,    0,    5,   23,   23,   23,
-        0,   13,   13,    0,   13,   13,   13,    0,   17,   25,
-       18,    0,   17,    0,   13,   13,   24,    0,   20,   13,
-        0,   19,   11,   13,    0,   12,   23,   23,   23,   23,
-        0,    0,    0,    2,    0,    3,    3,    0,    0,   23,
-       23,   23,   13,    0,   19,    0,   24,    0,   24,    0,
-        0,    0,   23,   23,    1,    0,    0,    3,    3,   10,
-        0,   23,   23,   23,    0,    0,    1,    0,    0,   23,
-       23,    0,    4,    3,    3,    9,   23,   23,   23,    1,
-
-        0,    0,    4,   23,   23,    0,    3,   23,   23,   23,
-        0,    0,   15,   16,    0,    3,   23,   23,    6,    0,
-        0,    0,    3,    7,   23,    0,    0,   14,    3,   23,
-        0,   14,    8,   14,    0
-    } ;
-
-static const YY_CHAR yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    5,    6,    1,    1,    1,    7,    6,    1,
-        1,    1,    1,    1,    8,    9,   10,    9,    9,    9,
-        9,    9,    9,    9,    9,    9,    9,    9,    1,   11,
-       12,   13,   14,    1,   15,   16,   17,   18,   19,   15,
-       15,   15,   20,   15,   15,   21,   22,   15,   23,   24,
-       15,   15,   25,   26,   27,   15,   15,   15,   28,   15,
-        1,    1,    1,    1,   15,    1,   29,   15,   30,   31,
-
-       32,   15,   33,   15,   34,   15,   15,   35,   36,   37,
-       38,   15,   15,   39,   40,   41,   15,   42,   15,   43,
-       44,   15,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
-
-static const YY_CHAR yy_meta[45] =
-    {   0,
-        1,    1,    2,    1,    1,    1,    3,    4,    4,    1,
-        5,    1,    3,    6,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4
-    } ;
-
-static const flex_int16_t yy_base[255] =
-    {   0,
-        0,   25,   50,   75,  100,  125,  138,  139,  181,  206,
-       16,   18,  821,  822,  230,   13,  814,  784,  141,  775,
-      822,    0,  746,  757,  242,   63,   84,  733,   10,  152,
-       91,  731,  255,  269,    0,  293,  113,  152,  698,  708,
-        0,  306,  320,  147,  161,  696,  667,  662,  665,  221,
-      344,  225,  287,  357,  235,  339,  336,  363,    6,  377,
-      391,  667,   19,    0,  282,  679,  404,  689,  822,  679,
-      822,  822,  682,  155,  822,  629,  663,    0,  634,  647,
-      643,  417,  429,   60,  433,  140,  633,  404,  632,  438,
-      621,  619,  166,  270,  612,  113,  167,  139,  588,    0,
-
-        0,  450,  453,  590,  596,    0,  190,    0,    0,  595,
-      566,    0,    0,  577,  166,   16,  822,  554,  554,  540,
-      371,  420,  116,   32,  463,  467,  477,  480,  493,  497,
-      502,  197,  510,  523,  536,  549,  519,  558,  564,  571,
-      578,  585,  208,  591,  563,  562,  545,    0,  542,  532,
-      546,  525,  505,  822,  527,  279,   13,  526,  224,  493,
-      491,  462,  333,  598,  483,  615,  506,  601,  478,  628,
-      621,   58,  469,  463,  822,  455,  433,  391,   61,  822,
-      453,  427,  417,  402,  635,  643,  646,  650,  212,  393,
-      388,  374,  822,  291,  378,  822,  342,  343,  331,  515,
-
-      542,  654,  348,  335,  307,  300,  323,  278,  279,  263,
-      607,  659,    0,    0,  268,  418,  169,  139,    0,  667,
-      672,  157,  431,    0,   86,  675,  679,  822,  114,   66,
-      686,  698,    0,  704,  822,  712,  718,  724,  730,  736,
-       66,  742,  748,  754,  760,  766,  772,  778,  784,  789,
-      795,  801,  807,  813
-    } ;
-
-static const flex_int16_t yy_def[255] =
-    {   0,
-      236,  236,  237,  237,  238,  238,    2,    2,  239,  239,
-        2,    2,  235,  235,  235,  235,  240,  235,  235,  235,
-      235,  241,  241,  242,  242,  242,  243,  242,  242,  242,
-      242,  242,  244,  244,  245,  245,  245,  246,  245,  245,
-      245,  247,  247,   15,  240,  235,  241,  241,  241,  248,
-      248,  249,  248,  250,  248,  248,  248,  248,  251,  252,
-      252,  241,  241,   15,  235,  235,  235,  235,  235,  240,
-      235,  235,  235,  235,  235,  235,  235,  241,  241,  242,
-      242,  242,  242,  242,  242,  242,  242,  243,  242,  243,
-      235,  242,  242,  242,  242,  242,  242,   34,   34,   34,
-
-      245,  245,  245,  245,  245,  245,  246,  245,  245,  245,
-       43,   43,   44,  235,  240,  240,  235,  241,  241,  241,
-      248,  248,  249,  251,  248,  249,  248,  248,  248,  248,
-      248,  249,  249,  250,  250,  253,  248,  254,  248,  248,
-      248,  248,  251,  248,  251,  251,   61,   61,  241,  241,
-      235,  235,  235,  235,  242,  242,  242,  240,  240,  241,
-      241,  241,  249,  249,  249,  253,  249,  254,  251,  248,
-      248,  251,  241,  241,  235,  235,  235,  242,  242,  235,
-      240,  241,  241,  241,  249,  249,  248,  248,  251,  241,
-      241,  235,  235,  242,  242,  235,  241,  241,  241,  249,
-
-      249,  248,  251,  241,  241,  235,  242,  241,  241,  241,
-      249,  248,  241,  241,  235,  242,  241,  241,  241,  249,
-      248,  235,  242,  241,  241,  249,  248,  235,  242,  241,
-      249,  248,  241,  249,    0,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235
-    } ;
-
-static const flex_int16_t yy_nxt[867] =
-    {   0,
-       14,   15,   16,   16,   14,   17,   14,   14,   14,   18,
-       19,   20,   21,   14,   65,   65,   65,   81,  146,  124,
-       81,   71,   92,   67,   23,   14,   15,   16,   16,   14,
-       17,   14,   14,   14,   18,   19,   20,   21,   14,   62,
-       63,   62,   63,   79,  146,  124,  150,  159,  179,   23,
-       24,   25,   26,   26,   24,   27,   24,   28,   24,   29,
-       30,   31,   32,   24,   83,   83,   83,   81,   81,   78,
-       81,  124,   92,   85,   34,   24,   25,   26,   26,   24,
-       27,   24,   28,   24,   29,   30,   31,   32,   24,   89,
-       80,   90,   97,  189,   80,  195,   80,  233,   81,   34,
-
-       35,   36,   37,   37,   35,   38,   35,   35,   35,   39,
-       19,   40,   41,   35,  103,  103,  103,  123,  123,  123,
-       81,   81,  230,   67,   43,   35,   36,   37,   37,   35,
-       38,   35,   35,   35,   39,   19,   40,   41,   35,   44,
-       44,   97,   73,   45,   45,   74,   78,   81,  113,   43,
-       75,   46,   46,   93,   76,  157,   94,  108,  101,   81,
-      114,   95,  151,   99,  101,   96,   71,   93,   97,   47,
-       47,   71,  152,   81,   81,  228,  225,   48,   48,   49,
-       49,   50,   51,   52,   53,   50,   54,   50,   50,   50,
-       55,   56,   57,   58,   59,  108,  101,  115,  123,  123,
-
-      123,  224,  101,  158,  116,   61,   50,   51,   52,   53,
-       50,   54,   50,   50,   50,   55,   56,   57,   58,   59,
-      146,  124,  122,  123,  122,  124,  126,  126,  126,   71,
-       61,   64,   65,   65,  124,  133,  122,  123,  122,   66,
-       67,   68,   69,   82,   83,   83,  203,  139,  124,   81,
-      172,   84,   85,   86,   87,   80,   80,   80,   80,   80,
-       80,   80,   98,  181,   80,   80,   80,   80,   80,   80,
-       80,   80,   80,   80,   80,   80,   98,  155,   80,   80,
-       80,   80,   80,   65,   65,   65,   81,  156,  127,  126,
-      127,  222,   67,  100,  102,  103,  103,  129,   81,  219,
-
-      124,  178,  104,   67,  105,  106,  101,  101,  101,  101,
-      101,  101,  101,  218,  217,  101,  207,  101,  101,  101,
-      101,  101,  101,  101,  101,  101,  101,  215,  214,  101,
-       81,  101,  101,  101,  163,  123,  123,  144,  123,  122,
-      140,  123,  122,  141,  112,  125,  126,  127,  142,  124,
-      216,  213,  143,  128,  129,  130,  131,  124,  135,  136,
-      135,  124,  137,  121,  122,  123,  122,  121,  210,  121,
-      138,  209,  122,  123,  122,  208,  124,  121,  122,  123,
-      122,  121,  121,  121,  124,   81,  121,  121,  121,  121,
-      124,  121,  122,  123,  122,  121,  121,  121,   81,  206,
-
-      121,  121,  121,  121,  124,   73,  205,  194,   74,   89,
-       80,   90,  204,   75,   80,  148,   80,   76,   82,   83,
-       83,  122,  123,  122,   81,   81,   84,   85,   86,   87,
-       83,   83,   83,  124,   93,  199,   81,   94,   81,   85,
-       81,  223,   95,   89,   80,   70,   96,  198,   80,  229,
-       80,  102,  103,  103,  103,  103,  103,  197,  196,  104,
-       67,  105,  106,   67,  125,  126,  127,  193,  126,  126,
-      126,  192,  128,  129,  130,  131,  124,  133,  127,  126,
-      127,  122,  123,  122,  123,  123,  123,  129,  191,  190,
-      124,  124,  139,  124,  140,  123,  122,  141,  144,  123,
-
-      122,  184,  142,  122,  123,  122,  143,  123,  123,  123,
-      124,  163,  123,  123,  164,  124,  123,  123,  123,  165,
-      122,  123,  122,   76,  135,  136,  135,  183,  137,  121,
-      182,  180,  124,  121,  175,  121,  138,  135,  136,  135,
-      177,  137,  121,  123,  123,  123,  121,  176,  121,  138,
-      136,  136,  136,  175,  167,  132,  174,  173,  211,  132,
-       70,  132,   70,  169,  145,  122,  123,  122,  145,  147,
-      146,  138,  140,  123,  122,  124,  124,  124,  162,  122,
-      123,  122,  161,  160,  124,  170,  122,  123,  122,  117,
-      111,  124,  144,  123,  122,  171,  110,  110,  124,  123,
-
-      123,  123,  109,   70,  124,  185,  169,  145,  123,  123,
-      123,  145,   99,  145,  138,  186,  136,  136,  136,   81,
-      167,  132,  122,  123,  122,  132,   81,  132,   70,  122,
-      123,  122,  220,  154,  124,  187,  123,  123,  123,   81,
-       81,  124,  200,  188,  123,  123,  123,  122,  123,  122,
-      235,  122,  123,  122,   81,  122,  123,  122,   79,  124,
-      122,  123,  122,  124,   77,  201,  202,  124,  123,  123,
-      123,  153,  124,  122,  123,  122,  123,  123,  123,  212,
-      122,  123,  122,   73,   71,  124,  221,  123,  123,  123,
-       77,   72,  124,  149,  226,  227,  120,  232,  231,  122,
-
-      123,  122,  119,  118,  234,  123,  123,  123,  117,  110,
-      109,  124,   22,   22,   22,   22,   22,   22,   33,   33,
-       33,   33,   33,   33,   42,   42,   42,   42,   42,   42,
-       60,   60,   60,   60,   60,   60,   70,   70,   81,   70,
-       91,   70,   80,   80,   80,   80,   80,   80,   88,   88,
-       88,   88,   88,   88,   99,   99,   99,   99,   99,   99,
-      101,  101,  101,  101,   81,  101,  107,  107,  107,  107,
-       79,  107,  111,  111,  111,  111,   77,  111,  121,  121,
-      121,  121,  121,  121,  132,  132,  132,  132,  132,  134,
-      134,  134,  134,  134,  134,  145,   72,  145,  145,  145,
-
-      145,  147,  147,  147,  147,  147,  147,  166,  166,  166,
-      166,  166,  166,  168,  168,  168,  168,  168,  168,   71,
-      235,   13,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235
-    } ;
-
-static const flex_int16_t yy_chk[867] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,   16,   16,   16,   29,   59,   59,
-      157,  116,   29,   16,    1,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    2,   11,
-       11,   12,   12,   63,  124,  124,   63,  116,  157,    2,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,   26,   26,   26,   84,  179,  241,
-       26,  172,   84,   26,    3,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,   27,
-       27,   27,   31,  172,   27,  179,   27,  230,   31,    4,
-
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,   37,   37,   37,  123,  123,  123,
-       96,  229,  225,   37,    5,    6,    6,    6,    6,    6,
-        6,    6,    6,    6,    6,    6,    6,    6,    6,    7,
-        8,   86,   19,    7,    8,   19,   98,   86,   44,    6,
-       19,    7,    8,   30,   19,   96,   30,   38,   38,   30,
-       44,   30,   74,   98,   38,   30,   45,   93,   97,    7,
-        8,  115,   74,   93,   97,  222,  218,    7,    8,    7,
-        8,    9,    9,    9,    9,    9,    9,    9,    9,    9,
-        9,    9,    9,    9,    9,  107,  107,   45,  132,  132,
-
-      132,  217,  107,  115,   45,    9,   10,   10,   10,   10,
-       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
-      143,  143,   50,   50,   50,  189,   52,   52,   52,  159,
-       10,   15,   15,   15,   50,   52,   55,   55,   55,   15,
-       15,   15,   15,   25,   25,   25,  189,   55,   55,   25,
-      143,   25,   25,   25,   25,   33,   33,   33,   33,   33,
-       33,   33,   33,  159,   33,   33,   33,   33,   33,   34,
-       34,   34,   34,   34,   34,   34,   34,   94,   34,   34,
-       34,   34,   34,   65,   65,   65,  156,   94,   53,   53,
-       53,  215,   65,   34,   36,   36,   36,   53,  194,  210,
-
-       53,  156,   36,   36,   36,   36,   42,   42,   42,   42,
-       42,   42,   42,  209,  208,   42,  194,   42,   42,   42,
-       43,   43,   43,   43,   43,   43,   43,  206,  205,   43,
-      207,   43,   43,   43,  163,  163,  163,   57,   57,   57,
-       56,   56,   56,   56,   43,   51,   51,   51,   56,   57,
-      207,  204,   56,   51,   51,   51,   51,   51,   54,   54,
-       54,  203,   54,   54,   58,   58,   58,   54,  199,   54,
-       54,  198,  121,  121,  121,  197,   58,   60,   60,   60,
-       60,   60,   60,   60,  121,  195,   60,   60,   60,   60,
-       60,   61,   61,   61,   61,   61,   61,   61,  178,  192,
-
-       61,   61,   61,   61,   61,   67,  191,  178,   67,   88,
-       88,   88,  190,   67,   88,   61,   88,   67,   82,   82,
-       82,  122,  122,  122,   82,  216,   82,   82,   82,   82,
-       83,   83,   83,  122,   85,  184,   83,   85,  223,   83,
-       85,  216,   85,   90,   90,   90,   85,  183,   90,  223,
-       90,  102,  102,  102,  103,  103,  103,  182,  181,  102,
-      102,  102,  102,  103,  125,  125,  125,  177,  126,  126,
-      126,  176,  125,  125,  125,  125,  125,  126,  127,  127,
-      127,  128,  128,  128,  165,  165,  165,  127,  174,  173,
-      127,  169,  128,  128,  129,  129,  129,  129,  130,  130,
-
-      130,  162,  129,  131,  131,  131,  129,  167,  167,  167,
-      130,  133,  133,  133,  133,  131,  200,  200,  200,  133,
-      137,  137,  137,  133,  134,  134,  134,  161,  134,  134,
-      160,  158,  137,  134,  155,  134,  134,  135,  135,  135,
-      153,  135,  135,  201,  201,  201,  135,  152,  135,  135,
-      136,  136,  136,  151,  136,  136,  150,  149,  201,  136,
-      138,  136,  136,  138,  138,  139,  139,  139,  138,  147,
-      138,  138,  140,  140,  140,  146,  145,  139,  120,  141,
-      141,  141,  119,  118,  140,  141,  142,  142,  142,  114,
-      111,  141,  144,  144,  144,  141,  110,  105,  142,  164,
-
-      164,  164,  104,  168,  144,  164,  168,  168,  211,  211,
-      211,  168,   99,  168,  168,  164,  166,  166,  166,   95,
-      166,  166,  171,  171,  171,  166,   92,  166,  166,  170,
-      170,  170,  211,   91,  171,  170,  185,  185,  185,   89,
-       87,  170,  185,  171,  186,  186,  186,  187,  187,  187,
-       81,  188,  188,  188,   80,  202,  202,  202,   79,  187,
-      212,  212,  212,  188,   77,  186,  188,  202,  220,  220,
-      220,   76,  212,  221,  221,  221,  226,  226,  226,  202,
-      227,  227,  227,   73,   70,  221,  212,  231,  231,  231,
-       68,   66,  227,   62,  220,  221,   49,  227,  226,  232,
-
-      232,  232,   48,   47,  231,  234,  234,  234,   46,   40,
-       39,  232,  236,  236,  236,  236,  236,  236,  237,  237,
-      237,  237,  237,  237,  238,  238,  238,  238,  238,  238,
-      239,  239,  239,  239,  239,  239,  240,  240,   32,  240,
-       28,  240,  242,  242,  242,  242,  242,  242,  243,  243,
-      243,  243,  243,  243,  244,  244,  244,  244,  244,  244,
-      245,  245,  245,  245,   24,  245,  246,  246,  246,  246,
-       23,  246,  247,  247,  247,  247,   20,  247,  248,  248,
-      248,  248,  248,  248,  249,  249,  249,  249,  249,  250,
-      250,  250,  250,  250,  250,  251,   18,  251,  251,  251,
-
-      251,  252,  252,  252,  252,  252,  252,  253,  253,  253,
-      253,  253,  253,  254,  254,  254,  254,  254,  254,   17,
-       13,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
-      235,  235,  235,  235,  235,  235
-    } ;
-
-/* Table of booleans, true if rule could match eol. */
-static const flex_int32_t yy_rule_can_match_eol[28] =
-    {   0,
-1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 1, 
-    0, 1, 1, 0, 1, 0, 0, 0,     };
-
-static yy_state_type yy_last_accepting_state;
-static char *yy_last_accepting_cpos;
-
-extern int yy_flex_debug;
-int yy_flex_debug = 0;
-
-/* The intent behind this definition is that it'll catch
- * any uses of REJECT which flex missed.
- */
-#define REJECT reject_used_but_not_detected
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-#define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
-#line 1 "xml.l"
-#line 2 "xml.l"
- 
-/* 
-	Basic relaxed xml lexical definition.
-	This is a basic definition of the lexical elements necessary to cover 
-	the MusicXML format. It is a simplified form based on the XML document
-	grammar as defined in 
-	"XML in a nutshell - 2nd edition" E.R.Harold and W.S.Means,
-	O'Reilly, June 2002, pp:366--371
-*/
-
-#include "xmlparse.hpp"
-#include <stdio.h>
-
-#define YY_NO_UNISTD_H
-
-extern int libmxmllval;
-
-static int utf16 = 0;
-static int bigendian = 1;
-static int start = 1;
-
-static int wgetc(FILE * fd) {
-	int c = getc(fd);
-	if (start) {
-		if (c == 0xff) {
-			utf16 = 1; bigendian = 0;
-			getc(fd); c = getc(fd);
-		}
-		else if (c == 0xfe) {
-			utf16 = 1; bigendian = 1;
-			getc(fd); c = getc(fd);
-		}
-		start = 0;
-	}
-	if (utf16) {
-		if (bigendian) c = getc(fd);
-		else getc(fd);
-	}
-
-	return c;
-}
-
-static size_t wfread (void * buf, size_t size, size_t nmemb, FILE * fd) {
-	char * ptr = (char *)buf;
-	size_t n=0;
-	while (nmemb--) {
-		*ptr++ = wgetc(fd);
-		if (feof(fd) || ferror(fd) ) break;
-		n++;
-	}
-	return n;
-}
-		 
-void lexinit(FILE* fd) {
-	utf16 = 0;
-	bigendian = 1;
-	start = 1;
-	yyrestart(fd);
-}
-		 
-void lexend() {
-	if (YY_CURRENT_BUFFER) {
-		libmxml_delete_buffer (YY_CURRENT_BUFFER);
-	}
-}
-
-#define getc	wgetc
-#define fread	wfread
-#define register		// to get rid of the -Wdeprecated-register
-
-#line 1066 "xmllex.c++"
-
-#line 1068 "xmllex.c++"
-
-#define INITIAL 0
-#define COMMENTSECT 1
-#define DATASECT 2
-#define XMLSECT 3
-#define PISECT 4
-#define DOCTYPESECT 5
-
-#ifndef YY_NO_UNISTD_H
-/* Special case for "unistd.h", since it is non-ANSI. We include it way
- * down here because we want the user's section 1 to have been scanned first.
- * The user has a chance to override it with an option.
- */
-#include <unistd.h>
-#endif
-
-#ifndef YY_EXTRA_TYPE
-#define YY_EXTRA_TYPE void *
-#endif
-
-static int yy_init_globals ( void );
-
-/* Accessor methods to globals.
-   These are made visible to non-reentrant scanners for convenience. */
-
-int yylex_destroy ( void );
-
-int yyget_debug ( void );
-
-void yyset_debug ( int debug_flag  );
-
-YY_EXTRA_TYPE yyget_extra ( void );
-
-void yyset_extra ( YY_EXTRA_TYPE user_defined  );
-
-FILE *yyget_in ( void );
-
-void yyset_in  ( FILE * _in_str  );
-
-FILE *yyget_out ( void );
-
-void yyset_out  ( FILE * _out_str  );
-
-			int yyget_leng ( void );
-
-char *yyget_text ( void );
-
-int yyget_lineno ( void );
-
-void yyset_lineno ( int _line_number  );
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap ( void );
-#else
-extern int yywrap ( void );
-#endif
-#endif
-
-#ifndef YY_NO_UNPUT
-    
-#endif
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy ( char *, const char *, int );
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen ( const char * );
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-static int yyinput ( void );
-#else
-static int input ( void );
-#endif
-
-#endif
-
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#ifdef __ia64__
-/* On IA-64, the buffer size is 16k, not 8k */
-#define YY_READ_BUF_SIZE 16384
-#else
-#define YY_READ_BUF_SIZE 8192
-#endif /* __ia64__ */
-#endif
-
-/* Copy whatever the last rule matched to the standard output. */
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO do { if (fwrite( yytext, (size_t) yyleng, 1, yyout )) {} } while (0)
-#endif
-
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_is_interactive ) \
-		{ \
-		int c = '*'; \
-		int n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else \
-		{ \
-		errno=0; \
-		while ( (result = (int) fread(buf, 1, (yy_size_t) max_size, yyin)) == 0 && ferror(yyin)) \
-			{ \
-			if( errno != EINTR) \
-				{ \
-				YY_FATAL_ERROR( "input in flex scanner failed" ); \
-				break; \
-				} \
-			errno=0; \
-			clearerr(yyin); \
-			} \
-		}\
-\
-
-#endif
-
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
-
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
-
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
-
-/* end tables serialization structures and prototypes */
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL_IS_OURS 1
-
-extern int yylex (void);
-
-#define YY_DECL int yylex (void)
-#endif /* !YY_DECL */
-
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
-
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK /*LINTED*/break;
-#endif
-
-#define YY_RULE_SETUP \
-	YY_USER_ACTION
-
-/** The main scanner function which does all the work.
- */
-YY_DECL
-{
-	yy_state_type yy_current_state;
-	char *yy_cp, *yy_bp;
-	int yy_act;
-    
-	if ( !(yy_init) )
-		{
-		(yy_init) = 1;
-
-#ifdef YY_USER_INIT
-		YY_USER_INIT;
-#endif
-
-		if ( ! (yy_start) )
-			(yy_start) = 1;	/* first start state */
-
-		if ( ! yyin )
-			yyin = stdin;
-
-		if ( ! yyout )
-			yyout = stdout;
-
-		if ( ! YY_CURRENT_BUFFER ) {
-			yyensure_buffer_stack ();
-			YY_CURRENT_BUFFER_LVALUE =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
-		}
-
-		yy_load_buffer_state(  );
-		}
-
-	{
-#line 92 "xml.l"
-
-
-
-#line 1292 "xmllex.c++"
-
-	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
-		{
-		yy_cp = (yy_c_buf_p);
-
-		/* Support of yytext. */
-		*yy_cp = (yy_hold_char);
-
-		/* yy_bp points to the position in yy_ch_buf of the start of
-		 * the current run.
-		 */
-		yy_bp = yy_cp;
-
-		yy_current_state = (yy_start);
-yy_match:
-		do
-			{
-			YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)] ;
-			if ( yy_accept[yy_current_state] )
-				{
-				(yy_last_accepting_state) = yy_current_state;
-				(yy_last_accepting_cpos) = yy_cp;
-				}
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 236 )
-					yy_c = yy_meta[yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-			++yy_cp;
-			}
-		while ( yy_current_state != 235 );
-		yy_cp = (yy_last_accepting_cpos);
-		yy_current_state = (yy_last_accepting_state);
-
-yy_find_action:
-		yy_act = yy_accept[yy_current_state];
-
-		YY_DO_BEFORE_ACTION;
-
-		if ( yy_act != YY_END_OF_BUFFER && yy_rule_can_match_eol[yy_act] )
-			{
-			int yyl;
-			for ( yyl = 0; yyl < yyleng; ++yyl )
-				if ( yytext[yyl] == '\n' )
-					
-    yylineno++;
-;
-			}
-
-do_action:	/* This label is used only to access EOF actions. */
-
-		switch ( yy_act )
-	{ /* beginning of action switch */
-			case 0: /* must back up */
-			/* undo the effects of YY_DO_BEFORE_ACTION */
-			*yy_cp = (yy_hold_char);
-			yy_cp = (yy_last_accepting_cpos);
-			yy_current_state = (yy_last_accepting_state);
-			goto yy_find_action;
-
-case 1:
-/* rule 1 can match eol */
-YY_RULE_SETUP
-#line 95 "xml.l"
-{ BEGIN COMMENTSECT; }
-	YY_BREAK
-case 2:
-YY_RULE_SETUP
-#line 96 "xml.l"
-{ BEGIN 0; }
-	YY_BREAK
-case 3:
-/* rule 3 can match eol */
-YY_RULE_SETUP
-#line 97 "xml.l"
-{ return COMMENT; }
-	YY_BREAK
-case 4:
-/* rule 4 can match eol */
-YY_RULE_SETUP
-#line 100 "xml.l"
-{ BEGIN XMLSECT; return XMLDECL; }
-	YY_BREAK
-case 5:
-YY_RULE_SETUP
-#line 101 "xml.l"
-{ BEGIN 0; return ENDXMLDECL; }
-	YY_BREAK
-case 6:
-YY_RULE_SETUP
-#line 102 "xml.l"
-{ return VERSION; }
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 103 "xml.l"
-{ return ENCODING; }
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 104 "xml.l"
-{ return STANDALONE; }
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 105 "xml.l"
-{ libmxmllval=1; return YES; }
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 106 "xml.l"
-{ libmxmllval=0; return NO; }
-	YY_BREAK
-case 11:
-/* rule 11 can match eol */
-YY_RULE_SETUP
-#line 108 "xml.l"
-{ BEGIN PISECT; }
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 109 "xml.l"
-{ BEGIN 0; return PI; }
-	YY_BREAK
-case 13:
-/* rule 13 can match eol */
-YY_RULE_SETUP
-#line 110 "xml.l"
-{ return PI; }
-	YY_BREAK
-case 14:
-/* rule 14 can match eol */
-YY_RULE_SETUP
-#line 112 "xml.l"
-{ BEGIN DOCTYPESECT; return DOCTYPE; }
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 113 "xml.l"
-{ return PUBLIC; }
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 114 "xml.l"
-{ return SYSTEM; }
-	YY_BREAK
-case 17:
-/* rule 17 can match eol */
-YY_RULE_SETUP
-#line 116 "xml.l"
-{ BEGIN 0; return LT; }
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 117 "xml.l"
-{ BEGIN DATASECT; return GT; }
-	YY_BREAK
-case 19:
-/* rule 19 can match eol */
-YY_RULE_SETUP
-#line 118 "xml.l"
-{ BEGIN 0; return ENDXMLS; }
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 119 "xml.l"
-{ return ENDXMLE; }
-	YY_BREAK
-case 21:
-/* rule 21 can match eol */
-YY_RULE_SETUP
-#line 121 "xml.l"
-{ return SPACE; }
-	YY_BREAK
-case 22:
-/* rule 22 can match eol */
-YY_RULE_SETUP
-#line 122 "xml.l"
-{ return DATA; }
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 123 "xml.l"
-{ return NAME; }
-	YY_BREAK
-case 24:
-/* rule 24 can match eol */
-YY_RULE_SETUP
-#line 124 "xml.l"
-{ return QUOTEDSTR; }
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 125 "xml.l"
-{ return EQ; }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 127 "xml.l"
-{ /* extra space ignored*/ }
-	YY_BREAK
-case YY_STATE_EOF(INITIAL):
-case YY_STATE_EOF(COMMENTSECT):
-case YY_STATE_EOF(DATASECT):
-case YY_STATE_EOF(XMLSECT):
-case YY_STATE_EOF(PISECT):
-case YY_STATE_EOF(DOCTYPESECT):
-#line 129 "xml.l"
-yyterminate();
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 130 "xml.l"
-ECHO;
-	YY_BREAK
-#line 1510 "xmllex.c++"
-
-	case YY_END_OF_BUFFER:
-		{
-		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - (yytext_ptr)) - 1;
-
-		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = (yy_hold_char);
-		YY_RESTORE_YY_MORE_OFFSET
-
-		if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_NEW )
-			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between YY_CURRENT_BUFFER and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-			YY_CURRENT_BUFFER_LVALUE->yy_input_file = yyin;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status = YY_BUFFER_NORMAL;
-			}
-
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( (yy_c_buf_p) <= &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			{ /* This was really a NUL. */
-			yy_state_type yy_next_state;
-
-			(yy_c_buf_p) = (yytext_ptr) + yy_amount_of_matched_text;
-
-			yy_current_state = yy_get_previous_state(  );
-
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
-
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-
-			if ( yy_next_state )
-				{
-				/* Consume the NUL. */
-				yy_cp = ++(yy_c_buf_p);
-				yy_current_state = yy_next_state;
-				goto yy_match;
-				}
-
-			else
-				{
-				yy_cp = (yy_last_accepting_cpos);
-				yy_current_state = (yy_last_accepting_state);
-				goto yy_find_action;
-				}
-			}
-
-		else switch ( yy_get_next_buffer(  ) )
-			{
-			case EOB_ACT_END_OF_FILE:
-				{
-				(yy_did_buffer_switch_on_eof) = 0;
-
-				if ( yywrap(  ) )
-					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					(yy_c_buf_p) = (yytext_ptr) + YY_MORE_ADJ;
-
-					yy_act = YY_STATE_EOF(YY_START);
-					goto do_action;
-					}
-
-				else
-					{
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-					}
-				break;
-				}
-
-			case EOB_ACT_CONTINUE_SCAN:
-				(yy_c_buf_p) =
-					(yytext_ptr) + yy_amount_of_matched_text;
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_match;
-
-			case EOB_ACT_LAST_MATCH:
-				(yy_c_buf_p) =
-				&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)];
-
-				yy_current_state = yy_get_previous_state(  );
-
-				yy_cp = (yy_c_buf_p);
-				yy_bp = (yytext_ptr) + YY_MORE_ADJ;
-				goto yy_find_action;
-			}
-		break;
-		}
-
-	default:
-		YY_FATAL_ERROR(
-			"fatal flex scanner internal error--no action found" );
-	} /* end of action switch */
-		} /* end of scanning one token */
-	} /* end of user's declarations */
-} /* end of yylex */
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-static int yy_get_next_buffer (void)
-{
-    	char *dest = YY_CURRENT_BUFFER_LVALUE->yy_ch_buf;
-	char *source = (yytext_ptr);
-	int number_to_move, i;
-	int ret_val;
-
-	if ( (yy_c_buf_p) > &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] )
-		YY_FATAL_ERROR(
-		"fatal flex scanner internal error--end of buffer missed" );
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_fill_buffer == 0 )
-		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( (yy_c_buf_p) - (yytext_ptr) - YY_MORE_ADJ == 1 )
-			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
-			return EOB_ACT_END_OF_FILE;
-			}
-
-		else
-			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
-			return EOB_ACT_LAST_MATCH;
-			}
-		}
-
-	/* Try to read more data. */
-
-	/* First move last chars to start of buffer. */
-	number_to_move = (int) ((yy_c_buf_p) - (yytext_ptr) - 1);
-
-	for ( i = 0; i < number_to_move; ++i )
-		*(dest++) = *(source++);
-
-	if ( YY_CURRENT_BUFFER_LVALUE->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars) = 0;
-
-	else
-		{
-			int num_to_read =
-			YY_CURRENT_BUFFER_LVALUE->yy_buf_size - number_to_move - 1;
-
-		while ( num_to_read <= 0 )
-			{ /* Not enough room in the buffer - grow it. */
-
-			/* just a shorter name for the current buffer */
-			YY_BUFFER_STATE b = YY_CURRENT_BUFFER_LVALUE;
-
-			int yy_c_buf_p_offset =
-				(int) ((yy_c_buf_p) - b->yy_ch_buf);
-
-			if ( b->yy_is_our_buffer )
-				{
-				int new_size = b->yy_buf_size * 2;
-
-				if ( new_size <= 0 )
-					b->yy_buf_size += b->yy_buf_size / 8;
-				else
-					b->yy_buf_size *= 2;
-
-				b->yy_ch_buf = (char *)
-					/* Include room in for 2 EOB chars. */
-					yyrealloc( (void *) b->yy_ch_buf,
-							 (yy_size_t) (b->yy_buf_size + 2)  );
-				}
-			else
-				/* Can't grow it, we don't own it. */
-				b->yy_ch_buf = NULL;
-
-			if ( ! b->yy_ch_buf )
-				YY_FATAL_ERROR(
-				"fatal error - scanner input buffer overflow" );
-
-			(yy_c_buf_p) = &b->yy_ch_buf[yy_c_buf_p_offset];
-
-			num_to_read = YY_CURRENT_BUFFER_LVALUE->yy_buf_size -
-						number_to_move - 1;
-
-			}
-
-		if ( num_to_read > YY_READ_BUF_SIZE )
-			num_to_read = YY_READ_BUF_SIZE;
-
-		/* Read in more data. */
-		YY_INPUT( (&YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[number_to_move]),
-			(yy_n_chars), num_to_read );
-
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	if ( (yy_n_chars) == 0 )
-		{
-		if ( number_to_move == YY_MORE_ADJ )
-			{
-			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin  );
-			}
-
-		else
-			{
-			ret_val = EOB_ACT_LAST_MATCH;
-			YY_CURRENT_BUFFER_LVALUE->yy_buffer_status =
-				YY_BUFFER_EOF_PENDING;
-			}
-		}
-
-	else
-		ret_val = EOB_ACT_CONTINUE_SCAN;
-
-	if (((yy_n_chars) + number_to_move) > YY_CURRENT_BUFFER_LVALUE->yy_buf_size) {
-		/* Extend the array by 50%, plus the number we really need. */
-		int new_size = (yy_n_chars) + number_to_move + ((yy_n_chars) >> 1);
-		YY_CURRENT_BUFFER_LVALUE->yy_ch_buf = (char *) yyrealloc(
-			(void *) YY_CURRENT_BUFFER_LVALUE->yy_ch_buf, (yy_size_t) new_size  );
-		if ( ! YY_CURRENT_BUFFER_LVALUE->yy_ch_buf )
-			YY_FATAL_ERROR( "out of dynamic memory in yy_get_next_buffer()" );
-		/* "- 2" to take care of EOB's */
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_size = (int) (new_size - 2);
-	}
-
-	(yy_n_chars) += number_to_move;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] = YY_END_OF_BUFFER_CHAR;
-	YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars) + 1] = YY_END_OF_BUFFER_CHAR;
-
-	(yytext_ptr) = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[0];
-
-	return ret_val;
-}
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-    static yy_state_type yy_get_previous_state (void)
-{
-	yy_state_type yy_current_state;
-	char *yy_cp;
-    
-	yy_current_state = (yy_start);
-
-	for ( yy_cp = (yytext_ptr) + YY_MORE_ADJ; yy_cp < (yy_c_buf_p); ++yy_cp )
-		{
-		YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		if ( yy_accept[yy_current_state] )
-			{
-			(yy_last_accepting_state) = yy_current_state;
-			(yy_last_accepting_cpos) = yy_cp;
-			}
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 236 )
-				yy_c = yy_meta[yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-		}
-
-	return yy_current_state;
-}
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-    static yy_state_type yy_try_NUL_trans  (yy_state_type yy_current_state )
-{
-	int yy_is_jam;
-    	char *yy_cp = (yy_c_buf_p);
-
-	YY_CHAR yy_c = 1;
-	if ( yy_accept[yy_current_state] )
-		{
-		(yy_last_accepting_state) = yy_current_state;
-		(yy_last_accepting_cpos) = yy_cp;
-		}
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 236 )
-			yy_c = yy_meta[yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 235);
-
-		return yy_is_jam ? 0 : yy_current_state;
-}
-
-#ifndef YY_NO_UNPUT
-
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-    static int yyinput (void)
-#else
-    static int input  (void)
-#endif
-
-{
-	int c;
-    
-	*(yy_c_buf_p) = (yy_hold_char);
-
-	if ( *(yy_c_buf_p) == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( (yy_c_buf_p) < &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[(yy_n_chars)] )
-			/* This was really a NUL. */
-			*(yy_c_buf_p) = '\0';
-
-		else
-			{ /* need more input */
-			int offset = (int) ((yy_c_buf_p) - (yytext_ptr));
-			++(yy_c_buf_p);
-
-			switch ( yy_get_next_buffer(  ) )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart( yyin );
-
-					/*FALLTHROUGH*/
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap(  ) )
-						return 0;
-
-					if ( ! (yy_did_buffer_switch_on_eof) )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
-
-				case EOB_ACT_CONTINUE_SCAN:
-					(yy_c_buf_p) = (yytext_ptr) + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) (yy_c_buf_p);	/* cast for 8-bit char's */
-	*(yy_c_buf_p) = '\0';	/* preserve yytext */
-	(yy_hold_char) = *++(yy_c_buf_p);
-
-	if ( c == '\n' )
-		
-    yylineno++;
-;
-
-	return c;
-}
-#endif	/* ifndef YY_NO_INPUT */
-
-/** Immediately switch to a different input stream.
- * @param input_file A readable stream.
- * 
- * @note This function does not reset the start condition to @c INITIAL .
- */
-    void yyrestart  (FILE * input_file )
-{
-    
-	if ( ! YY_CURRENT_BUFFER ){
-        yyensure_buffer_stack ();
-		YY_CURRENT_BUFFER_LVALUE =
-            yy_create_buffer( yyin, YY_BUF_SIZE );
-	}
-
-	yy_init_buffer( YY_CURRENT_BUFFER, input_file );
-	yy_load_buffer_state(  );
-}
-
-/** Switch to a different input buffer.
- * @param new_buffer The new input buffer.
- * 
- */
-    void yy_switch_to_buffer  (YY_BUFFER_STATE  new_buffer )
-{
-    
-	/* TODO. We should be able to replace this entire function body
-	 * with
-	 *		yypop_buffer_state();
-	 *		yypush_buffer_state(new_buffer);
-     */
-	yyensure_buffer_stack ();
-	if ( YY_CURRENT_BUFFER == new_buffer )
-		return;
-
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-	yy_load_buffer_state(  );
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-static void yy_load_buffer_state  (void)
-{
-    	(yy_n_chars) = YY_CURRENT_BUFFER_LVALUE->yy_n_chars;
-	(yytext_ptr) = (yy_c_buf_p) = YY_CURRENT_BUFFER_LVALUE->yy_buf_pos;
-	yyin = YY_CURRENT_BUFFER_LVALUE->yy_input_file;
-	(yy_hold_char) = *(yy_c_buf_p);
-}
-
-/** Allocate and initialize an input buffer state.
- * @param file A readable stream.
- * @param size The character buffer size in bytes. When in doubt, use @c YY_BUF_SIZE.
- * 
- * @return the allocated buffer state.
- */
-    YY_BUFFER_STATE yy_create_buffer  (FILE * file, int  size )
-{
-	YY_BUFFER_STATE b;
-    
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_buf_size = size;
-
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yyalloc( (yy_size_t) (b->yy_buf_size + 2)  );
-	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_is_our_buffer = 1;
-
-	yy_init_buffer( b, file );
-
-	return b;
-}
-
-/** Destroy the buffer.
- * @param b a buffer created with yy_create_buffer()
- * 
- */
-    void yy_delete_buffer (YY_BUFFER_STATE  b )
-{
-    
-	if ( ! b )
-		return;
-
-	if ( b == YY_CURRENT_BUFFER ) /* Not sure if we should pop here. */
-		YY_CURRENT_BUFFER_LVALUE = (YY_BUFFER_STATE) 0;
-
-	if ( b->yy_is_our_buffer )
-		yyfree( (void *) b->yy_ch_buf  );
-
-	yyfree( (void *) b  );
-}
-
-/* Initializes or reinitializes a buffer.
- * This function is sometimes called more than once on the same buffer,
- * such as during a yyrestart() or at EOF.
- */
-    static void yy_init_buffer  (YY_BUFFER_STATE  b, FILE * file )
-
-{
-	int oerrno = errno;
-    
-	yy_flush_buffer( b );
-
-	b->yy_input_file = file;
-	b->yy_fill_buffer = 1;
-
-    /* If b is the current buffer, then yy_init_buffer was _probably_
-     * called from yyrestart() or through yy_get_next_buffer.
-     * In that case, we don't want to reset the lineno or column.
-     */
-    if (b != YY_CURRENT_BUFFER){
-        b->yy_bs_lineno = 1;
-        b->yy_bs_column = 0;
-    }
-
-        b->yy_is_interactive = 0;
-    
-	errno = oerrno;
-}
-
-/** Discard all buffered characters. On the next scan, YY_INPUT will be called.
- * @param b the buffer state to be flushed, usually @c YY_CURRENT_BUFFER.
- * 
- */
-    void yy_flush_buffer (YY_BUFFER_STATE  b )
-{
-    	if ( ! b )
-		return;
-
-	b->yy_n_chars = 0;
-
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
-	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-	b->yy_buf_pos = &b->yy_ch_buf[0];
-
-	b->yy_at_bol = 1;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	if ( b == YY_CURRENT_BUFFER )
-		yy_load_buffer_state(  );
-}
-
-/** Pushes the new state onto the stack. The new state becomes
- *  the current state. This function will allocate the stack
- *  if necessary.
- *  @param new_buffer The new state.
- *  
- */
-void yypush_buffer_state (YY_BUFFER_STATE new_buffer )
-{
-    	if (new_buffer == NULL)
-		return;
-
-	yyensure_buffer_stack();
-
-	/* This block is copied from yy_switch_to_buffer. */
-	if ( YY_CURRENT_BUFFER )
-		{
-		/* Flush out information for old buffer. */
-		*(yy_c_buf_p) = (yy_hold_char);
-		YY_CURRENT_BUFFER_LVALUE->yy_buf_pos = (yy_c_buf_p);
-		YY_CURRENT_BUFFER_LVALUE->yy_n_chars = (yy_n_chars);
-		}
-
-	/* Only push if top exists. Otherwise, replace top. */
-	if (YY_CURRENT_BUFFER)
-		(yy_buffer_stack_top)++;
-	YY_CURRENT_BUFFER_LVALUE = new_buffer;
-
-	/* copied from yy_switch_to_buffer. */
-	yy_load_buffer_state(  );
-	(yy_did_buffer_switch_on_eof) = 1;
-}
-
-/** Removes and deletes the top of the stack, if present.
- *  The next element becomes the new top.
- *  
- */
-void yypop_buffer_state (void)
-{
-    	if (!YY_CURRENT_BUFFER)
-		return;
-
-	yy_delete_buffer(YY_CURRENT_BUFFER );
-	YY_CURRENT_BUFFER_LVALUE = NULL;
-	if ((yy_buffer_stack_top) > 0)
-		--(yy_buffer_stack_top);
-
-	if (YY_CURRENT_BUFFER) {
-		yy_load_buffer_state(  );
-		(yy_did_buffer_switch_on_eof) = 1;
-	}
-}
-
-/* Allocates the stack if it does not exist.
- *  Guarantees space for at least one push.
- */
-static void yyensure_buffer_stack (void)
-{
-	yy_size_t num_to_alloc;
-    
-	if (!(yy_buffer_stack)) {
-
-		/* First allocation is just for 2 elements, since we don't know if this
-		 * scanner will even need a stack. We use 2 instead of 1 to avoid an
-		 * immediate realloc on the next call.
-         */
-      num_to_alloc = 1; /* After all that talk, this was set to 1 anyways... */
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyalloc
-								(num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		memset((yy_buffer_stack), 0, num_to_alloc * sizeof(struct yy_buffer_state*));
-
-		(yy_buffer_stack_max) = num_to_alloc;
-		(yy_buffer_stack_top) = 0;
-		return;
-	}
-
-	if ((yy_buffer_stack_top) >= ((yy_buffer_stack_max)) - 1){
-
-		/* Increase the buffer to prepare for a possible push. */
-		yy_size_t grow_size = 8 /* arbitrary grow size */;
-
-		num_to_alloc = (yy_buffer_stack_max) + grow_size;
-		(yy_buffer_stack) = (struct yy_buffer_state**)yyrealloc
-								((yy_buffer_stack),
-								num_to_alloc * sizeof(struct yy_buffer_state*)
-								);
-		if ( ! (yy_buffer_stack) )
-			YY_FATAL_ERROR( "out of dynamic memory in yyensure_buffer_stack()" );
-
-		/* zero only the new slots.*/
-		memset((yy_buffer_stack) + (yy_buffer_stack_max), 0, grow_size * sizeof(struct yy_buffer_state*));
-		(yy_buffer_stack_max) = num_to_alloc;
-	}
-}
-
-/** Setup the input buffer state to scan directly from a user-specified character buffer.
- * @param base the character buffer
- * @param size the size in bytes of the character buffer
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_buffer  (char * base, yy_size_t  size )
-{
-	YY_BUFFER_STATE b;
-    
-	if ( size < 2 ||
-	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
-	     base[size-1] != YY_END_OF_BUFFER_CHAR )
-		/* They forgot to leave room for the EOB's. */
-		return NULL;
-
-	b = (YY_BUFFER_STATE) yyalloc( sizeof( struct yy_buffer_state )  );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-	b->yy_buf_size = (int) (size - 2);	/* "- 2" to take care of EOB's */
-	b->yy_buf_pos = b->yy_ch_buf = base;
-	b->yy_is_our_buffer = 0;
-	b->yy_input_file = NULL;
-	b->yy_n_chars = b->yy_buf_size;
-	b->yy_is_interactive = 0;
-	b->yy_at_bol = 1;
-	b->yy_fill_buffer = 0;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	yy_switch_to_buffer( b  );
-
-	return b;
-}
-
-/** Setup the input buffer state to scan a string. The next call to yylex() will
- * scan from a @e copy of @a str.
- * @param yystr a NUL-terminated string to scan
- * 
- * @return the newly allocated buffer state object.
- * @note If you want to scan bytes that may contain NUL values, then use
- *       yy_scan_bytes() instead.
- */
-YY_BUFFER_STATE yy_scan_string (const char * yystr )
-{
-    
-	return yy_scan_bytes( yystr, (int) strlen(yystr) );
-}
-
-/** Setup the input buffer state to scan the given bytes. The next call to yylex() will
- * scan from a @e copy of @a bytes.
- * @param yybytes the byte buffer to scan
- * @param _yybytes_len the number of bytes in the buffer pointed to by @a bytes.
- * 
- * @return the newly allocated buffer state object.
- */
-YY_BUFFER_STATE yy_scan_bytes  (const char * yybytes, int  _yybytes_len )
-{
-	YY_BUFFER_STATE b;
-	char *buf;
-	yy_size_t n;
-	int i;
-    
-	/* Get memory for full buffer, including space for trailing EOB's. */
-	n = (yy_size_t) (_yybytes_len + 2);
-	buf = (char *) yyalloc( n  );
-	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-	for ( i = 0; i < _yybytes_len; ++i )
-		buf[i] = yybytes[i];
-
-	buf[_yybytes_len] = buf[_yybytes_len+1] = YY_END_OF_BUFFER_CHAR;
-
-	b = yy_scan_buffer( buf, n );
-	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
-	b->yy_is_our_buffer = 1;
-
-	return b;
-}
-
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
-
-static void yynoreturn yy_fatal_error (const char* msg )
-{
-			fprintf( stderr, "%s\n", msg );
-	exit( YY_EXIT_FAILURE );
-}
-
-/* Redefine yyless() so it works in section 3 code. */
-
-#undef yyless
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-        int yyless_macro_arg = (n); \
-        YY_LESS_LINENO(yyless_macro_arg);\
-		yytext[yyleng] = (yy_hold_char); \
-		(yy_c_buf_p) = yytext + yyless_macro_arg; \
-		(yy_hold_char) = *(yy_c_buf_p); \
-		*(yy_c_buf_p) = '\0'; \
-		yyleng = yyless_macro_arg; \
-		} \
-	while ( 0 )
-
-/* Accessor  methods (get/set functions) to struct members. */
-
-/** Get the current line number.
- * 
- */
-int yyget_lineno  (void)
-{
-    
-    return yylineno;
-}
-
-/** Get the input stream.
- * 
- */
-FILE *yyget_in  (void)
-{
-        return yyin;
-}
-
-/** Get the output stream.
- * 
- */
-FILE *yyget_out  (void)
-{
-        return yyout;
-}
-
-/** Get the length of the current token.
- * 
- */
-int yyget_leng  (void)
-{
-        return yyleng;
-}
-
-/** Get the current token.
- * 
- */
-
-char *yyget_text  (void)
-{
-        return yytext;
-}
-
-/** Set the current line number.
- * @param _line_number line number
- * 
- */
-void yyset_lineno (int  _line_number )
-{
-    
-    yylineno = _line_number;
-}
-
-/** Set the input stream. This does not discard the current
- * input buffer.
- * @param _in_str A readable stream.
- * 
- * @see yy_switch_to_buffer
- */
-void yyset_in (FILE *  _in_str )
-{
-        yyin = _in_str ;
-}
-
-void yyset_out (FILE *  _out_str )
-{
-        yyout = _out_str ;
-}
-
-int yyget_debug  (void)
-{
-        return yy_flex_debug;
-}
-
-void yyset_debug (int  _bdebug )
-{
-        yy_flex_debug = _bdebug ;
-}
-
-static int yy_init_globals (void)
-{
-        /* Initialization is the same as for the non-reentrant scanner.
-     * This function is called from yylex_destroy(), so don't allocate here.
-     */
-
-    /* We do not touch yylineno unless the option is enabled. */
-    yylineno =  1;
-    
-    (yy_buffer_stack) = NULL;
-    (yy_buffer_stack_top) = 0;
-    (yy_buffer_stack_max) = 0;
-    (yy_c_buf_p) = NULL;
-    (yy_init) = 0;
-    (yy_start) = 0;
-
-/* Defined in main.c */
-#ifdef YY_STDINIT
-    yyin = stdin;
-    yyout = stdout;
-#else
-    yyin = NULL;
-    yyout = NULL;
-#endif
-
-    /* For future reference: Set errno on error, since we are called by
-     * yylex_init()
-     */
-    return 0;
-}
-
-/* yylex_destroy is for both reentrant and non-reentrant scanners. */
-int yylex_destroy  (void)
-{
-    
-    /* Pop the buffer stack, destroying each element. */
-	while(YY_CURRENT_BUFFER){
-		yy_delete_buffer( YY_CURRENT_BUFFER  );
-		YY_CURRENT_BUFFER_LVALUE = NULL;
-		yypop_buffer_state();
-	}
-
-	/* Destroy the stack itself. */
-	yyfree((yy_buffer_stack) );
-	(yy_buffer_stack) = NULL;
-
-    /* Reset the globals. This is important in a non-reentrant scanner so the next time
-     * yylex() is called, initialization will occur. */
-    yy_init_globals( );
-
-    return 0;
-}
-
-/*
- * Internal utility routines.
- */
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy (char* s1, const char * s2, int n )
-{
-		
-	int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
-}
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen (const char * s )
-{
-	int n;
-	for ( n = 0; s[n]; ++n )
-		;
-
-	return n;
-}
-#endif
-
-void *yyalloc (yy_size_t  size )
-{
-			return malloc(size);
-}
-
-void *yyrealloc  (void * ptr, yy_size_t  size )
-{
-		
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return realloc(ptr, size);
-}
-
-void yyfree (void * ptr )
-{
-			free( (char *) ptr );	/* see yyrealloc() for (char *) cast */
-}
-
-#define YYTABLES_NAME "yytables"
-
-#line 130 "xml.l"
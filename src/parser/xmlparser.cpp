@@ -0,0 +1,552 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <string.h>
+#include <iostream>
+
+#ifdef WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+#endif
+
+#include "mxlfile.h"
+#include "transcoder.h"
+#include "xmlparser.h"
+
+using namespace std;
+
+//______________________________________________________________________________
+// lexical classes, see xml.l
+static inline bool isSpace (char c)		{ return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'); }
+static inline bool isBlank (char c)		{ return (c == ' ') || (c == '\t'); }
+static inline bool isFirstChar (char c)	{ return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_'); }
+static inline bool isNameChar (char c)	{ return isFirstChar(c) || ((c >= '0') && (c <= '9')) || (c == '-') || (c == '.') || (c == ':'); }
+
+//______________________________________________________________________________
+// loads a stream in memory
+// data that are not UTF-8 are converted while reading (see transcoder)
+static bool load (FILE* fd, string& content, bool& transcoded)
+{
+	char buff[4096];
+	size_t n;
+	transcoder t;
+	bool first = true;
+	while ((n = fread (buff, 1, sizeof(buff), fd)) > 0) {
+		if (first) {
+			t.detect (buff, n);
+			first = false;
+		}
+		t.convert (buff, n, content);
+	}
+	if (ferror(fd)) return false;
+	t.end (content);
+	transcoded = t.active();
+	return true;
+}
+
+//______________________________________________________________________________
+// a read only memory mapping of a file
+// data() is null when the file can't be mapped
+//______________________________________________________________________________
+class mappedfile
+{
+	const char*	fData;
+	size_t		fSize;
+#ifdef WIN32
+	HANDLE		fFile;
+	HANDLE		fMapping;
+#endif
+
+	public:
+				 mappedfile (const char* file);
+		virtual ~mappedfile ();
+
+		const char*	data () const	{ return fData; }
+		size_t		size () const	{ return fSize; }
+};
+
+#ifdef WIN32
+mappedfile::mappedfile (const char* file) : fData(0), fSize(0), fMapping(0)
+{
+	fFile = CreateFileA (file, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+	if (fFile == INVALID_HANDLE_VALUE) return;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx (fFile, &size) || (size.QuadPart <= 0)) return;
+	fMapping = CreateFileMappingA (fFile, 0, PAGE_READONLY, 0, 0, 0);
+	if (!fMapping) return;
+	fData = (const char*)MapViewOfFile (fMapping, FILE_MAP_READ, 0, 0, 0);
+	if (fData) fSize = size_t(size.QuadPart);
+}
+
+mappedfile::~mappedfile ()
+{
+	if (fData) UnmapViewOfFile (fData);
+	if (fMapping) CloseHandle (fMapping);
+	if (fFile != INVALID_HANDLE_VALUE) CloseHandle (fFile);
+}
+
+#else
+mappedfile::mappedfile (const char* file) : fData(0), fSize(0)
+{
+	int fd = open (file, O_RDONLY);
+	if (fd < 0) return;
+	struct stat st;
+	if ((fstat (fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+		void* ptr = mmap (0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (ptr != MAP_FAILED) {
+			fData = (const char*)ptr;
+			fSize = st.st_size;
+			madvise (ptr, fSize, MADV_SEQUENTIAL);
+		}
+	}
+	close (fd);		// the mapping remains valid
+}
+
+mappedfile::~mappedfile ()
+{
+	if (fData) munmap ((void*)fData, fSize);
+}
+#endif
+
+//______________________________________________________________________________
+// the size of a null terminated buffer: UTF-16 data, that contain null bytes,
+// are detected by their byte order mark and must end with two null bytes,
+// the byte following a null byte at an even offset being read to tell
+// a null character from a null byte of a character.
+// a single null byte is not enough: data with a single terminating null byte
+// (e.g. std::string::c_str()) must be given with their size instead
+static size_t bufferSize (const char* buffer)
+{
+	const unsigned char* b = (const unsigned char*)buffer;
+	bool utf16 = ((b[0] == 0xff) && (b[1] == 0xfe)) || ((b[0] == 0xfe) && (b[1] == 0xff));
+	if (!utf16) return strlen(buffer);
+	size_t n = 2;
+	while (b[n] || b[n+1]) n += 2;
+	return n;
+}
+
+bool xmlparser::readbuffer (const char* buffer)
+{
+	if (!buffer) return false;		// error for empty buffers
+	return parse (buffer, bufferSize(buffer));
+}
+
+bool xmlparser::readbuffer (const char* buffer, size_t size)
+{
+	if (!buffer) return false;
+	return parse (buffer, size);
+}
+
+//______________________________________________________________________________
+bool xmlparser::readfile (const char* file)
+{
+	FILE * fd = fopen (file, "rb");
+	if (!fd) {
+		cerr << "can't open file " << file << endl;
+		return false;
+	}
+	string content;
+	bool ret = load (fd, content, fTranscoded);
+	fclose (fd);
+	return ret && parse (content.data(), content.size());
+}
+
+//______________________________________________________________________________
+bool xmlparser::mapfile (const char* file)
+{
+	mappedfile map (file);
+	// when mapping fails, fall back to readfile
+	if (!map.data())
+		return readfile (file);
+	return parse (map.data(), map.size());
+}
+
+//______________________________________________________________________________
+bool xmlparser::readstream (FILE* fd)
+{
+	if (!fd) return false;
+	string content;
+	return load (fd, content, fTranscoded) && parse (content.data(), content.size());
+}
+
+//______________________________________________________________________________
+bool xmlparser::parse (const char* buffer, size_t size)
+{
+	// compressed MusicXML: the score is inflated in memory and parsed from there
+	if (mxlfile::isArchive (buffer, size)) {
+		if (fInflated)
+			return error ("unexpected archive in the compressed MusicXML data");
+		mxlfile mxl (buffer, size);
+		string content;
+		if (!mxl.valid() || !mxl.readRootfile (content))
+			return error ("can't read the compressed MusicXML data");
+		fInflated = true;
+		return parse (content.data(), content.size());
+	}
+
+	// data that are not UTF-8 are converted in a single pass before scanning
+	if (!fTranscoded) {
+		transcoder t;
+		t.detect (buffer, size);
+		if (t.active()) {
+			string content;
+			t.convert (buffer, size, content);
+			t.end (content);
+			fTranscoded = true;
+			return parse (content.data(), content.size());
+		}
+		buffer += t.skip();		// UTF-8 byte order mark
+		size -= t.skip();
+	}
+
+	fPtr = buffer;
+	fEnd = buffer + size;
+	fLine = 1;
+	return prolog() && content() && misc();
+}
+
+//______________________________________________________________________________
+bool xmlparser::error (const char* msg)
+{
+	fReader->error (msg, fLine);
+	return false;
+}
+
+//______________________________________________________________________________
+// scanning primitives
+//______________________________________________________________________________
+bool xmlparser::lookup (const char* str) const
+{
+	size_t n = strlen(str);
+	return (size_t(fEnd - fPtr) >= n) && !strncmp(fPtr, str, n);
+}
+
+//______________________________________________________________________________
+bool xmlparser::match (const char* str)
+{
+	if (lookup (str)) {
+		fPtr += strlen(str);
+		return true;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+void xmlparser::skipSpace ()
+{
+	while ((fPtr < fEnd) && isSpace(*fPtr)) {
+		if (*fPtr == '\n') fLine++;
+		fPtr++;
+	}
+}
+
+//______________________________________________________________________________
+// skip everything up to str (included) and optionaly gives the skipped content
+bool xmlparser::skipTo (const char* str, token* content)
+{
+	size_t n = strlen(str);
+	const char* start = fPtr;
+	while (size_t(fEnd - fPtr) >= n) {
+		if ((*fPtr == *str) && !strncmp(fPtr, str, n)) {
+			if (content) content->set (start, fPtr);
+			fPtr += n;
+			return true;
+		}
+		if (*fPtr == '\n') fLine++;
+		fPtr++;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+bool xmlparser::getName (token& name)
+{
+	if ((fPtr >= fEnd) || !isFirstChar(*fPtr)) return false;
+	const char* start = fPtr++;
+	while ((fPtr < fEnd) && isNameChar(*fPtr)) fPtr++;
+	name.set (start, fPtr);
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::getQuoted (token& value)
+{
+	if ((fPtr >= fEnd) || ((*fPtr != '"') && (*fPtr != '\''))) return false;
+	char quote = *fPtr++;
+	const char* start = fPtr;
+	while ((fPtr < fEnd) && (*fPtr != quote)) {
+		if (*fPtr == '\n') fLine++;
+		fPtr++;
+	}
+	if (fPtr >= fEnd) return false;
+	value.set (start, fPtr++);
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::attribute (token& name, token& value)
+{
+	if (!getName (name))	return error ("attribute name expected");
+	skipSpace();
+	if (!match ("="))		return error ("'=' expected after attribute name");
+	skipSpace();
+	if (!getQuoted (value))	return error ("quoted attribute value expected");
+	return true;
+}
+
+//______________________________________________________________________________
+// grammar rules
+//______________________________________________________________________________
+bool xmlparser::prolog ()
+{
+	skipSpace();
+	if (lookup ("<?xml") && (fEnd - fPtr > 5) && isSpace(fPtr[5])) {
+		fPtr += 5;
+		if (!xmlDecl()) return false;
+	}
+	while (true) {
+		skipSpace();
+		if (lookup ("<!--")) {
+			if (!comment()) return false;
+		}
+		else if (lookup ("<!DOCTYPE")) {
+			if (!docType()) return false;
+		}
+		else if (lookup ("<?")) {
+			if (!procInstr()) return false;
+		}
+		else return true;
+	}
+}
+
+//______________________________________________________________________________
+bool xmlparser::xmlDecl ()
+{
+	string version, encoding;
+	int standalone = -1;
+	token name, value;
+	while (true) {
+		skipSpace();
+		if (match ("?>")) break;
+		if (!attribute (name, value)) return false;
+		if (name == "version")			version = value.str();
+		else if (name == "encoding")	encoding = value.str();
+		else if (name == "standalone") {
+			if (value == "yes")			standalone = 1;
+			else if (value == "no")		standalone = 0;
+			else return error ("unexpected standalone value");
+		}
+		else return error ("unexpected xml declaration attribute");
+	}
+	// converted data are now UTF-8
+	if (fTranscoded) encoding = "UTF-8";
+	if (!fReader->xmlDecl (version.c_str(), encoding.c_str(), standalone)) return error ("xmlDecl error");
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::docType ()
+{
+	fPtr += 9;		// skip "<!DOCTYPE"
+	skipSpace();
+	token start, pub, sys;
+	if (!getName (start)) return error ("doctype name expected");
+	skipSpace();
+
+	bool id = true, ispublic = false;
+	if (match ("PUBLIC")) {
+		ispublic = true;
+		skipSpace();
+		if (!getQuoted (pub)) return error ("public identifier expected");
+		skipSpace();
+		if (!getQuoted (sys)) return error ("system identifier expected");
+	}
+	else if (match ("SYSTEM")) {
+		skipSpace();
+		if (!getQuoted (sys)) return error ("system identifier expected");
+	}
+	else id = false;
+
+	skipSpace();
+	if (match ("[")) {			// internal subset is ignored
+		if (!skipTo ("]", 0)) return error ("unterminated doctype internal subset");
+		skipSpace();
+	}
+	if (!match (">")) return error ("'>' expected at the end of doctype");
+	if (id) fReader->docType (start.str().c_str(), ispublic, pub.str().c_str(), sys.str().c_str());
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::comment ()
+{
+	fPtr += 4;		// skip "<!--"
+	token text;
+	if (!skipTo ("-->", &text)) return error ("unterminated comment");
+	fReader->newComment (text.fStr, text.fSize);
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::procInstr ()
+{
+	fPtr += 2;		// skip "<?"
+	token text;
+	if (!skipTo ("?>", &text)) return error ("unterminated processing instruction");
+	fReader->newProcessingInstruction (text.fStr, text.fSize);
+	return true;
+}
+
+//______________________________________________________________________________
+bool xmlparser::startTag (bool& empty)
+{
+	fPtr++;			// skip '<'
+	while ((fPtr < fEnd) && isBlank(*fPtr)) fPtr++;
+	token elt;
+	if (!getName (elt)) return error ("element name expected");
+	if (!fReader->newElement (elt.fStr, elt.fSize)) return error ("element error");
+	token name, value;
+	while (true) {
+		skipSpace();
+		if (fPtr >= fEnd) return error ("unexpected end of file");
+		if ((*fPtr == '>') || lookup ("/>")) {
+			empty = (*fPtr == '/');
+			fPtr += empty ? 2 : 1;
+			if (fReader->skipElement() && !empty) {
+				if (!skipContent()) return false;
+				empty = true;
+			}
+			if (empty && !fReader->endElement (elt.fStr, elt.fSize)) return error ("end element error");
+			return true;
+		}
+		if (!attribute (name, value)) return false;
+		if (!fReader->newAttribute (name.fStr, name.fSize, value.fStr, value.fSize)) return error ("attribute error");
+	}
+}
+
+//______________________________________________________________________________
+// moves to the end of the current element: only the tags are scanned, the
+// comments and processing instructions are skipped, names are not checked
+bool xmlparser::skipContent ()
+{
+	int depth = 1;
+	while (fPtr < fEnd) {
+		const char* next = (const char*)memchr (fPtr, '<', fEnd - fPtr);
+		if (!next) next = fEnd;
+		fLine += int(count (fPtr, next, '\n'));
+		fPtr = next;
+		if (fPtr >= fEnd) break;
+
+		if (lookup ("<!--")) {
+			fPtr += 4;
+			if (!skipTo ("-->", 0)) return error ("unterminated comment");
+		}
+		else if (lookup ("<?")) {
+			fPtr += 2;
+			if (!skipTo ("?>", 0)) return error ("unterminated processing instruction");
+		}
+		else {
+			bool end = (fPtr + 1 < fEnd) && (fPtr[1] == '/');
+			char quote = 0;		// attribute values may contain '>'
+			while (++fPtr < fEnd) {
+				char c = *fPtr;
+				if (c == '\n') fLine++;
+				else if (quote) { if (c == quote) quote = 0; }
+				else if ((c == '"') || (c == '\'')) quote = c;
+				else if (c == '>') break;
+			}
+			if (fPtr >= fEnd) break;
+			if (end) depth--;
+			else if (fPtr[-1] != '/') depth++;
+			fPtr++;
+			if (!depth) return true;
+		}
+	}
+	return error ("unexpected end of file");
+}
+
+//______________________________________________________________________________
+bool xmlparser::endTag ()
+{
+	fPtr += 2;		// skip "</"
+	token elt;
+	if (!getName (elt)) return error ("element name expected");
+	skipSpace();
+	if (!match (">")) return error ("'>' expected at the end of element");
+	if (!fReader->endElement (elt.fStr, elt.fSize)) return error ("end element error");
+	return true;
+}
+
+//______________________________________________________________________________
+// the root element and its content
+bool xmlparser::content ()
+{
+	if (!lookup ("<") || lookup ("</") || lookup ("<!") || lookup ("<?"))
+		return error ("root element expected");
+
+	int depth = 0;
+	do {
+		if (fPtr >= fEnd) return error ("unexpected end of file");
+		if (*fPtr == '<') {
+			char next = (fPtr + 1 < fEnd) ? fPtr[1] : 0;
+			if (next == '/') {
+				if (!endTag()) return false;
+				depth--;
+			}
+			else if ((next == '!') && lookup ("<!--")) {
+				if (!comment()) return false;
+			}
+			else if (next == '?') {
+				if (!procInstr()) return false;
+			}
+			else {
+				bool empty;
+				if (!startTag (empty)) return false;
+				if (!empty) depth++;
+			}
+		}
+		else {
+			// element data: blank data are ignored, other data are kept as is
+			const char* start = fPtr;
+			bool blank = true;
+			while ((fPtr < fEnd) && (*fPtr != '<')) {
+				if (*fPtr == '\n') fLine++;
+				else if (blank && !isSpace(*fPtr)) blank = false;
+				fPtr++;
+			}
+			if (!blank) fReader->setValue (start, fPtr - start);
+		}
+	} while (depth > 0);
+	return true;
+}
+
+//______________________________________________________________________________
+// comments, processing instructions and spaces following the root element
+bool xmlparser::misc ()
+{
+	while (true) {
+		skipSpace();
+		if (fPtr >= fEnd) return true;
+		if (lookup ("<!--")) {
+			if (!comment()) return false;
+		}
+		else if (lookup ("<?")) {
+			if (!procInstr()) return false;
+		}
+		else return error ("unexpected data after the root element");
+	}
+}
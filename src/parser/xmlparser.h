@@ -0,0 +1,98 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlparser__
+#define __xmlparser__
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "reader.h"
+
+/*!
+\brief A reentrant xml parser.
+
+	xmlparser covers the xml subset used by MusicXML and keeps its whole state
+	in the instance: distinct xmlparser objects can be used concurrently from
+	different threads.
+	The input is first loaded in memory and then scanned in a single pass.
+	Names and values are passed to the reader as pointers into the input buffer
+	(see the zero-copy interface of reader), no intermediate copy is made.
+	The content of the elements skipped by the reader (see reader::skipElement)
+	is scanned for the matching end tag only: it is neither reported nor checked.
+	Compressed MusicXML (.mxl) input is detected and inflated in memory (see mxlfile),
+	once: an archive found inside an archive is rejected.
+	UTF-16, ISO-8859-1 and windows-1252 input is converted to UTF-8 (see transcoder),
+	the xml declaration encoding is then reported as UTF-8.
+*/
+//______________________________________________________________________________
+class xmlparser
+{
+	reader *		fReader;
+	const char *	fPtr;		// the current scanning position
+	const char *	fEnd;		// the end of the input
+	int				fLine;		// the current line number
+	bool			fTranscoded;	// true when the input has been converted to UTF-8
+	bool			fInflated;		// true when the input has been extracted from an archive
+
+	// a part of the input buffer, not null terminated
+	struct token {
+		const char*	fStr;
+		size_t		fSize;
+				token() : fStr(0), fSize(0) {}
+		void	set (const char* start, const char* end)	{ fStr = start; fSize = end - start; }
+		std::string str () const							{ return std::string(fStr, fSize); }
+		bool	operator == (const char* s) const			{ return !strncmp(fStr, s, fSize) && !s[fSize]; }
+	};
+
+	bool	parse		(const char* buffer, size_t size);
+
+	bool	xmlDecl		();
+	bool	docType		();
+	bool	prolog		();
+	bool	content		();
+	bool	misc		();
+	bool	startTag	(bool& empty);
+	bool	skipContent	();
+	bool	endTag		();
+	bool	comment		();
+	bool	procInstr	();
+	bool	attribute	(token& name, token& value);
+
+	bool	getName		(token& name);
+	bool	getQuoted	(token& value);
+	bool	skipTo		(const char* str, token* content);
+	void	skipSpace	();
+	bool	lookup		(const char* str) const;
+	bool	match		(const char* str);
+	bool	error		(const char* msg);
+
+	public:
+				 xmlparser(reader* r) : fReader(r), fPtr(0), fEnd(0), fLine(1), fTranscoded(false), fInflated(false) {}
+		virtual ~xmlparser() {}
+
+		//! parses a null terminated buffer, UTF-16 data must start with a byte order mark
+		//! and end with two null bytes
+		bool	readbuffer	(const char* buffer);
+		//! parses size bytes of a buffer, that may contain null bytes
+		bool	readbuffer	(const char* buffer, size_t size);
+		bool	readfile	(const char* file);
+		bool	readstream	(FILE* fd);
+		//! parses a file directly from a memory mapping, falls back to readfile when mapping fails
+		bool	mapfile		(const char* file);
+
+		//! the line number of the current scanning position
+		int		lineno () const		{ return fLine; }
+};
+
+
+#endif
@@ -18,13 +18,38 @@
 #pragma warning (disable : 4251 4275)
 #endif
 
+#include <vector>
+
 namespace MusicXML2 
 {
 
+/*!
+\brief the base class of the visitors
+
+	basevisitor caches the interfaces supported by a visitor: each element type
+	makes the dynamic_cast to its visitor interface only once per visitor object.
+	A visitor must therefore not be used before it is fully constructed.
+*/
 class basevisitor 
 {
+	std::vector<void*>	fCasts;		// the cast results indexed by key, unresolved() for unknown keys
+
+	static void* unresolved ()		{ return reinterpret_cast<void*>(1); }
+
 	public:
+				 basevisitor() {}
+				 basevisitor(const basevisitor&) {}		// the cache refers to the object: it is not copied
 		virtual ~basevisitor() {}
+		basevisitor& operator= (const basevisitor&) { return *this; }
+
+		//! gives the visitor interface T or null when the visitor doesn't support T
+		//! \param key a unique index for T, typically an element type
+		template <typename T> T* cast (int key) {
+			if (key >= int(fCasts.size())) fCasts.resize (key + 1, unresolved());
+			void*& ptr = fCasts[key];
+			if (ptr == unresolved()) ptr = dynamic_cast<T*>(this);
+			return static_cast<T*>(ptr);
+		}
 };
 
 }
@@ -25,13 +25,16 @@ namespace MusicXML2
 //______________________________________________________________________________
 void clonevisitor::copyAttributes (const Sxmlelement& src, Sxmlelement& dst )
 {
-	vector<Sxmlattribute> attr = src->attributes();
-	vector<Sxmlattribute>::const_iterator iter;
-	for (iter=attr.begin(); iter != attr.end(); iter++) {
-		Sxmlattribute attrcopy = xmlattribute::create();
-		attrcopy->setName( (*iter)->getName());
-		attrcopy->setValue( (*iter)->getValue());
-		dst->add( attrcopy );
+	size_t n = src->attributesSize();
+	for (size_t i = 0; i < n; i++) {
+		int id = xmlattribute::id (src->attributeName(i));
+		if (id) dst->add (id, src->attributeValue(i));
+		else {
+			Sxmlattribute attrcopy = xmlattribute::create();
+			attrcopy->setName( src->attributeName(i));
+			attrcopy->setValue( src->attributeValue(i));
+			dst->add( attrcopy );
+		}
 	}
 }
 
@@ -24,6 +24,7 @@ static inline long max(long v1, long v2) {return (v1 < v2) ? v2 : v1;}
 
 #include "midicontextvisitor.h"
 #include "xml.h"
+#include "xml_tree_browser.h"
 
 #define DEBUGMCV
 
@@ -84,7 +85,7 @@ midicontextvisitor::midicontextvisitor(long tpq, midiwriter* writer)
 {
 	fTPQ = tpq;
 	fMidiWriter = writer;
-	fInBackup = fInForward = false;
+	fInBackup = fInForward = fInSound = false;
     fEndMeasureDate = 0;
 	fEndPartDate = 0;
 
@@ -96,6 +97,20 @@ midicontextvisitor::midicontextvisitor(long tpq, midiwriter* writer)
     fDivisions = 1; // to be checked
 }
 
+//________________________________________________________________________
+// the other score-part elements are not browsed: their instruments are not used by the part
+void midicontextvisitor::init (const scoreindex& index, size_t part)
+{
+	xmlelement* list = index.getPartList();
+	if (!list || (part >= index.parts().size())) return;
+	const string& id = index.parts()[part].fID;
+	xml_tree_browser browser(this);
+	for (ctree<xmlelement>::literator i = list->lbegin(); i != list->lend(); i++) {
+		if (((*i)->getType() == k_score_part) && ((*i)->getAttributeValue("id") == id))
+			browser.browse (**i);
+	}
+}
+
 //________________________________________________________________________
 void midicontextvisitor::addDuration(long dur)
 {
@@ -257,6 +272,8 @@ void midicontextvisitor::visitStart ( S_part& elt )
     fEndMeasureDate = fEndPartDate = 0;
     fTranspose = 0;
     fDivisions = 1;
+	fCurrentDynamics = 90;
+	fCurrentChan = 0;
 
 	fCurrentPartID = elt->getAttributeValue("id");
 	int instrCount = fScoreInstruments.count(fCurrentPartID);
@@ -17,6 +17,7 @@
 #include <map>
 #include "xml.h"
 #include "typedefs.h"
+#include "scoreindex.h"
 #include "visitor.h"
 #include "notevisitor.h"
 #include "transposevisitor.h"
@@ -191,6 +192,10 @@ class EXP midicontextvisitor :
     public:    
 				 midicontextvisitor(long tpq, midiwriter* writer=0);
        	virtual ~midicontextvisitor();
+
+		//! collects the instruments of a part of an indexed score from its score-part only,
+		//! the part is browsed afterwards
+		void init (const scoreindex& index, size_t part);
 };
 
 /*! @} */
@@ -23,6 +23,20 @@ namespace MusicXML2
     }
     
     
+    void partlistvisitor::init(const scoreindex& index)
+    {
+        fPartGroups.clear();
+        fPartHeaders.clear();
+        fPartGroupIncrementer = 0;
+        fCurrentPartGroupIndex.clear();
+        part2staffmap.clear();
+        staffCreatorCounter = 1;
+        if (index.getPartList()) {
+            xml_tree_browser browser(this);
+            browser.browse(*index.getPartList());
+        }
+    }
+    
     partGroup* partlistvisitor::find_first_of_partID_inGroup(std::string partID)
     {
         // search if this part ID exists in any grouping
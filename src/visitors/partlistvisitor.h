@@ -17,6 +17,7 @@
 
 #include "exports.h"
 #include "guido.h"
+#include "scoreindex.h"
 #include "typedefs.h"
 #include "visitor.h"
 #include "xml.h"
@@ -74,6 +75,11 @@ namespace MusicXML2
         partlistvisitor();
         virtual	~partlistvisitor() {};
         
+        /*!
+         \brief Collects the part groups and headers from the part-list of an indexed score, without browsing the score
+         */
+        void init(const scoreindex& index);
+        
         std::map<int, partGroup> fPartGroups;
         
         std::map<std::string, partHeader> fPartHeaders;
@@ -14,6 +14,7 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <algorithm>
 #include "partsummary.h"
 
 using namespace std;
@@ -30,6 +31,31 @@ void partsummary::visitStart ( S_part& elt)
 	fStaffVoices.clear();
 }
 
+//________________________________________________________________________
+void partsummary::init (const scoreindex& index, size_t part)
+{
+	fStavesCount = 1;
+	fStaves.clear();
+	fVoices.clear();
+	fStaffVoices.clear();
+	if (part >= index.parts().size()) return;
+
+	const scoreindex::part& p = index.parts()[part];
+	fStavesCount = p.fStaves;
+	for (size_t i = p.fVoices.fFirst; i < p.fVoices.end(); i++) {
+		const scoreindex::voice& v = index.voices()[i];
+		fStaves[v.fStaff] += v.fNotes;
+		fVoices[v.fVoice] += v.fNotes;
+		fStaffVoices[v.fStaff][v.fVoice] = v.fNotes;
+	}
+	for (size_t i = p.fLayouts.fFirst; i < p.fLayouts.end(); i++) {
+		const scoreindex::layout& l = index.layouts()[i];
+		map<int, int>::iterator d = fStaffDistances.find (l.fStaff);
+		if (d == fStaffDistances.end()) fStaffDistances[l.fStaff] = l.fDistance;
+		else d->second = max(d->second, l.fDistance);
+	}
+}
+
 //________________________________________________________________________
 void partsummary::visitStart ( S_staves& elt)
 {
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "notevisitor.h"
+#include "scoreindex.h"
 #include "smartlist.h"
 
 namespace MusicXML2
@@ -34,6 +35,9 @@ namespace MusicXML2
 	- a count of staves
 	- a map that associate each stave with the corresponding number of notes
 	- a map that associate each stave with the corresponding voices and notes
+
+	The summary is collected by browsing a part, or it is read from a score index
+	(see init), without any traversal.
 */
 class EXP partsummary : 
 	public notevisitor,
@@ -44,6 +48,9 @@ class EXP partsummary :
 	public:
 				 partsummary() : fStavesCount(1) {};
 		virtual	~partsummary() {};
+
+		//! initializes the summary from a score index, part is the part index in the score index
+		virtual void init (const scoreindex& index, size_t part);
 		
 		//! returns the number of staves for the part
 		int countStaves () const				{ return fStavesCount; }
@@ -0,0 +1,290 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+
+#include "parallel.h"
+#include "smfwriter.h"
+#include "unrolled_xml_tree_browser.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+enum { kNoteOff = 0x80, kNoteOn = 0x90, kControl = 0xb0, kProgram = 0xc0 };
+enum { kOffOrder, kControlOrder, kOnOrder };
+
+//______________________________________________________________________________
+static inline int clip (long value, int min, int max)
+{
+	return (value < min) ? min : (value > max) ? max : int(value);
+}
+
+// MusicXML channels are 1 - 16, 0 when not specified
+static inline int channel (int chan)	{ return (chan > 0) ? clip (chan - 1, 0, 15) : 0; }
+
+//______________________________________________________________________________
+smfwriter::track& smfwriter::current ()
+{
+	if (fTracks.empty()) fTracks.push_back (track());
+	return fTracks.back();
+}
+
+void smfwriter::add (long date, int order, int status, int data1, int data2)
+{
+	event e;
+	e.fDate = (date < 0) ? 0 : date;
+	e.fOrder = (unsigned char)order;
+	e.fData[0] = (unsigned char)status;
+	e.fData[1] = (unsigned char)data1;
+	e.fData[2] = (unsigned char)data2;
+	current().fEvents.push_back (e);
+}
+
+size_t smfwriter::events () const
+{
+	size_t n = 0;
+	for (size_t i = 0; i < fTracks.size(); i++)
+		n += fTracks[i].fEvents.size();
+	return n;
+}
+
+//______________________________________________________________________________
+// the midiwriter interface
+//______________________________________________________________________________
+void smfwriter::startPart (int instrCount)
+{
+	fTracks.push_back (track());
+	fTracks.back().fEvents.reserve (fReserve);
+}
+
+void smfwriter::newInstrument (std::string instrName, int chan)
+{
+	track& t = current();
+	if (t.fName.empty()) t.fName = instrName;
+	else t.fInstruments.push_back (instrName);
+	if (chan >= 0) t.fChan = channel (chan);
+}
+
+void smfwriter::endPart (long date)
+{
+	track& t = current();
+	t.fEnd = max(t.fEnd, date);
+}
+
+void smfwriter::newNote (long date, int chan, float pitch, int velocity, int duration)
+{
+	int c = channel (chan);
+	int key = clip (long(pitch + 0.5f), 0, 127);
+	add (date, kOnOrder, kNoteOn | c, key, clip (velocity, 1, 127));
+	// a note lasts at least one tick: a note-off at the date of its note-on
+	// would be written first (see before) and the note would never end
+	add (date + max(duration, 1), kOffOrder, kNoteOff | c, key, 0);
+}
+
+void smfwriter::tempoChange (long date, int bpm)
+{
+	if (bpm > 0) {
+		bpm = clip (bpm, 1, 0xffff);
+		add (date, kControlOrder, kTempo, bpm >> 8, bpm & 0xff);
+	}
+}
+
+void smfwriter::pedalChange (long date, pedalType t, int value)
+{
+	int ctrl = (t == kSoftpedal) ? 67 : (t == kSostenutoPedal) ? 66 : 64;
+	add (date, kControlOrder, kControl | current().fChan, ctrl, clip (value, 0, 127));
+}
+
+// MusicXML volume is a percentage
+void smfwriter::volChange (long date, int chan, int vol)
+{
+	add (date, kControlOrder, kControl | channel (chan), 7, clip (vol * 127 / 100, 0, 127));
+}
+
+// MusicXML banks are 1 - 16384
+void smfwriter::bankChange (long date, int chan, int bank)
+{
+	bank = clip (bank - 1, 0, 0x3fff);
+	add (date, kControlOrder, kControl | channel (chan), 0, bank >> 7);
+	add (date, kControlOrder, kControl | channel (chan), 32, bank & 0x7f);
+}
+
+// MusicXML programs are 1 - 128
+void smfwriter::progChange (long date, int chan, int prog)
+{
+	add (date, kControlOrder, kProgram | channel (chan), clip (prog - 1, 0, 127), 0);
+}
+
+//______________________________________________________________________________
+// score conversion
+//______________________________________________________________________________
+void smfwriter::convert (const Sxmlelement& score)
+{
+	if (score) convert (scoreindex::create (score));
+}
+
+//______________________________________________________________________________
+// each part is browsed by its own visitor, that first collects the instruments
+// of its score-part: the parts don't share any state and are browsed concurrently.
+// the score-parts are browsed before, serially, since the part-list is shared by all the visitors.
+// the tracks are reserved from the parts notes count (without the repeats).
+void smfwriter::convert (const Sscoreindex& index)
+{
+	if (!index) return;
+	const vector<scoreindex::part>& parts = index->parts();
+	size_t n = parts.size();
+	vector<smfwriter> writers (n, smfwriter(fTPQ));
+	vector<unique_ptr<midicontextvisitor> > visitors;
+	for (size_t i = 0; i < n; i++) {
+		visitors.push_back (unique_ptr<midicontextvisitor>(new midicontextvisitor(fTPQ, &writers[i])));
+		writers[i].fReserve = parts[i].fNotes.fCount * 2 + 16;
+		visitors[i]->init (*index, i);
+	}
+
+	parallel (n, fThreads, [&] (size_t i) {
+		unrolled_xml_tree_browser browser (visitors[i].get());
+		browser.browse (*parts[i].fElement);
+	});
+
+	for (size_t i = 0; i < n; i++) {
+		for (size_t t = 0; t < writers[i].fTracks.size(); t++) {
+			fTracks.push_back (track());
+			swap (fTracks.back(), writers[i].fTracks[t]);
+		}
+	}
+}
+
+//______________________________________________________________________________
+// SMF output
+//______________________________________________________________________________
+void smfwriter::put (std::string& out, unsigned long value, int bytes)
+{
+	while (bytes--) out += char((value >> (bytes * 8)) & 0xff);
+}
+
+void smfwriter::putVarLen (std::string& out, unsigned long value)
+{
+	char buff[10];
+	int n = 0;
+	buff[n++] = char(value & 0x7f);
+	while (value >>= 7)
+		buff[n++] = char((value & 0x7f) | 0x80);
+	while (n--) out += buff[n];
+}
+
+void smfwriter::putMeta (std::string& out, long delta, int type, const std::string& text)
+{
+	putVarLen (out, delta);
+	out += char(0xff);
+	out += char(type);
+	putVarLen (out, text.size());
+	out += text;
+}
+
+static bool before (const smfwriter::event& a, const smfwriter::event& b)
+{
+	return (a.fDate < b.fDate) || ((a.fDate == b.fDate) && (a.fOrder < b.fOrder));
+}
+
+// writes a track chunk, the events are expected to be sorted
+void smfwriter::putTrack (std::string& out, std::vector<event>& events, const track* t, long end)
+{
+	out += "MTrk";
+	size_t sizePos = out.size();
+	put (out, 0, 4);
+
+	if (t) {
+		if (!t->fName.empty()) putMeta (out, 0, 0x03, t->fName);
+		for (size_t i = 0; i < t->fInstruments.size(); i++)
+			putMeta (out, 0, 0x04, t->fInstruments[i]);
+	}
+	long date = 0;
+	int status = 0;			// the running status
+	for (size_t i = 0; i < events.size(); i++) {
+		const event& e = events[i];
+		putVarLen (out, e.fDate - date);
+		date = e.fDate;
+		if (e.fData[0] == kTempo) {
+			unsigned long bpm = (e.fData[1] << 8) | e.fData[2];
+			out += "\xff\x51\x03";
+			put (out, 60000000UL / bpm, 3);
+			status = 0;
+			continue;
+		}
+		if (e.fData[0] != status) {
+			status = e.fData[0];
+			out += char(status);
+		}
+		out += char(e.fData[1]);
+		if ((status & 0xf0) != kProgram) out += char(e.fData[2]);
+	}
+	putVarLen (out, (end > date) ? end - date : 0);
+	out += "\xff\x2f";
+	out += char(0);
+
+	size_t size = out.size() - sizePos - 4;
+	for (int i = 0; i < 4; i++)
+		out[sizePos + i] = char((size >> ((3 - i) * 8)) & 0xff);
+}
+
+//______________________________________________________________________________
+// the tempo changes of all the parts are moved to the conductor track
+// the file is built in memory and written at once
+void smfwriter::write (std::ostream& os) const
+{
+	vector<event> tempo;
+	size_t size = 64;
+	for (size_t i = 0; i < fTracks.size(); i++) {
+		const vector<event>& events = fTracks[i].fEvents;
+		for (size_t e = 0; e < events.size(); e++)
+			if (events[e].fData[0] == kTempo) tempo.push_back (events[e]);
+		size += events.size() * 4 + fTracks[i].fName.size() + 32;
+	}
+	stable_sort (tempo.begin(), tempo.end(), before);
+	tempo.erase (unique (tempo.begin(), tempo.end(), [] (const event& a, const event& b) {
+		return (a.fDate == b.fDate) && (a.fData[1] == b.fData[1]) && (a.fData[2] == b.fData[2]);
+	}), tempo.end());
+
+	string out;
+	out.reserve (size + tempo.size() * 8);
+	out += "MThd";
+	put (out, 6, 4);
+	put (out, 1, 2);
+	put (out, fTracks.size() + 1, 2);
+	put (out, clip (fTPQ, 1, 0x7fff), 2);
+
+	putTrack (out, tempo, 0, 0);
+	vector<event> events;
+	for (size_t i = 0; i < fTracks.size(); i++) {
+		const track& t = fTracks[i];
+		events.clear();
+		for (size_t e = 0; e < t.fEvents.size(); e++)
+			if (t.fEvents[e].fData[0] != kTempo) events.push_back (t.fEvents[e]);
+		stable_sort (events.begin(), events.end(), before);
+		putTrack (out, events, &t, events.size() ? max(t.fEnd, events.back().fDate) : t.fEnd);
+	}
+	os.write (out.data(), out.size());
+}
+
+bool smfwriter::write (const char* file) const
+{
+	ofstream os (file, ios::out | ios::binary);
+	if (!os.is_open()) return false;
+	write (os);
+	return os.good();
+}
+
+}
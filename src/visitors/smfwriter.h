@@ -0,0 +1,111 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __smfwriter__
+#define __smfwriter__
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "exports.h"
+#include "midicontextvisitor.h"
+#include "scoreindex.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup visitors
+@{
+*/
+
+/*!
+\brief A Standard MIDI File writer.
+
+	smfwriter collects the events sent by a midicontextvisitor, one track per part,
+	and writes them as a format 1 Standard MIDI File. The first track is a conductor
+	track that gathers the tempo changes of all the parts.
+	It can be used as any midiwriter, or it can convert a score by itself (see convert):
+	the parts are then browsed concurrently when the threads count is greater than 1.
+	The file is the same whatever the number of threads.
+*/
+class EXP smfwriter : public midiwriter
+{
+	public:
+		// an event: a channel message or a tempo change
+		struct event {
+			long			fDate;
+			unsigned char	fOrder;		// at the same date: note offs first, then controls, then note ons
+			unsigned char	fData[3];	// the status byte and the data bytes, or kTempo and the tempo in bpm
+		};
+		struct track {
+			std::string					fName;			// the first instrument name
+			std::vector<std::string>	fInstruments;	// the names of the other instruments
+			std::vector<event>			fEvents;
+			long						fEnd;
+			int							fChan;			// the current channel, used by the pedal changes
+					track() : fEnd(0), fChan(0) {}
+		};
+		enum { kTempo = 0xff };
+
+	private:
+		long				fTPQ;
+		int					fThreads;
+		size_t				fReserve;		// the expected count of events of the next track
+		std::vector<track>	fTracks;
+
+		track&	current ();
+		void	add (long date, int order, int status, int data1, int data2);
+
+		static void	put (std::string& out, unsigned long value, int bytes);
+		static void	putVarLen (std::string& out, unsigned long value);
+		static void	putMeta (std::string& out, long delta, int type, const std::string& text);
+		static void	putTrack (std::string& out, std::vector<event>& events, const track* t, long end);
+
+	public:
+				 smfwriter(long tpq = 480) : fTPQ(tpq), fThreads(1), fReserve(0) {}
+		virtual ~smfwriter() {}
+
+		//! the parts are browsed concurrently by convert when count is greater than 1
+		void	setThreads (int count)			{ fThreads = count; }
+		long	getTPQ () const					{ return fTPQ; }
+		const std::vector<track>& tracks () const	{ return fTracks; }
+		//! the total count of events
+		size_t	events () const;
+
+		//! collects the events of a score-partwise element, one track per part
+		void	convert (const Sxmlelement& score);
+		//! collects the events of an indexed score (see TXMLFile::getIndex)
+		void	convert (const Sscoreindex& index);
+		//! writes the collected events as a Standard MIDI File (format 1)
+		void	write (std::ostream& os) const;
+		bool	write (const char* file) const;
+
+		// the midiwriter interface
+		virtual void startPart (int instrCount);
+		virtual void newInstrument (std::string instrName, int chan=-1);
+		virtual void endPart (long date);
+
+		virtual void newNote (long date, int chan, float pitch, int velocity, int duration);
+		virtual void tempoChange (long date, int bpm);
+		virtual void pedalChange (long date, pedalType t, int value);
+
+		virtual void volChange (long date, int chan, int vol);
+		virtual void bankChange (long date, int chan, int bank);
+		virtual void progChange (long date, int chan, int prog);
+};
+
+/*! @} */
+
+}
+
+#endif
@@ -49,9 +49,9 @@ void xmlvisitor::visitStart ( Sxmlelement& elt )
 {
 	fOut <<  fendl << "<" << elt->getName();
 	// print the element attributes first
-	vector<Sxmlattribute>::const_iterator attr; 
-	for (attr = elt->attributes().begin(); attr != elt->attributes().end(); attr++)
-		fOut << " " << (*attr)->getName() << "=\"" << (*attr)->getValue() << "\"";				
+	size_t n = elt->attributesSize();
+	for (size_t i = 0; i < n; i++)
+		fOut << " " << elt->attributeName(i) << "=\"" << elt->attributeValue(i) << "\"";
 	if (elt->empty()) {
 		fOut << "/>";	// element is empty, we can direclty close it
 	}
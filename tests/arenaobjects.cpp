@@ -0,0 +1,101 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <cstddef>
+#include <sstream>
+#include <stdint.h>
+
+#include "arena.h"
+#include "factory.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static inline bool aligned (const void* ptr)	{ return ((uintptr_t)ptr % alignof(max_align_t)) == 0; }
+
+//_______________________________________________________________________________
+// the names, values and attributes of the elements of a tree,
+// empty when an element or an attribute is not aligned as heap objects are
+static string dump (xmlelement* elt)
+{
+	ostringstream s;
+	vector<xmlelement*> stack (1, elt);
+	while (stack.size()) {
+		xmlelement* e = stack.back();
+		stack.pop_back();
+		if (!aligned (e)) return "";
+		s << e->getName() << " " << e->getValue();
+		const vector<Sxmlattribute>& attributes = e->attributes();
+		for (size_t i = 0; i < attributes.size(); i++) {
+			if (!aligned (&(*attributes[i]))) return "";
+			s << " " << attributes[i]->getName() << "=" << attributes[i]->getValue();
+		}
+		s << "\n";
+		for (ctree<xmlelement>::literator i = e->lbegin(); i != e->lend(); i++)
+			stack.push_back (*i);
+	}
+	return s.str();
+}
+
+// reads a file and dumps its tree, empty when the file can't be read
+static string parse (const string& file, bool useArena)
+{
+	xmlreader r;
+	r.useArena (useArena);
+	SXMLFile xml = r.read (file.c_str());
+	return (xml && xml->elements()) ? dump (xml->elements()) : "";
+}
+
+// heap and arena elements are mixed in a tree that outlives its file
+static bool mixed (const string& file)
+{
+	Sxmlelement root;
+	{
+		xmlreader r;
+		r.useArena (true);
+		SXMLFile xml = r.read (file.c_str());
+		if (!xml || !xml->elements()) return false;
+		root = xml->elements();
+	}
+	Sxmlelement heap = factory::instance().create ("note");
+	if (!aligned (&(*heap))) return false;
+	root->push (heap);
+	{
+		Sarena a = arena::create();
+		arena::scope scope (&(*a));
+		Sxmlelement inArena = factory::instance().create ("rest");
+		if (!aligned (&(*inArena))) return false;
+		heap->push (inArena);
+	}
+	return dump (root).size() > 0;
+}
+
+//_______________________________________________________________________________
+// the trees read from an arena must be the ones read from the heap,
+// with elements and attributes aligned as heap objects are
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	int errors = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		string heap = parse (files[f], false);
+		string inArena = parse (files[f], true);
+		if (heap.empty() || (heap != inArena)) errors += failed ("arenaobjects", files[f]);
+	}
+	if (files.size() && !mixed (files[0])) errors += failed ("arenaobjects", "mixed heap and arena elements");
+	return errors ? 1 : 0;
+}
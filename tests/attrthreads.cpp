@@ -0,0 +1,89 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <atomic>
+#include <thread>
+
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kThreads = 4;
+
+//_______________________________________________________________________________
+// the elements of a tree, collected without copying any smart pointer
+static void collect (xmlelement* elt, vector<xmlelement*>& elts)
+{
+	vector<xmlelement*> stack (1, elt);
+	while (stack.size()) {
+		xmlelement* e = stack.back();
+		stack.pop_back();
+		elts.push_back (e);
+		for (ctree<xmlelement>::literator i = e->lbegin(); i != e->lend(); i++)
+			stack.push_back (*i);
+	}
+}
+
+// the attributes of the elements, flattened as name and value strings
+static vector<string> flatten (const vector<xmlelement*>& elts, bool objects)
+{
+	vector<string> out;
+	for (size_t i = 0; i < elts.size(); i++) {
+		const xmlelement* e = elts[i];
+		if (objects) {
+			const vector<Sxmlattribute>& attrs = e->attributes();
+			for (size_t a = 0; a < attrs.size(); a++) {
+				out.push_back (attrs[a]->getName());
+				out.push_back (attrs[a]->getValue());
+			}
+		}
+		else for (size_t a = 0; a < e->attributesSize(); a++) {
+			const string* value = e->findAttribute (e->attributeName(a));
+			out.push_back (e->attributeName(a));
+			out.push_back (value ? *value : "missing");
+		}
+	}
+	return out;
+}
+
+//_______________________________________________________________________________
+// the attributes objects of a shared tree are requested from several threads at once,
+// while others read the attributes values: all must see the values read from the file
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	int errors = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[f].c_str());
+		if (!file) continue;
+		vector<xmlelement*> elts;
+		collect (file->elements(), elts);
+		vector<string> expected = flatten (elts, false);
+
+		atomic<int> bad (0);
+		vector<thread> threads;
+		for (int t = 0; t < kThreads; t++)
+			threads.push_back (thread ([&elts, &expected, &bad, t] () {
+				if (flatten (elts, t & 1) != expected) bad++;
+			}));
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+		if (bad) errors += failed ("attrthreads", files[f]);
+	}
+	return errors ? 1 : 0;
+}
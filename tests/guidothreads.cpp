@@ -0,0 +1,82 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "libmusicxml.h"
+#include "xml2guidovisitor.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kThreads = 4;
+
+//_______________________________________________________________________________
+// discards the converter warnings, that may be written from several threads
+class nullbuf : public streambuf
+{
+	protected:
+		virtual int_type	overflow (int_type c)						{ return traits_type::not_eof(c); }
+		virtual streamsize	xsputn (const char* s, streamsize n)		{ return n; }
+};
+
+//_______________________________________________________________________________
+// converts a file through the library interface, which uses the score index
+static string convert (const string& file, int threads, xmlErr& err)
+{
+	ostringstream out;
+	err = (threads > 1) ? musicxmlfile2guidoThreaded (file.c_str(), true, threads, out)
+						: musicxmlfile2guido (file.c_str(), true, out);
+	return out.str();
+}
+
+// converts a score without index: the parts are browsed to be summarized
+static string convert (const Sxmlelement& score, int threads)
+{
+	ostringstream out;
+	xml2guidovisitor v(true, true, true);
+	v.setThreads (threads);
+	v.convert (score, out);
+	return out.str();
+}
+
+//_______________________________________________________________________________
+// the guido code must be the same whatever the number of threads used to convert the parts
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	nullbuf null;
+	streambuf* cerrbuf = cerr.rdbuf (&null);
+	streambuf* coutbuf = cout.rdbuf (&null);
+	vector<string> errors;
+	for (size_t f = 0; f < files.size(); f++) {
+		xmlErr err1, errN;
+		string code1 = convert (files[f], 1, err1);
+		string codeN = convert (files[f], kThreads, errN);
+		bool same = (err1 == errN) && (code1 == codeN);
+
+		xmlreader r;
+		SXMLFile file = r.read (files[f].c_str());
+		if (same && file && file->elements() && (file->elements()->getType() == k_score_partwise))
+			same = convert (file->elements(), 1) == convert (file->elements(), kThreads);
+		if (!same) errors.push_back (files[f]);
+	}
+	cerr.rdbuf (cerrbuf);
+	cout.rdbuf (coutbuf);
+	for (size_t i = 0; i < errors.size(); i++)
+		failed ("guidothreads", errors[i]);
+	return errors.size() ? 1 : 0;
+}
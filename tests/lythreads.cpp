@@ -0,0 +1,130 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <atomic>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "libmusicxml.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kThreads = 4;
+
+// the files of the suite the converter reports an error for, with an empty output
+static const char* kFailures[] = {
+	"00c-Basics-Durations.xml",
+	"01e-Pitches-ParenthesizedAccidentals.xml",
+	"06c-Lyrics-Pianostaff-Finale.xml",
+	"08g-OverlappingPartGroups-Finale.xml",
+	"09f-Repeats-Finale.xml",
+	"10a-TwoVoicesOnStaff-Finale.xml",
+	"13b-ChordAsGraceNote-Finale.xml",
+	"24b-ChordAsGraceNote.xml",
+	"31a-Directions.xml",
+	"33e-Spanners-OctaveShifts-InvalidSize.xml",
+	"41f-StaffGroups-Overlapping.xml",
+	"41h-TooManyParts.xml",
+	"42a-MultiVoice-TwoVoicesOnStaff-Lyrics.xml",
+	"45e-Repeats-Nested-Alternatives.xml",
+	"45f-Repeats-InvalidEndings.xml",
+	"46g-PickupMeasure-Chordnames-FiguredBass.xml",
+	"61c-Lyrics-Pianostaff.xml",
+	"74a-FiguredBass.xml",
+};
+
+struct result {
+	xmlErr	fErr;
+	string	fCode;
+};
+
+//_______________________________________________________________________________
+static result convert (const string& file, xml2lyContext& context)
+{
+	result r;
+	ostringstream out;
+	r.fErr = musicxmlfile2lilypond (file.c_str(), context, out);
+	r.fCode = out.str();
+	return r;
+}
+
+//_______________________________________________________________________________
+// converts the unofficial test suite serially and then from kThreads threads at once,
+// each thread using its own context for successive conversions:
+// each conversion must give the same result, whatever the thread.
+// the files listed in kFailures must fail and the other ones must be converted
+// with a non empty output, so that a new failure or an unexpected fix is reported.
+// invalid options must be reported and not exit the process.
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files;
+	vector<string> all = testFiles (argv[2]);
+	for (size_t i = 0; i < all.size(); i++)
+		if (all[i].find ("UnofficialTestSuite") != string::npos) files.push_back (all[i]);
+	if (files.empty()) return failed ("lythreads", "no test file");
+	optionsVector options (1, "-q");
+
+	vector<result> expected;
+	for (size_t i = 0; i < files.size(); i++) {
+		xml2lyContext context;
+		context.setOptions (options);
+		expected.push_back (convert (files[i], context));
+	}
+
+	vector<result> results (files.size());
+	atomic<size_t> next (0);
+	auto worker = [&] () {
+		xml2lyContext context;
+		context.setOptions (options);
+		for (size_t i = next++; i < files.size(); i = next++)
+			results[i] = convert (files[i], context);
+	};
+	vector<thread> threads;
+	for (int i = 0; i < kThreads; i++)
+		threads.push_back (thread (worker));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	set<string> failures (kFailures, kFailures + sizeof(kFailures) / sizeof(kFailures[0]));
+	int errors = 0;
+	for (size_t i = 0; i < files.size(); i++) {
+		if ((results[i].fErr != expected[i].fErr) || (results[i].fCode != expected[i].fCode))
+			errors += failed ("lythreads", files[i]);
+		bool listed = failures.erase (files[i].substr (files[i].find_last_of ("/\\") + 1)) > 0;
+		if (listed && (expected[i].fErr == kNoErr))
+			errors += failed ("lythreads", files[i] + ": converted, remove it from kFailures");
+		else if (!listed && (expected[i].fErr != kNoErr))
+			errors += failed ("lythreads", files[i] + ": conversion failed");
+		else if (!listed && expected[i].fCode.empty())
+			errors += failed ("lythreads", files[i] + ": empty output");
+	}
+	for (set<string>::const_iterator i = failures.begin(); i != failures.end(); i++)
+		errors += failed ("lythreads", *i + ": listed in kFailures but not found");
+
+	optionsVector invalid (1, "-unknown-option");
+	atomic<int> unsupported (0);
+	threads.clear();
+	for (int i = 0; i < kThreads; i++)
+		threads.push_back (thread ([&] () {
+			xml2lyContext context;
+			if ((context.setOptions (invalid) == kUnsupported) && context.getOptions().empty()) unsupported++;
+		}));
+	for (size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+	if (unsupported != kThreads)
+		errors += failed ("lythreads", "invalid options not reported");
+	return errors ? 1 : 0;
+}
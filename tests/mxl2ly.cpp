@@ -0,0 +1,41 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "libmusicxml.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// converts a compressed MusicXML file through musicxmlfile2lilypond:
+// the output must be the one of the uncompressed score
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	string folder = string(argv[1]) + "/samples/musicxml/UnofficialTestSuite/";
+	string mxl = folder + "90a-Compressed-MusicXML.mxl";
+	string xml = folder + "20a-Compressed-MusicXML.xml";
+
+	xml2lyContext context;
+	context.setOptions (optionsVector (1, "-q"));
+	ostringstream fromMxl, fromXml;
+	if (musicxmlfile2lilypond (mxl.c_str(), context, fromMxl) != kNoErr)
+		return failed ("mxl2ly", mxl);
+	if (musicxmlfile2lilypond (xml.c_str(), context, fromXml) != kNoErr)
+		return failed ("mxl2ly", xml);
+	if (fromMxl.str().empty() || (fromMxl.str() != fromXml.str()))
+		return failed ("mxl2ly", mxl + ": unexpected output");
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "parallel.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const size_t kCalls = 1000;
+
+//_______________________________________________________________________________
+// a call throws: parallel must rethrow it to the caller, whatever the thread it
+// was made on, and no call may be made twice
+static bool rethrows (int threads, size_t failing)
+{
+	vector<atomic<int> > calls (kCalls);
+	for (size_t i = 0; i < kCalls; i++) calls[i] = 0;
+	try {
+		parallel (kCalls, threads, [&calls, failing] (size_t i) {
+			calls[i]++;
+			if (i == failing) throw runtime_error ("failing call");
+		});
+	}
+	catch (const runtime_error&) {
+		for (size_t i = 0; i < kCalls; i++)
+			if (calls[i] > 1) return false;
+		return calls[failing] == 1;
+	}
+	return false;
+}
+
+// without exception, each call is made once
+static bool completes (int threads)
+{
+	vector<atomic<int> > calls (kCalls);
+	for (size_t i = 0; i < kCalls; i++) calls[i] = 0;
+	parallel (kCalls, threads, [&calls] (size_t i) { calls[i]++; });
+	for (size_t i = 0; i < kCalls; i++)
+		if (calls[i] != 1) return false;
+	return true;
+}
+
+//_______________________________________________________________________________
+int main (int argc, char* argv[])
+{
+	int errors = 0;
+	const int threads[] = { 1, 2, 4, 16 };
+	for (int t : threads) {
+		string name = "threads " + to_string(t);
+		if (!completes (t)) errors += failed ("parallelerrors", name);
+		if (!rethrows (t, 0)) errors += failed ("parallelerrors", name + ", first call throwing");
+		if (!rethrows (t, kCalls / 2)) errors += failed ("parallelerrors", name + ", middle call throwing");
+		if (!rethrows (t, kCalls - 1)) errors += failed ("parallelerrors", name + ", last call throwing");
+	}
+	return errors ? 1 : 0;
+}
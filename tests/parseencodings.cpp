@@ -0,0 +1,136 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <sstream>
+
+#include "elements.h"
+#include "libmusicxml.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+// the names, values and input line numbers of the elements of a tree
+static string dump (const SXMLFile& file)
+{
+	if (!file || !file->elements()) return "";
+	ostringstream s;
+	vector<xmlelement*> stack (1, (xmlelement*)file->elements());
+	while (stack.size()) {
+		xmlelement* e = stack.back();
+		stack.pop_back();
+		s << e->getInputLineNumber() << " " << e->getName() << " " << e->getValue() << "\n";
+		for (ctree<xmlelement>::literator i = e->lbegin(); i != e->lend(); i++)
+			stack.push_back (*i);
+	}
+	return s.str();
+}
+
+// checks the UTF-8 sequences, some files declared as UTF-8 are not
+static bool validUtf8 (const string& s)
+{
+	for (size_t i = 0; i < s.size(); ) {
+		unsigned char c = s[i];
+		int n = (c < 0x80) ? 1 : ((c & 0xe0) == 0xc0) ? 2 : ((c & 0xf0) == 0xe0) ? 3 : ((c & 0xf8) == 0xf0) ? 4 : 0;
+		if (!n || (i + n > s.size())) return false;
+		for (int k = 1; k < n; k++)
+			if ((s[i+k] & 0xc0) != 0x80) return false;
+		i += n;
+	}
+	return true;
+}
+
+// the content of a file, empty when it is not UTF-8 encoded
+static string utf8 (const string& file)
+{
+	ifstream in (file.c_str(), ios::binary);
+	ostringstream s;
+	s << in.rdbuf();
+	string content = s.str();
+	string decl = content.substr (0, content.find ("?>"));
+	size_t encoding = decl.find ("encoding=");
+	if ((encoding != string::npos) && (decl.compare (encoding + 10, 5, "UTF-8") != 0) && (decl.compare (encoding + 10, 5, "utf-8") != 0))
+		return "";
+	if (content.empty() || (content[0] != '<') || !validUtf8 (content)) return "";
+	return content;
+}
+
+// converts UTF-8 data to UTF-16, with a byte order mark when bom is true
+static string utf16 (const string& in, bool littleEndian, bool bom)
+{
+	string out;
+	unsigned short units[2];
+	if (bom) out += littleEndian ? "\xff\xfe" : "\xfe\xff";
+	for (size_t i = 0; i < in.size(); ) {
+		unsigned char c = in[i];
+		int n = (c < 0x80) ? 1 : (c < 0xe0) ? 2 : (c < 0xf0) ? 3 : 4;
+		unsigned cp = (n == 1) ? c : (n == 2) ? (c & 0x1f) : (n == 3) ? (c & 0x0f) : (c & 0x07);
+		for (int k = 1; k < n; k++) cp = (cp << 6) | (in[i+k] & 0x3f);
+		i += n;
+		int count = 1;
+		if (cp >= 0x10000) {
+			cp -= 0x10000;
+			units[0] = 0xd800 | (cp >> 10);
+			units[1] = 0xdc00 | (cp & 0x3ff);
+			count = 2;
+		}
+		else units[0] = cp;
+		for (int k = 0; k < count; k++) {
+			char lo = char(units[k] & 0xff), hi = char(units[k] >> 8);
+			out += littleEndian ? lo : hi;
+			out += littleEndian ? hi : lo;
+		}
+	}
+	return out;
+}
+
+//_______________________________________________________________________________
+// the UTF-8 files are converted to UTF-16 and read from memory: null terminated
+// buffers with a byte order mark and sized buffers, with or without byte order mark.
+// they must give the trees read from the UTF-8 data, and the same guido code
+// through the buffer conversion
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	int errors = 0, count = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		string content = utf8 (files[f]);
+		if (content.empty()) continue;
+		xmlreader r;
+		string expected = dump (r.readbuff (content.c_str()));
+		if (expected.empty()) continue;
+		count++;
+		for (int le = 0; le < 2; le++) {
+			string bom = utf16 (content, le, true);
+			string terminated = bom + string (2, '\0');
+			if (dump (r.readbuff (terminated.c_str())) != expected)
+				errors += failed ("parseencodings", files[f] + (le ? " UTF-16LE null terminated" : " UTF-16BE null terminated"));
+			if (dump (r.readbuff (bom.data(), bom.size())) != expected)
+				errors += failed ("parseencodings", files[f] + (le ? " UTF-16LE with size" : " UTF-16BE with size"));
+			ostringstream guido, utf16guido;
+			musicxmlstring2guido (content.c_str(), true, guido);
+			musicxmlbuffer2guido (bom.data(), bom.size(), true, utf16guido);
+			if (utf16guido.str() != guido.str())
+				errors += failed ("parseencodings", files[f] + (le ? " UTF-16LE musicxmlbuffer2guido" : " UTF-16BE musicxmlbuffer2guido"));
+			string nobom = utf16 (content, le, false);
+			if (dump (r.readbuff (nobom.data(), nobom.size())) != expected)
+				errors += failed ("parseencodings", files[f] + (le ? " UTF-16LE without BOM" : " UTF-16BE without BOM"));
+		}
+	}
+	if (!count) errors += failed ("parseencodings", "no UTF-8 file");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include "elements.h"
+#include "factory.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+static const int kThreads = 4;
+
+//_______________________________________________________________________________
+// the names, values and input line numbers of the elements of a tree
+static string dump (xmlelement* elt)
+{
+	ostringstream s;
+	vector<xmlelement*> stack (1, elt);
+	while (stack.size()) {
+		xmlelement* e = stack.back();
+		stack.pop_back();
+		s << e->getInputLineNumber() << " " << e->getName() << " " << e->getValue() << "\n";
+		for (ctree<xmlelement>::literator i = e->lbegin(); i != e->lend(); i++)
+			stack.push_back (*i);
+	}
+	return s.str();
+}
+
+// reads a file and dumps its tree, empty when the file can't be read
+static string parse (const string& file)
+{
+	xmlreader r;
+	SXMLFile xml = r.read (file.c_str());
+	return (xml && xml->elements()) ? dump (xml->elements()) : "";
+}
+
+// the elements created by the factory out of parsing must have no input line number
+static bool create ()
+{
+	const factory& f = factory::instance();
+	Sxmlelement byName = f.create ("note");
+	Sxmlelement byType = f.create (k_measure);
+	return byName && byType && !byName->getInputLineNumber() && !byType->getInputLineNumber();
+}
+
+//_______________________________________________________________________________
+// the files are read concurrently, while elements are created from the factory:
+// all the trees must be the ones read by a single thread, with the same line numbers
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	vector<string> expected;
+	for (size_t f = 0; f < files.size(); f++)
+		expected.push_back (parse (files[f]));
+
+	vector<int> bad (files.size(), 0);		// each file is read by a single thread
+	atomic<size_t> next (0);
+	atomic<int> created (0);
+	vector<thread> threads;
+	for (int t = 0; t < kThreads; t++)
+		threads.push_back (thread ([&] () {
+			for (size_t f = next++; f < files.size(); f = next++) {
+				if (!create()) created++;
+				if (parse (files[f]) != expected[f]) bad[f]++;
+			}
+		}));
+	for (size_t t = 0; t < threads.size(); t++)
+		threads[t].join();
+
+	int errors = 0;
+	for (size_t f = 0; f < files.size(); f++)
+		if (bad[f]) errors += failed ("parsethreads", files[f]);
+	if (created) errors += failed ("parsethreads", "factory::create");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <climits>
+#include <cmath>
+#include <string>
+
+#include "rational.h"
+#include "tests.h"
+
+using namespace std;
+
+//_______________________________________________________________________________
+// exact results must be exact, out of range results approximated
+static bool exact (rational r, long int num, long int denom)
+{
+	rational expected (num, denom);
+	r.rationalise();
+	expected.rationalise();
+	return (r.getNumerator() == expected.getNumerator()) && (r.getDenominator() == expected.getDenominator());
+}
+
+static bool approximated (const rational& r, double expected)
+{
+	return fabs (r.toDouble() - expected) <= fabs (expected) * 1e-12;
+}
+
+static int check (bool ok, const string& what)
+{
+	return ok ? 0 : failed ("rationalrange", what);
+}
+
+//_______________________________________________________________________________
+// the operations on the range limits, LONG_MIN numerators in particular,
+// which can't be negated
+int main (int argc, char* argv[])
+{
+	const double kMin = (double) LONG_MIN;
+	int errors = 0;
+
+	// same denominator
+	errors += check (exact (rational(LONG_MIN) - rational(LONG_MIN), 0, 1), "LONG_MIN - LONG_MIN");
+	errors += check (exact (rational(-1) - rational(LONG_MIN), LONG_MAX, 1), "-1 - LONG_MIN");
+	errors += check (exact (rational(LONG_MIN + 1) - rational(1), LONG_MIN, 1), "LONG_MIN + 1 - 1");
+	errors += check (approximated (rational(0) - rational(LONG_MIN), -kMin), "0 - LONG_MIN");
+	errors += check (approximated (rational(LONG_MIN) - rational(1), kMin), "LONG_MIN - 1");
+	errors += check (approximated (rational(LONG_MIN) + rational(-1), kMin), "LONG_MIN + -1");
+
+	// cross multiplied
+	errors += check (exact (rational(-1, 2) - rational(LONG_MIN, 4), LONG_MAX - 1, 4), "-1/2 - LONG_MIN/4");
+	errors += check (exact (rational(LONG_MIN, 2) - rational(LONG_MIN, 4), LONG_MIN / 4, 1), "LONG_MIN/2 - LONG_MIN/4");
+	errors += check (approximated (rational(1, 3) - rational(LONG_MIN, 2), 1.0 / 3 - kMin / 2), "1/3 - LONG_MIN/2");
+	errors += check (approximated (rational(LONG_MIN, 3) - rational(1, 2), kMin / 3 - 0.5), "LONG_MIN/3 - 1/2");
+	errors += check (approximated (rational(LONG_MIN, 3) + rational(LONG_MIN, 2), kMin / 3 + kMin / 2), "LONG_MIN/3 + LONG_MIN/2");
+	rational r (1, 5);
+	r -= rational (LONG_MIN, 7);
+	errors += check (approximated (r, 0.2 - kMin / 7), "1/5 -= LONG_MIN/7");
+
+	// products and comparisons
+	errors += check (approximated (rational(LONG_MIN) * rational(-1), -kMin), "LONG_MIN * -1");
+	errors += check (rational(LONG_MIN, -1) > rational(0, -1), "LONG_MIN/-1 > 0/-1");
+	errors += check (rational(LONG_MIN, 3) < rational(LONG_MAX, 3), "LONG_MIN/3 < LONG_MAX/3");
+	errors += check (rational(LONG_MIN, 3) < rational(1, 2), "LONG_MIN/3 < 1/2");
+	return errors ? 1 : 0;
+}
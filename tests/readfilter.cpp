@@ -0,0 +1,214 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <limits.h>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include "elements.h"
+#include "factory.h"
+#include "xml.h"
+#include "xml_tree_browser.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "xmlvisitor.h"
+#include "tests.h"
+
+using namespace std;
+using namespace MusicXML2;
+
+//_______________________________________________________________________________
+static Sxmlelement element (int type)
+{
+	return factory::instance().create (type);
+}
+
+static Sxmlattribute attribute (const string& name, const string& value)
+{
+	Sxmlattribute attr = xmlattribute::create();
+	attr->setName (name);
+	attr->setValue (value);
+	return attr;
+}
+
+static string print (const Sxmlelement& elt)
+{
+	ostringstream s;
+	xmlvisitor v(s);
+	xml_tree_browser browser(&v);
+	browser.browse (*elt);
+	return s.str();
+}
+
+// the measures of a part
+static vector<Sxmlelement> measures (const Sxmlelement& part)
+{
+	vector<Sxmlelement> out;
+	for (ctree<xmlelement>::literator i = part->lbegin(); i != part->lend(); i++)
+		if ((*i)->getType() == k_measure) out.push_back (*i);
+	return out;
+}
+
+//_______________________________________________________________________________
+// converts a partwise score to a timewise score sharing its elements,
+// the measures keep only their number, null when the parts don't have the same measures
+static Sxmlelement timewise (const Sxmlelement& score)
+{
+	Sxmlelement out = element (k_score_timewise);
+	vector<Sxmlelement> parts;
+	vector<vector<Sxmlelement> > partMeasures;
+	for (ctree<xmlelement>::literator i = score->lbegin(); i != score->lend(); i++) {
+		if ((*i)->getType() == k_part) {
+			parts.push_back (*i);
+			partMeasures.push_back (measures (*i));
+		}
+		else out->push (*i);
+	}
+	if (parts.empty()) return out;
+	const vector<Sxmlelement>& first = partMeasures[0];
+	for (size_t p = 1; p < parts.size(); p++) {
+		if (partMeasures[p].size() != first.size()) return 0;
+		for (size_t m = 0; m < first.size(); m++)
+			if (partMeasures[p][m]->getAttributeValue("number") != first[m]->getAttributeValue("number")) return 0;
+	}
+	for (size_t m = 0; m < first.size(); m++) {
+		Sxmlelement measure = element (k_measure);
+		measure->add (attribute ("number", first[m]->getAttributeValue("number")));
+		for (size_t p = 0; p < parts.size(); p++) {
+			Sxmlelement part = element (k_part);
+			part->add (attribute ("id", parts[p]->getAttributeValue("id")));
+			for (ctree<xmlelement>::literator i = partMeasures[p][m]->lbegin(); i != partMeasures[p][m]->lend(); i++)
+				part->push (*i);
+			measure->push (part);
+		}
+		out->push (measure);
+	}
+	return out;
+}
+
+//_______________________________________________________________________________
+// the measures of a timewise score read with a filter must be the same measures,
+// carrying the same attributes, as the ones of the partwise score read with this filter
+static bool check (const string& file, const string& buffer, int first, int last, const set<string>& parts)
+{
+	xmlreader r;
+	r.keepMeasures (first, last);
+	r.keepParts (parts);
+	SXMLFile partwise = r.read (file.c_str());
+	Sxmlelement expected = partwise ? timewise (partwise->elements()) : Sxmlelement(0);
+	SXMLFile read = r.readbuff (buffer.c_str());
+	if (!expected || !read) return !expected && !read;
+	return print (expected) == print (read->elements());
+}
+
+//_______________________________________________________________________________
+// the measure numbers of the parts of a partwise score, by part id
+static map<string, string> partsMeasures (const SXMLFile& file)
+{
+	map<string, string> out;
+	if (!file) return out;
+	for (ctree<xmlelement>::literator i = file->elements()->lbegin(); i != file->elements()->lend(); i++) {
+		if ((*i)->getType() != k_part) continue;
+		string numbers;
+		vector<Sxmlelement> m = measures (*i);
+		for (size_t n = 0; n < m.size(); n++)
+			numbers += (n ? " " : "") + m[n]->getAttributeValue("number");
+		out[(*i)->getAttributeValue("id")] = numbers;
+	}
+	return out;
+}
+
+// checks that the first element of the first measure of a part is an attributes element
+// with the given divisions and clef sign, and that the part has no other attributes
+static bool carried (const SXMLFile& file, const string& id, const string& divisions, const string& sign)
+{
+	for (ctree<xmlelement>::literator i = file->elements()->lbegin(); i != file->elements()->lend(); i++) {
+		if (((*i)->getType() != k_part) || ((*i)->getAttributeValue("id") != id)) continue;
+		vector<Sxmlelement> m = measures (*i);
+		if (m.empty() || m[0]->elements().empty()) return false;
+		Sxmlelement attributes = m[0]->elements()[0];
+		if ((attributes->getType() != k_attributes) || (attributes->getValue(k_divisions) != divisions)
+			|| (attributes->getValue(k_sign) != sign)) return false;
+		int count = 0;
+		for (size_t n = 0; n < m.size(); n++)
+			for (ctree<xmlelement>::literator e = m[n]->lbegin(); e != m[n]->lend(); e++)
+				if ((*e)->getType() == k_attributes) count++;
+		return count == 1;
+	}
+	return false;
+}
+
+//_______________________________________________________________________________
+// direct checks on a known file: DeckTheHall.xml has 2 parts with 16 measures,
+// P1 (2 divisions, G clef) and P2 (1 division, F clef), and attributes in the first measure only
+static int known (const string& folder)
+{
+	string file = folder + "/samples/musicxml/other/DeckTheHall.xml";
+	int errors = 0;
+	map<string, string> parts;
+
+	xmlreader r;
+	r.keepMeasures (5, 8);
+	SXMLFile read = r.read (file.c_str());
+	parts = partsMeasures (read);
+	if ((parts.size() != 2) || (parts["P1"] != "5 6 7 8") || (parts["P2"] != "5 6 7 8"))
+		errors += failed ("readfilter: measures 5 to 8", file);
+	else if (!carried (read, "P1", "2", "G") || !carried (read, "P2", "1", "F"))
+		errors += failed ("readfilter: attributes carried to measure 5", file);
+
+	r.keepParts (set<string>{ "P2" });
+	r.keepMeasures (INT_MIN, 2);
+	read = r.read (file.c_str());
+	parts = partsMeasures (read);
+	if ((parts.size() != 1) || (parts["P2"] != "1 2") || !carried (read, "P2", "1", "F"))
+		errors += failed ("readfilter: part P2, measures 1 to 2", file);
+
+	r.skipParts (set<string>{ "P2" });
+	r.keepMeasures (15, INT_MAX);
+	read = r.read (file.c_str());
+	parts = partsMeasures (read);
+	if ((parts.size() != 1) || (parts["P1"] != "15 16") || !carried (read, "P1", "2", "G"))
+		errors += failed ("readfilter: part P2 skipped, measures 15 to 16", file);
+	return errors;
+}
+
+//_______________________________________________________________________________
+// direct checks on a known file, then
+// the partwise files are converted to timewise scores, that are read with several filters
+int main (int argc, char* argv[])
+{
+	if (argc < 3) return usage (argv[0]);
+	vector<string> files = testFiles (argv[2]);
+	const int ranges[][2] = { {2, 3}, {5, INT_MAX}, {INT_MIN, 1} };
+	int errors = known (argv[1]), tested = 0;
+	for (size_t f = 0; f < files.size(); f++) {
+		xmlreader r;
+		SXMLFile file = r.read (files[f].c_str());
+		if (!file || (file->elements()->getType() != k_score_partwise)) continue;
+		Sxmlelement score = timewise (file->elements());
+		if (!score) continue;
+		string buffer = print (score);
+		tested++;
+
+		set<string> all, last;
+		for (ctree<xmlelement>::literator i = file->elements()->lbegin(); i != file->elements()->lend(); i++)
+			if ((*i)->getType() == k_part) last = set<string>{ (*i)->getAttributeValue("id") };
+		bool ok = true;
+		for (size_t n = 0; ok && (n < sizeof(ranges) / sizeof(ranges[0])); n++)
+			ok = check (files[f], buffer, ranges[n][0], ranges[n][1], all)
+				&& check (files[f], buffer, ranges[n][0], ranges[n][1], last);
+		if (!ok) errors += failed ("readfilter", files[f]);
+	}
+	if (!tested) errors += failed ("readfilter", "no timewise score built");
+	return errors ? 1 : 0;
+}
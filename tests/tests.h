@@ -0,0 +1,50 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2019
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __tests__
+#define __tests__
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+	The tests are run by ctest with 2 arguments:
+	the files folder and a list of the MusicXML files it contains, one per line.
+	They return 0 on success and print the failures to cerr.
+*/
+
+//_______________________________________________________________________________
+inline std::vector<std::string> testFiles (const char* list)
+{
+	std::vector<std::string> files;
+	std::ifstream in (list);
+	std::string line;
+	while (std::getline (in, line))
+		if (line.size()) files.push_back (line);
+	return files;
+}
+
+inline int failed (const std::string& test, const std::string& file)
+{
+	std::cerr << test << " failed: " << file << std::endl;
+	return 1;
+}
+
+inline int usage (const char* test)
+{
+	std::cerr << "usage: " << test << " files-folder files-list" << std::endl;
+	return 1;
+}
+
+#endif